@@ -340,6 +340,7 @@ LOCAL_SRC_FILES                                          := \
     src/posix/platform/uart.cpp                             \
     src/posix/platform/udp.cpp                              \
     third_party/mbedtls/repo/library/aes.c                  \
+    third_party/mbedtls/repo/library/aesni.c                \
     third_party/mbedtls/repo/library/asn1parse.c            \
     third_party/mbedtls/repo/library/asn1write.c            \
     third_party/mbedtls/repo/library/base64.c               \
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/print-ot-config"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/print-ot-config.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/cli/cli.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli.cpp.o.d"
+  "/root/repo/src/cli/cli_coap.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_coap.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_coap.cpp.o.d"
+  "/root/repo/src/cli/cli_coap_secure.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_coap_secure.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_coap_secure.cpp.o.d"
+  "/root/repo/src/cli/cli_commissioner.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_commissioner.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_commissioner.cpp.o.d"
+  "/root/repo/src/cli/cli_console.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_console.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_console.cpp.o.d"
+  "/root/repo/src/cli/cli_dataset.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_dataset.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_dataset.cpp.o.d"
+  "/root/repo/src/cli/cli_joiner.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_joiner.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_joiner.cpp.o.d"
+  "/root/repo/src/cli/cli_network_data.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_network_data.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_network_data.cpp.o.d"
+  "/root/repo/src/cli/cli_srp_client.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_srp_client.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_srp_client.cpp.o.d"
+  "/root/repo/src/cli/cli_srp_server.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_srp_server.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_srp_server.cpp.o.d"
+  "/root/repo/src/cli/cli_uart.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_uart.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_uart.cpp.o.d"
+  "/root/repo/src/cli/cli_udp.cpp" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_udp.cpp.o" "gcc" "src/cli/CMakeFiles/openthread-cli-ftd.dir/cli_udp.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_posix/src/core/CMakeFiles/openthread-ftd.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openthread-cli-mtd.dir/cli.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli.cpp.o.d"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_coap.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_coap.cpp.o.d"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_coap_secure.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_coap_secure.cpp.o.d"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_commissioner.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_commissioner.cpp.o.d"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_console.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_console.cpp.o.d"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_dataset.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_dataset.cpp.o.d"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_joiner.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_joiner.cpp.o.d"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_network_data.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_network_data.cpp.o.d"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_srp_client.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_srp_client.cpp.o.d"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_srp_server.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_srp_server.cpp.o.d"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_uart.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_uart.cpp.o.d"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_udp.cpp.o"
+  "CMakeFiles/openthread-cli-mtd.dir/cli_udp.cpp.o.d"
+  "libopenthread-cli-mtd.a"
+  "libopenthread-cli-mtd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openthread-cli-mtd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,192 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/api/backbone_router_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/backbone_router_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/backbone_router_api.cpp.o.d"
+  "/root/repo/src/core/api/backbone_router_ftd_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/backbone_router_ftd_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/backbone_router_ftd_api.cpp.o.d"
+  "/root/repo/src/core/api/border_router_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/border_router_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/border_router_api.cpp.o.d"
+  "/root/repo/src/core/api/channel_manager_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/channel_manager_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/channel_manager_api.cpp.o.d"
+  "/root/repo/src/core/api/channel_monitor_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/channel_monitor_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/channel_monitor_api.cpp.o.d"
+  "/root/repo/src/core/api/child_supervision_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/child_supervision_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/child_supervision_api.cpp.o.d"
+  "/root/repo/src/core/api/coap_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/coap_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/coap_api.cpp.o.d"
+  "/root/repo/src/core/api/coap_secure_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/coap_secure_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/coap_secure_api.cpp.o.d"
+  "/root/repo/src/core/api/commissioner_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/commissioner_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/commissioner_api.cpp.o.d"
+  "/root/repo/src/core/api/crypto_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/crypto_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/crypto_api.cpp.o.d"
+  "/root/repo/src/core/api/dataset_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/dataset_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/dataset_api.cpp.o.d"
+  "/root/repo/src/core/api/dataset_ftd_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/dataset_ftd_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/dataset_ftd_api.cpp.o.d"
+  "/root/repo/src/core/api/dataset_updater_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/dataset_updater_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/dataset_updater_api.cpp.o.d"
+  "/root/repo/src/core/api/diags_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/diags_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/diags_api.cpp.o.d"
+  "/root/repo/src/core/api/dns_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/dns_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/dns_api.cpp.o.d"
+  "/root/repo/src/core/api/entropy_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/entropy_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/entropy_api.cpp.o.d"
+  "/root/repo/src/core/api/heap_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/heap_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/heap_api.cpp.o.d"
+  "/root/repo/src/core/api/icmp6_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/icmp6_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/icmp6_api.cpp.o.d"
+  "/root/repo/src/core/api/instance_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/instance_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/instance_api.cpp.o.d"
+  "/root/repo/src/core/api/ip6_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/ip6_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/ip6_api.cpp.o.d"
+  "/root/repo/src/core/api/jam_detection_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/jam_detection_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/jam_detection_api.cpp.o.d"
+  "/root/repo/src/core/api/joiner_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/joiner_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/joiner_api.cpp.o.d"
+  "/root/repo/src/core/api/link_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/link_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/link_api.cpp.o.d"
+  "/root/repo/src/core/api/link_metrics_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/link_metrics_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/link_metrics_api.cpp.o.d"
+  "/root/repo/src/core/api/link_raw_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/link_raw_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/link_raw_api.cpp.o.d"
+  "/root/repo/src/core/api/logging_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/logging_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/logging_api.cpp.o.d"
+  "/root/repo/src/core/api/message_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/message_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/message_api.cpp.o.d"
+  "/root/repo/src/core/api/multi_radio_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/multi_radio_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/multi_radio_api.cpp.o.d"
+  "/root/repo/src/core/api/netdata_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/netdata_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/netdata_api.cpp.o.d"
+  "/root/repo/src/core/api/netdiag_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/netdiag_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/netdiag_api.cpp.o.d"
+  "/root/repo/src/core/api/network_time_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/network_time_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/network_time_api.cpp.o.d"
+  "/root/repo/src/core/api/random_crypto_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/random_crypto_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/random_crypto_api.cpp.o.d"
+  "/root/repo/src/core/api/random_noncrypto_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/random_noncrypto_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/random_noncrypto_api.cpp.o.d"
+  "/root/repo/src/core/api/server_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/server_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/server_api.cpp.o.d"
+  "/root/repo/src/core/api/sntp_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/sntp_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/sntp_api.cpp.o.d"
+  "/root/repo/src/core/api/srp_client_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/srp_client_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/srp_client_api.cpp.o.d"
+  "/root/repo/src/core/api/srp_server_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/srp_server_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/srp_server_api.cpp.o.d"
+  "/root/repo/src/core/api/tasklet_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/tasklet_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/tasklet_api.cpp.o.d"
+  "/root/repo/src/core/api/thread_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/thread_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/thread_api.cpp.o.d"
+  "/root/repo/src/core/api/thread_ftd_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/thread_ftd_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/thread_ftd_api.cpp.o.d"
+  "/root/repo/src/core/api/udp_api.cpp" "src/core/CMakeFiles/openthread-ftd.dir/api/udp_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/api/udp_api.cpp.o.d"
+  "/root/repo/src/core/backbone_router/backbone_tmf.cpp" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/backbone_tmf.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/backbone_tmf.cpp.o.d"
+  "/root/repo/src/core/backbone_router/bbr_leader.cpp" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/bbr_leader.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/bbr_leader.cpp.o.d"
+  "/root/repo/src/core/backbone_router/bbr_local.cpp" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/bbr_local.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/bbr_local.cpp.o.d"
+  "/root/repo/src/core/backbone_router/bbr_manager.cpp" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/bbr_manager.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/bbr_manager.cpp.o.d"
+  "/root/repo/src/core/backbone_router/multicast_listeners_table.cpp" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/multicast_listeners_table.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/multicast_listeners_table.cpp.o.d"
+  "/root/repo/src/core/backbone_router/ndproxy_table.cpp" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/ndproxy_table.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/backbone_router/ndproxy_table.cpp.o.d"
+  "/root/repo/src/core/border_router/infra_if_platform.cpp" "src/core/CMakeFiles/openthread-ftd.dir/border_router/infra_if_platform.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/border_router/infra_if_platform.cpp.o.d"
+  "/root/repo/src/core/border_router/router_advertisement.cpp" "src/core/CMakeFiles/openthread-ftd.dir/border_router/router_advertisement.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/border_router/router_advertisement.cpp.o.d"
+  "/root/repo/src/core/border_router/routing_manager.cpp" "src/core/CMakeFiles/openthread-ftd.dir/border_router/routing_manager.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/border_router/routing_manager.cpp.o.d"
+  "/root/repo/src/core/coap/coap.cpp" "src/core/CMakeFiles/openthread-ftd.dir/coap/coap.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/coap/coap.cpp.o.d"
+  "/root/repo/src/core/coap/coap_message.cpp" "src/core/CMakeFiles/openthread-ftd.dir/coap/coap_message.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/coap/coap_message.cpp.o.d"
+  "/root/repo/src/core/coap/coap_secure.cpp" "src/core/CMakeFiles/openthread-ftd.dir/coap/coap_secure.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/coap/coap_secure.cpp.o.d"
+  "/root/repo/src/core/common/crc16.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/crc16.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/crc16.cpp.o.d"
+  "/root/repo/src/core/common/instance.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/instance.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/instance.cpp.o.d"
+  "/root/repo/src/core/common/logging.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/logging.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/logging.cpp.o.d"
+  "/root/repo/src/core/common/message.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/message.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/message.cpp.o.d"
+  "/root/repo/src/core/common/notifier.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/notifier.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/notifier.cpp.o.d"
+  "/root/repo/src/core/common/random_manager.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/random_manager.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/random_manager.cpp.o.d"
+  "/root/repo/src/core/common/settings.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/settings.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/settings.cpp.o.d"
+  "/root/repo/src/core/common/string.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/string.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/string.cpp.o.d"
+  "/root/repo/src/core/common/tasklet.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/tasklet.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/tasklet.cpp.o.d"
+  "/root/repo/src/core/common/time_ticker.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/time_ticker.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/time_ticker.cpp.o.d"
+  "/root/repo/src/core/common/timer.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/timer.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/timer.cpp.o.d"
+  "/root/repo/src/core/common/tlvs.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/tlvs.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/tlvs.cpp.o.d"
+  "/root/repo/src/core/common/trickle_timer.cpp" "src/core/CMakeFiles/openthread-ftd.dir/common/trickle_timer.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/common/trickle_timer.cpp.o.d"
+  "/root/repo/src/core/crypto/aes_ccm.cpp" "src/core/CMakeFiles/openthread-ftd.dir/crypto/aes_ccm.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/crypto/aes_ccm.cpp.o.d"
+  "/root/repo/src/core/crypto/aes_ecb.cpp" "src/core/CMakeFiles/openthread-ftd.dir/crypto/aes_ecb.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/crypto/aes_ecb.cpp.o.d"
+  "/root/repo/src/core/crypto/ecdsa.cpp" "src/core/CMakeFiles/openthread-ftd.dir/crypto/ecdsa.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/crypto/ecdsa.cpp.o.d"
+  "/root/repo/src/core/crypto/hkdf_sha256.cpp" "src/core/CMakeFiles/openthread-ftd.dir/crypto/hkdf_sha256.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/crypto/hkdf_sha256.cpp.o.d"
+  "/root/repo/src/core/crypto/hmac_sha256.cpp" "src/core/CMakeFiles/openthread-ftd.dir/crypto/hmac_sha256.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/crypto/hmac_sha256.cpp.o.d"
+  "/root/repo/src/core/crypto/mbedtls.cpp" "src/core/CMakeFiles/openthread-ftd.dir/crypto/mbedtls.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/crypto/mbedtls.cpp.o.d"
+  "/root/repo/src/core/crypto/pbkdf2_cmac.cpp" "src/core/CMakeFiles/openthread-ftd.dir/crypto/pbkdf2_cmac.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/crypto/pbkdf2_cmac.cpp.o.d"
+  "/root/repo/src/core/crypto/sha256.cpp" "src/core/CMakeFiles/openthread-ftd.dir/crypto/sha256.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/crypto/sha256.cpp.o.d"
+  "/root/repo/src/core/diags/factory_diags.cpp" "src/core/CMakeFiles/openthread-ftd.dir/diags/factory_diags.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/diags/factory_diags.cpp.o.d"
+  "/root/repo/src/core/mac/channel_mask.cpp" "src/core/CMakeFiles/openthread-ftd.dir/mac/channel_mask.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/mac/channel_mask.cpp.o.d"
+  "/root/repo/src/core/mac/data_poll_handler.cpp" "src/core/CMakeFiles/openthread-ftd.dir/mac/data_poll_handler.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/mac/data_poll_handler.cpp.o.d"
+  "/root/repo/src/core/mac/data_poll_sender.cpp" "src/core/CMakeFiles/openthread-ftd.dir/mac/data_poll_sender.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/mac/data_poll_sender.cpp.o.d"
+  "/root/repo/src/core/mac/link_raw.cpp" "src/core/CMakeFiles/openthread-ftd.dir/mac/link_raw.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/mac/link_raw.cpp.o.d"
+  "/root/repo/src/core/mac/mac.cpp" "src/core/CMakeFiles/openthread-ftd.dir/mac/mac.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/mac/mac.cpp.o.d"
+  "/root/repo/src/core/mac/mac_filter.cpp" "src/core/CMakeFiles/openthread-ftd.dir/mac/mac_filter.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/mac/mac_filter.cpp.o.d"
+  "/root/repo/src/core/mac/mac_frame.cpp" "src/core/CMakeFiles/openthread-ftd.dir/mac/mac_frame.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/mac/mac_frame.cpp.o.d"
+  "/root/repo/src/core/mac/mac_links.cpp" "src/core/CMakeFiles/openthread-ftd.dir/mac/mac_links.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/mac/mac_links.cpp.o.d"
+  "/root/repo/src/core/mac/mac_types.cpp" "src/core/CMakeFiles/openthread-ftd.dir/mac/mac_types.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/mac/mac_types.cpp.o.d"
+  "/root/repo/src/core/mac/sub_mac.cpp" "src/core/CMakeFiles/openthread-ftd.dir/mac/sub_mac.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/mac/sub_mac.cpp.o.d"
+  "/root/repo/src/core/mac/sub_mac_callbacks.cpp" "src/core/CMakeFiles/openthread-ftd.dir/mac/sub_mac_callbacks.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/mac/sub_mac_callbacks.cpp.o.d"
+  "/root/repo/src/core/meshcop/announce_begin_client.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/announce_begin_client.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/announce_begin_client.cpp.o.d"
+  "/root/repo/src/core/meshcop/border_agent.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/border_agent.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/border_agent.cpp.o.d"
+  "/root/repo/src/core/meshcop/commissioner.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/commissioner.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/commissioner.cpp.o.d"
+  "/root/repo/src/core/meshcop/dataset.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/dataset.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/dataset.cpp.o.d"
+  "/root/repo/src/core/meshcop/dataset_local.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/dataset_local.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/dataset_local.cpp.o.d"
+  "/root/repo/src/core/meshcop/dataset_manager.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/dataset_manager.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/dataset_manager.cpp.o.d"
+  "/root/repo/src/core/meshcop/dataset_manager_ftd.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/dataset_manager_ftd.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/dataset_manager_ftd.cpp.o.d"
+  "/root/repo/src/core/meshcop/dtls.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/dtls.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/dtls.cpp.o.d"
+  "/root/repo/src/core/meshcop/energy_scan_client.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/energy_scan_client.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/energy_scan_client.cpp.o.d"
+  "/root/repo/src/core/meshcop/joiner.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/joiner.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/joiner.cpp.o.d"
+  "/root/repo/src/core/meshcop/joiner_router.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/joiner_router.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/joiner_router.cpp.o.d"
+  "/root/repo/src/core/meshcop/meshcop.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/meshcop.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/meshcop.cpp.o.d"
+  "/root/repo/src/core/meshcop/meshcop_leader.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/meshcop_leader.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/meshcop_leader.cpp.o.d"
+  "/root/repo/src/core/meshcop/meshcop_tlvs.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/meshcop_tlvs.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/meshcop_tlvs.cpp.o.d"
+  "/root/repo/src/core/meshcop/panid_query_client.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/panid_query_client.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/panid_query_client.cpp.o.d"
+  "/root/repo/src/core/meshcop/timestamp.cpp" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/timestamp.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/meshcop/timestamp.cpp.o.d"
+  "/root/repo/src/core/net/checksum.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/checksum.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/checksum.cpp.o.d"
+  "/root/repo/src/core/net/dhcp6_client.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/dhcp6_client.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/dhcp6_client.cpp.o.d"
+  "/root/repo/src/core/net/dhcp6_server.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/dhcp6_server.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/dhcp6_server.cpp.o.d"
+  "/root/repo/src/core/net/dns_client.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/dns_client.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/dns_client.cpp.o.d"
+  "/root/repo/src/core/net/dns_headers.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/dns_headers.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/dns_headers.cpp.o.d"
+  "/root/repo/src/core/net/icmp6.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/icmp6.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/icmp6.cpp.o.d"
+  "/root/repo/src/core/net/ip6.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/ip6.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/ip6.cpp.o.d"
+  "/root/repo/src/core/net/ip6_address.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/ip6_address.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/ip6_address.cpp.o.d"
+  "/root/repo/src/core/net/ip6_filter.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/ip6_filter.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/ip6_filter.cpp.o.d"
+  "/root/repo/src/core/net/ip6_headers.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/ip6_headers.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/ip6_headers.cpp.o.d"
+  "/root/repo/src/core/net/ip6_mpl.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/ip6_mpl.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/ip6_mpl.cpp.o.d"
+  "/root/repo/src/core/net/netif.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/netif.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/netif.cpp.o.d"
+  "/root/repo/src/core/net/sntp_client.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/sntp_client.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/sntp_client.cpp.o.d"
+  "/root/repo/src/core/net/srp_client.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/srp_client.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/srp_client.cpp.o.d"
+  "/root/repo/src/core/net/srp_server.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/srp_server.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/srp_server.cpp.o.d"
+  "/root/repo/src/core/net/udp6.cpp" "src/core/CMakeFiles/openthread-ftd.dir/net/udp6.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/net/udp6.cpp.o.d"
+  "/root/repo/src/core/radio/radio.cpp" "src/core/CMakeFiles/openthread-ftd.dir/radio/radio.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/radio/radio.cpp.o.d"
+  "/root/repo/src/core/radio/radio_callbacks.cpp" "src/core/CMakeFiles/openthread-ftd.dir/radio/radio_callbacks.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/radio/radio_callbacks.cpp.o.d"
+  "/root/repo/src/core/radio/radio_platform.cpp" "src/core/CMakeFiles/openthread-ftd.dir/radio/radio_platform.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/radio/radio_platform.cpp.o.d"
+  "/root/repo/src/core/radio/trel_interface.cpp" "src/core/CMakeFiles/openthread-ftd.dir/radio/trel_interface.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/radio/trel_interface.cpp.o.d"
+  "/root/repo/src/core/radio/trel_link.cpp" "src/core/CMakeFiles/openthread-ftd.dir/radio/trel_link.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/radio/trel_link.cpp.o.d"
+  "/root/repo/src/core/radio/trel_packet.cpp" "src/core/CMakeFiles/openthread-ftd.dir/radio/trel_packet.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/radio/trel_packet.cpp.o.d"
+  "/root/repo/src/core/thread/address_resolver.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/address_resolver.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/address_resolver.cpp.o.d"
+  "/root/repo/src/core/thread/announce_begin_server.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/announce_begin_server.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/announce_begin_server.cpp.o.d"
+  "/root/repo/src/core/thread/announce_sender.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/announce_sender.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/announce_sender.cpp.o.d"
+  "/root/repo/src/core/thread/child_table.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/child_table.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/child_table.cpp.o.d"
+  "/root/repo/src/core/thread/csl_tx_scheduler.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/csl_tx_scheduler.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/csl_tx_scheduler.cpp.o.d"
+  "/root/repo/src/core/thread/discover_scanner.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/discover_scanner.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/discover_scanner.cpp.o.d"
+  "/root/repo/src/core/thread/dua_manager.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/dua_manager.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/dua_manager.cpp.o.d"
+  "/root/repo/src/core/thread/energy_scan_server.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/energy_scan_server.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/energy_scan_server.cpp.o.d"
+  "/root/repo/src/core/thread/indirect_sender.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/indirect_sender.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/indirect_sender.cpp.o.d"
+  "/root/repo/src/core/thread/key_manager.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/key_manager.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/key_manager.cpp.o.d"
+  "/root/repo/src/core/thread/link_metrics.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/link_metrics.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/link_metrics.cpp.o.d"
+  "/root/repo/src/core/thread/link_quality.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/link_quality.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/link_quality.cpp.o.d"
+  "/root/repo/src/core/thread/lowpan.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/lowpan.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/lowpan.cpp.o.d"
+  "/root/repo/src/core/thread/mesh_forwarder.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/mesh_forwarder.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/mesh_forwarder.cpp.o.d"
+  "/root/repo/src/core/thread/mesh_forwarder_ftd.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/mesh_forwarder_ftd.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/mesh_forwarder_ftd.cpp.o.d"
+  "/root/repo/src/core/thread/mesh_forwarder_mtd.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/mesh_forwarder_mtd.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/mesh_forwarder_mtd.cpp.o.d"
+  "/root/repo/src/core/thread/mle.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/mle.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/mle.cpp.o.d"
+  "/root/repo/src/core/thread/mle_router.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/mle_router.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/mle_router.cpp.o.d"
+  "/root/repo/src/core/thread/mle_types.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/mle_types.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/mle_types.cpp.o.d"
+  "/root/repo/src/core/thread/mlr_manager.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/mlr_manager.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/mlr_manager.cpp.o.d"
+  "/root/repo/src/core/thread/neighbor_table.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/neighbor_table.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/neighbor_table.cpp.o.d"
+  "/root/repo/src/core/thread/network_data.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_data.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_data.cpp.o.d"
+  "/root/repo/src/core/thread/network_data_leader.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_data_leader.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_data_leader.cpp.o.d"
+  "/root/repo/src/core/thread/network_data_leader_ftd.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_data_leader_ftd.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_data_leader_ftd.cpp.o.d"
+  "/root/repo/src/core/thread/network_data_local.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_data_local.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_data_local.cpp.o.d"
+  "/root/repo/src/core/thread/network_data_notifier.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_data_notifier.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_data_notifier.cpp.o.d"
+  "/root/repo/src/core/thread/network_diagnostic.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_diagnostic.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/network_diagnostic.cpp.o.d"
+  "/root/repo/src/core/thread/panid_query_server.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/panid_query_server.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/panid_query_server.cpp.o.d"
+  "/root/repo/src/core/thread/radio_selector.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/radio_selector.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/radio_selector.cpp.o.d"
+  "/root/repo/src/core/thread/router_table.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/router_table.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/router_table.cpp.o.d"
+  "/root/repo/src/core/thread/src_match_controller.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/src_match_controller.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/src_match_controller.cpp.o.d"
+  "/root/repo/src/core/thread/thread_netif.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/thread_netif.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/thread_netif.cpp.o.d"
+  "/root/repo/src/core/thread/time_sync_service.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/time_sync_service.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/time_sync_service.cpp.o.d"
+  "/root/repo/src/core/thread/tmf.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/tmf.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/tmf.cpp.o.d"
+  "/root/repo/src/core/thread/topology.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/topology.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/topology.cpp.o.d"
+  "/root/repo/src/core/thread/uri_paths.cpp" "src/core/CMakeFiles/openthread-ftd.dir/thread/uri_paths.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/thread/uri_paths.cpp.o.d"
+  "/root/repo/src/core/utils/channel_manager.cpp" "src/core/CMakeFiles/openthread-ftd.dir/utils/channel_manager.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/utils/channel_manager.cpp.o.d"
+  "/root/repo/src/core/utils/channel_monitor.cpp" "src/core/CMakeFiles/openthread-ftd.dir/utils/channel_monitor.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/utils/channel_monitor.cpp.o.d"
+  "/root/repo/src/core/utils/child_supervision.cpp" "src/core/CMakeFiles/openthread-ftd.dir/utils/child_supervision.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/utils/child_supervision.cpp.o.d"
+  "/root/repo/src/core/utils/dataset_updater.cpp" "src/core/CMakeFiles/openthread-ftd.dir/utils/dataset_updater.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/utils/dataset_updater.cpp.o.d"
+  "/root/repo/src/core/utils/flash.cpp" "src/core/CMakeFiles/openthread-ftd.dir/utils/flash.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/utils/flash.cpp.o.d"
+  "/root/repo/src/core/utils/heap.cpp" "src/core/CMakeFiles/openthread-ftd.dir/utils/heap.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/utils/heap.cpp.o.d"
+  "/root/repo/src/core/utils/jam_detector.cpp" "src/core/CMakeFiles/openthread-ftd.dir/utils/jam_detector.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/utils/jam_detector.cpp.o.d"
+  "/root/repo/src/core/utils/lookup_table.cpp" "src/core/CMakeFiles/openthread-ftd.dir/utils/lookup_table.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/utils/lookup_table.cpp.o.d"
+  "/root/repo/src/core/utils/otns.cpp" "src/core/CMakeFiles/openthread-ftd.dir/utils/otns.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/utils/otns.cpp.o.d"
+  "/root/repo/src/core/utils/parse_cmdline.cpp" "src/core/CMakeFiles/openthread-ftd.dir/utils/parse_cmdline.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/utils/parse_cmdline.cpp.o.d"
+  "/root/repo/src/core/utils/slaac_address.cpp" "src/core/CMakeFiles/openthread-ftd.dir/utils/slaac_address.cpp.o" "gcc" "src/core/CMakeFiles/openthread-ftd.dir/utils/slaac_address.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,351 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openthread-mtd.dir/api/backbone_router_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/backbone_router_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/backbone_router_ftd_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/backbone_router_ftd_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/border_router_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/border_router_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/channel_manager_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/channel_manager_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/channel_monitor_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/channel_monitor_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/child_supervision_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/child_supervision_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/coap_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/coap_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/coap_secure_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/coap_secure_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/commissioner_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/commissioner_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/crypto_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/crypto_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/dataset_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/dataset_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/dataset_ftd_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/dataset_ftd_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/dataset_updater_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/dataset_updater_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/diags_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/diags_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/dns_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/dns_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/entropy_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/entropy_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/heap_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/heap_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/icmp6_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/icmp6_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/instance_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/instance_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/ip6_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/ip6_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/jam_detection_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/jam_detection_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/joiner_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/joiner_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/link_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/link_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/link_metrics_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/link_metrics_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/link_raw_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/link_raw_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/logging_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/logging_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/message_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/message_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/multi_radio_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/multi_radio_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/netdata_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/netdata_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/netdiag_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/netdiag_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/network_time_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/network_time_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/random_crypto_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/random_crypto_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/random_noncrypto_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/random_noncrypto_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/server_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/server_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/sntp_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/sntp_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/srp_client_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/srp_client_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/srp_server_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/srp_server_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/tasklet_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/tasklet_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/thread_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/thread_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/thread_ftd_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/thread_ftd_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/api/udp_api.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/api/udp_api.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/backbone_tmf.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/backbone_tmf.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/bbr_leader.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/bbr_leader.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/bbr_local.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/bbr_local.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/bbr_manager.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/bbr_manager.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/multicast_listeners_table.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/multicast_listeners_table.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/ndproxy_table.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/backbone_router/ndproxy_table.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/border_router/infra_if_platform.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/border_router/infra_if_platform.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/border_router/router_advertisement.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/border_router/router_advertisement.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/border_router/routing_manager.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/border_router/routing_manager.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/coap/coap.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/coap/coap.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/coap/coap_message.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/coap/coap_message.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/coap/coap_secure.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/coap/coap_secure.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/crc16.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/crc16.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/instance.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/instance.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/logging.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/logging.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/message.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/message.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/notifier.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/notifier.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/random_manager.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/random_manager.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/settings.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/settings.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/string.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/string.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/tasklet.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/tasklet.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/time_ticker.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/time_ticker.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/timer.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/timer.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/tlvs.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/tlvs.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/common/trickle_timer.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/common/trickle_timer.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/crypto/aes_ccm.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/crypto/aes_ccm.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/crypto/aes_ecb.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/crypto/aes_ecb.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/crypto/ecdsa.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/crypto/ecdsa.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/crypto/hkdf_sha256.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/crypto/hkdf_sha256.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/crypto/hmac_sha256.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/crypto/hmac_sha256.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/crypto/mbedtls.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/crypto/mbedtls.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/crypto/pbkdf2_cmac.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/crypto/pbkdf2_cmac.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/crypto/sha256.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/crypto/sha256.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/diags/factory_diags.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/diags/factory_diags.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/mac/channel_mask.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/mac/channel_mask.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/mac/data_poll_handler.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/mac/data_poll_handler.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/mac/data_poll_sender.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/mac/data_poll_sender.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/mac/link_raw.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/mac/link_raw.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/mac/mac.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/mac/mac.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/mac/mac_filter.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/mac/mac_filter.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/mac/mac_frame.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/mac/mac_frame.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/mac/mac_links.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/mac/mac_links.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/mac/mac_types.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/mac/mac_types.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/mac/sub_mac.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/mac/sub_mac.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/mac/sub_mac_callbacks.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/mac/sub_mac_callbacks.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/announce_begin_client.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/announce_begin_client.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/border_agent.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/border_agent.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/commissioner.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/commissioner.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/dataset.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/dataset.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/dataset_local.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/dataset_local.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/dataset_manager.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/dataset_manager.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/dataset_manager_ftd.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/dataset_manager_ftd.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/dtls.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/dtls.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/energy_scan_client.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/energy_scan_client.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/joiner.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/joiner.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/joiner_router.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/joiner_router.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/meshcop.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/meshcop.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/meshcop_leader.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/meshcop_leader.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/meshcop_tlvs.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/meshcop_tlvs.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/panid_query_client.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/panid_query_client.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/meshcop/timestamp.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/meshcop/timestamp.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/checksum.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/checksum.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/dhcp6_client.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/dhcp6_client.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/dhcp6_server.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/dhcp6_server.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/dns_client.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/dns_client.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/dns_headers.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/dns_headers.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/icmp6.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/icmp6.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/ip6.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/ip6.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/ip6_address.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/ip6_address.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/ip6_filter.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/ip6_filter.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/ip6_headers.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/ip6_headers.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/ip6_mpl.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/ip6_mpl.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/netif.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/netif.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/sntp_client.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/sntp_client.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/srp_client.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/srp_client.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/srp_server.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/srp_server.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/net/udp6.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/net/udp6.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/radio/radio.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/radio/radio.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/radio/radio_callbacks.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/radio/radio_callbacks.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/radio/radio_platform.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/radio/radio_platform.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/radio/trel_interface.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/radio/trel_interface.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/radio/trel_link.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/radio/trel_link.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/radio/trel_packet.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/radio/trel_packet.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/address_resolver.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/address_resolver.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/announce_begin_server.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/announce_begin_server.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/announce_sender.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/announce_sender.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/child_table.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/child_table.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/csl_tx_scheduler.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/csl_tx_scheduler.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/discover_scanner.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/discover_scanner.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/dua_manager.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/dua_manager.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/energy_scan_server.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/energy_scan_server.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/indirect_sender.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/indirect_sender.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/key_manager.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/key_manager.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/link_metrics.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/link_metrics.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/link_quality.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/link_quality.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/lowpan.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/lowpan.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/mesh_forwarder.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/mesh_forwarder.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/mesh_forwarder_ftd.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/mesh_forwarder_ftd.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/mesh_forwarder_mtd.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/mesh_forwarder_mtd.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/mle.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/mle.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/mle_router.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/mle_router.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/mle_types.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/mle_types.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/mlr_manager.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/mlr_manager.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/neighbor_table.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/neighbor_table.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/network_data.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/network_data.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/network_data_leader.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/network_data_leader.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/network_data_leader_ftd.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/network_data_leader_ftd.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/network_data_local.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/network_data_local.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/network_data_notifier.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/network_data_notifier.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/network_diagnostic.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/network_diagnostic.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/panid_query_server.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/panid_query_server.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/radio_selector.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/radio_selector.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/router_table.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/router_table.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/src_match_controller.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/src_match_controller.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/thread_netif.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/thread_netif.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/time_sync_service.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/time_sync_service.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/tmf.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/tmf.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/topology.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/topology.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/thread/uri_paths.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/thread/uri_paths.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/utils/channel_manager.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/utils/channel_manager.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/utils/channel_monitor.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/utils/channel_monitor.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/utils/child_supervision.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/utils/child_supervision.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/utils/dataset_updater.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/utils/dataset_updater.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/utils/flash.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/utils/flash.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/utils/heap.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/utils/heap.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/utils/jam_detector.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/utils/jam_detector.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/utils/lookup_table.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/utils/lookup_table.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/utils/otns.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/utils/otns.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/utils/parse_cmdline.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/utils/parse_cmdline.cpp.o.d"
+  "CMakeFiles/openthread-mtd.dir/utils/slaac_address.cpp.o"
+  "CMakeFiles/openthread-mtd.dir/utils/slaac_address.cpp.o.d"
+  "libopenthread-mtd.a"
+  "libopenthread-mtd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openthread-mtd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
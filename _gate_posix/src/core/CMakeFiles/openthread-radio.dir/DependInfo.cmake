@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/api/diags_api.cpp" "src/core/CMakeFiles/openthread-radio.dir/api/diags_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/api/diags_api.cpp.o.d"
+  "/root/repo/src/core/api/instance_api.cpp" "src/core/CMakeFiles/openthread-radio.dir/api/instance_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/api/instance_api.cpp.o.d"
+  "/root/repo/src/core/api/link_raw_api.cpp" "src/core/CMakeFiles/openthread-radio.dir/api/link_raw_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/api/link_raw_api.cpp.o.d"
+  "/root/repo/src/core/api/logging_api.cpp" "src/core/CMakeFiles/openthread-radio.dir/api/logging_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/api/logging_api.cpp.o.d"
+  "/root/repo/src/core/api/random_noncrypto_api.cpp" "src/core/CMakeFiles/openthread-radio.dir/api/random_noncrypto_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/api/random_noncrypto_api.cpp.o.d"
+  "/root/repo/src/core/api/tasklet_api.cpp" "src/core/CMakeFiles/openthread-radio.dir/api/tasklet_api.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/api/tasklet_api.cpp.o.d"
+  "/root/repo/src/core/common/instance.cpp" "src/core/CMakeFiles/openthread-radio.dir/common/instance.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/common/instance.cpp.o.d"
+  "/root/repo/src/core/common/logging.cpp" "src/core/CMakeFiles/openthread-radio.dir/common/logging.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/common/logging.cpp.o.d"
+  "/root/repo/src/core/common/random_manager.cpp" "src/core/CMakeFiles/openthread-radio.dir/common/random_manager.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/common/random_manager.cpp.o.d"
+  "/root/repo/src/core/common/string.cpp" "src/core/CMakeFiles/openthread-radio.dir/common/string.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/common/string.cpp.o.d"
+  "/root/repo/src/core/common/tasklet.cpp" "src/core/CMakeFiles/openthread-radio.dir/common/tasklet.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/common/tasklet.cpp.o.d"
+  "/root/repo/src/core/common/timer.cpp" "src/core/CMakeFiles/openthread-radio.dir/common/timer.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/common/timer.cpp.o.d"
+  "/root/repo/src/core/crypto/aes_ccm.cpp" "src/core/CMakeFiles/openthread-radio.dir/crypto/aes_ccm.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/crypto/aes_ccm.cpp.o.d"
+  "/root/repo/src/core/crypto/aes_ecb.cpp" "src/core/CMakeFiles/openthread-radio.dir/crypto/aes_ecb.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/crypto/aes_ecb.cpp.o.d"
+  "/root/repo/src/core/diags/factory_diags.cpp" "src/core/CMakeFiles/openthread-radio.dir/diags/factory_diags.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/diags/factory_diags.cpp.o.d"
+  "/root/repo/src/core/mac/link_raw.cpp" "src/core/CMakeFiles/openthread-radio.dir/mac/link_raw.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/mac/link_raw.cpp.o.d"
+  "/root/repo/src/core/mac/mac_frame.cpp" "src/core/CMakeFiles/openthread-radio.dir/mac/mac_frame.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/mac/mac_frame.cpp.o.d"
+  "/root/repo/src/core/mac/mac_types.cpp" "src/core/CMakeFiles/openthread-radio.dir/mac/mac_types.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/mac/mac_types.cpp.o.d"
+  "/root/repo/src/core/mac/sub_mac.cpp" "src/core/CMakeFiles/openthread-radio.dir/mac/sub_mac.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/mac/sub_mac.cpp.o.d"
+  "/root/repo/src/core/mac/sub_mac_callbacks.cpp" "src/core/CMakeFiles/openthread-radio.dir/mac/sub_mac_callbacks.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/mac/sub_mac_callbacks.cpp.o.d"
+  "/root/repo/src/core/radio/radio.cpp" "src/core/CMakeFiles/openthread-radio.dir/radio/radio.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/radio/radio.cpp.o.d"
+  "/root/repo/src/core/radio/radio_callbacks.cpp" "src/core/CMakeFiles/openthread-radio.dir/radio/radio_callbacks.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/radio/radio_callbacks.cpp.o.d"
+  "/root/repo/src/core/radio/radio_platform.cpp" "src/core/CMakeFiles/openthread-radio.dir/radio/radio_platform.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/radio/radio_platform.cpp.o.d"
+  "/root/repo/src/core/thread/link_quality.cpp" "src/core/CMakeFiles/openthread-radio.dir/thread/link_quality.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/thread/link_quality.cpp.o.d"
+  "/root/repo/src/core/utils/lookup_table.cpp" "src/core/CMakeFiles/openthread-radio.dir/utils/lookup_table.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/utils/lookup_table.cpp.o.d"
+  "/root/repo/src/core/utils/parse_cmdline.cpp" "src/core/CMakeFiles/openthread-radio.dir/utils/parse_cmdline.cpp.o" "gcc" "src/core/CMakeFiles/openthread-radio.dir/utils/parse_cmdline.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
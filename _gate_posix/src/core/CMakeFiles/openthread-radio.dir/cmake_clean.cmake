@@ -0,0 +1,61 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openthread-radio.dir/api/diags_api.cpp.o"
+  "CMakeFiles/openthread-radio.dir/api/diags_api.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/api/instance_api.cpp.o"
+  "CMakeFiles/openthread-radio.dir/api/instance_api.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/api/link_raw_api.cpp.o"
+  "CMakeFiles/openthread-radio.dir/api/link_raw_api.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/api/logging_api.cpp.o"
+  "CMakeFiles/openthread-radio.dir/api/logging_api.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/api/random_noncrypto_api.cpp.o"
+  "CMakeFiles/openthread-radio.dir/api/random_noncrypto_api.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/api/tasklet_api.cpp.o"
+  "CMakeFiles/openthread-radio.dir/api/tasklet_api.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/common/instance.cpp.o"
+  "CMakeFiles/openthread-radio.dir/common/instance.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/common/logging.cpp.o"
+  "CMakeFiles/openthread-radio.dir/common/logging.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/common/random_manager.cpp.o"
+  "CMakeFiles/openthread-radio.dir/common/random_manager.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/common/string.cpp.o"
+  "CMakeFiles/openthread-radio.dir/common/string.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/common/tasklet.cpp.o"
+  "CMakeFiles/openthread-radio.dir/common/tasklet.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/common/timer.cpp.o"
+  "CMakeFiles/openthread-radio.dir/common/timer.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/crypto/aes_ccm.cpp.o"
+  "CMakeFiles/openthread-radio.dir/crypto/aes_ccm.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/crypto/aes_ecb.cpp.o"
+  "CMakeFiles/openthread-radio.dir/crypto/aes_ecb.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/diags/factory_diags.cpp.o"
+  "CMakeFiles/openthread-radio.dir/diags/factory_diags.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/mac/link_raw.cpp.o"
+  "CMakeFiles/openthread-radio.dir/mac/link_raw.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/mac/mac_frame.cpp.o"
+  "CMakeFiles/openthread-radio.dir/mac/mac_frame.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/mac/mac_types.cpp.o"
+  "CMakeFiles/openthread-radio.dir/mac/mac_types.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/mac/sub_mac.cpp.o"
+  "CMakeFiles/openthread-radio.dir/mac/sub_mac.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/mac/sub_mac_callbacks.cpp.o"
+  "CMakeFiles/openthread-radio.dir/mac/sub_mac_callbacks.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/radio/radio.cpp.o"
+  "CMakeFiles/openthread-radio.dir/radio/radio.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/radio/radio_callbacks.cpp.o"
+  "CMakeFiles/openthread-radio.dir/radio/radio_callbacks.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/radio/radio_platform.cpp.o"
+  "CMakeFiles/openthread-radio.dir/radio/radio_platform.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/thread/link_quality.cpp.o"
+  "CMakeFiles/openthread-radio.dir/thread/link_quality.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/utils/lookup_table.cpp.o"
+  "CMakeFiles/openthread-radio.dir/utils/lookup_table.cpp.o.d"
+  "CMakeFiles/openthread-radio.dir/utils/parse_cmdline.cpp.o"
+  "CMakeFiles/openthread-radio.dir/utils/parse_cmdline.cpp.o.d"
+  "libopenthread-radio.a"
+  "libopenthread-radio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openthread-radio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openthread-hdlc.dir/hdlc.cpp.o"
+  "CMakeFiles/openthread-hdlc.dir/hdlc.cpp.o.d"
+  "libopenthread-hdlc.a"
+  "libopenthread-hdlc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openthread-hdlc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
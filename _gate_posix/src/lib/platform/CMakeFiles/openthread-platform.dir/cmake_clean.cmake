@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openthread-platform.dir/exit_code.c.o"
+  "CMakeFiles/openthread-platform.dir/exit_code.c.o.d"
+  "libopenthread-platform.a"
+  "libopenthread-platform.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/openthread-platform.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
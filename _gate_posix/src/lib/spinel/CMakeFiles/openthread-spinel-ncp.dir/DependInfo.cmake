@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/lib/spinel/spinel.c" "src/lib/spinel/CMakeFiles/openthread-spinel-ncp.dir/spinel.c.o" "gcc" "src/lib/spinel/CMakeFiles/openthread-spinel-ncp.dir/spinel.c.o.d"
+  "/root/repo/src/lib/spinel/spinel_buffer.cpp" "src/lib/spinel/CMakeFiles/openthread-spinel-ncp.dir/spinel_buffer.cpp.o" "gcc" "src/lib/spinel/CMakeFiles/openthread-spinel-ncp.dir/spinel_buffer.cpp.o.d"
+  "/root/repo/src/lib/spinel/spinel_decoder.cpp" "src/lib/spinel/CMakeFiles/openthread-spinel-ncp.dir/spinel_decoder.cpp.o" "gcc" "src/lib/spinel/CMakeFiles/openthread-spinel-ncp.dir/spinel_decoder.cpp.o.d"
+  "/root/repo/src/lib/spinel/spinel_encoder.cpp" "src/lib/spinel/CMakeFiles/openthread-spinel-ncp.dir/spinel_encoder.cpp.o" "gcc" "src/lib/spinel/CMakeFiles/openthread-spinel-ncp.dir/spinel_encoder.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
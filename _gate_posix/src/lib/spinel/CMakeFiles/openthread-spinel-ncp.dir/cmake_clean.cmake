@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openthread-spinel-ncp.dir/spinel.c.o"
+  "CMakeFiles/openthread-spinel-ncp.dir/spinel.c.o.d"
+  "CMakeFiles/openthread-spinel-ncp.dir/spinel_buffer.cpp.o"
+  "CMakeFiles/openthread-spinel-ncp.dir/spinel_buffer.cpp.o.d"
+  "CMakeFiles/openthread-spinel-ncp.dir/spinel_decoder.cpp.o"
+  "CMakeFiles/openthread-spinel-ncp.dir/spinel_decoder.cpp.o.d"
+  "CMakeFiles/openthread-spinel-ncp.dir/spinel_encoder.cpp.o"
+  "CMakeFiles/openthread-spinel-ncp.dir/spinel_encoder.cpp.o.d"
+  "libopenthread-spinel-ncp.a"
+  "libopenthread-spinel-ncp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/openthread-spinel-ncp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openthread-spinel-rcp.dir/spinel.c.o"
+  "CMakeFiles/openthread-spinel-rcp.dir/spinel.c.o.d"
+  "CMakeFiles/openthread-spinel-rcp.dir/spinel_buffer.cpp.o"
+  "CMakeFiles/openthread-spinel-rcp.dir/spinel_buffer.cpp.o.d"
+  "CMakeFiles/openthread-spinel-rcp.dir/spinel_decoder.cpp.o"
+  "CMakeFiles/openthread-spinel-rcp.dir/spinel_decoder.cpp.o.d"
+  "CMakeFiles/openthread-spinel-rcp.dir/spinel_encoder.cpp.o"
+  "CMakeFiles/openthread-spinel-rcp.dir/spinel_encoder.cpp.o.d"
+  "libopenthread-spinel-rcp.a"
+  "libopenthread-spinel-rcp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/openthread-spinel-rcp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openthread-url.dir/url.cpp.o"
+  "CMakeFiles/openthread-url.dir/url.cpp.o.d"
+  "libopenthread-url.a"
+  "libopenthread-url.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openthread-url.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
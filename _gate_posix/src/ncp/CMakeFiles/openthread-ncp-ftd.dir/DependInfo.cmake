@@ -0,0 +1,35 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ncp/changed_props_set.cpp" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/changed_props_set.cpp.o" "gcc" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/changed_props_set.cpp.o.d"
+  "/root/repo/src/ncp/ncp_base.cpp" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_base.cpp.o" "gcc" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_base.cpp.o.d"
+  "/root/repo/src/ncp/ncp_base_dispatcher.cpp" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_base_dispatcher.cpp.o" "gcc" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_base_dispatcher.cpp.o.d"
+  "/root/repo/src/ncp/ncp_base_ftd.cpp" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_base_ftd.cpp.o" "gcc" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_base_ftd.cpp.o.d"
+  "/root/repo/src/ncp/ncp_base_mtd.cpp" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_base_mtd.cpp.o" "gcc" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_base_mtd.cpp.o.d"
+  "/root/repo/src/ncp/ncp_base_radio.cpp" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_base_radio.cpp.o" "gcc" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_base_radio.cpp.o.d"
+  "/root/repo/src/ncp/ncp_spi.cpp" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_spi.cpp.o" "gcc" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_spi.cpp.o.d"
+  "/root/repo/src/ncp/ncp_uart.cpp" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_uart.cpp.o" "gcc" "src/ncp/CMakeFiles/openthread-ncp-ftd.dir/ncp_uart.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_posix/src/core/CMakeFiles/openthread-ftd.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/posix/platform/CMakeFiles/openthread-posix.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/lib/hdlc/CMakeFiles/openthread-hdlc.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/lib/spinel/CMakeFiles/openthread-spinel-ncp.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/lib/platform/CMakeFiles/openthread-platform.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/lib/url/CMakeFiles/openthread-url.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
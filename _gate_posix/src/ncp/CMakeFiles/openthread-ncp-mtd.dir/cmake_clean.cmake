@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openthread-ncp-mtd.dir/changed_props_set.cpp.o"
+  "CMakeFiles/openthread-ncp-mtd.dir/changed_props_set.cpp.o.d"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_base.cpp.o"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_base.cpp.o.d"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_base_dispatcher.cpp.o"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_base_dispatcher.cpp.o.d"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_base_ftd.cpp.o"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_base_ftd.cpp.o.d"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_base_mtd.cpp.o"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_base_mtd.cpp.o.d"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_base_radio.cpp.o"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_base_radio.cpp.o.d"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_spi.cpp.o"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_spi.cpp.o.d"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_uart.cpp.o"
+  "CMakeFiles/openthread-ncp-mtd.dir/ncp_uart.cpp.o.d"
+  "libopenthread-ncp-mtd.a"
+  "libopenthread-ncp-mtd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openthread-ncp-mtd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openthread-rcp.dir/changed_props_set.cpp.o"
+  "CMakeFiles/openthread-rcp.dir/changed_props_set.cpp.o.d"
+  "CMakeFiles/openthread-rcp.dir/ncp_base.cpp.o"
+  "CMakeFiles/openthread-rcp.dir/ncp_base.cpp.o.d"
+  "CMakeFiles/openthread-rcp.dir/ncp_base_dispatcher.cpp.o"
+  "CMakeFiles/openthread-rcp.dir/ncp_base_dispatcher.cpp.o.d"
+  "CMakeFiles/openthread-rcp.dir/ncp_base_radio.cpp.o"
+  "CMakeFiles/openthread-rcp.dir/ncp_base_radio.cpp.o.d"
+  "CMakeFiles/openthread-rcp.dir/ncp_spi.cpp.o"
+  "CMakeFiles/openthread-rcp.dir/ncp_spi.cpp.o.d"
+  "CMakeFiles/openthread-rcp.dir/ncp_uart.cpp.o"
+  "CMakeFiles/openthread-rcp.dir/ncp_uart.cpp.o.d"
+  "libopenthread-rcp.a"
+  "libopenthread-rcp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openthread-rcp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ot-ctl.dir/client.cpp.o"
+  "CMakeFiles/ot-ctl.dir/client.cpp.o.d"
+  "ot-ctl"
+  "ot-ctl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ot-ctl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
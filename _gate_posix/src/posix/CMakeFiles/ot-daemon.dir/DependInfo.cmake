@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/posix/main.c" "src/posix/CMakeFiles/ot-daemon.dir/main.c.o" "gcc" "src/posix/CMakeFiles/ot-daemon.dir/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_posix/src/cli/CMakeFiles/openthread-cli-ftd.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/posix/platform/CMakeFiles/openthread-posix.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/core/CMakeFiles/openthread-ftd.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/ncp/CMakeFiles/openthread-ncp-ftd.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/lib/platform/CMakeFiles/openthread-platform.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/lib/url/CMakeFiles/openthread-url.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/lib/hdlc/CMakeFiles/openthread-hdlc.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/lib/spinel/CMakeFiles/openthread-spinel-ncp.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ot-daemon.dir/main.c.o"
+  "CMakeFiles/ot-daemon.dir/main.c.o.d"
+  "ot-daemon"
+  "ot-daemon.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ot-daemon.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
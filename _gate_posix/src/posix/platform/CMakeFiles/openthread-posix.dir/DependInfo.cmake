@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/posix/platform/alarm.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/alarm.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/alarm.cpp.o.d"
+  "/root/repo/src/posix/platform/backbone.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/backbone.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/backbone.cpp.o.d"
+  "/root/repo/src/posix/platform/entropy.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/entropy.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/entropy.cpp.o.d"
+  "/root/repo/src/posix/platform/hdlc_interface.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/hdlc_interface.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/hdlc_interface.cpp.o.d"
+  "/root/repo/src/posix/platform/infra_if.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/infra_if.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/infra_if.cpp.o.d"
+  "/root/repo/src/posix/platform/logging.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/logging.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/logging.cpp.o.d"
+  "/root/repo/src/posix/platform/mainloop.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/mainloop.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/mainloop.cpp.o.d"
+  "/root/repo/src/posix/platform/misc.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/misc.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/misc.cpp.o.d"
+  "/root/repo/src/posix/platform/multicast_routing.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/multicast_routing.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/multicast_routing.cpp.o.d"
+  "/root/repo/src/posix/platform/netif.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/netif.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/netif.cpp.o.d"
+  "/root/repo/src/posix/platform/radio.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/radio.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/radio.cpp.o.d"
+  "/root/repo/src/posix/platform/radio_url.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/radio_url.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/radio_url.cpp.o.d"
+  "/root/repo/src/posix/platform/settings.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/settings.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/settings.cpp.o.d"
+  "/root/repo/src/posix/platform/spi_interface.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/spi_interface.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/spi_interface.cpp.o.d"
+  "/root/repo/src/posix/platform/system.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/system.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/system.cpp.o.d"
+  "/root/repo/src/posix/platform/trel_udp6.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/trel_udp6.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/trel_udp6.cpp.o.d"
+  "/root/repo/src/posix/platform/uart.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/uart.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/uart.cpp.o.d"
+  "/root/repo/src/posix/platform/udp.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/udp.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/udp.cpp.o.d"
+  "/root/repo/src/posix/platform/virtual_time.cpp" "src/posix/platform/CMakeFiles/openthread-posix.dir/virtual_time.cpp.o" "gcc" "src/posix/platform/CMakeFiles/openthread-posix.dir/virtual_time.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_posix/src/lib/platform/CMakeFiles/openthread-platform.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/src/lib/url/CMakeFiles/openthread-url.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
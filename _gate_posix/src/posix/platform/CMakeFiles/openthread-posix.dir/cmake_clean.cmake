@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openthread-posix.dir/alarm.cpp.o"
+  "CMakeFiles/openthread-posix.dir/alarm.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/backbone.cpp.o"
+  "CMakeFiles/openthread-posix.dir/backbone.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/entropy.cpp.o"
+  "CMakeFiles/openthread-posix.dir/entropy.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/hdlc_interface.cpp.o"
+  "CMakeFiles/openthread-posix.dir/hdlc_interface.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/infra_if.cpp.o"
+  "CMakeFiles/openthread-posix.dir/infra_if.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/logging.cpp.o"
+  "CMakeFiles/openthread-posix.dir/logging.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/mainloop.cpp.o"
+  "CMakeFiles/openthread-posix.dir/mainloop.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/misc.cpp.o"
+  "CMakeFiles/openthread-posix.dir/misc.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/multicast_routing.cpp.o"
+  "CMakeFiles/openthread-posix.dir/multicast_routing.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/netif.cpp.o"
+  "CMakeFiles/openthread-posix.dir/netif.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/radio.cpp.o"
+  "CMakeFiles/openthread-posix.dir/radio.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/radio_url.cpp.o"
+  "CMakeFiles/openthread-posix.dir/radio_url.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/settings.cpp.o"
+  "CMakeFiles/openthread-posix.dir/settings.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/spi_interface.cpp.o"
+  "CMakeFiles/openthread-posix.dir/spi_interface.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/system.cpp.o"
+  "CMakeFiles/openthread-posix.dir/system.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/trel_udp6.cpp.o"
+  "CMakeFiles/openthread-posix.dir/trel_udp6.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/uart.cpp.o"
+  "CMakeFiles/openthread-posix.dir/uart.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/udp.cpp.o"
+  "CMakeFiles/openthread-posix.dir/udp.cpp.o.d"
+  "CMakeFiles/openthread-posix.dir/virtual_time.cpp.o"
+  "CMakeFiles/openthread-posix.dir/virtual_time.cpp.o.d"
+  "libopenthread-posix.a"
+  "libopenthread-posix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openthread-posix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,127 @@
+# Install script for directory: /root/repo/third_party/mbedtls/repo/include
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Debug")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/mbedtls" TYPE FILE PERMISSIONS OWNER_READ OWNER_WRITE GROUP_READ WORLD_READ FILES
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/aes.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/aesni.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/arc4.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/aria.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/asn1.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/asn1write.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/base64.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/bignum.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/blowfish.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/bn_mul.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/camellia.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ccm.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/certs.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/chacha20.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/chachapoly.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/check_config.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/cipher.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/cipher_internal.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/cmac.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/compat-1.3.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/config.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ctr_drbg.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/debug.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/des.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/dhm.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ecdh.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ecdsa.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ecjpake.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ecp.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ecp_internal.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/entropy.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/entropy_poll.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/error.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/gcm.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/havege.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/hkdf.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/hmac_drbg.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/md.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/md2.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/md4.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/md5.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/md_internal.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/memory_buffer_alloc.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/net.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/net_sockets.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/nist_kw.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/oid.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/padlock.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/pem.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/pk.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/pk_internal.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/pkcs11.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/pkcs12.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/pkcs5.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/platform.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/platform_time.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/platform_util.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/poly1305.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ripemd160.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/rsa.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/rsa_internal.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/sha1.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/sha256.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/sha512.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ssl.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ssl_cache.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ssl_ciphersuites.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ssl_cookie.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ssl_internal.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/ssl_ticket.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/threading.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/timing.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/version.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/x509.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/x509_crl.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/x509_crt.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/x509_csr.h"
+    "/root/repo/third_party/mbedtls/repo/include/mbedtls/xtea.h"
+    )
+endif()
+
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lib"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/lib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,79 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third_party/mbedtls/repo/library/aes.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/aes.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/aes.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/aesni.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/aesni.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/aesni.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/arc4.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/arc4.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/arc4.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/aria.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/aria.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/aria.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/asn1parse.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/asn1parse.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/asn1parse.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/asn1write.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/asn1write.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/asn1write.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/base64.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/base64.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/base64.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/bignum.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/bignum.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/bignum.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/blowfish.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/blowfish.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/blowfish.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/camellia.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/camellia.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/camellia.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ccm.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ccm.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ccm.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/chacha20.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/chacha20.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/chacha20.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/chachapoly.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/chachapoly.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/chachapoly.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/cipher.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/cipher.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/cipher.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/cipher_wrap.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/cipher_wrap.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/cipher_wrap.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/cmac.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/cmac.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/cmac.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ctr_drbg.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ctr_drbg.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ctr_drbg.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/des.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/des.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/des.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/dhm.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/dhm.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/dhm.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ecdh.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ecdh.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ecdh.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ecdsa.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ecdsa.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ecdsa.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ecjpake.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ecjpake.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ecjpake.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ecp.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ecp.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ecp.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ecp_curves.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ecp_curves.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ecp_curves.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/entropy.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/entropy.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/entropy.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/entropy_poll.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/entropy_poll.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/entropy_poll.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/error.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/error.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/error.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/gcm.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/gcm.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/gcm.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/havege.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/havege.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/havege.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/hkdf.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/hkdf.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/hkdf.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/hmac_drbg.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/hmac_drbg.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/hmac_drbg.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/md.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/md.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/md.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/md2.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/md2.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/md2.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/md4.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/md4.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/md4.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/md5.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/md5.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/md5.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/md_wrap.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/md_wrap.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/md_wrap.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/memory_buffer_alloc.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/memory_buffer_alloc.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/memory_buffer_alloc.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/nist_kw.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/nist_kw.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/nist_kw.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/oid.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/oid.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/oid.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/padlock.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/padlock.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/padlock.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/pem.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pem.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pem.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/pk.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pk.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pk.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/pk_wrap.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pk_wrap.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pk_wrap.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/pkcs12.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pkcs12.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pkcs12.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/pkcs5.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pkcs5.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pkcs5.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/pkparse.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pkparse.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pkparse.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/pkwrite.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pkwrite.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/pkwrite.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/platform.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/platform.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/platform.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/platform_util.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/platform_util.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/platform_util.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/poly1305.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/poly1305.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/poly1305.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ripemd160.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ripemd160.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/ripemd160.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/rsa.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/rsa.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/rsa.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/rsa_internal.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/rsa_internal.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/rsa_internal.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/sha1.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/sha1.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/sha1.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/sha256.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/sha256.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/sha256.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/sha512.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/sha512.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/sha512.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/threading.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/threading.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/threading.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/timing.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/timing.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/timing.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/version.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/version.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/version.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/version_features.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/version_features.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/version_features.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/xtea.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/xtea.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/xtea.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,131 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mbedcrypto.dir/aes.c.o"
+  "CMakeFiles/mbedcrypto.dir/aes.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/aesni.c.o"
+  "CMakeFiles/mbedcrypto.dir/aesni.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/arc4.c.o"
+  "CMakeFiles/mbedcrypto.dir/arc4.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/aria.c.o"
+  "CMakeFiles/mbedcrypto.dir/aria.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/asn1parse.c.o"
+  "CMakeFiles/mbedcrypto.dir/asn1parse.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/asn1write.c.o"
+  "CMakeFiles/mbedcrypto.dir/asn1write.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/base64.c.o"
+  "CMakeFiles/mbedcrypto.dir/base64.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/bignum.c.o"
+  "CMakeFiles/mbedcrypto.dir/bignum.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/blowfish.c.o"
+  "CMakeFiles/mbedcrypto.dir/blowfish.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/camellia.c.o"
+  "CMakeFiles/mbedcrypto.dir/camellia.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/ccm.c.o"
+  "CMakeFiles/mbedcrypto.dir/ccm.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/chacha20.c.o"
+  "CMakeFiles/mbedcrypto.dir/chacha20.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/chachapoly.c.o"
+  "CMakeFiles/mbedcrypto.dir/chachapoly.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/cipher.c.o"
+  "CMakeFiles/mbedcrypto.dir/cipher.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/cipher_wrap.c.o"
+  "CMakeFiles/mbedcrypto.dir/cipher_wrap.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/cmac.c.o"
+  "CMakeFiles/mbedcrypto.dir/cmac.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/ctr_drbg.c.o"
+  "CMakeFiles/mbedcrypto.dir/ctr_drbg.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/des.c.o"
+  "CMakeFiles/mbedcrypto.dir/des.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/dhm.c.o"
+  "CMakeFiles/mbedcrypto.dir/dhm.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/ecdh.c.o"
+  "CMakeFiles/mbedcrypto.dir/ecdh.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/ecdsa.c.o"
+  "CMakeFiles/mbedcrypto.dir/ecdsa.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/ecjpake.c.o"
+  "CMakeFiles/mbedcrypto.dir/ecjpake.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/ecp.c.o"
+  "CMakeFiles/mbedcrypto.dir/ecp.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/ecp_curves.c.o"
+  "CMakeFiles/mbedcrypto.dir/ecp_curves.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/entropy.c.o"
+  "CMakeFiles/mbedcrypto.dir/entropy.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/entropy_poll.c.o"
+  "CMakeFiles/mbedcrypto.dir/entropy_poll.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/error.c.o"
+  "CMakeFiles/mbedcrypto.dir/error.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/gcm.c.o"
+  "CMakeFiles/mbedcrypto.dir/gcm.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/havege.c.o"
+  "CMakeFiles/mbedcrypto.dir/havege.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/hkdf.c.o"
+  "CMakeFiles/mbedcrypto.dir/hkdf.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/hmac_drbg.c.o"
+  "CMakeFiles/mbedcrypto.dir/hmac_drbg.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/md.c.o"
+  "CMakeFiles/mbedcrypto.dir/md.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/md2.c.o"
+  "CMakeFiles/mbedcrypto.dir/md2.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/md4.c.o"
+  "CMakeFiles/mbedcrypto.dir/md4.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/md5.c.o"
+  "CMakeFiles/mbedcrypto.dir/md5.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/md_wrap.c.o"
+  "CMakeFiles/mbedcrypto.dir/md_wrap.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/memory_buffer_alloc.c.o"
+  "CMakeFiles/mbedcrypto.dir/memory_buffer_alloc.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/nist_kw.c.o"
+  "CMakeFiles/mbedcrypto.dir/nist_kw.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/oid.c.o"
+  "CMakeFiles/mbedcrypto.dir/oid.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/padlock.c.o"
+  "CMakeFiles/mbedcrypto.dir/padlock.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/pem.c.o"
+  "CMakeFiles/mbedcrypto.dir/pem.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/pk.c.o"
+  "CMakeFiles/mbedcrypto.dir/pk.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/pk_wrap.c.o"
+  "CMakeFiles/mbedcrypto.dir/pk_wrap.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/pkcs12.c.o"
+  "CMakeFiles/mbedcrypto.dir/pkcs12.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/pkcs5.c.o"
+  "CMakeFiles/mbedcrypto.dir/pkcs5.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/pkparse.c.o"
+  "CMakeFiles/mbedcrypto.dir/pkparse.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/pkwrite.c.o"
+  "CMakeFiles/mbedcrypto.dir/pkwrite.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/platform.c.o"
+  "CMakeFiles/mbedcrypto.dir/platform.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/platform_util.c.o"
+  "CMakeFiles/mbedcrypto.dir/platform_util.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/poly1305.c.o"
+  "CMakeFiles/mbedcrypto.dir/poly1305.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/ripemd160.c.o"
+  "CMakeFiles/mbedcrypto.dir/ripemd160.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/rsa.c.o"
+  "CMakeFiles/mbedcrypto.dir/rsa.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/rsa_internal.c.o"
+  "CMakeFiles/mbedcrypto.dir/rsa_internal.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/sha1.c.o"
+  "CMakeFiles/mbedcrypto.dir/sha1.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/sha256.c.o"
+  "CMakeFiles/mbedcrypto.dir/sha256.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/sha512.c.o"
+  "CMakeFiles/mbedcrypto.dir/sha512.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/threading.c.o"
+  "CMakeFiles/mbedcrypto.dir/threading.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/timing.c.o"
+  "CMakeFiles/mbedcrypto.dir/timing.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/version.c.o"
+  "CMakeFiles/mbedcrypto.dir/version.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/version_features.c.o"
+  "CMakeFiles/mbedcrypto.dir/version_features.c.o.d"
+  "CMakeFiles/mbedcrypto.dir/xtea.c.o"
+  "CMakeFiles/mbedcrypto.dir/xtea.c.o.d"
+  "libmbedcrypto.a"
+  "libmbedcrypto.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mbedcrypto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third_party/mbedtls/repo/library/debug.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/debug.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/debug.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/net_sockets.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/net_sockets.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/net_sockets.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ssl_cache.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_cache.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_cache.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ssl_ciphersuites.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_ciphersuites.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_ciphersuites.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ssl_cli.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_cli.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_cli.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ssl_cookie.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_cookie.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_cookie.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ssl_srv.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_srv.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_srv.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ssl_ticket.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_ticket.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_ticket.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/ssl_tls.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_tls.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedtls.dir/ssl_tls.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/DependInfo.cmake"
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mbedtls.dir/debug.c.o"
+  "CMakeFiles/mbedtls.dir/debug.c.o.d"
+  "CMakeFiles/mbedtls.dir/net_sockets.c.o"
+  "CMakeFiles/mbedtls.dir/net_sockets.c.o.d"
+  "CMakeFiles/mbedtls.dir/ssl_cache.c.o"
+  "CMakeFiles/mbedtls.dir/ssl_cache.c.o.d"
+  "CMakeFiles/mbedtls.dir/ssl_ciphersuites.c.o"
+  "CMakeFiles/mbedtls.dir/ssl_ciphersuites.c.o.d"
+  "CMakeFiles/mbedtls.dir/ssl_cli.c.o"
+  "CMakeFiles/mbedtls.dir/ssl_cli.c.o.d"
+  "CMakeFiles/mbedtls.dir/ssl_cookie.c.o"
+  "CMakeFiles/mbedtls.dir/ssl_cookie.c.o.d"
+  "CMakeFiles/mbedtls.dir/ssl_srv.c.o"
+  "CMakeFiles/mbedtls.dir/ssl_srv.c.o.d"
+  "CMakeFiles/mbedtls.dir/ssl_ticket.c.o"
+  "CMakeFiles/mbedtls.dir/ssl_ticket.c.o.d"
+  "CMakeFiles/mbedtls.dir/ssl_tls.c.o"
+  "CMakeFiles/mbedtls.dir/ssl_tls.c.o.d"
+  "libmbedtls.a"
+  "libmbedtls.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mbedtls.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
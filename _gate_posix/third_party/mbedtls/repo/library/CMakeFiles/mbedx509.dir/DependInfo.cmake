@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third_party/mbedtls/repo/library/certs.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/certs.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/certs.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/pkcs11.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/pkcs11.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/pkcs11.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/x509.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/x509_create.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509_create.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509_create.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/x509_crl.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509_crl.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509_crl.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/x509_crt.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509_crt.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509_crt.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/x509_csr.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509_csr.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509_csr.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/x509write_crt.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509write_crt.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509write_crt.c.o.d"
+  "/root/repo/third_party/mbedtls/repo/library/x509write_csr.c" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509write_csr.c.o" "gcc" "third_party/mbedtls/repo/library/CMakeFiles/mbedx509.dir/x509write_csr.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_posix/third_party/mbedtls/repo/library/CMakeFiles/mbedcrypto.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
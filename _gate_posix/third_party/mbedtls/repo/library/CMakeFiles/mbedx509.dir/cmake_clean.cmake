@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mbedx509.dir/certs.c.o"
+  "CMakeFiles/mbedx509.dir/certs.c.o.d"
+  "CMakeFiles/mbedx509.dir/pkcs11.c.o"
+  "CMakeFiles/mbedx509.dir/pkcs11.c.o.d"
+  "CMakeFiles/mbedx509.dir/x509.c.o"
+  "CMakeFiles/mbedx509.dir/x509.c.o.d"
+  "CMakeFiles/mbedx509.dir/x509_create.c.o"
+  "CMakeFiles/mbedx509.dir/x509_create.c.o.d"
+  "CMakeFiles/mbedx509.dir/x509_crl.c.o"
+  "CMakeFiles/mbedx509.dir/x509_crl.c.o.d"
+  "CMakeFiles/mbedx509.dir/x509_crt.c.o"
+  "CMakeFiles/mbedx509.dir/x509_crt.c.o.d"
+  "CMakeFiles/mbedx509.dir/x509_csr.c.o"
+  "CMakeFiles/mbedx509.dir/x509_csr.c.o.d"
+  "CMakeFiles/mbedx509.dir/x509write_crt.c.o"
+  "CMakeFiles/mbedx509.dir/x509write_crt.c.o.d"
+  "CMakeFiles/mbedx509.dir/x509write_csr.c.o"
+  "CMakeFiles/mbedx509.dir/x509write_csr.c.o.d"
+  "libmbedx509.a"
+  "libmbedx509.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/mbedx509.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libmbedx509.a"
+)
@@ -147,6 +147,46 @@
  */
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 1
 
+/**
+ * @def OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+ *
+ * Define to 1 to keep a RAM index of the settings records stored through the otPlatFlash* APIs.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+ *
+ * Define to 1 to support the adaptive CSMA-CA backoff and frame retry policy.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+ *
+ * Define to 1 to keep the expanded AES key schedules of the MAC keys.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+ *
+ * Define to 1 to enable `otTaskletsPostFromThread()`, which posts tasklet entries from any thread.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+#define OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE 1
+#endif
+
 /**
  * @def CLI_COAP_SECURE_USE_COAP_DEFAULT_HANDLER
  *
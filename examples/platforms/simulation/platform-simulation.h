@@ -231,6 +231,39 @@ void otSimSendUartWriteEvent(const uint8_t *aData, uint16_t aLength);
  */
 bool platformRadioIsTransmitPending(void);
 
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+
+/**
+ * This function initializes the wakeup used by tasklet entries posted from other threads.
+ *
+ */
+void platformTaskletsInit(void);
+
+/**
+ * This function shuts down the wakeup used by tasklet entries posted from other threads.
+ *
+ */
+void platformTaskletsDeinit(void);
+
+/**
+ * This function updates the file descriptor sets with the file descriptor of the tasklet wakeup.
+ *
+ * @param[inout]  aReadFdSet   A pointer to the read file descriptors.
+ * @param[inout]  aMaxFd       A pointer to the max file descriptor.
+ *
+ */
+void platformTaskletsUpdateFdSet(fd_set *aReadFdSet, int *aMaxFd);
+
+/**
+ * This function performs tasklet wakeup processing.
+ *
+ * @param[in]  aReadFdSet   A pointer to the read file descriptors.
+ *
+ */
+void platformTaskletsProcess(const fd_set *aReadFdSet);
+
+#endif // OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 
 /**
@@ -120,6 +120,9 @@ void otSysInit(int aArgCount, char *aArgVector[])
     platformTrelInit(speedUpFactor);
 #endif
     platformRandomInit();
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    platformTaskletsInit();
+#endif
 }
 
 bool otSysPseudoResetWasRequested(void)
@@ -133,6 +136,9 @@ void otSysDeinit(void)
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     platformTrelDeinit();
 #endif
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    platformTaskletsDeinit();
+#endif
 }
 
 void otSysProcessDrivers(otInstance *aInstance)
@@ -154,6 +160,9 @@ void otSysProcessDrivers(otInstance *aInstance)
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     platformTrelUpdateFdSet(&read_fds, &write_fds, &timeout, &max_fd);
 #endif
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    platformTaskletsUpdateFdSet(&read_fds, &max_fd);
+#endif
 
     if (otTaskletsArePending(aInstance))
     {
@@ -167,6 +176,9 @@ void otSysProcessDrivers(otInstance *aInstance)
     {
         platformUartProcess();
         platformRadioProcess(aInstance, &read_fds, &write_fds);
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+        platformTaskletsProcess(&read_fds);
+#endif
     }
     else if (errno != EINTR)
     {
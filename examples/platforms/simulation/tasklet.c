@@ -0,0 +1,153 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * @brief
+ *   This file implements the wakeup of the main loop for tasklet entries posted from other threads.
+ */
+
+#include "platform-simulation.h"
+
+#include <errno.h>
+#include <sched.h>
+
+#include <openthread/tasklet.h>
+
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+
+// The write end is read by the posting threads, so it is only accessed
+// atomically. `sWakeupWriters` counts the posting threads using it, and
+// `platformTaskletsDeinit()` waits for them before closing it.
+
+static int sWakeupFds[2] = {-1, -1};
+static int sWakeupWriters;
+
+void platformTaskletsInit(void)
+{
+    int fds[2];
+
+    if (pipe(fds) != 0)
+    {
+        perror("pipe");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (fcntl(fds[i], F_SETFL, fcntl(fds[i], F_GETFL) | O_NONBLOCK) != 0 ||
+            fcntl(fds[i], F_SETFD, FD_CLOEXEC) != 0)
+        {
+            perror("fcntl");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    sWakeupFds[0] = fds[0];
+    __atomic_store_n(&sWakeupFds[1], fds[1], __ATOMIC_SEQ_CST);
+}
+
+void platformTaskletsDeinit(void)
+{
+    int writeFd = __atomic_exchange_n(&sWakeupFds[1], -1, __ATOMIC_SEQ_CST);
+
+    while (__atomic_load_n(&sWakeupWriters, __ATOMIC_SEQ_CST) != 0)
+    {
+        sched_yield();
+    }
+
+    if (writeFd != -1)
+    {
+        close(writeFd);
+    }
+
+    if (sWakeupFds[0] != -1)
+    {
+        close(sWakeupFds[0]);
+        sWakeupFds[0] = -1;
+    }
+}
+
+void platformTaskletsUpdateFdSet(fd_set *aReadFdSet, int *aMaxFd)
+{
+    if (sWakeupFds[0] != -1)
+    {
+        FD_SET(sWakeupFds[0], aReadFdSet);
+
+        if (aMaxFd != NULL && *aMaxFd < sWakeupFds[0])
+        {
+            *aMaxFd = sWakeupFds[0];
+        }
+    }
+}
+
+void platformTaskletsProcess(const fd_set *aReadFdSet)
+{
+    uint8_t buffer[16];
+
+    // Only drain the pipe, the posted entries are run by `otTaskletsProcess()`.
+
+    if (sWakeupFds[0] != -1 && FD_ISSET(sWakeupFds[0], aReadFdSet))
+    {
+        while (read(sWakeupFds[0], buffer, sizeof(buffer)) > 0)
+        {
+        }
+    }
+}
+
+void otTaskletsSignalPendingFromThread(otInstance *aInstance)
+{
+    const uint8_t value = 1;
+    int           writeFd;
+    ssize_t       rval;
+
+    OT_UNUSED_VARIABLE(aInstance);
+
+    __atomic_add_fetch(&sWakeupWriters, 1, __ATOMIC_SEQ_CST);
+    writeFd = __atomic_load_n(&sWakeupFds[1], __ATOMIC_SEQ_CST);
+
+    if (writeFd != -1)
+    {
+        do
+        {
+            rval = write(writeFd, &value, sizeof(value));
+        } while (rval == -1 && errno == EINTR);
+
+        // A full pipe already wakes up the main loop, so `EAGAIN` is ignored.
+
+        if (rval == -1 && errno != EAGAIN)
+        {
+            perror("write");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    __atomic_sub_fetch(&sWakeupWriters, 1, __ATOMIC_SEQ_CST);
+}
+
+#endif // OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
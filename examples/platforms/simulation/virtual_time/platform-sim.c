@@ -248,6 +248,9 @@ void otSysInit(int argc, char *argv[])
     platformAlarmInit(1);
     platformRadioInit();
     platformRandomInit();
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    platformTaskletsInit();
+#endif
 
     signal(SIGTERM, &handleSignal);
     signal(SIGHUP, &handleSignal);
@@ -261,6 +264,9 @@ bool otSysPseudoResetWasRequested(void)
 void otSysDeinit(void)
 {
     close(sSockFd);
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    platformTaskletsDeinit();
+#endif
 }
 
 void otSysProcessDrivers(otInstance *aInstance)
@@ -286,6 +292,13 @@ void otSysProcessDrivers(otInstance *aInstance)
 #if OPENTHREAD_SIMULATION_VIRTUAL_TIME_UART == 0
     platformUartUpdateFdSet(&read_fds, &write_fds, &error_fds, &max_fd);
 #endif
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    // The tasklet wakeup is a real-time event. It only makes the node run
+    // the entries posted from another thread, virtual time does not advance
+    // since no event is received from the simulator. The node reports sleep
+    // again on its next pass through this function.
+    platformTaskletsUpdateFdSet(&read_fds, &max_fd);
+#endif
 
     if (!otTaskletsArePending(aInstance) && platformAlarmGetNext() > 0 && !platformRadioIsTransmitPending())
     {
@@ -303,6 +316,13 @@ void otSysProcessDrivers(otInstance *aInstance)
         {
             receiveEvent(aInstance);
         }
+
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+        if (rval > 0)
+        {
+            platformTaskletsProcess(&read_fds);
+        }
+#endif
     }
 
     platformAlarmProcess(aInstance);
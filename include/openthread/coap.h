@@ -482,6 +482,19 @@ typedef struct otCoapTxParameters
     uint8_t mMaxRetransmit;
 } otCoapTxParameters;
 
+/**
+ * This structure represents the counters of a CoAP response cache.
+ *
+ * The response cache keeps the responses to received confirmable requests to answer retransmitted requests.
+ *
+ */
+typedef struct otCoapResponseCacheCounters
+{
+    uint32_t mHits;      ///< The number of received requests answered from the cache.
+    uint32_t mMisses;    ///< The number of received requests without a cached response.
+    uint32_t mEvictions; ///< The number of responses removed from a full cache before their exchange lifetime.
+} otCoapResponseCacheCounters;
+
 /**
  * This function initializes the CoAP header.
  *
@@ -1041,6 +1054,16 @@ void otCoapRemoveBlockWiseResource(otInstance *aInstance, otCoapBlockwiseResourc
  */
 void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandler, void *aContext);
 
+/**
+ * This function gets the response cache counters of the CoAP server.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the response cache counters.
+ *
+ */
+const otCoapResponseCacheCounters *otCoapGetResponseCacheCounters(otInstance *aInstance);
+
 /**
  * This function sends a CoAP response from the server with custom transmission parameters.
  *
@@ -372,6 +372,17 @@ typedef struct otMacCounters
     uint32_t mRxErrOther;
 } otMacCounters;
 
+/**
+ * This structure represents the adaptive transmit policy counters.
+ *
+ */
+typedef struct otLinkAdaptiveTxCounters
+{
+    uint32_t mBackoffRaised;  ///< The number of frames sent with a raised minimum CSMA-CA backoff exponent.
+    uint32_t mRetriesLimited; ///< The number of data frames sent with a lowered maximum number of retries.
+    uint32_t mRetriesRemoved; ///< The total number of retries removed from the retry limit of those frames.
+} otLinkAdaptiveTxCounters;
+
 /**
  * This structure represents a received IEEE 802.15.4 Beacon.
  *
@@ -1086,6 +1097,57 @@ otError otLinkCslSetTimeout(otInstance *aInstance, uint32_t aTimeout);
  */
 uint16_t otLinkGetCcaFailureRate(otInstance *aInstance);
 
+/**
+ * This function enables or disables the adaptive transmit policy.
+ *
+ * When enabled, the minimum CSMA-CA backoff exponent follows the CCA failure rate on the PAN channel, and the maximum
+ * number of frame retries of data frames is lowered for neighbors whose recent frame error rate shows that retries
+ * rarely succeed. If `OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE` is also enabled, the retries are further
+ * limited to what the successful transmissions recorded in the retry histograms needed.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE` configuration is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aEnabled   TRUE to enable the adaptive transmit policy, FALSE to disable it.
+ *
+ */
+void otLinkSetAdaptiveTxPolicyEnabled(otInstance *aInstance, bool aEnabled);
+
+/**
+ * This function indicates whether the adaptive transmit policy is enabled.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE` configuration is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @retval TRUE   The adaptive transmit policy is enabled.
+ * @retval FALSE  The adaptive transmit policy is disabled.
+ *
+ */
+bool otLinkIsAdaptiveTxPolicyEnabled(otInstance *aInstance);
+
+/**
+ * This function gets the adaptive transmit policy counters.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE` configuration is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the adaptive transmit policy counters.
+ *
+ */
+const otLinkAdaptiveTxCounters *otLinkGetAdaptiveTxCounters(otInstance *aInstance);
+
+/**
+ * This function resets the adaptive transmit policy counters.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE` configuration is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otLinkResetAdaptiveTxCounters(otInstance *aInstance);
+
 /**
  * This function enables or disables the link layer.
  *
@@ -60,6 +60,28 @@ typedef struct otMessage
     struct otMessage *mNext; ///< A pointer to the next Message buffer.
 } otMessage;
 
+/**
+ * The number of message priority levels tracked in `otBufferInfo`.
+ *
+ * This includes the three `otMessagePriority` levels and the internal network control level used by OpenThread for
+ * network-critical traffic such as MLE (at index `OT_MESSAGE_PRIORITY_HIGH + 1`).
+ *
+ */
+#define OT_MESSAGE_NUM_PRIORITY_LEVELS 4
+
+/**
+ * This structure represents the message buffer usage of a single priority level.
+ *
+ */
+typedef struct otMessagePriorityBufferInfo
+{
+    uint16_t mInUseBuffers;    ///< The number of buffers held by messages of this priority.
+    uint16_t mMaxInUseBuffers; ///< The maximum number of buffers held by messages of this priority (high-water mark).
+    uint16_t mQuota;           ///< The maximum number of buffers this priority may hold (0 for no quota).
+    uint16_t mReservedBuffers; ///< The number of free buffers reserved for this and higher priorities.
+    uint32_t mAllocFailures;   ///< The number of buffer allocations that failed for this priority.
+} otMessagePriorityBufferInfo;
+
 /**
  * This structure represents the message buffer information.
  *
@@ -86,6 +108,8 @@ typedef struct otBufferInfo
     uint16_t mCoapSecureBuffers;       ///< The number of buffers in the CoAP secure send queue.
     uint16_t mApplicationCoapMessages; ///< The number of messages in the application CoAP send queue.
     uint16_t mApplicationCoapBuffers;  ///< The number of buffers in the application CoAP send queue.
+
+    otMessagePriorityBufferInfo mPriorities[OT_MESSAGE_NUM_PRIORITY_LEVELS]; ///< Buffer usage per priority level.
 } otBufferInfo;
 
 /**
@@ -370,6 +394,16 @@ otMessage *otMessageQueueGetNext(otMessageQueue *aQueue, const otMessage *aMessa
  */
 void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo);
 
+/**
+ * Reset the per-priority message buffer high-water marks and allocation failure counters.
+ *
+ * After reset, the high-water mark of each priority level is set to its current number of buffers in use.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ *
+ */
+void otMessageResetBufferInfo(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -51,6 +51,30 @@ extern "C" {
  *
  */
 
+/**
+ * This function pointer is called when a tasklet entry posted by `otTaskletsPostFromThread()` is run.
+ *
+ * @param[in]  aInstance  A pointer to the OpenThread instance.
+ * @param[in]  aContext   A pointer to application-specific context.
+ *
+ */
+typedef void (*otTaskletHandler)(otInstance *aInstance, void *aContext);
+
+/**
+ * This structure represents a tasklet entry which can be posted from any thread.
+ *
+ * The entry is owned by the caller and must remain valid until its handler is called. It can be embedded in a larger
+ * structure (e.g. a received frame) to hand over data to the OpenThread thread.
+ *
+ */
+typedef struct otTaskletEntry
+{
+    struct otTaskletEntry *mNext;     ///< Used internally by OpenThread.
+    otTaskletHandler       mHandler;  ///< The handler to call from the OpenThread thread.
+    void *                 mContext;  ///< A pointer to application-specific context passed to `mHandler`.
+    bool                   mIsPosted; ///< Used internally by OpenThread (MUST be initialized to false).
+} otTaskletEntry;
+
 /**
  * Run all queued OpenThread tasklets at the time this is called.
  *
@@ -78,6 +102,35 @@ bool otTaskletsArePending(otInstance *aInstance);
  */
 extern void otTaskletsSignalPending(otInstance *aInstance);
 
+/**
+ * Post a tasklet entry from any thread.
+ *
+ * This function is thread-safe and lock-free. It may be called from threads other than the one running the OpenThread
+ * stack. The handler of @p aEntry is called from `otTaskletsProcess()`, in the order the entries were posted, before
+ * the other queued tasklets. The handler may post the entry again.
+ *
+ * This function is available when `OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE` is enabled.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aEntry     A pointer to the tasklet entry to post.
+ *
+ * @retval OT_ERROR_NONE     Successfully posted the entry.
+ * @retval OT_ERROR_ALREADY  The entry is already posted and its handler has not been called yet.
+ *
+ */
+otError otTaskletsPostFromThread(otInstance *aInstance, otTaskletEntry *aEntry);
+
+/**
+ * OpenThread calls this function when a tasklet entry is posted by `otTaskletsPostFromThread()` to an empty queue.
+ *
+ * This function may be called from any thread and MUST be thread-safe. It should wake up the thread running the
+ * OpenThread stack so that `otTaskletsProcess()` is called.
+ *
+ * @param[in] aInstance A pointer to an OpenThread instance.
+ *
+ */
+extern void otTaskletsSignalPendingFromThread(otInstance *aInstance);
+
 /**
  * @}
  *
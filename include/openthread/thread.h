@@ -35,6 +35,7 @@
 #ifndef OPENTHREAD_THREAD_H_
 #define OPENTHREAD_THREAD_H_
 
+#include <openthread/coap.h>
 #include <openthread/dataset.h>
 #include <openthread/link.h>
 #include <openthread/message.h>
@@ -152,6 +153,45 @@ typedef struct otIpCounters
     uint32_t mRxFailure; ///< The number of IPv6 packets failed to receive.
 } otIpCounters;
 
+/**
+ * This structure represents the 6LoWPAN reassembly counters.
+ *
+ */
+typedef struct otReassemblyCounters
+{
+    uint32_t mStarted;       ///< The number of datagrams whose reassembly was started.
+    uint32_t mCompleted;     ///< The number of datagrams successfully reassembled.
+    uint32_t mTimedOut;      ///< The number of datagrams dropped on reassembly timeout.
+    uint32_t mEvicted;       ///< The number of datagrams dropped to make room for another datagram.
+    uint32_t mSourceLimited; ///< The number of datagrams dropped due to the per-source reassembly limit.
+    uint32_t mUnmatched;     ///< The number of next fragments dropped with no matching datagram in reassembly.
+} otReassemblyCounters;
+
+/**
+ * This structure represents the 6LoWPAN fragment transmit counters (direct transmissions only).
+ *
+ */
+typedef struct otFragmentTxCounters
+{
+    uint32_t mTxFragments;      ///< The number of fragment frames transmitted (successfully or not).
+    uint32_t mTxFailures;       ///< The number of fragment frames that failed after all MAC transmit attempts.
+    uint32_t mTxPipelined;      ///< The number of fragment frames requested directly from the previous tx done.
+    uint32_t mDatagramsAborted; ///< The number of datagrams whose remaining fragments were dropped on a failure.
+} otFragmentTxCounters;
+
+/**
+ * This structure represents the key ring counters.
+ *
+ * The key ring holds the MAC and MLE keys of the previous, current and next key sequence.
+ *
+ */
+typedef struct otKeyRingCounters
+{
+    uint32_t mHits;      ///< The number of previous or next key sequence key lookups served from the key ring.
+    uint32_t mMisses;    ///< The number of previous or next key sequence key lookups that computed the key.
+    uint32_t mRefreshes; ///< The number of key sequences whose keys were prepared in the background.
+} otKeyRingCounters;
+
 /**
  * This structure represents the Thread MLE counters.
  *
@@ -757,7 +797,27 @@ otError otThreadGetParentLastRssi(otInstance *aInstance, int8_t *aLastRssi);
 const otIpCounters *otThreadGetIp6Counters(otInstance *aInstance);
 
 /**
- * Reset the IPv6 counters.
+ * Get the 6LoWPAN reassembly counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the 6LoWPAN reassembly counters.
+ *
+ */
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance);
+
+/**
+ * Get the 6LoWPAN fragment transmit counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the 6LoWPAN fragment transmit counters.
+ *
+ */
+const otFragmentTxCounters *otThreadGetFragmentTxCounters(otInstance *aInstance);
+
+/**
+ * Reset the IPv6 counters, including the 6LoWPAN reassembly and fragment transmit counters.
  *
  * @param[in]  aInstance  A pointer to an OpenThread instance.
  *
@@ -775,13 +835,33 @@ void otThreadResetIp6Counters(otInstance *aInstance);
 const otMleCounters *otThreadGetMleCounters(otInstance *aInstance);
 
 /**
- * Reset the Thread MLE counters.
+ * Get the key ring counters.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the key ring counters.
+ *
+ */
+const otKeyRingCounters *otThreadGetKeyRingCounters(otInstance *aInstance);
+
+/**
+ * Reset the Thread MLE counters, including the key ring counters.
  *
  * @param[in]  aInstance  A pointer to an OpenThread instance.
  *
  */
 void otThreadResetMleCounters(otInstance *aInstance);
 
+/**
+ * Get the response cache counters of the Thread Management Framework (TMF) CoAP agent.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the TMF response cache counters.
+ *
+ */
+const otCoapResponseCacheCounters *otThreadGetTmfResponseCacheCounters(otInstance *aInstance);
+
 /**
  * This function pointer is called every time an MLE Parent Response message is received.
  *
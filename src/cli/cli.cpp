@@ -605,11 +605,22 @@ exit:
 
 otError Interpreter::ProcessBufferInfo(uint8_t aArgsLength, char *aArgs[])
 {
-    OT_UNUSED_VARIABLE(aArgsLength);
-    OT_UNUSED_VARIABLE(aArgs);
+    static const char *const kPriorityNames[] = {"low", "normal", "high", "net"};
 
+    otError      error = OT_ERROR_NONE;
     otBufferInfo bufferInfo;
 
+    static_assert(OT_ARRAY_LENGTH(kPriorityNames) == OT_MESSAGE_NUM_PRIORITY_LEVELS, "kPriorityNames is invalid");
+
+    if (aArgsLength == 1)
+    {
+        VerifyOrExit(strcmp(aArgs[0], "reset") == 0, error = OT_ERROR_INVALID_ARGS);
+        otMessageResetBufferInfo(mInstance);
+        ExitNow();
+    }
+
+    VerifyOrExit(aArgsLength == 0, error = OT_ERROR_INVALID_ARGS);
+
     otMessageGetBufferInfo(mInstance, &bufferInfo);
 
     OutputLine("total: %d", bufferInfo.mTotalBuffers);
@@ -624,7 +635,16 @@ otError Interpreter::ProcessBufferInfo(uint8_t aArgsLength, char *aArgs[])
     OutputLine("coap secure: %d %d", bufferInfo.mCoapSecureMessages, bufferInfo.mCoapSecureBuffers);
     OutputLine("application coap: %d %d", bufferInfo.mApplicationCoapMessages, bufferInfo.mApplicationCoapBuffers);
 
-    return OT_ERROR_NONE;
+    for (uint8_t priority = 0; priority < OT_MESSAGE_NUM_PRIORITY_LEVELS; priority++)
+    {
+        const otMessagePriorityBufferInfo &info = bufferInfo.mPriorities[priority];
+
+        OutputLine("priority %s: %d %d %d %d %u", kPriorityNames[priority], info.mInUseBuffers, info.mMaxInUseBuffers,
+                   info.mQuota, info.mReservedBuffers, info.mAllocFailures);
+    }
+
+exit:
+    return error;
 }
 
 otError Interpreter::ProcessCcaThreshold(uint8_t aArgsLength, char *aArgs[])
@@ -1159,9 +1179,44 @@ otError Interpreter::ProcessCounters(uint8_t aArgsLength, char *aArgs[])
 
     if (aArgsLength == 0)
     {
+        OutputLine("ip");
         OutputLine("mac");
         OutputLine("mle");
     }
+    else if (strcmp(aArgs[0], "ip") == 0)
+    {
+        if (aArgsLength == 1)
+        {
+            const otIpCounters *        ipCounters         = otThreadGetIp6Counters(mInstance);
+            const otReassemblyCounters *reassemblyCounters = otThreadGetReassemblyCounters(mInstance);
+            const otFragmentTxCounters *fragmentTxCounters = otThreadGetFragmentTxCounters(mInstance);
+
+            OutputLine("TxSuccess: %d", ipCounters->mTxSuccess);
+            OutputLine("TxFailed: %d", ipCounters->mTxFailure);
+            OutputLine("RxSuccess: %d", ipCounters->mRxSuccess);
+            OutputLine("RxFailed: %d", ipCounters->mRxFailure);
+            OutputLine("Reassembly:");
+            OutputLine(kIndentSize, "Started: %d", reassemblyCounters->mStarted);
+            OutputLine(kIndentSize, "Completed: %d", reassemblyCounters->mCompleted);
+            OutputLine(kIndentSize, "TimedOut: %d", reassemblyCounters->mTimedOut);
+            OutputLine(kIndentSize, "Evicted: %d", reassemblyCounters->mEvicted);
+            OutputLine(kIndentSize, "SourceLimited: %d", reassemblyCounters->mSourceLimited);
+            OutputLine(kIndentSize, "Unmatched: %d", reassemblyCounters->mUnmatched);
+            OutputLine("FragmentTx:");
+            OutputLine(kIndentSize, "Fragments: %d", fragmentTxCounters->mTxFragments);
+            OutputLine(kIndentSize, "Failures: %d", fragmentTxCounters->mTxFailures);
+            OutputLine(kIndentSize, "Pipelined: %d", fragmentTxCounters->mTxPipelined);
+            OutputLine(kIndentSize, "DatagramsAborted: %d", fragmentTxCounters->mDatagramsAborted);
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "reset") == 0))
+        {
+            otThreadResetIp6Counters(mInstance);
+        }
+        else
+        {
+            ExitNow(error = OT_ERROR_INVALID_ARGS);
+        }
+    }
     else if (strcmp(aArgs[0], "mac") == 0)
     {
         if (aArgsLength == 1)
@@ -1213,7 +1268,8 @@ otError Interpreter::ProcessCounters(uint8_t aArgsLength, char *aArgs[])
     {
         if (aArgsLength == 1)
         {
-            const otMleCounters *mleCounters = otThreadGetMleCounters(mInstance);
+            const otMleCounters *    mleCounters     = otThreadGetMleCounters(mInstance);
+            const otKeyRingCounters *keyRingCounters = otThreadGetKeyRingCounters(mInstance);
 
             OutputLine("Role Disabled: %d", mleCounters->mDisabledRole);
             OutputLine("Role Detached: %d", mleCounters->mDetachedRole);
@@ -1224,6 +1280,9 @@ otError Interpreter::ProcessCounters(uint8_t aArgsLength, char *aArgs[])
             OutputLine("Partition Id Changes: %d", mleCounters->mPartitionIdChanges);
             OutputLine("Better Partition Attach Attempts: %d", mleCounters->mBetterPartitionAttachAttempts);
             OutputLine("Parent Changes: %d", mleCounters->mParentChanges);
+            OutputLine("Key Ring Hits: %d", keyRingCounters->mHits);
+            OutputLine("Key Ring Misses: %d", keyRingCounters->mMisses);
+            OutputLine("Key Ring Refreshes: %d", keyRingCounters->mRefreshes);
         }
         else if ((aArgsLength == 2) && (strcmp(aArgs[1], "reset") == 0))
         {
@@ -4438,6 +4497,12 @@ otError Interpreter::ProcessMac(uint8_t aArgsLength, char *aArgs[])
     {
         error = ProcessMacRetries(aArgsLength - 1, aArgs + 1);
     }
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+    else if (strcmp(aArgs[0], "adaptive") == 0)
+    {
+        error = ProcessMacAdaptive(aArgsLength - 1, aArgs + 1);
+    }
+#endif
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     else if (strcmp(aArgs[0], "send") == 0)
     {
@@ -4453,6 +4518,51 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+otError Interpreter::ProcessMacAdaptive(uint8_t aArgsLength, char *aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aArgsLength == 0)
+    {
+        OutputLine(otLinkIsAdaptiveTxPolicyEnabled(mInstance) ? "Enabled" : "Disabled");
+    }
+    else if (strcmp(aArgs[0], "enable") == 0)
+    {
+        otLinkSetAdaptiveTxPolicyEnabled(mInstance, true);
+    }
+    else if (strcmp(aArgs[0], "disable") == 0)
+    {
+        otLinkSetAdaptiveTxPolicyEnabled(mInstance, false);
+    }
+    else if (strcmp(aArgs[0], "counters") == 0)
+    {
+        if (aArgsLength == 1)
+        {
+            const otLinkAdaptiveTxCounters *counters = otLinkGetAdaptiveTxCounters(mInstance);
+
+            OutputLine("BackoffRaised: %u", counters->mBackoffRaised);
+            OutputLine("RetriesLimited: %u", counters->mRetriesLimited);
+            OutputLine("RetriesRemoved: %u", counters->mRetriesRemoved);
+        }
+        else if ((aArgsLength == 2) && (strcmp(aArgs[1], "reset") == 0))
+        {
+            otLinkResetAdaptiveTxCounters(mInstance);
+        }
+        else
+        {
+            error = OT_ERROR_INVALID_ARGS;
+        }
+    }
+    else
+    {
+        error = OT_ERROR_INVALID_ARGS;
+    }
+
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+
 otError Interpreter::ProcessMacRetries(uint8_t aArgsLength, char *aArgs[])
 {
     otError error = OT_ERROR_NONE;
@@ -515,6 +515,9 @@ private:
     otError ProcessMacFilterRss(uint8_t aArgsLength, char *aArgs[]);
 #endif
     otError ProcessMac(uint8_t aArgsLength, char *aArgs[]);
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+    otError ProcessMacAdaptive(uint8_t aArgsLength, char *aArgs[]);
+#endif
     otError ProcessMacRetries(uint8_t aArgsLength, char *aArgs[]);
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
     otError ProcessMacSend(uint8_t aArgsLength, char *aArgs[]);
@@ -317,6 +317,13 @@ void otCoapSetDefaultHandler(otInstance *aInstance, otCoapRequestHandler aHandle
     instance.GetApplicationCoap().SetDefaultHandler(aHandler, aContext);
 }
 
+const otCoapResponseCacheCounters *otCoapGetResponseCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.GetApplicationCoap().GetResponseCacheCounters();
+}
+
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 otError otCoapSendResponseBlockWiseWithParameters(otInstance *                aInstance,
                                                   otMessage *                 aMessage,
@@ -482,6 +482,36 @@ uint16_t otLinkGetCcaFailureRate(otInstance *aInstance)
     return instance.Get<Mac::Mac>().GetCcaFailureRate();
 }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+void otLinkSetAdaptiveTxPolicyEnabled(otInstance *aInstance, bool aEnabled)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Mac::Mac>().SetAdaptiveTxPolicyEnabled(aEnabled);
+}
+
+bool otLinkIsAdaptiveTxPolicyEnabled(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<Mac::Mac>().IsAdaptiveTxPolicyEnabled();
+}
+
+const otLinkAdaptiveTxCounters *otLinkGetAdaptiveTxCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<Mac::Mac>().GetAdaptiveTxCounters();
+}
+
+void otLinkResetAdaptiveTxCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<Mac::Mac>().ResetAdaptiveTxCounters();
+}
+#endif // OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
 uint8_t otLinkCslGetChannel(otInstance *aInstance)
 {
@@ -178,6 +178,12 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
 
     aBufferInfo->mFreeBuffers = instance.Get<MessagePool>().GetFreeBufferCount();
 
+    for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+    {
+        instance.Get<MessagePool>().GetPriorityBufferInfo(static_cast<Message::Priority>(priority),
+                                                          aBufferInfo->mPriorities[priority]);
+    }
+
     instance.Get<MeshForwarder>().GetSendQueue().GetInfo(aBufferInfo->m6loSendMessages, aBufferInfo->m6loSendBuffers);
 
     instance.Get<MeshForwarder>().GetReassemblyQueue().GetInfo(aBufferInfo->m6loReassemblyMessages,
@@ -228,4 +234,11 @@ void otMessageGetBufferInfo(otInstance *aInstance, otBufferInfo *aBufferInfo)
     aBufferInfo->mApplicationCoapBuffers  = 0;
 #endif
 }
+
+void otMessageResetBufferInfo(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    instance.Get<MessagePool>().ResetPriorityBufferInfo();
+}
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
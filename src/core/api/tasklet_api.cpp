@@ -68,3 +68,16 @@ exit:
 OT_TOOL_WEAK void otTaskletsSignalPending(otInstance *)
 {
 }
+
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+otError otTaskletsPostFromThread(otInstance *aInstance, otTaskletEntry *aEntry)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return instance.Get<TaskletScheduler>().PostFromThread(*aEntry);
+}
+
+OT_TOOL_WEAK void otTaskletsSignalPendingFromThread(otInstance *)
+{
+}
+#endif
@@ -486,6 +486,20 @@ const otIpCounters *otThreadGetIp6Counters(otInstance *aInstance)
     return &instance.Get<MeshForwarder>().GetCounters();
 }
 
+const otReassemblyCounters *otThreadGetReassemblyCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<MeshForwarder>().GetReassemblyCounters();
+}
+
+const otFragmentTxCounters *otThreadGetFragmentTxCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<MeshForwarder>().GetFragmentTxCounters();
+}
+
 void otThreadResetIp6Counters(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
@@ -500,11 +514,26 @@ const otMleCounters *otThreadGetMleCounters(otInstance *aInstance)
     return &instance.Get<Mle::MleRouter>().GetCounters();
 }
 
+const otKeyRingCounters *otThreadGetKeyRingCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<KeyManager>().GetKeyRingCounters();
+}
+
+const otCoapResponseCacheCounters *otThreadGetTmfResponseCacheCounters(otInstance *aInstance)
+{
+    Instance &instance = *static_cast<Instance *>(aInstance);
+
+    return &instance.Get<Tmf::TmfAgent>().GetResponseCacheCounters();
+}
+
 void otThreadResetMleCounters(otInstance *aInstance)
 {
     Instance &instance = *static_cast<Instance *>(aInstance);
 
     instance.Get<Mle::MleRouter>().ResetCounters();
+    instance.Get<KeyManager>().ResetKeyRingCounters();
 }
 
 void otThreadRegisterParentResponseCallback(otInstance *                   aInstance,
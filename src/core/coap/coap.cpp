@@ -30,6 +30,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
+#include "common/hash.hpp"
 #include "common/instance.hpp"
 #include "common/locator-getters.hpp"
 #include "common/logging.hpp"
@@ -48,8 +49,13 @@ namespace Coap {
 
 CoapBase::CoapBase(Instance &aInstance, Sender aSender)
     : InstanceLocator(aInstance)
+    , mTokenBuckets()
+    , mMessageIdBuckets()
+    , mDeadlineHeapSize(0)
+    , mNumUnindexedRequests(0)
     , mMessageId(Random::NonCrypto::GetUint16())
     , mRetransmissionTimer(aInstance, Coap::HandleRetransmissionTimer, this)
+    , mResourceIndex()
     , mContext(nullptr)
     , mInterceptor(nullptr)
     , mResponsesQueue(aInstance)
@@ -82,7 +88,7 @@ void CoapBase::ClearRequests(const Ip6::Address *aAddress)
         Metadata metadata;
 
         nextMessage = message->GetNextCoapMessage();
-        metadata.ReadFrom(*message);
+        ReadMetadata(*message, metadata);
 
         if ((aAddress == nullptr) || (metadata.mSourceAddress == *aAddress))
         {
@@ -107,12 +113,55 @@ void CoapBase::RemoveBlockWiseResource(ResourceBlockWise &aResource)
 void CoapBase::AddResource(Resource &aResource)
 {
     IgnoreError(mResources.Add(aResource));
+    RebuildResourceIndex();
 }
 
 void CoapBase::RemoveResource(Resource &aResource)
 {
     IgnoreError(mResources.Remove(aResource));
     aResource.SetNext(nullptr);
+    RebuildResourceIndex();
+}
+
+void CoapBase::SetResourceIndex(const Resource **aSlots, uint16_t aNumSlots)
+{
+    mResourceIndex.Init(aSlots, aNumSlots);
+    RebuildResourceIndex();
+}
+
+uint32_t CoapBase::HashUriPath(const char *aUriPath)
+{
+    Fnv1aHash hash;
+
+    hash.UpdateString(aUriPath);
+
+    return hash.GetHash();
+}
+
+void CoapBase::RebuildResourceIndex(void)
+{
+    mResourceIndex.Clear();
+
+    for (const Resource *resource = mResources.GetHead(); resource != nullptr; resource = resource->GetNext())
+    {
+        mResourceIndex.Add(*resource, HashUriPath(resource->mUriPath));
+    }
+}
+
+const Resource *CoapBase::FindResource(const char *aUriPath, uint32_t aUriPathHash) const
+{
+    const Resource *resource;
+
+    if (mResourceIndex.IsUsable())
+    {
+        resource = mResourceIndex.FindMatching(aUriPathHash, aUriPath);
+    }
+    else
+    {
+        resource = mResources.FindMatching(aUriPath);
+    }
+
+    return resource;
 }
 
 void CoapBase::SetDefaultHandler(RequestHandler aHandler, void *aContext)
@@ -414,80 +463,137 @@ void CoapBase::HandleRetransmissionTimer(Timer &aTimer)
 
 void CoapBase::HandleRetransmissionTimer(void)
 {
-    TimeMilli        now      = TimerMilli::GetNow();
-    TimeMilli        nextTime = now.GetDistantFuture();
-    Metadata         metadata;
-    Message *        nextMessage;
-    Ip6::MessageInfo messageInfo;
+    TimeMilli now      = TimerMilli::GetNow();
+    TimeMilli nextTime = now.GetDistantFuture();
+    Message * nextMessage;
+    Metadata  metadata;
 
-    for (Message *message = mPendingRequests.GetHead(); message != nullptr; message = nextMessage)
+    // Only the requests whose deadline has passed are visited, in
+    // deadline order, from the top of the deadline heap.
+
+    while ((mDeadlineHeapSize > 0) && (now >= mDeadlineHeap[0]->mMetadata.mNextTimerShot))
+    {
+        PendingRequest &request = *mDeadlineHeap[0];
+
+#if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
+        if (request.mMessage->IsRequest() && request.mMetadata.mObserve && request.mMetadata.mAcknowledged)
+        {
+            // This is a RFC7641 subscription.  Do not time out.
+            RemoveFromDeadlineHeap(request);
+            continue;
+        }
+#endif
+
+        if (HandleRequestDeadline(*request.mMessage, request.mMetadata, now))
+        {
+            MoveDownInDeadlineHeap(0);
+        }
+    }
+
+    if (mDeadlineHeapSize > 0)
+    {
+        nextTime = mDeadlineHeap[0]->mMetadata.mNextTimerShot;
+    }
+
+    // Requests stored without a pending request entry are checked one
+    // by one.
+
+    for (Message *message = (mNumUnindexedRequests > 0) ? mPendingRequests.GetHead() : nullptr; message != nullptr;
+         message          = nextMessage)
     {
         nextMessage = message->GetNextCoapMessage();
 
+        if (FindPendingRequest(*message) != nullptr)
+        {
+            continue;
+        }
+
         metadata.ReadFrom(*message);
 
-        if (now >= metadata.mNextTimerShot)
-        {
 #if OPENTHREAD_CONFIG_COAP_OBSERVE_API_ENABLE
-            if (message->IsRequest() && metadata.mObserve && metadata.mAcknowledged)
-            {
-                // This is a RFC7641 subscription.  Do not time out.
-                continue;
-            }
+        if (message->IsRequest() && metadata.mObserve && metadata.mAcknowledged)
+        {
+            // This is a RFC7641 subscription.  Do not time out.
+            continue;
+        }
 #endif
 
-            if (!metadata.mConfirmable || (metadata.mRetransmissionsRemaining == 0))
+        if (now >= metadata.mNextTimerShot)
+        {
+            if (!HandleRequestDeadline(*message, metadata, now))
             {
-                // No expected response or acknowledgment.
-                FinalizeCoapTransaction(*message, metadata, nullptr, nullptr, OT_ERROR_RESPONSE_TIMEOUT);
                 continue;
             }
 
-            // Increment retransmission counter and timer.
-            metadata.mRetransmissionsRemaining--;
-            metadata.mRetransmissionTimeout *= 2;
-            metadata.mNextTimerShot = now + metadata.mRetransmissionTimeout;
             metadata.UpdateIn(*message);
-
-            // Retransmit
-            if (!metadata.mAcknowledged)
-            {
-                messageInfo.SetPeerAddr(metadata.mDestinationAddress);
-                messageInfo.SetPeerPort(metadata.mDestinationPort);
-                messageInfo.SetSockAddr(metadata.mSourceAddress);
-#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-                messageInfo.SetHopLimit(metadata.mHopLimit);
-                messageInfo.SetIsHostInterface(metadata.mIsHostInterface);
-#endif
-                messageInfo.SetMulticastLoop(metadata.mMulticastLoop);
-
-                SendCopy(*message, messageInfo);
-            }
         }
 
-        if (nextTime > metadata.mNextTimerShot)
+        if (metadata.mNextTimerShot < nextTime)
         {
             nextTime = metadata.mNextTimerShot;
         }
     }
 
-    if (nextTime < now.GetDistantFuture())
+    if (nextTime != now.GetDistantFuture())
     {
         mRetransmissionTimer.FireAt(nextTime);
     }
 }
 
+bool CoapBase::HandleRequestDeadline(Message &aRequest, Metadata &aMetadata, TimeMilli aNow)
+{
+    bool             isPending = false;
+    Ip6::MessageInfo messageInfo;
+
+    if (!aMetadata.mConfirmable || (aMetadata.mRetransmissionsRemaining == 0))
+    {
+        // No expected response or acknowledgment.
+        FinalizeCoapTransaction(aRequest, aMetadata, nullptr, nullptr, OT_ERROR_RESPONSE_TIMEOUT);
+        ExitNow();
+    }
+
+    isPending = true;
+
+    // Increment retransmission counter and timer.
+    aMetadata.mRetransmissionsRemaining--;
+    aMetadata.mRetransmissionTimeout *= 2;
+    aMetadata.mNextTimerShot = aNow + aMetadata.mRetransmissionTimeout;
+
+    // Retransmit
+    if (!aMetadata.mAcknowledged)
+    {
+        messageInfo.SetPeerAddr(aMetadata.mDestinationAddress);
+        messageInfo.SetPeerPort(aMetadata.mDestinationPort);
+        messageInfo.SetSockAddr(aMetadata.mSourceAddress);
+#if OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+        messageInfo.SetHopLimit(aMetadata.mHopLimit);
+        messageInfo.SetIsHostInterface(aMetadata.mIsHostInterface);
+#endif
+        messageInfo.SetMulticastLoop(aMetadata.mMulticastLoop);
+
+        SendCopy(aRequest, messageInfo);
+    }
+
+exit:
+    return isPending;
+}
+
 void CoapBase::FinalizeCoapTransaction(Message &               aRequest,
                                        const Metadata &        aMetadata,
                                        Message *               aResponse,
                                        const Ip6::MessageInfo *aMessageInfo,
                                        otError                 aResult)
 {
+    // `aMetadata` may belong to the pending request entry released
+    // by `DequeueMessage()`, so the handler is read out first.
+    ResponseHandler handler = aMetadata.mResponseHandler;
+    void *          context = aMetadata.mResponseContext;
+
     DequeueMessage(aRequest);
 
-    if (aMetadata.mResponseHandler != nullptr)
+    if (handler != nullptr)
     {
-        aMetadata.mResponseHandler(aMetadata.mResponseContext, aResponse, aMessageInfo, aResult);
+        handler(context, aResponse, aMessageInfo, aResult);
     }
 }
 
@@ -500,7 +606,7 @@ otError CoapBase::AbortTransaction(ResponseHandler aHandler, void *aContext)
     for (Message *message = mPendingRequests.GetHead(); message != nullptr; message = nextMessage)
     {
         nextMessage = message->GetNextCoapMessage();
-        metadata.ReadFrom(*message);
+        ReadMetadata(*message, metadata);
 
         if (metadata.mResponseHandler == aHandler && metadata.mResponseContext == aContext)
         {
@@ -514,27 +620,59 @@ otError CoapBase::AbortTransaction(ResponseHandler aHandler, void *aContext)
 
 Message *CoapBase::CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, const Metadata &aMetadata)
 {
-    otError  error       = OT_ERROR_NONE;
-    Message *messageCopy = nullptr;
+    Message *       messageCopy = nullptr;
+    PendingRequest *request;
+
+    VerifyOrExit((messageCopy = aMessage.Clone(aCopyLength)) != nullptr);
 
-    VerifyOrExit((messageCopy = aMessage.Clone(aCopyLength)) != nullptr, error = OT_ERROR_NO_BUFS);
+    request = mPendingRequestPool.Allocate();
+
+    if (request != nullptr)
+    {
+        request->mMessage  = messageCopy;
+        request->mMetadata = aMetadata;
+        AddToIndex(*request);
+        AddToDeadlineHeap(*request);
+    }
+    else
+    {
+        // All pending request entries are in use, so the metadata is
+        // kept at the end of the stored copy.
+        if (aMetadata.AppendTo(*messageCopy) != OT_ERROR_NONE)
+        {
+            messageCopy->Free();
+            ExitNow(messageCopy = nullptr);
+        }
 
-    SuccessOrExit(error = aMetadata.AppendTo(*messageCopy));
+        mNumUnindexedRequests++;
+    }
 
     mRetransmissionTimer.FireAtIfEarlier(aMetadata.mNextTimerShot);
 
     mPendingRequests.Enqueue(*messageCopy);
 
 exit:
-    FreeAndNullMessageOnError(messageCopy, error);
     return messageCopy;
 }
 
 void CoapBase::DequeueMessage(Message &aMessage)
 {
+    PendingRequest *request = FindPendingRequest(aMessage);
+
+    if (request != nullptr)
+    {
+        RemoveFromIndex(*request);
+        RemoveFromDeadlineHeap(*request);
+        mPendingRequestPool.Free(*request);
+    }
+    else
+    {
+        mNumUnindexedRequests--;
+    }
+
     mPendingRequests.Dequeue(aMessage);
 
-    if (mRetransmissionTimer.IsRunning() && (mPendingRequests.GetHead() == nullptr))
+    if (mRetransmissionTimer.IsRunning() && (mDeadlineHeapSize == 0) && (mNumUnindexedRequests == 0))
     {
         mRetransmissionTimer.Stop();
     }
@@ -545,6 +683,193 @@ void CoapBase::DequeueMessage(Message &aMessage)
     // the timer would just shoot earlier and then it'd be setup again.
 }
 
+void CoapBase::MarkAcknowledged(Message &aRequest)
+{
+    PendingRequest *request = FindPendingRequest(aRequest);
+
+    if (request != nullptr)
+    {
+        request->mMetadata.mAcknowledged = true;
+    }
+    else
+    {
+        Metadata metadata;
+
+        metadata.ReadFrom(aRequest);
+        metadata.mAcknowledged = true;
+        metadata.UpdateIn(aRequest);
+    }
+}
+
+void CoapBase::ReadMetadata(const Message &aRequest, Metadata &aMetadata)
+{
+    const PendingRequest *request = FindPendingRequest(aRequest);
+
+    if (request != nullptr)
+    {
+        aMetadata = request->mMetadata;
+    }
+    else
+    {
+        aMetadata.ReadFrom(aRequest);
+    }
+}
+
+uint16_t CoapBase::GetTokenBucket(const Message &aMessage)
+{
+    Fnv1aHash hash;
+
+    hash.Update(aMessage.GetToken(), aMessage.GetTokenLength());
+
+    return hash.GetBucket(kNumRequestBuckets);
+}
+
+CoapBase::PendingRequest *CoapBase::FindPendingRequest(const Message &aRequest)
+{
+    PendingRequest *request;
+
+    for (request = mMessageIdBuckets[GetMessageIdBucket(aRequest.GetMessageId())]; request != nullptr;
+         request = request->mNextByMessageId)
+    {
+        if (request->mMessage == &aRequest)
+        {
+            break;
+        }
+    }
+
+    return request;
+}
+
+void CoapBase::AddToIndex(PendingRequest &aRequest)
+{
+    PendingRequest **link;
+
+    // Entries are appended to the end of their buckets so that the
+    // oldest matching request is found first.
+
+    aRequest.mNextByToken     = nullptr;
+    aRequest.mNextByMessageId = nullptr;
+
+    for (link = &mTokenBuckets[GetTokenBucket(*aRequest.mMessage)]; *link != nullptr; link = &(*link)->mNextByToken)
+    {
+    }
+
+    *link = &aRequest;
+
+    for (link = &mMessageIdBuckets[GetMessageIdBucket(aRequest.mMessage->GetMessageId())]; *link != nullptr;
+         link = &(*link)->mNextByMessageId)
+    {
+    }
+
+    *link = &aRequest;
+}
+
+void CoapBase::RemoveFromIndex(PendingRequest &aRequest)
+{
+    PendingRequest **link;
+
+    for (link = &mTokenBuckets[GetTokenBucket(*aRequest.mMessage)]; *link != nullptr; link = &(*link)->mNextByToken)
+    {
+        if (*link == &aRequest)
+        {
+            *link = aRequest.mNextByToken;
+            break;
+        }
+    }
+
+    for (link = &mMessageIdBuckets[GetMessageIdBucket(aRequest.mMessage->GetMessageId())]; *link != nullptr;
+         link = &(*link)->mNextByMessageId)
+    {
+        if (*link == &aRequest)
+        {
+            *link = aRequest.mNextByMessageId;
+            break;
+        }
+    }
+}
+
+void CoapBase::AddToDeadlineHeap(PendingRequest &aRequest)
+{
+    OT_ASSERT(mDeadlineHeapSize < kMaxPendingRequests);
+
+    SetDeadlineHeapEntry(mDeadlineHeapSize++, aRequest);
+    MoveUpInDeadlineHeap(aRequest.mHeapIndex);
+}
+
+void CoapBase::RemoveFromDeadlineHeap(PendingRequest &aRequest)
+{
+    uint16_t index = aRequest.mHeapIndex;
+
+    VerifyOrExit(index != kNotInDeadlineHeap);
+
+    aRequest.mHeapIndex = kNotInDeadlineHeap;
+    mDeadlineHeapSize--;
+
+    // Move the last entry into the freed position and restore the
+    // heap order around it.
+
+    VerifyOrExit(index != mDeadlineHeapSize);
+
+    SetDeadlineHeapEntry(index, *mDeadlineHeap[mDeadlineHeapSize]);
+    MoveUpInDeadlineHeap(index);
+    MoveDownInDeadlineHeap(mDeadlineHeap[index]->mHeapIndex);
+
+exit:
+    return;
+}
+
+void CoapBase::MoveUpInDeadlineHeap(uint16_t aIndex)
+{
+    PendingRequest &request = *mDeadlineHeap[aIndex];
+
+    while (aIndex > 0)
+    {
+        uint16_t parent = (aIndex - 1) / 2;
+
+        if (mDeadlineHeap[parent]->mMetadata.mNextTimerShot <= request.mMetadata.mNextTimerShot)
+        {
+            break;
+        }
+
+        SetDeadlineHeapEntry(aIndex, *mDeadlineHeap[parent]);
+        aIndex = parent;
+    }
+
+    SetDeadlineHeapEntry(aIndex, request);
+}
+
+void CoapBase::MoveDownInDeadlineHeap(uint16_t aIndex)
+{
+    PendingRequest &request = *mDeadlineHeap[aIndex];
+
+    while (2 * aIndex + 1 < mDeadlineHeapSize)
+    {
+        uint16_t child = 2 * aIndex + 1;
+
+        if ((child + 1 < mDeadlineHeapSize) &&
+            (mDeadlineHeap[child + 1]->mMetadata.mNextTimerShot < mDeadlineHeap[child]->mMetadata.mNextTimerShot))
+        {
+            child++;
+        }
+
+        if (request.mMetadata.mNextTimerShot <= mDeadlineHeap[child]->mMetadata.mNextTimerShot)
+        {
+            break;
+        }
+
+        SetDeadlineHeapEntry(aIndex, *mDeadlineHeap[child]);
+        aIndex = child;
+    }
+
+    SetDeadlineHeapEntry(aIndex, request);
+}
+
+void CoapBase::SetDeadlineHeapEntry(uint16_t aIndex, PendingRequest &aRequest)
+{
+    mDeadlineHeap[aIndex] = &aRequest;
+    aRequest.mHeapIndex   = aIndex;
+}
+
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 void CoapBase::FreeLastBlockResponse(void)
 {
@@ -945,9 +1270,16 @@ void CoapBase::SendCopy(const Message &aMessage, const Ip6::MessageInfo &aMessag
 {
     otError  error;
     Message *messageCopy = nullptr;
+    uint16_t length      = aMessage.GetLength();
+
+    if (FindPendingRequest(aMessage) == nullptr)
+    {
+        // Leave out the metadata at the end of the stored copy.
+        length -= sizeof(Metadata);
+    }
 
     // Create a message copy for lower layers.
-    messageCopy = aMessage.Clone(aMessage.GetLength() - sizeof(Metadata));
+    messageCopy = aMessage.Clone(length);
     VerifyOrExit(messageCopy != nullptr, error = OT_ERROR_NO_BUFS);
 
     SuccessOrExit(error = Send(*messageCopy, aMessageInfo));
@@ -965,44 +1297,79 @@ Message *CoapBase::FindRelatedRequest(const Message &         aResponse,
                                       const Ip6::MessageInfo &aMessageInfo,
                                       Metadata &              aMetadata)
 {
-    Message *message;
+    PendingRequest *request = nullptr;
+    Message *       message = nullptr;
 
-    for (message = mPendingRequests.GetHead(); message != nullptr; message = message->GetNextCoapMessage())
-    {
-        aMetadata.ReadFrom(*message);
+    // With unindexed requests, an indexed match may be newer than an
+    // unindexed one, so all requests are searched in queue order to
+    // return the oldest match.
+
+    VerifyOrExit(mNumUnindexedRequests == 0, message = FindQueuedRelatedRequest(aResponse, aMessageInfo, aMetadata));
 
-        if (((aMetadata.mDestinationAddress == aMessageInfo.GetPeerAddr()) ||
-             aMetadata.mDestinationAddress.IsMulticast() ||
-             aMetadata.mDestinationAddress.GetIid().IsAnycastLocator()) &&
-            (aMetadata.mDestinationPort == aMessageInfo.GetPeerPort()))
+    switch (aResponse.GetType())
+    {
+    case kTypeReset:
+    case kTypeAck:
+        for (request = mMessageIdBuckets[GetMessageIdBucket(aResponse.GetMessageId())]; request != nullptr;
+             request = request->mNextByMessageId)
         {
-            switch (aResponse.GetType())
+            if ((aResponse.GetMessageId() == request->mMessage->GetMessageId()) &&
+                request->mMetadata.MatchesPeer(aMessageInfo))
             {
-            case kTypeReset:
-            case kTypeAck:
-                if (aResponse.GetMessageId() == message->GetMessageId())
-                {
-                    ExitNow();
-                }
-
                 break;
+            }
+        }
 
-            case kTypeConfirmable:
-            case kTypeNonConfirmable:
-                if (aResponse.IsTokenEqual(*message))
-                {
-                    ExitNow();
-                }
+        break;
 
+    case kTypeConfirmable:
+    case kTypeNonConfirmable:
+        for (request = mTokenBuckets[GetTokenBucket(aResponse)]; request != nullptr; request = request->mNextByToken)
+        {
+            if (aResponse.IsTokenEqual(*request->mMessage) && request->mMetadata.MatchesPeer(aMessageInfo))
+            {
                 break;
             }
         }
+
+        break;
     }
 
+    VerifyOrExit(request != nullptr);
+
+    aMetadata = request->mMetadata;
+    message   = request->mMessage;
+
 exit:
     return message;
 }
 
+Message *CoapBase::FindQueuedRelatedRequest(const Message &         aResponse,
+                                            const Ip6::MessageInfo &aMessageInfo,
+                                            Metadata &              aMetadata)
+{
+    Message *message;
+
+    for (message = mPendingRequests.GetHead(); message != nullptr; message = message->GetNextCoapMessage())
+    {
+        if (((aResponse.GetType() == kTypeReset) || (aResponse.GetType() == kTypeAck))
+                ? (aResponse.GetMessageId() != message->GetMessageId())
+                : !aResponse.IsTokenEqual(*message))
+        {
+            continue;
+        }
+
+        ReadMetadata(*message, aMetadata);
+
+        if (aMetadata.MatchesPeer(aMessageInfo))
+        {
+            break;
+        }
+    }
+
+    return message;
+}
+
 void CoapBase::Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
     Message &message = static_cast<Message &>(aMessage);
@@ -1087,8 +1454,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
                 // notification.
                 if (metadata.mConfirmable)
                 {
-                    metadata.mAcknowledged = true;
-                    metadata.UpdateIn(*request);
+                    MarkAcknowledged(*request);
                 }
 
                 // Remove the message if response is not expected, otherwise await
@@ -1112,8 +1478,7 @@ void CoapBase::ProcessReceivedResponse(Message &aMessage, const Ip6::MessageInfo
                 metadata.mResponseHandler(metadata.mResponseContext, &aMessage, &aMessageInfo, OT_ERROR_NONE);
 
                 // Consider the message acknowledged at this point.
-                metadata.mAcknowledged = true;
-                metadata.UpdateIn(*request);
+                MarkAcknowledged(*request);
             }
             else
 #endif
@@ -1248,9 +1613,11 @@ exit:
 
 void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
 {
-    char     uriPath[Message::kMaxReceivedUriPath + 1];
-    Message *cachedResponse = nullptr;
-    otError  error          = OT_ERROR_NOT_FOUND;
+    char            uriPath[Message::kMaxReceivedUriPath + 1];
+    Fnv1aHash       uriPathHash;
+    const Resource *matchedResource;
+    Message *       cachedResponse = nullptr;
+    otError         error          = OT_ERROR_NOT_FOUND;
 #if OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
     Option::Iterator iterator;
     char *           curUriPath         = uriPath;
@@ -1290,12 +1657,14 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
             if (curUriPath != uriPath)
             {
                 *curUriPath++ = '/';
+                uriPathHash.Update('/');
             }
 
             VerifyOrExit(curUriPath + iterator.GetOption()->GetLength() < OT_ARRAY_END(uriPath),
                          error = OT_ERROR_PARSE);
 
             IgnoreError(iterator.ReadOptionValue(curUriPath));
+            uriPathHash.Update(reinterpret_cast<const uint8_t *>(curUriPath), iterator.GetOption()->GetLength());
             curUriPath += iterator.GetOption()->GetLength();
             break;
 
@@ -1379,17 +1748,16 @@ void CoapBase::ProcessReceivedRequest(Message &aMessage, const Ip6::MessageInfo
         }
     }
 #else
-    SuccessOrExit(error = aMessage.ReadUriPathOptions(uriPath));
+    SuccessOrExit(error = aMessage.ReadUriPathOptions(uriPath, uriPathHash));
 #endif // OPENTHREAD_CONFIG_COAP_BLOCKWISE_TRANSFER_ENABLE
 
-    for (const Resource *resource = mResources.GetHead(); resource; resource = resource->GetNext())
+    matchedResource = FindResource(uriPath, uriPathHash.GetHash());
+
+    if (matchedResource != nullptr)
     {
-        if (strcmp(resource->mUriPath, uriPath) == 0)
-        {
-            resource->HandleRequest(aMessage, aMessageInfo);
-            error = OT_ERROR_NONE;
-            ExitNow();
-        }
+        matchedResource->HandleRequest(aMessage, aMessageInfo);
+        error = OT_ERROR_NONE;
+        ExitNow();
     }
 
     if (mDefaultHandler)
@@ -1426,167 +1794,305 @@ void CoapBase::Metadata::UpdateIn(Message &aMessage) const
     aMessage.Write(aMessage.GetLength() - sizeof(*this), *this);
 }
 
+bool CoapBase::Metadata::MatchesPeer(const Ip6::MessageInfo &aMessageInfo) const
+{
+    return ((mDestinationAddress == aMessageInfo.GetPeerAddr()) || mDestinationAddress.IsMulticast() ||
+            mDestinationAddress.GetIid().IsAnycastLocator()) &&
+           (mDestinationPort == aMessageInfo.GetPeerPort());
+}
+
 ResponsesQueue::ResponsesQueue(Instance &aInstance)
-    : mTimer(aInstance, ResponsesQueue::HandleTimer, this)
+    : mBuckets()
+    , mExpiryWheel()
+    , mLongLifetimeResponses(nullptr)
+    , mCounters()
+    , mTimer(aInstance, ResponsesQueue::HandleTimer, this)
 {
 }
 
+uint16_t ResponsesQueue::GetBucket(uint16_t aMessageId, const Ip6::Address &aPeerAddress, uint16_t aPeerPort)
+{
+    Fnv1aHash hash;
+
+    hash.UpdateUint16(aMessageId);
+    hash.UpdateUint16(aPeerPort);
+    hash.Update(aPeerAddress.mFields.m8, sizeof(aPeerAddress.mFields.m8));
+
+    return hash.GetBucket(kNumResponseBuckets);
+}
+
+uint16_t ResponsesQueue::GetExpirySlot(TimeMilli aTime)
+{
+    // A response is placed in the slot of the first tick at or after
+    // its dequeue time, so all responses in the slot of `now` or of a
+    // later tick have not expired before that tick.
+
+    return static_cast<uint16_t>(((aTime.GetValue() + (1u << kExpiryWheelTickShift) - 1) >> kExpiryWheelTickShift) %
+                                 kExpiryWheelSlots);
+}
+
 otError ResponsesQueue::GetMatchedResponseCopy(const Message &         aRequest,
                                                const Ip6::MessageInfo &aMessageInfo,
                                                Message **              aResponse)
 {
-    otError        error = OT_ERROR_NONE;
-    const Message *cacheResponse;
+    otError         error = OT_ERROR_NONE;
+    CachedResponse *cachedResponse;
+
+    cachedResponse = FindMatchedResponse(aRequest, aMessageInfo);
 
-    cacheResponse = FindMatchedResponse(aRequest, aMessageInfo);
-    VerifyOrExit(cacheResponse != nullptr, error = OT_ERROR_NOT_FOUND);
+    if (cachedResponse == nullptr)
+    {
+        mCounters.mMisses++;
+        ExitNow(error = OT_ERROR_NOT_FOUND);
+    }
 
-    *aResponse = cacheResponse->Clone(cacheResponse->GetLength() - sizeof(ResponseMetadata));
+    mCounters.mHits++;
+
+    *aResponse = cachedResponse->mMessage->Clone();
     VerifyOrExit(*aResponse != nullptr, error = OT_ERROR_NO_BUFS);
 
 exit:
     return error;
 }
 
-const Message *ResponsesQueue::FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const
+ResponsesQueue::CachedResponse *ResponsesQueue::FindMatchedResponse(const Message &         aRequest,
+                                                                    const Ip6::MessageInfo &aMessageInfo)
 {
-    Message *message;
+    uint16_t        messageId = aRequest.GetMessageId();
+    CachedResponse *response;
 
-    for (message = mQueue.GetHead(); message != nullptr; message = message->GetNextCoapMessage())
+    for (response = mBuckets[GetBucket(messageId, aMessageInfo.GetPeerAddr(), aMessageInfo.GetPeerPort())];
+         response != nullptr;
+         response = response->mNextInBucket)
     {
-        if (message->GetMessageId() == aRequest.GetMessageId())
+        if ((response->mMessageId == messageId) && (response->mPeerPort == aMessageInfo.GetPeerPort()) &&
+            (response->mPeerAddress == aMessageInfo.GetPeerAddr()))
         {
-            ResponseMetadata metadata;
+            break;
+        }
+    }
+
+    return response;
+}
+
+ResponsesQueue::CachedResponse *&ResponsesQueue::GetList(const CachedResponse &aResponse)
+{
+    return aResponse.mIsLongLifetime ? mLongLifetimeResponses : mExpiryWheel[GetExpirySlot(aResponse.mDequeueTime)];
+}
+
+ResponsesQueue::CachedResponse *ResponsesQueue::FindEarliestResponse(TimeMilli aNow) const
+{
+    // All responses in the wheel expire within `kMaxCacheLifetime`
+    // from `aNow`, so the first non-empty slot starting from the slot
+    // of `aNow` holds the earliest one of them. It is then compared to
+    // the responses on the long lifetime list.
 
-            metadata.ReadFrom(*message);
+    CachedResponse *earliest = nullptr;
+    uint16_t        slot     = GetExpirySlot(aNow);
 
-            if ((metadata.mMessageInfo.GetPeerPort() == aMessageInfo.GetPeerPort()) &&
-                (metadata.mMessageInfo.GetPeerAddr() == aMessageInfo.GetPeerAddr()))
+    for (uint16_t i = 0; (i < kExpiryWheelSlots) && (earliest == nullptr); i++)
+    {
+        for (CachedResponse *response = mExpiryWheel[slot]; response != nullptr; response = response->GetNext())
+        {
+            if ((earliest == nullptr) || (response->mDequeueTime < earliest->mDequeueTime))
             {
-                break;
+                earliest = response;
             }
         }
+
+        slot = (slot + 1) % kExpiryWheelSlots;
     }
 
-    return message;
+    for (CachedResponse *response = mLongLifetimeResponses; response != nullptr; response = response->GetNext())
+    {
+        if ((earliest == nullptr) || (response->mDequeueTime < earliest->mDequeueTime))
+        {
+            earliest = response;
+        }
+    }
+
+    return earliest;
 }
 
 void ResponsesQueue::EnqueueResponse(Message &               aMessage,
                                      const Ip6::MessageInfo &aMessageInfo,
                                      const TxParameters &    aTxParameters)
 {
+    TimeMilli        now      = TimerMilli::GetNow();
+    uint32_t         lifetime = aTxParameters.CalculateExchangeLifetime();
+    CachedResponse * response;
     Message *        responseCopy;
-    ResponseMetadata metadata;
-
-    metadata.mDequeueTime = TimerMilli::GetNow() + aTxParameters.CalculateExchangeLifetime();
-    metadata.mMessageInfo = aMessageInfo;
+    uint16_t         bucket;
+    CachedResponse **list;
 
     VerifyOrExit(FindMatchedResponse(aMessage, aMessageInfo) == nullptr);
 
-    UpdateQueue();
+    if ((response = mResponsePool.Allocate()) == nullptr)
+    {
+        if (mTimer.IsRunning() && (mTimer.GetFireTime() <= now))
+        {
+            // The timer has not yet been handled for the responses that
+            // already expired, so remove them first.
+
+            DequeueExpiredResponses(mTimer.GetFireTime(), now);
+            response = mResponsePool.Allocate();
+        }
+
+        if (response == nullptr)
+        {
+            // The cache is full with unexpired responses, so evict
+            // the one closest to expiring.
 
-    VerifyOrExit((responseCopy = aMessage.Clone()) != nullptr);
+            DequeueResponse(*FindEarliestResponse(now));
+            mCounters.mEvictions++;
 
-    VerifyOrExit(metadata.AppendTo(*responseCopy) == OT_ERROR_NONE, responseCopy->Free());
+            response = mResponsePool.Allocate();
+            OT_ASSERT(response != nullptr);
+        }
+    }
+
+    if ((responseCopy = aMessage.Clone()) == nullptr)
+    {
+        mResponsePool.Free(*response);
+        ExitNow();
+    }
+
+    response->mMessage        = responseCopy;
+    response->mDequeueTime    = now + lifetime;
+    response->mPeerAddress    = aMessageInfo.GetPeerAddr();
+    response->mPeerPort       = aMessageInfo.GetPeerPort();
+    response->mMessageId      = aMessage.GetMessageId();
+    response->mIsLongLifetime = (lifetime > kMaxCacheLifetime);
+
+    bucket                  = GetBucket(response->mMessageId, response->mPeerAddress, response->mPeerPort);
+    response->mNextInBucket = mBuckets[bucket];
+    mBuckets[bucket]        = response;
+
+    list            = &GetList(*response);
+    response->mPrev = nullptr;
+    response->mNext = *list;
+
+    if (response->mNext != nullptr)
+    {
+        response->mNext->mPrev = response;
+    }
+
+    *list = response;
 
     mQueue.Enqueue(*responseCopy);
 
-    mTimer.FireAtIfEarlier(metadata.mDequeueTime);
+    mTimer.FireAtIfEarlier(response->mDequeueTime);
 
 exit:
     return;
 }
 
-void ResponsesQueue::UpdateQueue(void)
+void ResponsesQueue::DequeueResponse(CachedResponse &aResponse)
 {
-    uint16_t  msgCount    = 0;
-    Message * earliestMsg = nullptr;
-    TimeMilli earliestDequeueTime(0);
-
-    // Check the number of messages in the queue and if number is at
-    // `kMaxCachedResponses` remove the one with earliest dequeue
-    // time.
+    CachedResponse **link;
 
-    for (Message *message = mQueue.GetHead(); message != nullptr; message = message->GetNextCoapMessage())
+    for (link = &mBuckets[GetBucket(aResponse.mMessageId, aResponse.mPeerAddress, aResponse.mPeerPort)];
+         *link != &aResponse; link = &(*link)->mNextInBucket)
     {
-        ResponseMetadata metadata;
-
-        metadata.ReadFrom(*message);
+    }
 
-        if ((earliestMsg == nullptr) || (metadata.mDequeueTime < earliestDequeueTime))
-        {
-            earliestMsg         = message;
-            earliestDequeueTime = metadata.mDequeueTime;
-        }
+    *link = aResponse.mNextInBucket;
 
-        msgCount++;
+    if (aResponse.mPrev == nullptr)
+    {
+        GetList(aResponse) = aResponse.mNext;
+    }
+    else
+    {
+        aResponse.mPrev->mNext = aResponse.mNext;
     }
 
-    if (msgCount >= kMaxCachedResponses)
+    if (aResponse.mNext != nullptr)
     {
-        DequeueResponse(*earliestMsg);
+        aResponse.mNext->mPrev = aResponse.mPrev;
     }
-}
 
-void ResponsesQueue::DequeueResponse(Message &aMessage)
-{
-    mQueue.Dequeue(aMessage);
-    aMessage.Free();
+    mQueue.Dequeue(*aResponse.mMessage);
+    aResponse.mMessage->Free();
+    mResponsePool.Free(aResponse);
 }
 
 void ResponsesQueue::DequeueAllResponses(void)
 {
-    Message *message;
+    for (CachedResponse *&head : mExpiryWheel)
+    {
+        while (head != nullptr)
+        {
+            DequeueResponse(*head);
+        }
+    }
 
-    while ((message = mQueue.GetHead()) != nullptr)
+    while (mLongLifetimeResponses != nullptr)
     {
-        DequeueResponse(*message);
+        DequeueResponse(*mLongLifetimeResponses);
     }
-}
 
-void ResponsesQueue::HandleTimer(Timer &aTimer)
-{
-    static_cast<ResponsesQueue *>(static_cast<TimerMilliContext &>(aTimer).GetContext())->HandleTimer();
+    mTimer.Stop();
 }
 
-void ResponsesQueue::HandleTimer(void)
+void ResponsesQueue::DequeueExpiredResponses(TimeMilli aFrom, TimeMilli aNow)
 {
-    TimeMilli now             = TimerMilli::GetNow();
-    TimeMilli nextDequeueTime = now.GetDistantFuture();
-    Message * nextMessage;
-
-    for (Message *message = mQueue.GetHead(); message != nullptr; message = nextMessage)
-    {
-        ResponseMetadata metadata;
+    // The timer always fires at the earliest dequeue time, so expired
+    // responses can only be in the slots from `aFrom` (the timer's fire
+    // time) up to `aNow`.
 
-        nextMessage = message->GetNextCoapMessage();
+    uint32_t        numSlots = OT_MIN(((aNow - aFrom) >> kExpiryWheelTickShift) + 2, kExpiryWheelSlots);
+    uint16_t        slot     = GetExpirySlot(aFrom);
+    CachedResponse *earliest;
 
-        metadata.ReadFrom(*message);
+    for (uint32_t i = 0; i < numSlots; i++)
+    {
+        CachedResponse *next;
 
-        if (now >= metadata.mDequeueTime)
+        for (CachedResponse *response = mExpiryWheel[slot]; response != nullptr; response = next)
         {
-            DequeueResponse(*message);
-            continue;
+            next = response->GetNext();
+
+            if (response->mDequeueTime <= aNow)
+            {
+                DequeueResponse(*response);
+            }
         }
 
-        if (metadata.mDequeueTime < nextDequeueTime)
+        slot = (slot + 1) % kExpiryWheelSlots;
+    }
+
+    for (CachedResponse *response = mLongLifetimeResponses, *next; response != nullptr; response = next)
+    {
+        next = response->GetNext();
+
+        if (response->mDequeueTime <= aNow)
         {
-            nextDequeueTime = metadata.mDequeueTime;
+            DequeueResponse(*response);
         }
     }
 
-    if (nextDequeueTime < now.GetDistantFuture())
+    mTimer.Stop();
+
+    if ((earliest = FindEarliestResponse(aNow)) != nullptr)
     {
-        mTimer.FireAt(nextDequeueTime);
+        mTimer.FireAt(earliest->mDequeueTime);
     }
 }
 
-void ResponsesQueue::ResponseMetadata::ReadFrom(const Message &aMessage)
+void ResponsesQueue::HandleTimer(Timer &aTimer)
 {
-    uint16_t length = aMessage.GetLength();
+    static_cast<ResponsesQueue *>(static_cast<TimerMilliContext &>(aTimer).GetContext())->HandleTimer();
+}
 
-    OT_ASSERT(length >= sizeof(*this));
-    IgnoreError(aMessage.Read(length - sizeof(*this), *this));
+void ResponsesQueue::HandleTimer(void)
+{
+    DequeueExpiredResponses(mTimer.GetFireTime(), TimerMilli::GetNow());
+}
+
+bool Resource::Matches(const char *aUriPath) const
+{
+    return strcmp(mUriPath, aUriPath) == 0;
 }
 
 /// Return product of @p aValueA and @p aValueB if no overflow otherwise 0.
@@ -35,10 +35,12 @@
 
 #include "coap/coap_message.hpp"
 #include "common/debug.hpp"
+#include "common/hash_index.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pool.hpp"
 #include "common/timer.hpp"
 #include "net/ip6.hpp"
 #include "net/netif.hpp"
@@ -169,6 +171,17 @@ public:
      */
     const char *GetUriPath(void) const { return mUriPath; }
 
+    /**
+     * This method indicates whether the resource matches a given URI path.
+     *
+     * @param[in]  aUriPath  A pointer to a null-terminated string for the URI path.
+     *
+     * @retval TRUE   The resource has the URI path @p aUriPath.
+     * @retval FALSE  The resource does not have the URI path @p aUriPath.
+     *
+     */
+    bool Matches(const char *aUriPath) const;
+
 protected:
     void HandleRequest(Message &aMessage, const Ip6::MessageInfo &aMessageInfo) const
     {
@@ -292,7 +305,8 @@ public:
      * If matching response (the same Message ID, source endpoint address and port) exists in the cache given
      * response is not added.
      *
-     * The CoAP response is copied before it is added to the cache.
+     * The CoAP response is copied before it is added to the cache. It is kept for the exchange lifetime of
+     * @p aTxParameters, but no longer than about 254 seconds.
      *
      * @param[in]  aMessage      The CoAP response to add to the cache.
      * @param[in]  aMessageInfo  The message info corresponding to @p aMessage.
@@ -329,30 +343,66 @@ public:
      */
     const MessageQueue &GetResponses(void) const { return mQueue; }
 
+    /**
+     * This method returns the response cache counters.
+     *
+     * @returns A reference to the response cache counters.
+     *
+     */
+    const otCoapResponseCacheCounters &GetCounters(void) const { return mCounters; }
+
 private:
     enum
     {
         kMaxCachedResponses = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES,
+        kNumResponseBuckets = kMaxCachedResponses, // Number of buckets in the (peer, message ID) hash index.
     };
 
-    struct ResponseMetadata
+    // The expiry wheel spans 32 ticks of 8.192 seconds. A power of two
+    // tick keeps the slot of a time stable across `TimeMilli` wrap.
+    // The wheel holds responses cached for at most 31 ticks (about 254
+    // seconds, more than the 247 seconds exchange lifetime of the
+    // default transmission parameters), so that a slot never holds
+    // responses from two turns of the wheel. Responses with a longer
+    // exchange lifetime are kept on a separate unsorted list.
+    enum : uint32_t
     {
-        otError AppendTo(Message &aMessage) const { return aMessage.Append(*this); }
-        void    ReadFrom(const Message &aMessage);
+        kExpiryWheelTickShift = 13,
+        kExpiryWheelSlots     = 32,
+        kMaxCacheLifetime     = (kExpiryWheelSlots - 1) << kExpiryWheelTickShift, // In milliseconds.
+    };
 
-        TimeMilli        mDequeueTime;
-        Ip6::MessageInfo mMessageInfo;
+    struct CachedResponse : public LinkedListEntry<CachedResponse>
+    {
+        CachedResponse *mNext;           // Next entry in the pool free list or in the same expiry list.
+        CachedResponse *mPrev;           // Previous entry in the same expiry list.
+        CachedResponse *mNextInBucket;   // Next entry in the same hash bucket.
+        Message *       mMessage;        // The cached response.
+        TimeMilli       mDequeueTime;    // Time when the response is removed from the cache.
+        Ip6::Address    mPeerAddress;    // IPv6 address of the requester.
+        uint16_t        mPeerPort;       // UDP port of the requester.
+        uint16_t        mMessageId;      // Message ID of the request and the response.
+        bool            mIsLongLifetime; // Whether the entry is on the long lifetime list instead of the wheel.
     };
 
-    const Message *FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo) const;
-    void           DequeueResponse(Message &aMessage);
-    void           UpdateQueue(void);
+    static uint16_t GetBucket(uint16_t aMessageId, const Ip6::Address &aPeerAddress, uint16_t aPeerPort);
+    static uint16_t GetExpirySlot(TimeMilli aTime);
+    CachedResponse *FindMatchedResponse(const Message &aRequest, const Ip6::MessageInfo &aMessageInfo);
+    CachedResponse *FindEarliestResponse(TimeMilli aNow) const;
+    CachedResponse *&GetList(const CachedResponse &aResponse);
+    void            DequeueResponse(CachedResponse &aResponse);
+    void            DequeueExpiredResponses(TimeMilli aFrom, TimeMilli aNow);
 
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
-    MessageQueue      mQueue;
-    TimerMilliContext mTimer;
+    MessageQueue                              mQueue;
+    Pool<CachedResponse, kMaxCachedResponses> mResponsePool;
+    CachedResponse *                          mBuckets[kNumResponseBuckets];
+    CachedResponse *                          mExpiryWheel[kExpiryWheelSlots];
+    CachedResponse *                          mLongLifetimeResponses;
+    otCoapResponseCacheCounters               mCounters;
+    TimerMilliContext                         mTimer;
 };
 
 /**
@@ -660,6 +710,14 @@ public:
      */
     const MessageQueue &GetCachedResponses(void) const { return mResponsesQueue.GetResponses(); }
 
+    /**
+     * This method returns the counters of the cached response list.
+     *
+     * @returns A reference to the response cache counters.
+     *
+     */
+    const otCoapResponseCacheCounters &GetResponseCacheCounters(void) const { return mResponsesQueue.GetCounters(); }
+
 protected:
     /**
      * This function pointer is called to send a CoAP message.
@@ -693,12 +751,34 @@ protected:
      */
     void Receive(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+    /**
+     * This method sets the slots of the URI path hash index used to find the resource of a received request.
+     *
+     * Without an index, the URI path of a received request is compared against every resource. Agents which register
+     * many resources provide an index.
+     *
+     * @param[in]  aSlots     A pointer to an array of slots, which MUST stay valid as long as the agent.
+     * @param[in]  aNumSlots  The number of slots in @p aSlots.
+     *
+     */
+    void SetResourceIndex(const Resource **aSlots, uint16_t aNumSlots);
+
 private:
+    enum
+    {
+        kMaxPendingRequests = OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS,
+        kNumRequestBuckets  = kMaxPendingRequests, // Number of buckets in each pending request hash index.
+        kNotInDeadlineHeap  = 0xffff,              // Heap index of a pending request not awaiting its deadline.
+    };
+
+    static_assert(kMaxPendingRequests < kNotInDeadlineHeap, "COAP_MAX_PENDING_REQUESTS is too large");
+
     struct Metadata
     {
         otError AppendTo(Message &aMessage) const { return aMessage.Append(*this); }
         void    ReadFrom(const Message &aMessage);
         void    UpdateIn(Message &aMessage) const;
+        bool    MatchesPeer(const Ip6::MessageInfo &aMessageInfo) const;
 
         Ip6::Address    mSourceAddress;            // IPv6 address of the message source.
         Ip6::Address    mDestinationAddress;       // IPv6 address of the message destination.
@@ -728,13 +808,51 @@ private:
 #endif
     };
 
+    // A pending request keeps the metadata of a stored request copy
+    // outside of the message, and links it into the token and the
+    // message ID hash indexes and into the retransmission deadline
+    // heap. When all entries are in use, the metadata is appended to
+    // the stored copy instead and the request is found by going
+    // through `mPendingRequests`.
+    struct PendingRequest : public LinkedListEntry<PendingRequest>
+    {
+        PendingRequest *mNext;            // Next entry in the pool free list.
+        PendingRequest *mNextByToken;     // Next entry in the same token hash bucket.
+        PendingRequest *mNextByMessageId; // Next entry in the same message ID hash bucket.
+        Message *       mMessage;         // The stored request copy.
+        uint16_t        mHeapIndex;       // Position in the deadline heap, or `kNotInDeadlineHeap`.
+        Metadata        mMetadata;        // The request metadata.
+    };
+
     static void HandleRetransmissionTimer(Timer &aTimer);
     void        HandleRetransmissionTimer(void);
 
+    static uint32_t HashUriPath(const char *aUriPath);
+    void            RebuildResourceIndex(void);
+    const Resource *FindResource(const char *aUriPath, uint32_t aUriPathHash) const;
+
     void     ClearRequests(const Ip6::Address *aAddress);
     Message *CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopyLength, const Metadata &aMetadata);
     void     DequeueMessage(Message &aMessage);
+    void     MarkAcknowledged(Message &aRequest);
+    void     ReadMetadata(const Message &aRequest, Metadata &aMetadata);
+    bool     HandleRequestDeadline(Message &aRequest, Metadata &aMetadata, TimeMilli aNow);
+
+    static uint16_t GetTokenBucket(const Message &aMessage);
+    static uint16_t GetMessageIdBucket(uint16_t aMessageId) { return aMessageId % kNumRequestBuckets; }
+    PendingRequest *FindPendingRequest(const Message &aRequest);
+    void            AddToIndex(PendingRequest &aRequest);
+    void            RemoveFromIndex(PendingRequest &aRequest);
+    void            AddToDeadlineHeap(PendingRequest &aRequest);
+    void            RemoveFromDeadlineHeap(PendingRequest &aRequest);
+    void            MoveUpInDeadlineHeap(uint16_t aIndex);
+    void            MoveDownInDeadlineHeap(uint16_t aIndex);
+    void            SetDeadlineHeapEntry(uint16_t aIndex, PendingRequest &aRequest);
+
     Message *FindRelatedRequest(const Message &aResponse, const Ip6::MessageInfo &aMessageInfo, Metadata &aMetadata);
+    Message *FindQueuedRelatedRequest(const Message &         aResponse,
+                                      const Ip6::MessageInfo &aMessageInfo,
+                                      Metadata &              aMetadata);
     void     FinalizeCoapTransaction(Message &               aRequest,
                                      const Metadata &        aMetadata,
                                      Message *               aResponse,
@@ -778,11 +896,18 @@ private:
 
     otError Send(ot::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
-    MessageQueue      mPendingRequests;
-    uint16_t          mMessageId;
-    TimerMilliContext mRetransmissionTimer;
+    MessageQueue                              mPendingRequests;
+    Pool<PendingRequest, kMaxPendingRequests> mPendingRequestPool;
+    PendingRequest *                          mTokenBuckets[kNumRequestBuckets];
+    PendingRequest *                          mMessageIdBuckets[kNumRequestBuckets];
+    PendingRequest *                          mDeadlineHeap[kMaxPendingRequests];
+    uint16_t                                  mDeadlineHeapSize;
+    uint16_t                                  mNumUnindexedRequests;
+    uint16_t                                  mMessageId;
+    TimerMilliContext                         mRetransmissionTimer;
 
     LinkedList<Resource> mResources;
+    HashIndex<const Resource> mResourceIndex;
 
     void *         mContext;
     Interceptor    mInterceptor;
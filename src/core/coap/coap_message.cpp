@@ -233,6 +233,13 @@ exit:
 }
 
 otError Message::ReadUriPathOptions(char (&aUriPath)[kMaxReceivedUriPath + 1]) const
+{
+    Fnv1aHash hash;
+
+    return ReadUriPathOptions(aUriPath, hash);
+}
+
+otError Message::ReadUriPathOptions(char (&aUriPath)[kMaxReceivedUriPath + 1], Fnv1aHash &aHash) const
 {
     char *           curUriPath = aUriPath;
     otError          error      = OT_ERROR_NONE;
@@ -247,11 +254,13 @@ otError Message::ReadUriPathOptions(char (&aUriPath)[kMaxReceivedUriPath + 1]) c
         if (curUriPath != aUriPath)
         {
             *curUriPath++ = '/';
+            aHash.Update('/');
         }
 
         VerifyOrExit(curUriPath + optionLength < OT_ARRAY_END(aUriPath), error = OT_ERROR_PARSE);
 
         IgnoreError(iterator.ReadOptionValue(curUriPath));
+        aHash.Update(reinterpret_cast<const uint8_t *>(curUriPath), optionLength);
         curUriPath += optionLength;
 
         SuccessOrExit(error = iterator.Advance(kOptionUriPath));
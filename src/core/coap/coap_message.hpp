@@ -41,6 +41,7 @@
 #include "common/clearable.hpp"
 #include "common/code_utils.hpp"
 #include "common/encoding.hpp"
+#include "common/hash.hpp"
 #include "common/message.hpp"
 #include "net/ip6_address.hpp"
 
@@ -495,6 +496,22 @@ public:
      */
     otError ReadUriPathOptions(char (&aUriPath)[kMaxReceivedUriPath + 1]) const;
 
+    /**
+     * This method reads the Uri-Path options, constructs the URI path in the buffer referenced by @p `aUriPath` and
+     * mixes the URI path into @p aHash as it is read.
+     *
+     * The resulting hash is the same as hashing the constructed URI path string after it is read.
+     *
+     * @param[in]    aUriPath  A reference to the buffer for storing URI path.
+     *                         NOTE: The buffer size must be `kMaxReceivedUriPath + 1`.
+     * @param[inout] aHash     A reference to the hash to mix the URI path into.
+     *
+     * @retval  OT_ERROR_NONE   Successfully read the Uri-Path options.
+     * @retval  OT_ERROR_PARSE  CoAP Option header not well-formed.
+     *
+     */
+    otError ReadUriPathOptions(char (&aUriPath)[kMaxReceivedUriPath + 1], Fnv1aHash &aHash) const;
+
     /**
      * This method appends a Block option
      *
@@ -36,10 +36,12 @@
 
 #include "openthread-core-config.h"
 
+#include "common/clearable.hpp"
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
 #include "common/equatable.hpp"
+#include "common/type_traits.hpp"
 
 namespace ot {
 
@@ -56,6 +58,10 @@ namespace ot {
 /**
  * This class represents a bit-vector.
  *
+ * When the bit-vector size is a multiple of four bytes, the bits are stored in 32-bit words, so that finding the set
+ * bits and counting them can be done a word at a time. Otherwise they are stored in bytes, so that a small bit-vector
+ * (e.g., a child mask with a few children) takes no more RAM than needed.
+ *
  * @tparam N  Specifies the number of bits.
  *
  */
@@ -74,7 +80,7 @@ public:
     bool Get(uint16_t aIndex) const
     {
         OT_ASSERT(aIndex < N);
-        return (mMask[aIndex / 8] & (0x80 >> (aIndex % 8))) != 0;
+        return (mMask[aIndex / kBitsPerWord] & BitFor(aIndex)) != 0;
     }
 
     /**
@@ -90,12 +96,12 @@ public:
 
         if (aValue)
         {
-            mMask[aIndex / 8] |= 0x80 >> (aIndex % 8);
+            mMask[aIndex / kBitsPerWord] |= BitFor(aIndex);
         }
         else
         {
-            mMask[aIndex / 8] &= ~(0x80 >> (aIndex % 8));
-        };
+            mMask[aIndex / kBitsPerWord] &= static_cast<Word>(~BitFor(aIndex));
+        }
     }
 
     /**
@@ -109,9 +115,9 @@ public:
     {
         bool rval = false;
 
-        for (uint8_t b : mMask)
+        for (Word word : mMask)
         {
-            if (b != 0)
+            if (word != 0)
             {
                 ExitNow(rval = true);
             }
@@ -121,8 +127,106 @@ public:
         return rval;
     }
 
+    /**
+     * This method returns the number of set indexes.
+     *
+     * @returns The number of set indexes.
+     *
+     */
+    uint16_t GetNumSet(void) const
+    {
+        uint16_t numSet = 0;
+
+        for (Word word : mMask)
+        {
+            numSet += CountBits(word);
+        }
+
+        return numSet;
+    }
+
+    /**
+     * This method finds the first set index at or after a given index.
+     *
+     * This method can be used to iterate over the set indexes as follows:
+     *
+     *     for (uint16_t index = 0; mask.FindNextSet(index); index++) { ... }
+     *
+     * @param[inout] aIndex  The index to start the search from. On success, it is updated to the set index found.
+     *
+     * @retval TRUE   A set index was found and @p aIndex was updated.
+     * @retval FALSE  There is no set index at or after @p aIndex.
+     *
+     */
+    bool FindNextSet(uint16_t &aIndex) const
+    {
+        bool     found = false;
+        uint16_t wordIndex;
+        Word     word;
+
+        VerifyOrExit(aIndex < N);
+
+        wordIndex = aIndex / kBitsPerWord;
+        word      = mMask[wordIndex] & static_cast<Word>(~(BitFor(aIndex) - 1));
+
+        while (word == 0)
+        {
+            VerifyOrExit(++wordIndex < kNumWords);
+            word = mMask[wordIndex];
+        }
+
+        aIndex = static_cast<uint16_t>(wordIndex * kBitsPerWord + CountTrailingZeros(word));
+        found  = true;
+
+    exit:
+        return found;
+    }
+
 private:
-    uint8_t mMask[BitVectorBytes(N)];
+    typedef typename TypeTraits::Conditional<(((N + 7) / 8) % sizeof(uint32_t) == 0), uint32_t, uint8_t>::Type Word;
+
+    enum : uint16_t
+    {
+        kBitsPerWord = sizeof(Word) * 8,
+        kNumWords    = (N + kBitsPerWord - 1) / kBitsPerWord,
+    };
+
+    static Word BitFor(uint16_t aIndex) { return static_cast<Word>(static_cast<Word>(1) << (aIndex % kBitsPerWord)); }
+
+    static uint8_t CountBits(uint32_t aWord)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<uint8_t>(__builtin_popcount(aWord));
+#else
+        uint8_t count = 0;
+
+        for (; aWord != 0; aWord &= (aWord - 1))
+        {
+            count++;
+        }
+
+        return count;
+#endif
+    }
+
+    static uint8_t CountTrailingZeros(uint32_t aWord)
+    {
+        // `aWord` must be non-zero.
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<uint8_t>(__builtin_ctz(aWord));
+#else
+        uint8_t count = 0;
+
+        for (; (aWord & 1) == 0; aWord >>= 1)
+        {
+            count++;
+        }
+
+        return count;
+#endif
+    }
+
+    Word mMask[kNumWords];
 };
 
 /**
@@ -0,0 +1,145 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for the hash function used by the hash indexes.
+ */
+
+#ifndef HASH_HPP_
+#define HASH_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+namespace ot {
+
+/**
+ * This class implements the 32-bit FNV-1a hash.
+ *
+ * The hash is computed incrementally by calling the `Update()` methods with the fields of a key, and is then mapped to
+ * a bucket or slot of a hash index using `GetBucket()`.
+ *
+ */
+class Fnv1aHash
+{
+public:
+    /**
+     * This constructor initializes the hash.
+     *
+     */
+    Fnv1aHash(void)
+        : mHash(kOffsetBasis)
+    {
+    }
+
+    /**
+     * This method mixes a byte into the hash.
+     *
+     * @param[in] aByte  The byte.
+     *
+     */
+    void Update(uint8_t aByte) { mHash = (mHash ^ aByte) * kPrime; }
+
+    /**
+     * This method mixes a buffer into the hash.
+     *
+     * @param[in] aBuffer  A pointer to the buffer.
+     * @param[in] aLength  The buffer length (number of bytes).
+     *
+     */
+    void Update(const uint8_t *aBuffer, uint16_t aLength)
+    {
+        for (; aLength > 0; aLength--)
+        {
+            Update(*aBuffer++);
+        }
+    }
+
+    /**
+     * This method mixes a `uint16_t` value into the hash (least significant byte first).
+     *
+     * @param[in] aValue  The value.
+     *
+     */
+    void UpdateUint16(uint16_t aValue)
+    {
+        Update(static_cast<uint8_t>(aValue & 0xff));
+        Update(static_cast<uint8_t>(aValue >> 8));
+    }
+
+    /**
+     * This method mixes the characters of a null-terminated string into the hash.
+     *
+     * @param[in] aString  A pointer to the string.
+     *
+     */
+    void UpdateString(const char *aString)
+    {
+        for (; *aString != '\0'; aString++)
+        {
+            Update(static_cast<uint8_t>(*aString));
+        }
+    }
+
+    /**
+     * This method returns the hash value.
+     *
+     * The upper half of the hash is folded into the lower half, so that the low order bits used to select a bucket
+     * depend on all bits of the key.
+     *
+     * @returns The hash value.
+     *
+     */
+    uint32_t GetHash(void) const { return mHash ^ (mHash >> 16); }
+
+    /**
+     * This method returns the bucket of a hash index selected by the hash value.
+     *
+     * @param[in] aNumBuckets  The number of buckets in the index.
+     *
+     * @returns The bucket index, in the range [0, @p aNumBuckets).
+     *
+     */
+    uint16_t GetBucket(uint16_t aNumBuckets) const { return static_cast<uint16_t>(GetHash() % aNumBuckets); }
+
+private:
+    enum : uint32_t
+    {
+        kOffsetBasis = 2166136261u,
+        kPrime       = 16777619u,
+    };
+
+    uint32_t mHash;
+};
+
+} // namespace ot
+
+#endif // HASH_HPP_
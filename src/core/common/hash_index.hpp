@@ -0,0 +1,182 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for a hash index over the entries of a list.
+ */
+
+#ifndef HASH_INDEX_HPP_
+#define HASH_INDEX_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/non_copyable.hpp"
+
+namespace ot {
+
+/**
+ * This template class implements a hash index over the entries of a list, using open addressing with linear probing.
+ *
+ * The index does not own its entries nor its slots. The owner provides the slots with `Init()`, and rebuilds the index
+ * by calling `Clear()` and then `Add()` for every entry of the list whenever the list changes. Entries added earlier
+ * are found first by `FindMatching()`, so adding the entries in list order makes a lookup return the same entry as a
+ * walk of the list would.
+ *
+ * At most three quarters of the slots are used, which keeps the probe sequences short. When more entries are added,
+ * the index is no longer usable (see `IsUsable()`) and the owner has to walk the list instead.
+ *
+ * @tparam Type  The entry type. It MUST provide a `bool Matches(const Indicator &)` method for the indicator types
+ *               passed to `FindMatching()`.
+ *
+ */
+template <typename Type> class HashIndex : private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes the index without any slots.
+     *
+     */
+    HashIndex(void)
+        : mSlots(nullptr)
+        , mNumSlots(0)
+        , mNumEntries(0)
+        , mOverflow(false)
+    {
+    }
+
+    /**
+     * This method sets the slots of the index and clears it.
+     *
+     * @param[in] aSlots     A pointer to an array of slots.
+     * @param[in] aNumSlots  The number of slots in @p aSlots.
+     *
+     */
+    void Init(Type **aSlots, uint16_t aNumSlots)
+    {
+        mSlots    = aSlots;
+        mNumSlots = aNumSlots;
+        Clear();
+    }
+
+    /**
+     * This method removes all entries from the index.
+     *
+     */
+    void Clear(void)
+    {
+        for (uint16_t slot = 0; slot < mNumSlots; slot++)
+        {
+            mSlots[slot] = nullptr;
+        }
+
+        mNumEntries = 0;
+        mOverflow   = false;
+    }
+
+    /**
+     * This method indicates whether the index can be used for lookups.
+     *
+     * @retval TRUE   The index has slots and holds every entry added since it was last cleared.
+     * @retval FALSE  The index has no slots, or more entries were added than it can hold.
+     *
+     */
+    bool IsUsable(void) const { return (mNumSlots > 0) && !mOverflow; }
+
+    /**
+     * This method adds an entry to the index.
+     *
+     * @param[in] aEntry  A reference to the entry.
+     * @param[in] aHash   The hash of the key of @p aEntry.
+     *
+     */
+    void Add(Type &aEntry, uint32_t aHash)
+    {
+        uint16_t slot;
+
+        if (mNumEntries >= (mNumSlots * 3) / 4)
+        {
+            mOverflow = true;
+        }
+
+        if (mOverflow)
+        {
+            return;
+        }
+
+        for (slot = GetSlot(aHash); mSlots[slot] != nullptr; slot = GetNextSlot(slot))
+        {
+        }
+
+        mSlots[slot] = &aEntry;
+        mNumEntries++;
+    }
+
+    /**
+     * This method finds the first entry added to the index that matches a given indicator.
+     *
+     * This method MUST only be used when `IsUsable()` returns TRUE.
+     *
+     * @param[in] aHash       The hash of the key of the entry.
+     * @param[in] aIndicator  The indicator passed to the `Matches()` method of the entries.
+     *
+     * @returns A pointer to the matching entry, or nullptr if none is found.
+     *
+     */
+    template <typename Indicator> Type *FindMatching(uint32_t aHash, const Indicator &aIndicator) const
+    {
+        Type *entry = nullptr;
+
+        for (uint16_t slot = GetSlot(aHash); mSlots[slot] != nullptr; slot = GetNextSlot(slot))
+        {
+            if (mSlots[slot]->Matches(aIndicator))
+            {
+                entry = mSlots[slot];
+                break;
+            }
+        }
+
+        return entry;
+    }
+
+private:
+    uint16_t GetSlot(uint32_t aHash) const { return static_cast<uint16_t>(aHash % mNumSlots); }
+    uint16_t GetNextSlot(uint16_t aSlot) const { return static_cast<uint16_t>((aSlot + 1) % mNumSlots); }
+
+    Type **  mSlots;
+    uint16_t mNumSlots;
+    uint16_t mNumEntries;
+    bool     mOverflow;
+};
+
+} // namespace ot
+
+#endif // HASH_INDEX_HPP_
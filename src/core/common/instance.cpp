@@ -59,7 +59,8 @@ otHeapCAllocFn ot::Instance::mCAlloc = nullptr;
 #endif // OPENTHREAD_MTD || OPENTHREAD_FTD
 
 Instance::Instance(void)
-    : mTimerMilliScheduler(*this)
+    : mTaskletScheduler(*this)
+    , mTimerMilliScheduler(*this)
 #if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
     , mTimerMicroScheduler(*this)
 #endif
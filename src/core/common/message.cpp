@@ -49,6 +49,27 @@
 
 namespace ot {
 
+static_assert(Message::kNumPriorities == OT_MESSAGE_NUM_PRIORITY_LEVELS, "OT_MESSAGE_NUM_PRIORITY_LEVELS is invalid");
+
+static_assert(OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_NORMAL + OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_HIGH +
+                      OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_NET <
+                  OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS,
+              "Message buffer reserves exceed OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS");
+
+const uint16_t MessagePool::kBufferQuotas[Message::kNumPriorities] = {
+    OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_LOW,
+    OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_NORMAL,
+    OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_HIGH,
+    OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_NET,
+};
+
+const uint16_t MessagePool::kBufferReserves[Message::kNumPriorities] = {
+    0,
+    OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_NORMAL,
+    OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_HIGH,
+    OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_NET,
+};
+
 MessagePool::MessagePool(Instance &aInstance)
     : InstanceLocator(aInstance)
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
@@ -58,13 +79,18 @@ MessagePool::MessagePool(Instance &aInstance)
 #if OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
     otPlatMessagePoolInit(&GetInstance(), kNumBuffers, sizeof(Buffer));
 #endif
+
+    memset(mInUseBuffers, 0, sizeof(mInUseBuffers));
+    memset(mMaxInUseBuffers, 0, sizeof(mMaxInUseBuffers));
+    memset(mAllocFailures, 0, sizeof(mAllocFailures));
 }
 
 Message *MessagePool::New(Message::Type aType, uint16_t aReserveHeader, Message::Priority aPriority)
 {
-    otError  error = OT_ERROR_NONE;
-    Message *message;
+    otError  error   = OT_ERROR_NONE;
+    Message *message = nullptr;
 
+    VerifyOrExit(static_cast<uint8_t>(aPriority) < Message::kNumPriorities);
     VerifyOrExit((message = static_cast<Message *>(NewBuffer(aPriority))) != nullptr);
 
     memset(message, 0, sizeof(*message));
@@ -73,7 +99,10 @@ Message *MessagePool::New(Message::Type aType, uint16_t aReserveHeader, Message:
     message->SetReserved(aReserveHeader);
     message->SetLinkSecurityEnabled(true);
 
-    SuccessOrExit(error = message->SetPriority(aPriority));
+    // The buffer is already accounted to `aPriority`, so the priority
+    // is set directly instead of through `Message::SetPriority()`.
+    message->GetMetadata().mPriority = aPriority;
+
     SuccessOrExit(error = message->SetLength(0));
 
 exit:
@@ -102,42 +131,54 @@ void MessagePool::Free(Message *aMessage)
 {
     OT_ASSERT(aMessage->Next() == nullptr && aMessage->Prev() == nullptr);
 
-    FreeBuffers(static_cast<Buffer *>(aMessage));
+    FreeBuffers(static_cast<Buffer *>(aMessage), aMessage->GetPriority());
 }
 
 Buffer *MessagePool::NewBuffer(Message::Priority aPriority)
 {
     Buffer *buffer = nullptr;
 
-    while ((
-#if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-               buffer = static_cast<Buffer *>(GetInstance().HeapCAlloc(sizeof(Buffer), 1))
-#elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
-               buffer = static_cast<Buffer *>(otPlatMessagePoolNew(&GetInstance()))
-#else
-               buffer = mBufferPool.Allocate()
-#endif
-                   ) == nullptr)
+    VerifyOrExit((kBufferQuotas[aPriority] == 0) || (mInUseBuffers[aPriority] < kBufferQuotas[aPriority]));
+
+    while (!CanAllocateBuffer(aPriority) || (buffer = AllocateBuffer()) == nullptr)
     {
         SuccessOrExit(ReclaimBuffers(aPriority));
     }
 
-#if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
-    mNumFreeBuffers--;
-#endif
-
     buffer->SetNextBuffer(nullptr);
+    AddBuffers(aPriority, 1);
 
 exit:
     if (buffer == nullptr)
     {
-        otLogInfoMem("No available message buffer");
+        mAllocFailures[aPriority]++;
+        otLogInfoMem("No available message buffer (priority %d)", aPriority);
+    }
+
+    return buffer;
+}
+
+Buffer *MessagePool::AllocateBuffer(void)
+{
+    Buffer *buffer;
+
+#if OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
+    buffer = static_cast<Buffer *>(GetInstance().HeapCAlloc(sizeof(Buffer), 1));
+#elif OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT
+    buffer = static_cast<Buffer *>(otPlatMessagePoolNew(&GetInstance()));
+#else
+    buffer = mBufferPool.Allocate();
+
+    if (buffer != nullptr)
+    {
+        mNumFreeBuffers--;
     }
+#endif
 
     return buffer;
 }
 
-void MessagePool::FreeBuffers(Buffer *aBuffer)
+void MessagePool::FreeBuffers(Buffer *aBuffer, Message::Priority aPriority)
 {
     while (aBuffer != nullptr)
     {
@@ -150,6 +191,7 @@ void MessagePool::FreeBuffers(Buffer *aBuffer)
         mBufferPool.Free(*aBuffer);
         mNumFreeBuffers++;
 #endif
+        RemoveBuffers(aPriority, 1);
         aBuffer = next;
     }
 }
@@ -159,6 +201,59 @@ otError MessagePool::ReclaimBuffers(Message::Priority aPriority)
     return Get<MeshForwarder>().EvictMessage(aPriority);
 }
 
+bool MessagePool::CanAllocateBuffer(Message::Priority aPriority) const
+{
+    uint16_t minFreeBuffers = GetMinFreeBufferCount(aPriority);
+
+    return (minFreeBuffers == 0) || (GetFreeBufferCount() > minFreeBuffers);
+}
+
+uint16_t MessagePool::GetMinFreeBufferCount(Message::Priority aPriority) const
+{
+    uint16_t count = 0;
+
+    // Buffers reserved for all the priority levels above `aPriority`
+    // cannot be taken by messages of `aPriority`.
+
+    for (uint8_t priority = aPriority + 1; priority < Message::kNumPriorities; priority++)
+    {
+        count += kBufferReserves[priority];
+    }
+
+    return count;
+}
+
+void MessagePool::AddBuffers(Message::Priority aPriority, uint16_t aCount)
+{
+    mInUseBuffers[aPriority] += aCount;
+
+    if (mInUseBuffers[aPriority] > mMaxInUseBuffers[aPriority])
+    {
+        mMaxInUseBuffers[aPriority] = mInUseBuffers[aPriority];
+    }
+}
+
+void MessagePool::RemoveBuffers(Message::Priority aPriority, uint16_t aCount)
+{
+    OT_ASSERT(mInUseBuffers[aPriority] >= aCount);
+    mInUseBuffers[aPriority] -= aCount;
+}
+
+void MessagePool::GetPriorityBufferInfo(Message::Priority aPriority, otMessagePriorityBufferInfo &aInfo) const
+{
+    aInfo.mInUseBuffers    = mInUseBuffers[aPriority];
+    aInfo.mMaxInUseBuffers = mMaxInUseBuffers[aPriority];
+    aInfo.mQuota           = kBufferQuotas[aPriority];
+    aInfo.mReservedBuffers = kBufferReserves[aPriority];
+    aInfo.mAllocFailures   = mAllocFailures[aPriority];
+}
+
+void MessagePool::ResetPriorityBufferInfo(void)
+{
+    memcpy(mMaxInUseBuffers, mInUseBuffers, sizeof(mMaxInUseBuffers));
+    memset(mAllocFailures, 0, sizeof(mAllocFailures));
+}
+
 uint16_t MessagePool::GetFreeBufferCount(void) const
 {
     uint16_t rval;
@@ -223,7 +318,7 @@ otError Message::ResizeMessage(uint16_t aLength)
     curBuffer  = curBuffer->GetNextBuffer();
     lastBuffer->SetNextBuffer(nullptr);
 
-    GetMessagePool()->FreeBuffers(curBuffer);
+    GetMessagePool()->FreeBuffers(curBuffer, GetPriority());
 
 exit:
     return error;
@@ -278,9 +373,9 @@ exit:
     return error;
 }
 
-uint8_t Message::GetBufferCount(void) const
+uint16_t Message::GetBufferCount(void) const
 {
-    uint8_t rval = 1;
+    uint16_t rval = 1;
 
     for (const Buffer *curBuffer = GetNextBuffer(); curBuffer; curBuffer = curBuffer->GetNextBuffer())
     {
@@ -334,9 +429,13 @@ otError Message::SetPriority(Priority aPriority)
     PriorityQueue *priorityQueue = nullptr;
 
     VerifyOrExit(priority < kNumPriorities, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(GetMetadata().mPriority != priority);
+    OT_ASSERT(!IsChildPending());
+
+    GetMessagePool()->RemoveBuffers(GetPriority(), GetBufferCount());
+    GetMessagePool()->AddBuffers(aPriority, GetBufferCount());
 
     VerifyOrExit(IsInAQueue(), GetMetadata().mPriority = priority);
-    VerifyOrExit(GetMetadata().mPriority != priority);
 
     if (GetMetadata().mInPriorityQ)
     {
@@ -586,29 +685,256 @@ void Message::WriteBytes(uint16_t aOffset, const void *aBuf, uint16_t aLength)
 
 uint16_t Message::CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const
 {
-    uint16_t bytesCopied = 0;
-    Chunk    chunk;
+    uint16_t      bytesCopied = 0;
+    uint16_t      dstLength;
+    Chunk         chunk;
+    WritableChunk dstChunk;
 
     // This implementing can potentially overwrite the data when bytes are
     // being copied forward within the same message, i.e., source and
-    // destination messages are the same, and source offset is smaller than
-    // the destination offset. We assert not allowing such a use.
+    // destination messages are the same, source offset is smaller than
+    // the destination offset and the source and destination ranges
+    // overlap. We assert not allowing such a use.
 
-    OT_ASSERT((&aMessage != this) || (aSourceOffset >= aDestinationOffset));
+    OT_ASSERT((&aMessage != this) || (aSourceOffset >= aDestinationOffset) ||
+              (aSourceOffset + aLength <= aDestinationOffset));
 
     GetFirstChunk(aSourceOffset, aLength, chunk);
 
-    while (chunk.GetLength() > 0)
+    dstLength = chunk.GetLength() + aLength;
+    OT_ASSERT(aDestinationOffset + dstLength <= aMessage.GetLength());
+
+    // Walk the source and destination buffer chains in lockstep so
+    // that each one is traversed only once.
+
+    aMessage.GetFirstChunk(aDestinationOffset, dstLength, dstChunk);
+
+    while ((chunk.GetLength() > 0) && (dstChunk.GetLength() > 0))
     {
-        aMessage.WriteBytes(aDestinationOffset, chunk.GetData(), chunk.GetLength());
-        aDestinationOffset += chunk.GetLength();
-        bytesCopied += chunk.GetLength();
-        GetNextChunk(aLength, chunk);
+        uint16_t length = OT_MIN(chunk.GetLength(), dstChunk.GetLength());
+
+        memmove(dstChunk.GetData(), chunk.GetData(), length);
+        bytesCopied += length;
+
+        chunk.mData += length;
+        chunk.mLength -= length;
+        dstChunk.mData += length;
+        dstChunk.mLength -= length;
+
+        if (chunk.GetLength() == 0)
+        {
+            GetNextChunk(aLength, chunk);
+        }
+
+        if (dstChunk.GetLength() == 0)
+        {
+            aMessage.GetNextChunk(dstLength, dstChunk);
+        }
     }
 
     return bytesCopied;
 }
 
+otError Message::AppendBytesFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+{
+    otError  error     = OT_ERROR_NONE;
+    uint16_t oldLength = GetLength();
+    uint16_t newLength = oldLength + aLength;
+
+    VerifyOrExit(aOffset + aLength <= aMessage.GetLength(), error = OT_ERROR_PARSE);
+    VerifyOrExit(newLength >= oldLength, error = OT_ERROR_NO_BUFS);
+    VerifyOrExit(aLength > 0);
+
+    SuccessOrExit(error = SetLength(newLength));
+
+    // When appending from the same message, the source bytes are
+    // always before the destination (end of message), so it is
+    // safe to use `CopyTo()`.
+
+    aMessage.CopyTo(aOffset, oldLength, aLength, *this);
+
+exit:
+    return error;
+}
+
+uint16_t Message::GetLengthToBufferEnd(uint16_t aPosition)
+{
+    // This method returns the number of bytes from a given position
+    // (which includes the reserved header bytes) to the end of the
+    // buffer containing it.
+
+    return (aPosition < kHeadBufferDataSize)
+               ? static_cast<uint16_t>(kHeadBufferDataSize - aPosition)
+               : static_cast<uint16_t>(kBufferDataSize - (aPosition - kHeadBufferDataSize) % kBufferDataSize);
+}
+
+otError Message::SpliceFromMessage(Message &aMessage, uint16_t aOffset)
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t length;
+    uint16_t copyLength;
+    uint16_t position;
+    uint16_t numBuffers;
+    Buffer * lastBuffer;
+    Buffer * prevBuffer;
+    Buffer * buffer;
+
+    VerifyOrExit((&aMessage != this) && (aMessage.GetMessagePool() == GetMessagePool()) &&
+                     (aOffset <= aMessage.GetLength()),
+                 error = OT_ERROR_INVALID_ARGS);
+
+    length = aMessage.GetLength() - aOffset;
+    VerifyOrExit(static_cast<uint16_t>(GetLength() + length) >= GetLength(), error = OT_ERROR_NO_BUFS);
+
+    // The bytes up to the end of the source buffer containing `aOffset`
+    // are copied, the buffers after it are relinked.
+
+    copyLength = GetLengthToBufferEnd(aMessage.GetReserved() + aOffset) % kBufferDataSize;
+
+    if ((length > copyLength) && (GetLength() == 0))
+    {
+        // Grow the reserved header such that the message ends exactly
+        // on a buffer boundary after `copyLength` bytes are appended.
+
+        position = GetReserved() + copyLength;
+        position += GetLengthToBufferEnd(position) % kBufferDataSize;
+        SetReserved(position - copyLength);
+    }
+
+    position = GetReserved() + GetLength() + copyLength;
+
+    if ((length <= copyLength) || (position < kHeadBufferDataSize) ||
+        (GetLengthToBufferEnd(position) != kBufferDataSize))
+    {
+        SuccessOrExit(error = AppendBytesFromMessage(aMessage, aOffset, length));
+        ExitNow();
+    }
+
+    SuccessOrExit(error = AppendBytesFromMessage(aMessage, aOffset, copyLength));
+
+    lastBuffer = this;
+
+    while (lastBuffer->GetNextBuffer() != nullptr)
+    {
+        lastBuffer = lastBuffer->GetNextBuffer();
+    }
+
+    // Find the source buffer starting at the boundary.
+
+    position   = aMessage.GetReserved() + aOffset + copyLength - kHeadBufferDataSize;
+    prevBuffer = &aMessage;
+    buffer     = aMessage.GetNextBuffer();
+
+    for (; position > 0; position -= kBufferDataSize)
+    {
+        prevBuffer = buffer;
+        buffer     = buffer->GetNextBuffer();
+    }
+
+    OT_ASSERT(buffer != nullptr);
+
+    prevBuffer->SetNextBuffer(nullptr);
+    lastBuffer->SetNextBuffer(buffer);
+
+    if (GetPriority() != aMessage.GetPriority())
+    {
+        // The relinked buffers are now held by a message of a different priority.
+
+        numBuffers = 0;
+
+        for (; buffer != nullptr; buffer = buffer->GetNextBuffer())
+        {
+            numBuffers++;
+        }
+
+        GetMessagePool()->RemoveBuffers(aMessage.GetPriority(), numBuffers);
+        GetMessagePool()->AddBuffers(GetPriority(), numBuffers);
+    }
+
+    GetMetadata().mLength += length - copyLength;
+
+exit:
+    if (error == OT_ERROR_NONE)
+    {
+        // Shrinking a message never fails.
+        IgnoreError(aMessage.SetLength(aOffset));
+    }
+
+    return error;
+}
+
+Message::Cursor::Cursor(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+    : mMessage(&aMessage)
+    , mRemainingLength(aLength)
+    , mOffset(aOffset)
+{
+    Chunk chunk;
+
+    aMessage.GetFirstChunk(aOffset, mRemainingLength, chunk);
+
+    mBuffer = chunk.mBuffer;
+    mData   = chunk.GetData();
+    mLength = chunk.GetLength();
+
+    if (mLength == 0)
+    {
+        mRemainingLength = 0;
+    }
+}
+
+void Message::Cursor::Advance(void)
+{
+    Chunk chunk;
+
+    VerifyOrExit(mLength > 0);
+
+    mOffset += mLength;
+
+    chunk.mBuffer = mBuffer;
+    mMessage->GetNextChunk(mRemainingLength, chunk);
+
+    mBuffer = chunk.mBuffer;
+    mData   = chunk.GetData();
+    mLength = chunk.GetLength();
+
+exit:
+    return;
+}
+
+void Message::Cursor::Skip(uint16_t aLength)
+{
+    while ((aLength > 0) && !IsAtEnd())
+    {
+        if (aLength < mLength)
+        {
+            mData += aLength;
+            mLength -= aLength;
+            mOffset += aLength;
+            break;
+        }
+
+        aLength -= mLength;
+        Advance();
+    }
+}
+
+uint16_t Message::Cursor::ReadBytes(void *aBuf, uint16_t aLength)
+{
+    uint8_t *bufPtr    = static_cast<uint8_t *>(aBuf);
+    uint16_t bytesRead = 0;
+
+    while ((bytesRead < aLength) && !IsAtEnd())
+    {
+        uint16_t length = OT_MIN(static_cast<uint16_t>(aLength - bytesRead), mLength);
+
+        memcpy(bufPtr + bytesRead, mData, length);
+        bytesRead += length;
+        Skip(length);
+    }
+
+    return bytesRead;
+}
+
 Message *Message::Clone(uint16_t aLength) const
 {
     otError  error = OT_ERROR_NONE;
@@ -655,6 +981,11 @@ bool Message::IsChildPending(void) const
     return GetMetadata().mChildMask.HasAny();
 }
 
+const ChildMask &Message::GetChildMask(void) const
+{
+    return GetMetadata().mChildMask;
+}
+
 void Message::SetLinkInfo(const ThreadLinkInfo &aLinkInfo)
 {
     SetLinkSecurityEnabled(aLinkInfo.mLinkSecurity);
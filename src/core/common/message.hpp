@@ -201,6 +201,7 @@ struct MessageMetadata
 class Buffer : public otMessage, public LinkedListEntry<Buffer>
 {
     friend class Message;
+    friend class MessagePool;
 
 public:
     /**
@@ -300,7 +301,6 @@ protected:
  */
 class Message : public Buffer
 {
-    friend class Checksum;
     friend class Crypto::HmacSha256;
     friend class Crypto::Sha256;
     friend class MessagePool;
@@ -478,7 +478,7 @@ public:
      * This method returns the number of buffers in the message.
      *
      */
-    uint8_t GetBufferCount(void) const;
+    uint16_t GetBufferCount(void) const;
 
     /**
      * This method returns the byte offset within the message.
@@ -575,6 +575,9 @@ public:
      * If the message is already queued in a priority queue, changing the priority ensures to
      * update the message in the associated queue.
      *
+     * The priority of a message queued for sleepy children MUST NOT be changed, since it would move the message
+     * relative to the first queued message tracked for each of those children.
+     *
      * @param[in]  aPriority  The message priority level.
      *
      * @retval OT_ERROR_NONE           Successfully set the priority for the message.
@@ -813,6 +816,147 @@ public:
      */
     uint16_t CopyTo(uint16_t aSourceOffset, uint16_t aDestinationOffset, uint16_t aLength, Message &aMessage) const;
 
+    /**
+     * This method appends bytes read from another (or the same) message to the end of the current message.
+     *
+     * On success, this method grows the message by @p aLength bytes.
+     *
+     * @param[in] aMessage  The message to read the bytes from.
+     * @param[in] aOffset   The offset in @p aMessage to start reading the bytes from.
+     * @param[in] aLength   The number of bytes to read from @p aMessage and append.
+     *
+     * @retval OT_ERROR_NONE     Successfully appended the bytes.
+     * @retval OT_ERROR_NO_BUFS  Insufficient available buffers to grow the message.
+     * @retval OT_ERROR_PARSE    Not enough bytes in @p aMessage to read @p aLength bytes from @p aOffset.
+     *
+     */
+    otError AppendBytesFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
+
+    /**
+     * This method moves the bytes of another message (from a given offset to its end) to the end of the current
+     * message.
+     *
+     * Instead of copying the data, the buffers of @p aMessage are unlinked from it and linked to the current message.
+     * At most one buffer worth of bytes is copied to align the bytes on a buffer boundary. This requires the end of
+     * the current message and @p aOffset in @p aMessage to be at the same position within their buffers. This is
+     * always the case when the current message is empty (its reserved header length is increased as needed to align
+     * them). Otherwise the bytes are copied.
+     *
+     * On success, the current message grows by the number of moved bytes and @p aMessage is truncated to
+     * @p aOffset bytes. Both messages MUST be from the same message pool.
+     *
+     * @param[in] aMessage  The message to move the bytes from.
+     * @param[in] aOffset   The offset in @p aMessage of the first byte to move.
+     *
+     * @retval OT_ERROR_NONE          Successfully moved the bytes.
+     * @retval OT_ERROR_NO_BUFS       Insufficient available buffers to grow the message.
+     * @retval OT_ERROR_INVALID_ARGS  @p aOffset is beyond the length of @p aMessage, or @p aMessage is the same as
+     *                                the current message or is from a different message pool.
+     *
+     */
+    otError SpliceFromMessage(Message &aMessage, uint16_t aOffset);
+
+    /**
+     * This class implements a cursor to iterate over the contiguous data spans of a message.
+     *
+     * A message's data is stored in a chain of buffers. The cursor provides direct access to the contiguous data in
+     * each buffer (within a given range of the message) and keeps its position so that reading sequentially from the
+     * message does not walk the buffer chain from the start on every read.
+     *
+     * The message MUST NOT be resized while a cursor is in use.
+     *
+     */
+    class Cursor
+    {
+    public:
+        /**
+         * This constructor initializes the cursor to the first span of a given range of the message.
+         *
+         * If the range goes beyond the end of the message, it is truncated to the message length.
+         *
+         * @param[in] aMessage  The message to iterate over.
+         * @param[in] aOffset   The offset in @p aMessage of the start of the range.
+         * @param[in] aLength   The length of the range (in bytes).
+         *
+         */
+        Cursor(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
+
+        /**
+         * This method indicates whether the cursor has reached the end of the range.
+         *
+         * @retval TRUE   The cursor is at the end of the range (there is no more data).
+         * @retval FALSE  The cursor is pointing to a (non-empty) span.
+         *
+         */
+        bool IsAtEnd(void) const { return (mLength == 0); }
+
+        /**
+         * This method returns a pointer to the data of the current span.
+         *
+         * @returns A pointer to the data of the current span.
+         *
+         */
+        const uint8_t *GetData(void) const { return mData; }
+
+        /**
+         * This method returns the length (in bytes) of the current span.
+         *
+         * @returns The length of the current span, or zero if the cursor is at the end of the range.
+         *
+         */
+        uint16_t GetLength(void) const { return mLength; }
+
+        /**
+         * This method returns the offset in the message corresponding to the start of the current span.
+         *
+         * @returns The message offset of the current span.
+         *
+         */
+        uint16_t GetOffset(void) const { return mOffset; }
+
+        /**
+         * This method returns the number of remaining bytes in the range (including the current span).
+         *
+         * @returns The number of remaining bytes in the range.
+         *
+         */
+        uint16_t GetRemainingLength(void) const { return mLength + mRemainingLength; }
+
+        /**
+         * This method moves the cursor to the next span.
+         *
+         */
+        void Advance(void);
+
+        /**
+         * This method moves the cursor forward by a given number of bytes.
+         *
+         * @param[in] aLength  The number of bytes to skip. If longer than the remaining length, the cursor moves to
+         *                     the end of the range.
+         *
+         */
+        void Skip(uint16_t aLength);
+
+        /**
+         * This method reads bytes from the current position and moves the cursor past the read bytes.
+         *
+         * @param[out] aBuf     A pointer to a data buffer to copy the read bytes into.
+         * @param[in]  aLength  Number of bytes to read.
+         *
+         * @returns The number of bytes read (smaller than @p aLength if the end of the range is reached).
+         *
+         */
+        uint16_t ReadBytes(void *aBuf, uint16_t aLength);
+
+    private:
+        const Message *mMessage;
+        const Buffer * mBuffer;          // Buffer containing the current span.
+        const uint8_t *mData;            // Pointer to start of current span.
+        uint16_t       mLength;          // Length of current span.
+        uint16_t       mRemainingLength; // Remaining length in the range after the current span.
+        uint16_t       mOffset;          // Message offset of the current span.
+    };
+
     /**
      * This method creates a copy of the message.
      *
@@ -892,6 +1036,14 @@ public:
      */
     bool IsChildPending(void) const;
 
+    /**
+     * This method returns the mask of children for which the message forwarding is scheduled.
+     *
+     * @returns A reference to the child mask of the message.
+     *
+     */
+    const ChildMask &GetChildMask(void) const;
+
     /**
      * This method returns the RLOC16 of the mesh destination.
      *
@@ -1336,6 +1488,8 @@ private:
         uint8_t *GetData(void) const { return const_cast<uint8_t *>(mData); }
     };
 
+    static uint16_t GetLengthToBufferEnd(uint16_t aPosition);
+
     void GetFirstChunk(uint16_t aOffset, uint16_t &aLength, Chunk &chunk) const;
     void GetNextChunk(uint16_t &aLength, Chunk &aChunk) const;
 
@@ -1605,15 +1759,43 @@ public:
      */
     uint16_t GetTotalBufferCount(void) const;
 
+    /**
+     * This method gets the buffer usage information of a given priority level.
+     *
+     * @param[in]   aPriority  The priority level.
+     * @param[out]  aInfo      A reference to return the buffer usage information.
+     *
+     */
+    void GetPriorityBufferInfo(Message::Priority aPriority, otMessagePriorityBufferInfo &aInfo) const;
+
+    /**
+     * This method resets the per-priority high-water marks and allocation failure counters.
+     *
+     * The high-water mark of each priority level is set to its current number of buffers in use.
+     *
+     */
+    void ResetPriorityBufferInfo(void);
+
 private:
-    Buffer *NewBuffer(Message::Priority aPriority);
-    void    FreeBuffers(Buffer *aBuffer);
-    otError ReclaimBuffers(Message::Priority aPriority);
+    static const uint16_t kBufferQuotas[Message::kNumPriorities];
+    static const uint16_t kBufferReserves[Message::kNumPriorities];
+
+    Buffer * NewBuffer(Message::Priority aPriority);
+    Buffer * AllocateBuffer(void);
+    void     FreeBuffers(Buffer *aBuffer, Message::Priority aPriority);
+    otError  ReclaimBuffers(Message::Priority aPriority);
+    bool     CanAllocateBuffer(Message::Priority aPriority) const;
+    uint16_t GetMinFreeBufferCount(Message::Priority aPriority) const;
+    void     AddBuffers(Message::Priority aPriority, uint16_t aCount);
+    void     RemoveBuffers(Message::Priority aPriority, uint16_t aCount);
 
 #if !OPENTHREAD_CONFIG_PLATFORM_MESSAGE_MANAGEMENT && !OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
     uint16_t                  mNumFreeBuffers;
     Pool<Buffer, kNumBuffers> mBufferPool;
 #endif
+    uint16_t mInUseBuffers[Message::kNumPriorities];
+    uint16_t mMaxInUseBuffers[Message::kNumPriorities];
+    uint32_t mAllocFailures[Message::kNumPriorities];
 };
 
 /**
@@ -0,0 +1,153 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for a lock-free multi-producer single-consumer queue.
+ */
+
+#ifndef MPSC_QUEUE_HPP_
+#define MPSC_QUEUE_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stddef.h>
+
+namespace ot {
+
+/**
+ * @addtogroup core-mpsc-queue
+ *
+ * @brief
+ *   This module includes definitions for OpenThread lock-free multi-producer single-consumer queue.
+ *
+ * @{
+ *
+ */
+
+/**
+ * This template class represents an intrusive lock-free multi-producer single-consumer queue.
+ *
+ * Entries can be pushed from any thread, while a single consumer thread takes all the queued entries at once. Since
+ * entries are never removed one by one, the queue is not exposed to the ABA problem and needs no per-entry
+ * reference counting, which makes it simpler and cheaper than a Michael-Scott queue for this use.
+ *
+ * The template type `Type` should provide `GetNext()` and `SetNext()` methods (which can be realized by `Type`
+ * inheriting from `LinkedListEntry<Type>` class). An entry must not be pushed again before it is taken by the
+ * consumer.
+ *
+ * @note The implementation relies on the GCC/Clang `__atomic` builtins.
+ *
+ */
+template <typename Type> class MpscQueue
+{
+public:
+    /**
+     * This constructor initializes the queue.
+     *
+     */
+    MpscQueue(void)
+        : mHead(nullptr)
+    {
+    }
+
+    /**
+     * This method indicates whether the queue is empty.
+     *
+     * This method can be called from any thread.
+     *
+     * @retval TRUE   If the queue is empty.
+     * @retval FALSE  If the queue is not empty.
+     *
+     */
+    bool IsEmpty(void) const { return __atomic_load_n(&mHead, __ATOMIC_RELAXED) == nullptr; }
+
+    /**
+     * This method pushes an entry to the queue.
+     *
+     * This method can be called from any thread.
+     *
+     * @param[in]  aEntry  A reference to the entry to push.
+     *
+     * @retval TRUE   If the queue was empty before @p aEntry was pushed.
+     * @retval FALSE  If the queue was not empty.
+     *
+     */
+    bool Push(Type &aEntry)
+    {
+        Type *head = __atomic_load_n(&mHead, __ATOMIC_RELAXED);
+
+        do
+        {
+            aEntry.SetNext(head);
+        } while (!__atomic_compare_exchange_n(&mHead, &head, &aEntry, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+        return (head == nullptr);
+    }
+
+    /**
+     * This method takes all the entries from the queue.
+     *
+     * This method must only be called from the consumer thread.
+     *
+     * @returns A pointer to the first of the taken entries in the order they were pushed (linked through `GetNext()`),
+     *          or nullptr if the queue is empty.
+     *
+     */
+    Type *PopAll(void)
+    {
+        Type *entry = __atomic_exchange_n(&mHead, nullptr, __ATOMIC_ACQUIRE);
+        Type *first = nullptr;
+
+        // Entries are pushed at the head, so the list is reversed to
+        // restore the order in which they were pushed.
+
+        while (entry != nullptr)
+        {
+            Type *next = entry->GetNext();
+
+            entry->SetNext(first);
+            first = entry;
+            entry = next;
+        }
+
+        return first;
+    }
+
+private:
+    Type *mHead;
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace ot
+
+#endif // MPSC_QUEUE_HPP_
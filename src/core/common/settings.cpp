@@ -152,6 +152,9 @@ void SettingsDriver::Wipe(void)
 SettingsDriver::SettingsDriver(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mFlash(aInstance)
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    , mCompactionTasklet(aInstance, SettingsDriver::HandleCompactionTasklet, this)
+#endif
 {
 }
 
@@ -166,7 +169,13 @@ void SettingsDriver::Deinit(void)
 
 otError SettingsDriver::Add(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    return mFlash.Add(aKey, aValue, aValueLength);
+    otError error = mFlash.Add(aKey, aValue, aValueLength);
+
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    PostCompaction();
+#endif
+
+    return error;
 }
 
 otError SettingsDriver::Delete(uint16_t aKey, int aIndex)
@@ -181,7 +190,13 @@ otError SettingsDriver::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t
 
 otError SettingsDriver::Set(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    return mFlash.Set(aKey, aValue, aValueLength);
+    otError error = mFlash.Set(aKey, aValue, aValueLength);
+
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    PostCompaction();
+#endif
+
+    return error;
 }
 
 void SettingsDriver::Wipe(void)
@@ -189,6 +204,28 @@ void SettingsDriver::Wipe(void)
     mFlash.Wipe();
 }
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+void SettingsDriver::PostCompaction(void)
+{
+    if (mFlash.IsCompacting())
+    {
+        mCompactionTasklet.Post();
+    }
+}
+
+void SettingsDriver::HandleCompactionTasklet(Tasklet &aTasklet)
+{
+    aTasklet.GetOwner<SettingsDriver>().HandleCompactionTasklet();
+}
+
+void SettingsDriver::HandleCompactionTasklet(void)
+{
+    // Compaction also advances with every write, the tasklet completes it while the stack is otherwise idle.
+    mFlash.ContinueCompaction();
+    PostCompaction();
+}
+#endif // OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+
 #endif // !OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
 
 void Settings::Init(void)
@@ -41,6 +41,7 @@
 #include "common/equatable.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/tasklet.hpp"
 #include "mac/mac_types.hpp"
 #include "net/ip6_address.hpp"
 #include "utils/flash.hpp"
@@ -148,7 +149,16 @@ public:
 
 #if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
 private:
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    void        PostCompaction(void);
+    static void HandleCompactionTasklet(Tasklet &aTasklet);
+    void        HandleCompactionTasklet(void);
+#endif
+
     Flash mFlash;
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    Tasklet mCompactionTasklet;
+#endif
 #endif
 };
 
@@ -57,8 +57,9 @@ void Tasklet::Post(void)
     }
 }
 
-TaskletScheduler::TaskletScheduler(void)
-    : mTail(nullptr)
+TaskletScheduler::TaskletScheduler(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mTail(nullptr)
 {
 }
 
@@ -82,7 +83,13 @@ void TaskletScheduler::PostTasklet(Tasklet &aTasklet)
 
 void TaskletScheduler::ProcessQueuedTasklets(void)
 {
-    Tasklet *tail = mTail;
+    Tasklet *tail;
+
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    // The thread entries are processed first so that any tasklet posted
+    // from their handlers is included in the copy of the list below.
+    ProcessThreadEntries();
+#endif
 
     // This method processes all tasklets queued when this is called. We
     // keep a copy the current list and then clear the main list by
@@ -90,6 +97,7 @@ void TaskletScheduler::ProcessQueuedTasklets(void)
     // the currently queued tasklets will then trigger a call to
     // `otTaskletsSignalPending()`.
 
+    tail  = mTail;
     mTail = nullptr;
 
     while (tail != nullptr)
@@ -110,4 +118,41 @@ void TaskletScheduler::ProcessQueuedTasklets(void)
     }
 }
 
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+otError TaskletScheduler::PostFromThread(otTaskletEntry &aEntry)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(!__atomic_exchange_n(&aEntry.mIsPosted, true, __ATOMIC_ACQUIRE), error = OT_ERROR_ALREADY);
+
+    if (mThreadEntries.Push(static_cast<ThreadEntry &>(aEntry)))
+    {
+        otTaskletsSignalPendingFromThread(&GetInstance());
+    }
+
+exit:
+    return error;
+}
+
+void TaskletScheduler::ProcessThreadEntries(void)
+{
+    ThreadEntry *entry = mThreadEntries.PopAll();
+
+    while (entry != nullptr)
+    {
+        ThreadEntry *    next    = entry->GetNext();
+        otTaskletHandler handler = entry->mHandler;
+        void *           context = entry->mContext;
+
+        // Once `mIsPosted` is cleared, the entry may be posted again
+        // (or released) by its owner, so it is not accessed afterwards.
+
+        __atomic_store_n(&entry->mIsPosted, false, __ATOMIC_RELEASE);
+        handler(&GetInstance(), context);
+
+        entry = next;
+    }
+}
+#endif // OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+
 } // namespace ot
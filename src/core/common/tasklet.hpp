@@ -40,7 +40,9 @@
 
 #include <openthread/tasklet.h>
 
+#include "common/linked_list.hpp"
 #include "common/locator.hpp"
+#include "common/mpsc_queue.hpp"
 #include "common/non_copyable.hpp"
 
 namespace ot {
@@ -150,7 +152,7 @@ private:
  * This class implements the tasklet scheduler.
  *
  */
-class TaskletScheduler : private NonCopyable
+class TaskletScheduler : public InstanceLocator, private NonCopyable
 {
     friend class Tasklet;
 
@@ -158,8 +160,10 @@ public:
     /**
      * This constructor initializes the object.
      *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
      */
-    TaskletScheduler(void);
+    explicit TaskletScheduler(Instance &aInstance);
 
     /**
      * This method indicates whether or not there are tasklets pending.
@@ -168,7 +172,14 @@ public:
      * @retval FALSE  If there are no tasklets pending.
      *
      */
-    bool AreTaskletsPending(void) const { return mTail != nullptr; }
+    bool AreTaskletsPending(void) const
+    {
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+        return (mTail != nullptr) || !mThreadEntries.IsEmpty();
+#else
+        return mTail != nullptr;
+#endif
+    }
 
     /**
      * This method processes all tasklets queued when this is called.
@@ -176,10 +187,36 @@ public:
      */
     void ProcessQueuedTasklets(void);
 
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    /**
+     * This method posts a tasklet entry from any thread.
+     *
+     * This method is thread-safe and lock-free. The handler of @p aEntry is called from `ProcessQueuedTasklets()`.
+     *
+     * @param[in]  aEntry  A reference to the tasklet entry to post.
+     *
+     * @retval OT_ERROR_NONE     Successfully posted the entry.
+     * @retval OT_ERROR_ALREADY  The entry is already posted.
+     *
+     */
+    otError PostFromThread(otTaskletEntry &aEntry);
+#endif
+
 private:
     void PostTasklet(Tasklet &aTasklet);
 
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    class ThreadEntry : public otTaskletEntry, public LinkedListEntry<ThreadEntry>
+    {
+    };
+
+    void ProcessThreadEntries(void);
+#endif
+
     Tasklet *mTail; // A circular singly linked-list
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    MpscQueue<ThreadEntry> mThreadEntries;
+#endif
 };
 
 /**
@@ -81,8 +81,7 @@ void TimerMilli::StartAt(TimeMilli aStartTime, uint32_t aDelay)
 
 void TimerMilli::FireAt(TimeMilli aFireTime)
 {
-    mFireTime = aFireTime;
-    Get<TimerMilliScheduler>().Add(*this);
+    Get<TimerMilliScheduler>().Add(*this, aFireTime);
 }
 
 void TimerMilli::FireAtIfEarlier(TimeMilli aFireTime)
@@ -98,65 +97,189 @@ void TimerMilli::Stop(void)
     Get<TimerMilliScheduler>().Remove(*this);
 }
 
-void TimerScheduler::Add(Timer &aTimer, const AlarmApi &aAlarmApi)
+TimerScheduler::TimerScheduler(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mEarliest(nullptr)
+    , mIsProcessing(false)
 {
-    Timer *prev = nullptr;
-    Time   now(aAlarmApi.AlarmGetNow());
+    for (Slot &slot : mSlots)
+    {
+        slot.mHead     = nullptr;
+        slot.mTail     = nullptr;
+        slot.mEarliest = nullptr;
+    }
+}
+
+void TimerScheduler::Add(Timer &aTimer, Time aFireTime, const AlarmApi &aAlarmApi)
+{
+    Time now(aAlarmApi.AlarmGetNow());
+
+    // The timer is removed before its fire time is updated since
+    // the fire time determines its slot in the wheel.
 
     Remove(aTimer, aAlarmApi);
 
-    for (Timer *cur = mTimerList.GetHead(); cur; prev = cur, cur = cur->GetNext())
+    aTimer.mFireTime = aFireTime;
+    LinkToSlot(aTimer, now);
+
+    if ((mEarliest == nullptr) || aTimer.DoesFireBefore(*mEarliest, now))
+    {
+        mEarliest = &aTimer;
+
+        if (!mIsProcessing)
+        {
+            SetAlarm(aAlarmApi);
+        }
+    }
+}
+
+void TimerScheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+{
+    Time now;
+
+    VerifyOrExit(aTimer.IsRunning());
+
+    now = Time(aAlarmApi.AlarmGetNow());
+    UnlinkFromSlot(aTimer, now);
+
+    if (mEarliest == &aTimer)
     {
-        if (aTimer.DoesFireBefore(*cur, now))
+        // All other running timers fire at or after the removed
+        // one, so the search can start from its fire time.
+
+        mEarliest = FindEarliest(aTimer.mFireTime, now);
+
+        if (!mIsProcessing)
         {
-            break;
+            SetAlarm(aAlarmApi);
         }
     }
 
-    if (prev == nullptr)
+exit:
+    return;
+}
+
+void TimerScheduler::LinkToSlot(Timer &aTimer, Time aNow)
+{
+    Slot &slot = mSlots[GetSlotIndex(aTimer.mFireTime)];
+
+    // New timers are appended at the tail so that timers with the
+    // same fire time are fired in the order they were started.
+
+    aTimer.mNext = nullptr;
+    aTimer.mPrev = slot.mTail;
+
+    if (slot.mTail != nullptr)
     {
-        mTimerList.Push(aTimer);
-        SetAlarm(aAlarmApi);
+        slot.mTail->mNext = &aTimer;
     }
     else
     {
-        mTimerList.PushAfter(aTimer, *prev);
+        slot.mHead = &aTimer;
+    }
+
+    slot.mTail = &aTimer;
+
+    if ((slot.mEarliest == nullptr) || aTimer.DoesFireBefore(*slot.mEarliest, aNow))
+    {
+        slot.mEarliest = &aTimer;
     }
 }
 
-void TimerScheduler::Remove(Timer &aTimer, const AlarmApi &aAlarmApi)
+void TimerScheduler::UnlinkFromSlot(Timer &aTimer, Time aNow)
 {
-    VerifyOrExit(aTimer.IsRunning());
+    Slot &slot = mSlots[GetSlotIndex(aTimer.mFireTime)];
 
-    if (mTimerList.GetHead() == &aTimer)
+    if (aTimer.mPrev != nullptr)
     {
-        mTimerList.Pop();
-        SetAlarm(aAlarmApi);
+        aTimer.mPrev->mNext = aTimer.mNext;
     }
     else
     {
-        IgnoreError(mTimerList.Remove(aTimer));
+        slot.mHead = aTimer.mNext;
     }
 
-    aTimer.SetNext(&aTimer);
+    if (aTimer.mNext != nullptr)
+    {
+        aTimer.mNext->mPrev = aTimer.mPrev;
+    }
+    else
+    {
+        slot.mTail = aTimer.mPrev;
+    }
 
-exit:
-    return;
+    aTimer.mNext = &aTimer;
+    aTimer.mPrev = nullptr;
+
+    if (slot.mEarliest == &aTimer)
+    {
+        // Only the timers sharing the slot are scanned. The list is
+        // walked from its head so that among timers with the same
+        // fire time the one started first is picked.
+
+        slot.mEarliest = nullptr;
+
+        for (Timer *timer = slot.mHead; timer != nullptr; timer = timer->mNext)
+        {
+            if ((slot.mEarliest == nullptr) || timer->DoesFireBefore(*slot.mEarliest, aNow))
+            {
+                slot.mEarliest = timer;
+            }
+        }
+    }
+}
+
+Timer *TimerScheduler::FindEarliest(Time aStartTime, Time aNow) const
+{
+    Timer *  earliest  = nullptr;
+    uint32_t slotStart = aStartTime.GetValue() & ~((static_cast<uint32_t>(1) << kSlotShift) - 1);
+    uint16_t index     = GetSlotIndex(aStartTime);
+
+    // Walk one revolution of the wheel starting from the slot of
+    // `aStartTime`, looking only at the earliest timer of each slot.
+    // If the earliest timer of the slot at a given offset falls
+    // within that slot's window in the current revolution, it is the
+    // earliest timer overall. Otherwise all timers in the slot fire
+    // in a later revolution. While walking, the earliest of the
+    // per-slot timers is also tracked, which is the result when no
+    // timer fires within one revolution.
+
+    for (uint16_t offset = 0; offset < kNumSlots; offset++)
+    {
+        Timer *timer = mSlots[index].mEarliest;
+
+        if (timer != nullptr)
+        {
+            if (((timer->mFireTime.GetValue() - slotStart) >> kSlotShift) == offset)
+            {
+                earliest = timer;
+                break;
+            }
+
+            if ((earliest == nullptr) || timer->DoesFireBefore(*earliest, aNow))
+            {
+                earliest = timer;
+            }
+        }
+
+        index = (index + 1) & (kNumSlots - 1);
+    }
+
+    return earliest;
 }
 
 void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 {
-    if (mTimerList.IsEmpty())
+    if (mEarliest == nullptr)
     {
         aAlarmApi.AlarmStop(&GetInstance());
     }
     else
     {
-        Timer *  timer = mTimerList.GetHead();
         Time     now(aAlarmApi.AlarmGetNow());
         uint32_t remaining;
 
-        remaining = (now < timer->mFireTime) ? (timer->mFireTime - now) : 0;
+        remaining = (now < mEarliest->mFireTime) ? (mEarliest->mFireTime - now) : 0;
 
         aAlarmApi.AlarmStartAt(&GetInstance(), now.GetValue(), remaining);
     }
@@ -164,24 +287,27 @@ void TimerScheduler::SetAlarm(const AlarmApi &aAlarmApi)
 
 void TimerScheduler::ProcessTimers(const AlarmApi &aAlarmApi)
 {
-    Timer *timer = mTimerList.GetHead();
+    Time    now(aAlarmApi.AlarmGetNow());
+    uint8_t numFired = 0;
 
-    if (timer)
+    // The platform alarm is updated once after the whole batch of
+    // expired timers is fired (and not on every `Add()`/`Remove()`
+    // from the timer handlers).
+
+    mIsProcessing = true;
+
+    while ((mEarliest != nullptr) && (now >= mEarliest->mFireTime) && (numFired < kMaxBatchSize))
     {
-        Time now(aAlarmApi.AlarmGetNow());
+        Timer &timer = *mEarliest;
 
-        if (now >= timer->mFireTime)
-        {
-            Remove(*timer, aAlarmApi); // `Remove()` will `SetAlarm` for next timer if there is any.
-            timer->Fired();
-            ExitNow();
-        }
+        Remove(timer, aAlarmApi);
+        numFired++;
+        timer.Fired();
     }
 
-    SetAlarm(aAlarmApi);
+    mIsProcessing = false;
 
-exit:
-    return;
+    SetAlarm(aAlarmApi);
 }
 
 extern "C" void otPlatAlarmMilliFired(otInstance *aInstance)
@@ -211,8 +337,7 @@ void TimerMicro::StartAt(TimeMicro aStartTime, uint32_t aDelay)
 
 void TimerMicro::FireAt(TimeMicro aFireTime)
 {
-    mFireTime = aFireTime;
-    Get<TimerMicroScheduler>().Add(*this);
+    Get<TimerMicroScheduler>().Add(*this, aFireTime);
 }
 
 void TimerMicro::Stop(void)
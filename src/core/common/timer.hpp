@@ -42,8 +42,9 @@
 #include <openthread/platform/alarm-micro.h>
 #include <openthread/platform/alarm-milli.h>
 
+#include "openthread-core-config.h"
+
 #include "common/debug.hpp"
-#include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/tasklet.hpp"
@@ -67,10 +68,9 @@ class TimerMilliScheduler;
  * This class implements a timer.
  *
  */
-class Timer : public InstanceLocator, public OwnerLocator, public LinkedListEntry<Timer>
+class Timer : public InstanceLocator, public OwnerLocator
 {
     friend class TimerScheduler;
-    friend class LinkedListEntry<Timer>;
 
 public:
     /**
@@ -101,6 +101,7 @@ public:
         , mHandler(aHandler)
         , mFireTime()
         , mNext(this)
+        , mPrev(nullptr)
     {
     }
 
@@ -138,7 +139,8 @@ protected:
 
     Handler mHandler;
     Time    mFireTime;
-    Timer * mNext;
+    Timer * mNext; // Next timer in the same wheel slot (`this` when the timer is not running).
+    Timer * mPrev; // Previous timer in the same wheel slot.
 };
 
 /**
@@ -251,6 +253,12 @@ private:
 /**
  * This class implements the base timer scheduler.
  *
+ * Running timers are kept in a hashed timing wheel. Each wheel slot covers `2^kSlotShift` ticks and holds an unsorted
+ * doubly linked list of the timers whose fire time maps to it, along with the earliest timer in that list. The
+ * scheduler also tracks the earliest timer overall, which is the one used to program the platform alarm. When the
+ * earliest timer is removed, only the per-slot earliest timers are examined (at most `kNumSlots` of them), so the
+ * cost of stopping or firing the head timer does not depend on the number of running timers.
+ *
  */
 class TimerScheduler : public InstanceLocator, private NonCopyable
 {
@@ -274,19 +282,19 @@ protected:
      * @param[in]  aInstance  A reference to the instance object.
      *
      */
-    explicit TimerScheduler(Instance &aInstance)
-        : InstanceLocator(aInstance)
-    {
-    }
+    explicit TimerScheduler(Instance &aInstance);
 
     /**
      * This method adds a timer instance to the timer scheduler.
      *
+     * If the timer is already running, it is first removed and then re-added with the new fire time.
+     *
      * @param[in]  aTimer     A reference to the timer instance.
+     * @param[in]  aFireTime  The fire time of the timer.
      * @param[in]  aAlarmApi  A reference to the Alarm APIs.
      *
      */
-    void Add(Timer &aTimer, const AlarmApi &aAlarmApi);
+    void Add(Timer &aTimer, Time aFireTime, const AlarmApi &aAlarmApi);
 
     /**
      * This method removes a timer instance to the timer scheduler.
@@ -300,20 +308,47 @@ protected:
     /**
      * This method processes the running timers.
      *
+     * All timers that have expired are fired (up to `kMaxBatchSize` timers per call), and then the platform alarm is
+     * set for the next timer.
+     *
      * @param[in]  aAlarmApi  A reference to the Alarm APIs.
      *
      */
     void ProcessTimers(const AlarmApi &aAlarmApi);
 
     /**
-     * This method sets the platform alarm based on timer at front of the list.
+     * This method sets the platform alarm based on the earliest running timer.
      *
      * @param[in]  aAlarmApi  A reference to the Alarm APIs.
      *
      */
     void SetAlarm(const AlarmApi &aAlarmApi);
 
-    LinkedList<Timer> mTimerList;
+private:
+    static const uint16_t kNumSlots     = OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS;
+    static const uint8_t  kSlotShift    = OPENTHREAD_CONFIG_TIMER_WHEEL_SLOT_SHIFT;
+    static const uint8_t  kMaxBatchSize = OPENTHREAD_CONFIG_TIMER_MAX_BATCH_SIZE;
+
+    static_assert(kNumSlots > 0 && (kNumSlots & (kNumSlots - 1)) == 0, "TIMER_WHEEL_NUM_SLOTS must be power of two");
+    static_assert(kSlotShift < 32, "TIMER_WHEEL_SLOT_SHIFT is too large");
+    static_assert(kMaxBatchSize > 0, "TIMER_MAX_BATCH_SIZE must be non-zero");
+
+    struct Slot
+    {
+        Timer *mHead;
+        Timer *mTail;
+        Timer *mEarliest; // Earliest timer in the slot (across all revolutions of the wheel).
+    };
+
+    static uint16_t GetSlotIndex(Time aTime) { return (aTime.GetValue() >> kSlotShift) & (kNumSlots - 1); }
+
+    void   LinkToSlot(Timer &aTimer, Time aNow);
+    void   UnlinkFromSlot(Timer &aTimer, Time aNow);
+    Timer *FindEarliest(Time aStartTime, Time aNow) const;
+
+    Slot   mSlots[kNumSlots];
+    Timer *mEarliest;
+    bool   mIsProcessing;
 };
 
 /**
@@ -337,10 +372,11 @@ public:
     /**
      * This method adds a timer instance to the timer scheduler.
      *
-     * @param[in]  aTimer  A reference to the timer instance.
+     * @param[in]  aTimer     A reference to the timer instance.
+     * @param[in]  aFireTime  The fire time of the timer.
      *
      */
-    void Add(TimerMilli &aTimer) { TimerScheduler::Add(aTimer, sAlarmMilliApi); }
+    void Add(TimerMilli &aTimer, TimeMilli aFireTime) { TimerScheduler::Add(aTimer, aFireTime, sAlarmMilliApi); }
 
     /**
      * This method removes a timer instance to the timer scheduler.
@@ -444,10 +480,11 @@ public:
     /**
      * This method adds a timer instance to the timer scheduler.
      *
-     * @param[in]  aTimer  A reference to the timer instance.
+     * @param[in]  aTimer     A reference to the timer instance.
+     * @param[in]  aFireTime  The fire time of the timer.
      *
      */
-    void Add(TimerMicro &aTimer) { TimerScheduler::Add(aTimer, sAlarmMicroApi); }
+    void Add(TimerMicro &aTimer, TimeMicro aFireTime) { TimerScheduler::Add(aTimer, aFireTime, sAlarmMicroApi); }
 
     /**
      * This method removes a timer instance to the timer scheduler.
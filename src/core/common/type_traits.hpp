@@ -104,6 +104,27 @@ template <typename Type> struct IsSame<Type, Type> : public TrueValue
 {
 };
 
+/**
+ * This type selects between two given types based on a boolean condition.
+ *
+ * The type `Conditional<kCondition, TypeOnTrue, TypeOnFalse>::Type` would be `TypeOnTrue` when `kCondition` is `true`,
+ * otherwise it would be `TypeOnFalse`.
+ *
+ * @tparam kCondition    The condition to select the type.
+ * @tparam TypeOnTrue    The type to select when @p kCondition is `true`.
+ * @tparam TypeOnFalse   The type to select when @p kCondition is `false`.
+ *
+ */
+template <bool kCondition, typename TypeOnTrue, typename TypeOnFalse> struct Conditional
+{
+    typedef TypeOnTrue Type; ///< The selected type.
+};
+
+template <typename TypeOnTrue, typename TypeOnFalse> struct Conditional<false, TypeOnTrue, TypeOnFalse>
+{
+    typedef TypeOnFalse Type;
+};
+
 } // namespace TypeTraits
 } // namespace ot
 
@@ -40,13 +40,29 @@
  *
  * Maximum number of cached responses for CoAP Confirmable messages.
  *
- * Cached responses are used for message deduplication.
+ * Cached responses are used for message deduplication. They are indexed by requester and Message ID, and when
+ * the cache is full the response closest to the end of its exchange lifetime is evicted.
  *
  */
 #ifndef OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES
 #define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS
+ *
+ * Number of outstanding CoAP requests (and confirmable responses) per CoAP agent that are indexed by token, message ID
+ * and retransmission deadline.
+ *
+ * Each indexed transaction keeps its retransmission metadata in a fixed entry. When all entries are in use, the
+ * metadata of further transactions is appended to their stored message copy and they are found by going through all
+ * pending messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS
+#define OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS 16
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_COAP_API_ENABLE
  *
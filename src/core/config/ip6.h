@@ -127,6 +127,17 @@
 #define OPENTHREAD_CONFIG_IP6_SLAAC_NUM_ADDRESSES 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE
+ *
+ * The number of slots in the local port index used to find the UDP socket for a received datagram. It should be at
+ * least 4/3 of the number of open UDP sockets, otherwise received datagrams are matched by a walk of the socket list.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE
+#define OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE 32
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
  *
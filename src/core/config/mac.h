@@ -95,6 +95,32 @@
 #define OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+ *
+ * Define to 1 to support the adaptive transmit policy, which tunes the CSMA-CA minimum backoff exponent from the CCA
+ * failure rate and lowers the frame retries towards neighbors with a high frame error rate.
+ *
+ * The policy is disabled at run time until it is enabled with `otLinkSetAdaptiveTxPolicyEnabled()`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+ *
+ * Define to 1 to keep the expanded AES key schedules of the previous, current and next IEEE 802.15.4 MAC keys, so
+ * that MAC frame security processing does not expand the key for every frame.
+ *
+ * This trades RAM for three AES contexts against CPU time per secured frame.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_MAX_SIZE_COUNT_DIRECT
  *
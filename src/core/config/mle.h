@@ -53,6 +53,9 @@
  *
  * The maximum number of children.
  *
+ * The child table finds children through a Child ID index and an extended address hash index instead of scanning all
+ * entries, so values up to the number of Child IDs (511) are practical.
+ *
  */
 #ifndef OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
 #define OPENTHREAD_CONFIG_MLE_MAX_CHILDREN 10
@@ -128,6 +128,18 @@
 #define OPENTHREAD_CONFIG_UDP_FORWARD_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+ *
+ * Define to 1 to enable `otTaskletsPostFromThread()`, which posts tasklet entries from any thread.
+ *
+ * @note The implementation relies on the GCC/Clang `__atomic` builtins.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+#define OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_USE_HEAP_ENABLE
  *
@@ -150,6 +162,79 @@
 #define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 44
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_LOW
+ *
+ * The maximum number of message buffers that may be held by low priority messages (0 for no quota).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_LOW
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_LOW 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_NORMAL
+ *
+ * The maximum number of message buffers that may be held by normal priority messages (0 for no quota).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_NORMAL
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_NORMAL 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_HIGH
+ *
+ * The maximum number of message buffers that may be held by high priority messages (0 for no quota).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_HIGH
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_HIGH 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_NET
+ *
+ * The maximum number of message buffers that may be held by network control priority messages (0 for no quota).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_NET
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_QUOTA_NET 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_NORMAL
+ *
+ * The number of free message buffers reserved for normal and higher priority messages.
+ *
+ * Low priority messages cannot allocate a buffer when doing so would reduce the number of free buffers below the sum
+ * of the reserves of all higher priority levels.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_NORMAL
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_NORMAL 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_HIGH
+ *
+ * The number of free message buffers reserved for high and network control priority messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_HIGH
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_HIGH 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_NET
+ *
+ * The number of free message buffers reserved for network control priority messages (e.g. MLE).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_NET
+#define OPENTHREAD_CONFIG_MESSAGE_BUFFER_RESERVE_NET 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MESSAGE_BUFFER_SIZE
  *
@@ -192,6 +277,19 @@
 #define OPENTHREAD_CONFIG_DROP_MESSAGE_ON_FRAGMENT_TX_FAILURE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_TX_PIPELINE_ENABLE
+ *
+ * Define as 1 to request the next fragment of a direct transmission as soon as the previous fragment frame is sent.
+ * The MAC then starts the next fragment from the transmit done callback (unless a higher priority MAC operation is
+ * pending), instead of going through the transmission scheduling tasklet and route lookup for every fragment. The
+ * next fragment is not pipelined while a higher priority message waits for direct transmission.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_TX_PIPELINE_ENABLE
+#define OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_TX_PIPELINE_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT
  *
@@ -202,6 +300,44 @@
 #define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES
+ *
+ * The maximum number of 6LoWPAN datagrams being reassembled at the same time.
+ *
+ * When the reassembly table is full, the oldest datagram being reassembled is dropped to make room for a new one.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_PER_SOURCE
+ *
+ * The maximum number of 6LoWPAN datagrams from the same source being reassembled at the same time.
+ *
+ * When a source reaches this limit, its oldest datagram being reassembled is dropped to make room for a new one, so
+ * that a single source cannot take over the whole reassembly table.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_PER_SOURCE
+#define OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_PER_SOURCE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_6LOWPAN_COMPRESSION_CACHE_SIZE
+ *
+ * The number of flows for which the LOWPAN_IPHC header compression result is cached.
+ *
+ * A flow is identified by its IPv6 and MAC source and destination addresses, next header and hop limit. The cache is
+ * invalidated whenever the Network Data (and therefore the 6LoWPAN contexts) changes.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_6LOWPAN_COMPRESSION_CACHE_SIZE
+#define OPENTHREAD_CONFIG_6LOWPAN_COMPRESSION_CACHE_SIZE 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_JOINER_UDP_PORT
  *
@@ -367,6 +503,55 @@
 #define OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+ *
+ * Define to 1 to keep a RAM index of the settings records stored through the otPlatFlash* APIs, so that settings
+ * are located without scanning the flash area on every access.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+#define OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_FLASH_INDEX_MAX_ENTRIES
+ *
+ * The maximum number of settings records tracked by the flash RAM index (4 bytes each).
+ *
+ * When the flash area holds more live records, the driver falls back to scanning the flash area until the index fits
+ * again.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FLASH_INDEX_MAX_ENTRIES
+#define OPENTHREAD_CONFIG_FLASH_INDEX_MAX_ENTRIES 64
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_FLASH_COMPACTION_THRESHOLD
+ *
+ * The usage of the active flash swap area (in percent) above which compaction into the inactive swap area starts
+ * in the background. Zero disables background compaction, the swap area is then only compacted once it is full.
+ *
+ * Applicable only when `OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FLASH_COMPACTION_THRESHOLD
+#define OPENTHREAD_CONFIG_FLASH_COMPACTION_THRESHOLD 75
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_FLASH_COMPACTION_STEP_RECORDS
+ *
+ * The maximum number of settings records examined in a single background compaction step.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_FLASH_COMPACTION_STEP_RECORDS
+#define OPENTHREAD_CONFIG_FLASH_COMPACTION_STEP_RECORDS 8
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_FAILED_CHILD_TRANSMISSIONS
  *
@@ -493,4 +678,36 @@
 #define OPENTHREAD_CONFIG_MLR_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS
+ *
+ * The number of slots in the hashed timing wheel used by the timer schedulers. It MUST be a power of two.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS
+#define OPENTHREAD_CONFIG_TIMER_WHEEL_NUM_SLOTS 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_WHEEL_SLOT_SHIFT
+ *
+ * The width of a timing wheel slot as a power of two of timer ticks (milliseconds or microseconds). For example, the
+ * default value of 6 gives 64 ms wide slots for `TimerMilli`, so a wheel with 16 slots covers about one second.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_WHEEL_SLOT_SHIFT
+#define OPENTHREAD_CONFIG_TIMER_WHEEL_SLOT_SHIFT 6
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TIMER_MAX_BATCH_SIZE
+ *
+ * The maximum number of expired timers that are fired from a single platform alarm callback. Any remaining expired
+ * timers are fired from the next alarm callback (the platform alarm is re-armed with zero delay).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TIMER_MAX_BATCH_SIZE
+#define OPENTHREAD_CONFIG_TIMER_MAX_BATCH_SIZE 8
+#endif
+
 #endif // OPENTHREAD_CORE_DEFAULT_CONFIG_H_
@@ -80,4 +80,18 @@
 #define OPENTHREAD_CONFIG_SRP_SERVER_MAX_ADDRESSES_NUM 2
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+ *
+ * Specifies the number of hash buckets used to look up host names, service instance names and the interned name
+ * storage of the SRP server.
+ *
+ * Lookups stay correct with any size, but they slow down once the number of registered names is much larger than
+ * the number of buckets.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE 32
+#endif
+
 #endif // CONFIG_SRP_SERVER_H_
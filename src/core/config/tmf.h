@@ -40,11 +40,25 @@
  *
  * The number of EID-to-RLOC cache entries.
  *
+ * Cache lookups use a hash index keyed on the EID, so this can be set to a large value (e.g., on a border router)
+ * without slowing down the per-packet lookups.
+ *
  */
 #ifndef OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_RESOURCE_INDEX_SIZE
+ *
+ * The number of slots in the URI path hash index of the TMF agent. It should be at least 4/3 of the number of TMF
+ * resources registered by the enabled features, otherwise requests are dispatched by a walk of the resource list.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_RESOURCE_INDEX_SIZE
+#define OPENTHREAD_CONFIG_TMF_RESOURCE_INDEX_SIZE 64
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_MAX_SNOOP_ENTRIES
  *
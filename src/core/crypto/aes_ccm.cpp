@@ -44,7 +44,8 @@ namespace Crypto {
 
 void AesCcm::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
 {
-    mEcb.SetKey(aKey, CHAR_BIT * aKeyLength);
+    mKeySchedule.SetKey(aKey, CHAR_BIT * aKeyLength);
+    mExternalKeySchedule = nullptr;
 }
 
 void AesCcm::SetKey(const Mac::Key &aMacKey)
@@ -115,7 +116,7 @@ void AesCcm::Init(uint32_t    aHeaderLength,
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    GetKeySchedule().Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -163,7 +164,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
     {
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            GetKeySchedule().Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -177,7 +178,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            GetKeySchedule().Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -204,7 +205,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
                 }
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+            GetKeySchedule().Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
@@ -221,7 +222,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            GetKeySchedule().Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -234,7 +235,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            GetKeySchedule().Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -248,7 +249,7 @@ void AesCcm::Finalize(void *aTag)
 
     OT_ASSERT(mPlainTextCur == mPlainTextLength);
 
-    mEcb.Encrypt(mCtr, mCtrPad);
+    GetKeySchedule().Encrypt(mCtr, mCtrPad);
 
     for (int i = 0; i < mTagLength; i++)
     {
@@ -270,5 +271,42 @@ void AesCcm::GenerateNonce(const Mac::ExtAddress &aAddress,
     aNonce[0] = aSecurityLevel;
 }
 
+otError AesCcm::ProcessBatch(const AesEcb &aKeySchedule, BatchEntry *aEntries, uint16_t aNumEntries, Mode aMode)
+{
+    otError error = OT_ERROR_NONE;
+    AesCcm  aesCcm;
+    uint8_t tag[kMaxTagLength];
+
+    aesCcm.SetKey(aKeySchedule);
+
+    for (uint16_t i = 0; i < aNumEntries; i++)
+    {
+        BatchEntry &entry = aEntries[i];
+
+        aesCcm.Init(entry.mHeaderLength, entry.mPayloadLength, entry.mTagLength, entry.mNonce, kNonceSize);
+        aesCcm.Header(entry.mHeader, entry.mHeaderLength);
+        aesCcm.Payload(entry.mPayload, entry.mPayload, entry.mPayloadLength, aMode);
+
+        entry.mError = OT_ERROR_NONE;
+
+        if (aMode == kEncrypt)
+        {
+            aesCcm.Finalize(entry.mTag);
+        }
+        else
+        {
+            aesCcm.Finalize(tag);
+
+            if (memcmp(tag, entry.mTag, entry.mTagLength) != 0)
+            {
+                entry.mError = OT_ERROR_SECURITY;
+                error        = OT_ERROR_SECURITY;
+            }
+        }
+    }
+
+    return error;
+}
+
 } // namespace Crypto
 } // namespace ot
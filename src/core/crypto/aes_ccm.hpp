@@ -40,6 +40,7 @@
 
 #include <openthread/error.h>
 
+#include "common/non_copyable.hpp"
 #include "crypto/aes_ecb.hpp"
 #include "mac/mac_types.hpp"
 
@@ -57,7 +58,7 @@ namespace Crypto {
  * This class implements AES CCM computation.
  *
  */
-class AesCcm
+class AesCcm : private NonCopyable
 {
 public:
     enum
@@ -77,6 +78,33 @@ public:
         kDecrypt, // Decryption mode.
     };
 
+    /**
+     * This structure represents a single message (e.g., a frame) processed by `ProcessBatch()`.
+     *
+     * The payload is encrypted or decrypted in place.
+     *
+     */
+    struct BatchEntry
+    {
+        const void *   mHeader;        ///< A pointer to the header (authenticated only).
+        uint32_t       mHeaderLength;  ///< Length of header in bytes.
+        void *         mPayload;       ///< A pointer to the payload (processed in place).
+        uint32_t       mPayloadLength; ///< Length of payload in bytes.
+        const uint8_t *mNonce;         ///< A pointer to the nonce (`kNonceSize` bytes).
+        void *         mTag;           ///< A pointer to the tag (output for `kEncrypt`, verified for `kDecrypt`).
+        uint8_t        mTagLength;     ///< Length of tag in bytes.
+        otError        mError;         ///< Set by `ProcessBatch()`: `OT_ERROR_SECURITY` if tag verification failed.
+    };
+
+    /**
+     * This constructor initializes the AES CCM object.
+     *
+     */
+    AesCcm(void)
+        : mExternalKeySchedule(nullptr)
+    {
+    }
+
     /**
      * This method sets the key.
      *
@@ -94,6 +122,17 @@ public:
      */
     void SetKey(const Mac::Key &aMacKey);
 
+    /**
+     * This method sets the key from an already expanded AES key schedule.
+     *
+     * This avoids expanding the key again when the same key is used for many computations. The `AesEcb` object
+     * is referenced (not copied) and MUST remain valid and unchanged until the computation is finalized.
+     *
+     * @param[in]  aKeySchedule   An `AesEcb` object whose key is set.
+     *
+     */
+    void SetKey(const AesEcb &aKeySchedule) { mExternalKeySchedule = &aKeySchedule; }
+
     /**
      * This method initializes the AES CCM computation.
      *
@@ -160,8 +199,31 @@ public:
                               uint8_t                aSecurityLevel,
                               uint8_t *              aNonce);
 
+    /**
+     * This static method performs AES CCM on a batch of messages using the same key.
+     *
+     * The key schedule is expanded once by the caller and shared by all messages in the batch. For `kEncrypt`, the
+     * tag of each entry is generated. For `kDecrypt`, the tag of each entry is verified and `mError` is updated.
+     *
+     * @param[in]    aKeySchedule  An `AesEcb` object whose key is set.
+     * @param[inout] aEntries      An array of batch entries.
+     * @param[in]    aNumEntries   The number of entries in @p aEntries.
+     * @param[in]    aMode         Mode to indicate whether to encrypt (`kEncrypt`) or decrypt (`kDecrypt`).
+     *
+     * @retval OT_ERROR_NONE      All entries were processed successfully.
+     * @retval OT_ERROR_SECURITY  Tag verification failed for at least one entry (check `mError` of each entry).
+     *
+     */
+    static otError ProcessBatch(const AesEcb &aKeySchedule, BatchEntry *aEntries, uint16_t aNumEntries, Mode aMode);
+
 private:
-    AesEcb   mEcb;
+    const AesEcb &GetKeySchedule(void) const
+    {
+        return (mExternalKeySchedule != nullptr) ? *mExternalKeySchedule : mKeySchedule;
+    }
+
+    AesEcb        mKeySchedule;
+    const AesEcb *mExternalKeySchedule; // Key schedule set by `SetKey(const AesEcb &)`, or `nullptr` if `mKeySchedule`.
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
     uint8_t  mCtrPad[AesEcb::kBlockSize];
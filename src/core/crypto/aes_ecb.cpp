@@ -46,9 +46,11 @@ void AesEcb::SetKey(const uint8_t *aKey, uint16_t aKeyLength)
     mbedtls_aes_setkey_enc(&mContext, aKey, aKeyLength);
 }
 
-void AesEcb::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize])
+void AesEcb::Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]) const
 {
-    mbedtls_aes_crypt_ecb(&mContext, MBEDTLS_AES_ENCRYPT, aInput, aOutput);
+    // `mbedtls_aes_crypt_ecb()` takes a non-const context but does not
+    // modify it.
+    mbedtls_aes_crypt_ecb(const_cast<mbedtls_aes_context *>(&mContext), MBEDTLS_AES_ENCRYPT, aInput, aOutput);
 }
 
 AesEcb::~AesEcb(void)
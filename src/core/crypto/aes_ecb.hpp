@@ -84,11 +84,14 @@ public:
     /**
      * This method encrypts data.
      *
+     * Encryption only reads the expanded key schedule, so a single `AesEcb` object may be shared by several
+     * computations (e.g., `AesCcm` objects) using the same key.
+     *
      * @param[in]   aInput   A pointer to the input buffer.
      * @param[out]  aOutput  A pointer to the output buffer.
      *
      */
-    void Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]);
+    void Encrypt(const uint8_t aInput[kBlockSize], uint8_t aOutput[kBlockSize]) const;
 
 private:
     mbedtls_aes_context mContext;
@@ -120,6 +120,9 @@ Mac::Mac(Instance &aInstance)
     , mOobFrame(nullptr)
     , mKeyIdMode2FrameCounter(0)
     , mCcaSampleCount(0)
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+    , mAdaptiveTxPolicyEnabled(false)
+#endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     , mTxError(OT_ERROR_NONE)
 #endif
@@ -130,6 +133,9 @@ Mac::Mac(Instance &aInstance)
 
     mCcaSuccessRateTracker.Clear();
     ResetCounters();
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+    ResetAdaptiveTxCounters();
+#endif
     mExtendedPanId.Clear();
 
     SetEnabled(true);
@@ -1181,6 +1187,9 @@ void Mac::BeginTransmit(void)
         frame = Get<MeshForwarder>().HandleFrameRequest(txFrames);
         VerifyOrExit(frame != nullptr);
         frame->SetSequence(mDataSequence++);
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+        ApplyAdaptiveFrameRetries(*frame, /* aIsDirect */ true);
+#endif
         break;
 
 #if OPENTHREAD_FTD
@@ -1190,6 +1199,9 @@ void Mac::BeginTransmit(void)
         txFrames.SetMaxFrameRetries(mMaxFrameRetriesIndirect);
         frame = Get<DataPollHandler>().HandleFrameRequest(txFrames);
         VerifyOrExit(frame != nullptr);
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+        ApplyAdaptiveFrameRetries(*frame, /* aIsDirect */ false);
+#endif
 
         // If the frame is marked as a retransmission, then data sequence number is already set.
         if (!frame->IsARetransmission())
@@ -1307,6 +1319,10 @@ void Mac::BeginTransmit(void)
     }
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+    ApplyAdaptiveBackoff(*frame);
+#endif
+
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     mLinks.Send(*frame, mTxPendingRadioLinks);
 #else
@@ -1350,6 +1366,150 @@ void Mac::RecordCcaStatus(bool aCcaSuccess, uint8_t aChannel)
     }
 }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+void Mac::SetAdaptiveTxPolicyEnabled(bool aEnabled)
+{
+    VerifyOrExit(mAdaptiveTxPolicyEnabled != aEnabled);
+
+    mAdaptiveTxPolicyEnabled = aEnabled;
+    mLinks.SetMinBackoffExponent(SubMac::kMinBE);
+
+    otLogInfoMac("Adaptive tx policy %s", aEnabled ? "enabled" : "disabled");
+
+exit:
+    return;
+}
+
+void Mac::ApplyAdaptiveBackoff(const TxFrame &aFrame)
+{
+    uint8_t minBackoffExponent = SubMac::kMinBE;
+
+    // The CCA failure rate is only tracked on the PAN channel (see
+    // `RecordCcaStatus()`). A busy channel has more contenders, so
+    // the backoff window is widened by one exponent step for every
+    // `kAdaptiveCcaFailureRateStep` of CCA failure rate.
+
+    if (mAdaptiveTxPolicyEnabled && aFrame.IsCsmaCaEnabled() && (aFrame.GetChannel() == mPanChannel))
+    {
+        minBackoffExponent += static_cast<uint8_t>(GetCcaFailureRate() / kAdaptiveCcaFailureRateStep);
+
+        if (minBackoffExponent > SubMac::kMaxBE)
+        {
+            minBackoffExponent = SubMac::kMaxBE;
+        }
+
+        if (minBackoffExponent > SubMac::kMinBE)
+        {
+            mAdaptiveTxCounters.mBackoffRaised++;
+        }
+    }
+
+    mLinks.SetMinBackoffExponent(minBackoffExponent);
+}
+
+void Mac::ApplyAdaptiveFrameRetries(TxFrame &aFrame, bool aIsDirect)
+{
+    uint8_t   maxFrameRetries = aFrame.GetMaxFrameRetries();
+    uint8_t   frameRetries    = maxFrameRetries;
+    Address   dstAddr;
+    Neighbor *neighbor;
+
+    OT_UNUSED_VARIABLE(aIsDirect);
+
+    VerifyOrExit(mAdaptiveTxPolicyEnabled && aFrame.GetAckRequest());
+    VerifyOrExit(maxFrameRetries > kAdaptiveMinFrameRetries);
+
+    // The neighbor frame error rate is tracked per transmission
+    // attempt (see `RecordFrameTransmitStatus()`), so it is the
+    // chance that one more retry fails as well.
+
+    IgnoreError(aFrame.GetDstAddr(dstAddr));
+    neighbor = Get<NeighborTable>().FindNeighbor(dstAddr);
+
+    if (neighbor != nullptr)
+    {
+        uint16_t frameErrorRate = neighbor->GetLinkInfo().GetFrameErrorRate();
+
+        if (frameErrorRate >= kAdaptiveHopelessFrameErrorRate)
+        {
+            frameRetries = kAdaptiveMinFrameRetries;
+        }
+        else if (frameErrorRate >= kAdaptivePoorFrameErrorRate)
+        {
+            frameRetries = (frameRetries + 1) / 2;
+        }
+    }
+
+#if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
+    {
+        const uint32_t *histogram      = aIsDirect ? mRetryHistogram.mTxDirectRetrySuccess
+                                                   : mRetryHistogram.mTxIndirectRetrySuccess;
+        uint8_t         histogramSize  = aIsDirect ? OT_ARRAY_LENGTH(mRetryHistogram.mTxDirectRetrySuccess)
+                                                   : OT_ARRAY_LENGTH(mRetryHistogram.mTxIndirectRetrySuccess);
+        uint8_t         histogramLimit = GetHistogramRetryLimit(histogram, histogramSize, maxFrameRetries);
+
+        if (histogramLimit < frameRetries)
+        {
+            frameRetries = histogramLimit;
+        }
+    }
+#endif
+
+    if (frameRetries < kAdaptiveMinFrameRetries)
+    {
+        frameRetries = kAdaptiveMinFrameRetries;
+    }
+
+    VerifyOrExit(frameRetries < maxFrameRetries);
+
+    aFrame.SetMaxFrameRetries(frameRetries);
+    mAdaptiveTxCounters.mRetriesLimited++;
+    mAdaptiveTxCounters.mRetriesRemoved += maxFrameRetries - frameRetries;
+
+exit:
+    return;
+}
+
+#if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
+uint8_t Mac::GetHistogramRetryLimit(const uint32_t *aHistogram, uint8_t aHistogramSize, uint8_t aMaxFrameRetries) const
+{
+    // Returns the number of retries that covered
+    // `kAdaptiveHistogramCoverage` percent of the recorded successful
+    // transmissions, plus one so that the limit can grow back when
+    // more retries start to pay off. The histogram only counts
+    // successes up to its size, so it is not used when the current
+    // retry limit goes beyond it.
+
+    uint8_t  limit = aMaxFrameRetries;
+    uint64_t total = 0;
+    uint64_t sum   = 0;
+
+    VerifyOrExit(aMaxFrameRetries < aHistogramSize);
+
+    for (uint8_t retries = 0; retries <= aMaxFrameRetries; retries++)
+    {
+        total += aHistogram[retries];
+    }
+
+    VerifyOrExit(total >= kAdaptiveMinHistogramSamples);
+
+    for (uint8_t retries = 0; retries < aMaxFrameRetries; retries++)
+    {
+        sum += aHistogram[retries];
+
+        if (sum * 100 >= total * kAdaptiveHistogramCoverage)
+        {
+            limit = retries + 1;
+            break;
+        }
+    }
+
+exit:
+    return limit;
+}
+#endif // OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
+#endif // OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+
 void Mac::RecordFrameTransmitStatus(const TxFrame &aFrame,
                                     const RxFrame *aAckFrame,
                                     otError        aError,
@@ -1733,9 +1893,10 @@ otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Ne
     uint8_t           keyIdMode;
     uint32_t          frameCounter;
     uint8_t           keyid;
-    uint32_t          keySequence = 0;
-    const Key *       macKey;
-    const ExtAddress *extAddress;
+    uint32_t              keySequence = 0;
+    const Key *           macKey;
+    const Crypto::AesEcb *keySchedule = nullptr;
+    const ExtAddress *    extAddress;
 
     VerifyOrExit(aFrame.GetSecurityEnabled(), error = OT_ERROR_NONE);
 
@@ -1806,6 +1967,10 @@ otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Ne
             }
         }
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE && OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+        keySchedule = keyManager.GetMacKeySchedule(keySequence, *macKey);
+#endif
+
         extAddress = &aSrcAddr.GetExtended();
 
         break;
@@ -1820,7 +1985,7 @@ otError Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Ne
         OT_UNREACHABLE_CODE(break);
     }
 
-    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey));
+    SuccessOrExit(aFrame.ProcessReceiveAesCcm(*extAddress, *macKey, keySchedule));
 
     if ((keyIdMode == Frame::kKeyIdMode1) && aNeighbor->IsStateValid())
     {
@@ -1871,9 +2036,11 @@ otError Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
     uint32_t    frameCounter;
     Address     srcAddr;
     Address     dstAddr;
-    Neighbor *  neighbor   = nullptr;
-    KeyManager &keyManager = Get<KeyManager>();
-    const Key * macKey;
+    Neighbor *            neighbor   = nullptr;
+    KeyManager &          keyManager = Get<KeyManager>();
+    uint32_t              keySequence;
+    const Key *           macKey;
+    const Crypto::AesEcb *keySchedule = nullptr;
 
     VerifyOrExit(aAckFrame.GetSecurityEnabled(), error = OT_ERROR_NONE);
     VerifyOrExit(aAckFrame.IsVersion2015());
@@ -1920,27 +2087,36 @@ otError Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
 
     if (ackKeyId == (keyManager.GetCurrentKeySequence() & 0x7f))
     {
-        macKey = &mLinks.GetSubMac().GetCurrentMacKey();
+        keySequence = keyManager.GetCurrentKeySequence();
+        macKey      = &mLinks.GetSubMac().GetCurrentMacKey();
     }
     else if (ackKeyId == ((keyManager.GetCurrentKeySequence() - 1) & 0x7f))
     {
-        macKey = &mLinks.GetSubMac().GetPreviousMacKey();
+        keySequence = keyManager.GetCurrentKeySequence() - 1;
+        macKey      = &keyManager.GetTemporaryMacKey(keySequence);
     }
     else if (ackKeyId == ((keyManager.GetCurrentKeySequence() + 1) & 0x7f))
     {
-        macKey = &mLinks.GetSubMac().GetNextMacKey();
+        keySequence = keyManager.GetCurrentKeySequence() + 1;
+        macKey      = &keyManager.GetTemporaryMacKey(keySequence);
     }
     else
     {
         ExitNow();
     }
 
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    keySchedule = keyManager.GetMacKeySchedule(keySequence, *macKey);
+#else
+    OT_UNUSED_VARIABLE(keySequence);
+#endif
+
     if (neighbor->IsStateValid())
     {
         VerifyOrExit(frameCounter >= neighbor->GetLinkAckFrameCounter());
     }
 
-    error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey);
+    error = aAckFrame.ProcessReceiveAesCcm(srcAddr.GetExtended(), *macKey, keySchedule);
     SuccessOrExit(error);
 
     if (neighbor->IsStateValid())
@@ -2580,7 +2756,7 @@ void Mac::ProcessCsl(const RxFrame &aFrame, const Address &aSrcAddr)
                  static_cast<uint32_t>(aFrame.GetTimestamp()), aFrame.GetSequence(), csl->GetPeriod(), csl->GetPhase(),
                  child->GetCslPhase());
 
-    Get<CslTxScheduler>().Update();
+    Get<CslTxScheduler>().Update(*child);
 
 exit:
     return;
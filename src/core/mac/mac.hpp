@@ -56,6 +56,8 @@
 
 namespace ot {
 
+class AdaptiveTxPolicyTester;
+class CslTxSchedulerTester;
 class Neighbor;
 
 /**
@@ -128,6 +130,8 @@ typedef otEnergyScanResult EnergyScanResult;
 class Mac : public InstanceLocator, private NonCopyable
 {
     friend class ot::Instance;
+    friend class ot::AdaptiveTxPolicyTester;
+    friend class ot::CslTxSchedulerTester;
 
 public:
     /**
@@ -662,6 +666,44 @@ public:
      */
     uint16_t GetCcaFailureRate(void) const { return mCcaSuccessRateTracker.GetFailureRate(); }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+    /**
+     * This method indicates whether the adaptive transmit policy is enabled.
+     *
+     * @retval TRUE   The adaptive transmit policy is enabled.
+     * @retval FALSE  The adaptive transmit policy is disabled.
+     *
+     */
+    bool IsAdaptiveTxPolicyEnabled(void) const { return mAdaptiveTxPolicyEnabled; }
+
+    /**
+     * This method enables or disables the adaptive transmit policy.
+     *
+     * When enabled, the minimum CSMA-CA backoff exponent follows the CCA failure rate on the PAN channel, and the
+     * maximum number of frame retries of direct and indirect data frames is lowered for neighbors whose recent frame
+     * error rate shows that retries rarely succeed (and, if the retry histogram is enabled, to the number of retries
+     * that recent successful transmissions actually needed).
+     *
+     * @param[in]  aEnabled  TRUE to enable the adaptive transmit policy, FALSE to disable it.
+     *
+     */
+    void SetAdaptiveTxPolicyEnabled(bool aEnabled);
+
+    /**
+     * This method returns the adaptive transmit policy counters.
+     *
+     * @returns A reference to the adaptive transmit policy counters.
+     *
+     */
+    const otLinkAdaptiveTxCounters &GetAdaptiveTxCounters(void) const { return mAdaptiveTxCounters; }
+
+    /**
+     * This method resets the adaptive transmit policy counters.
+     *
+     */
+    void ResetAdaptiveTxCounters(void) { memset(&mAdaptiveTxCounters, 0, sizeof(mAdaptiveTxCounters)); }
+#endif // OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+
     /**
      * This method Starts/Stops the Link layer. It may only be used when the Netif Interface is down.
      *
@@ -783,6 +825,18 @@ private:
         kMaxAcquisitionId  = 0xffff,
     };
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+    enum
+    {
+        kAdaptiveCcaFailureRateStep     = 0x4000, // Min backoff exponent is raised by one per 25% CCA failure rate.
+        kAdaptivePoorFrameErrorRate     = 0xc000, // Frame error rate (75%) from which retries are halved.
+        kAdaptiveHopelessFrameErrorRate = 0xf000, // Frame error rate (93.75%) from which retries are minimal.
+        kAdaptiveMinFrameRetries        = 1,      // Retries are never lowered below this value.
+        kAdaptiveMinHistogramSamples    = 64,     // Successful frames needed before trusting the retry histogram.
+        kAdaptiveHistogramCoverage      = 99,     // Percentage of successful frames the retry limit must cover.
+    };
+#endif
+
     enum Operation
     {
         kOperationIdle = 0,
@@ -858,6 +912,14 @@ private:
     void LogFrameTxFailure(const TxFrame &aFrame, otError aError, uint8_t aRetryCount, bool aWillRetx) const;
     void LogBeacon(const char *aActionText, const BeaconPayload &aBeaconPayload) const;
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+    void    ApplyAdaptiveBackoff(const TxFrame &aFrame);
+    void    ApplyAdaptiveFrameRetries(TxFrame &aFrame, bool aIsDirect);
+#if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
+    uint8_t GetHistogramRetryLimit(const uint32_t *aHistogram, uint8_t aHistogramSize, uint8_t aMaxFrameRetries) const;
+#endif
+#endif
+
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     uint8_t GetTimeIeOffset(const Frame &aFrame);
 #endif
@@ -943,6 +1005,10 @@ private:
 #if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
     RetryHistogram mRetryHistogram;
 #endif
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+    bool                     mAdaptiveTxPolicyEnabled;
+    otLinkAdaptiveTxCounters mAdaptiveTxCounters;
+#endif
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     RadioTypes mTxPendingRadioLinks;
@@ -1118,10 +1118,11 @@ void TxFrame::CopyFrom(const TxFrame &aFromFrame)
 #endif
 }
 
-void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
+void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress, const Crypto::AesEcb *aKeySchedule)
 {
 #if OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
     OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aKeySchedule);
 #else
     uint32_t       frameCounter = 0;
     uint8_t        securityLevel;
@@ -1136,7 +1137,15 @@ void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(GetAesKey());
+    if (aKeySchedule != nullptr)
+    {
+        aesCcm.SetKey(*aKeySchedule);
+    }
+    else
+    {
+        aesCcm.SetKey(GetAesKey());
+    }
+
     tagLength = GetFooterLength() - GetFcsSize();
 
     aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
@@ -1280,11 +1289,14 @@ exit:
 }
 #endif // OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
 
-otError RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const Key &aMacKey)
+otError RxFrame::ProcessReceiveAesCcm(const ExtAddress &    aExtAddress,
+                                      const Key &           aMacKey,
+                                      const Crypto::AesEcb *aKeySchedule)
 {
 #if OPENTHREAD_RADIO
     OT_UNUSED_VARIABLE(aExtAddress);
     OT_UNUSED_VARIABLE(aMacKey);
+    OT_UNUSED_VARIABLE(aKeySchedule);
 
     return OT_ERROR_NONE;
 #else
@@ -1303,7 +1315,15 @@ otError RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const Key &
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(aMacKey);
+    if (aKeySchedule != nullptr)
+    {
+        aesCcm.SetKey(*aKeySchedule);
+    }
+    else
+    {
+        aesCcm.SetKey(aMacKey);
+    }
+
     tagLength = GetFooterLength() - GetFcsSize();
 
     aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
@@ -43,6 +43,13 @@
 #include "mac/mac_types.hpp"
 
 namespace ot {
+
+namespace Crypto {
+
+class AesEcb;
+
+} // namespace Crypto
+
 namespace Mac {
 
 using ot::Encoding::LittleEndian::HostSwap16;
@@ -1170,12 +1177,16 @@ public:
      * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
      *                          for AES CCM computation.
      * @param[in]  aMacKey      A reference to the MAC key to decrypt the received frame.
+     * @param[in]  aKeySchedule A pointer to an already expanded key schedule of @p aMacKey, or `nullptr` to
+     *                          expand @p aMacKey for this frame.
      *
      * @retval OT_ERROR_NONE      Process of received frame AES CCM succeeded.
      * @retval OT_ERROR_SECURITY  Received frame MIC check failed.
      *
      */
-    otError ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const Key &aMacKey);
+    otError ProcessReceiveAesCcm(const ExtAddress &    aExtAddress,
+                                 const Key &           aMacKey,
+                                 const Crypto::AesEcb *aKeySchedule = nullptr);
 
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     /**
@@ -1316,9 +1327,11 @@ public:
      *
      * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
      *                          for AES CCM computation.
+     * @param[in]  aKeySchedule A pointer to an already expanded key schedule of the frame's AES key, or `nullptr`
+     *                          to expand the key for this frame.
      *
      */
-    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress);
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress, const Crypto::AesEcb *aKeySchedule = nullptr);
 
     /**
      * This method indicates whether or not the frame has security processed.
@@ -223,18 +223,7 @@ const Key *Links::GetTemporaryMacKey(const Frame &aFrame, uint32_t aKeySequence)
     if (radioType == kRadioTypeIeee802154)
 #endif
     {
-        if (aKeySequence == Get<KeyManager>().GetCurrentKeySequence() - 1)
-        {
-            ExitNow(key = &Get<SubMac>().GetPreviousMacKey());
-        }
-        else if (aKeySequence == Get<KeyManager>().GetCurrentKeySequence() + 1)
-        {
-            ExitNow(key = &Get<SubMac>().GetNextMacKey());
-        }
-        else
-        {
-            OT_ASSERT(false);
-        }
+        ExitNow(key = &Get<KeyManager>().GetTemporaryMacKey(aKeySequence));
     }
 #endif
 
@@ -414,6 +414,20 @@ public:
         OT_UNUSED_VARIABLE(aRxOnWhenBackoff);
     }
 
+    /**
+     * This method sets the minimum CSMA-CA backoff exponent used by the IEEE 802.15.4 radio link.
+     *
+     * @param[in]  aMinBackoffExponent  The minimum CSMA-CA backoff exponent.
+     *
+     */
+    void SetMinBackoffExponent(uint8_t aMinBackoffExponent)
+    {
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+        mSubMac.SetMinBackoffExponent(aMinBackoffExponent);
+#endif
+        OT_UNUSED_VARIABLE(aMinBackoffExponent);
+    }
+
     /**
      * This method enables all radio links.
      *
@@ -90,6 +90,30 @@ void ExtAddress::CopyAddress(uint8_t *aDst, const uint8_t *aSrc, CopyByteOrder a
     }
 }
 
+bool Address::operator==(const Address &aOther) const
+{
+    bool equal = (mType == aOther.mType);
+
+    VerifyOrExit(equal);
+
+    switch (mType)
+    {
+    case kTypeShort:
+        equal = (GetShort() == aOther.GetShort());
+        break;
+
+    case kTypeExtended:
+        equal = (GetExtended() == aOther.GetExtended());
+        break;
+
+    case kTypeNone:
+        break;
+    }
+
+exit:
+    return equal;
+}
+
 Address::InfoString Address::ToString(void) const
 {
     return (mType == kTypeExtended) ? GetExtended().ToString()
@@ -54,6 +54,7 @@ SubMac::SubMac(Instance &aInstance)
     , mRadioCaps(Get<Radio>().GetCaps())
     , mState(kStateDisabled)
     , mCsmaBackoffs(0)
+    , mMinBackoffExponent(kMinBE)
     , mTransmitRetries(0)
     , mShortAddress(kShortAddrInvalid)
     , mRxOnWhenBackoff(true)
@@ -338,16 +339,21 @@ void SubMac::ProcessTransmitSecurity(void)
     VerifyOrExit(mTransmitFrame.GetTimeIeOffset() == 0);
 #endif
 
-    mTransmitFrame.ProcessTransmitAesCcm(*extAddress);
+    mTransmitFrame.ProcessTransmitAesCcm(*extAddress, mCallbacks.GetCurrentMacKeySchedule(GetCurrentMacKey()));
 
 exit:
     return;
 }
 
+void SubMac::SetMinBackoffExponent(uint8_t aMinBackoffExponent)
+{
+    mMinBackoffExponent = (aMinBackoffExponent < kMaxBE) ? aMinBackoffExponent : static_cast<uint8_t>(kMaxBE);
+}
+
 void SubMac::StartCsmaBackoff(void)
 {
     uint32_t backoff;
-    uint32_t backoffExponent = kMinBE + mTransmitRetries + mCsmaBackoffs;
+    uint32_t backoffExponent = mMinBackoffExponent + mTransmitRetries + mCsmaBackoffs;
 
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     if (mTransmitFrame.mInfo.mTxInfo.mTxDelay != 0)
@@ -83,6 +83,8 @@ public:
     enum
     {
         kInvalidRssiValue = 127, ///< Invalid Received Signal Strength Indicator (RSSI) value.
+        kMinBE            = 3,   ///< macMinBE (IEEE 802.15.4-2006).
+        kMaxBE            = 5,   ///< macMaxBE (IEEE 802.15.4-2006).
     };
 
     /**
@@ -176,6 +178,16 @@ public:
          *
          */
         void FrameCounterUpdated(uint32_t aFrameCounter);
+
+        /**
+         * This method gets the expanded AES key schedule of the current MAC key, if one is available.
+         *
+         * @param[in]  aCurrKey  The current MAC key.
+         *
+         * @returns A pointer to the key schedule of @p aCurrKey, or `nullptr` if the key should be expanded per frame.
+         *
+         */
+        const Crypto::AesEcb *GetCurrentMacKeySchedule(const Key &aCurrKey);
     };
 
     /**
@@ -260,6 +272,24 @@ public:
      */
     void SetRxOnWhenBackoff(bool aRxOnWhenBackoff) { mRxOnWhenBackoff = aRxOnWhenBackoff; }
 
+    /**
+     * This method returns the minimum CSMA-CA backoff exponent (macMinBE).
+     *
+     * @returns The minimum CSMA-CA backoff exponent.
+     *
+     */
+    uint8_t GetMinBackoffExponent(void) const { return mMinBackoffExponent; }
+
+    /**
+     * This method sets the minimum CSMA-CA backoff exponent (macMinBE).
+     *
+     * The new value applies from the next frame transmission and is limited to `kMaxBE`.
+     *
+     * @param[in]  aMinBackoffExponent  The minimum CSMA-CA backoff exponent.
+     *
+     */
+    void SetMinBackoffExponent(uint8_t aMinBackoffExponent);
+
     /**
      * This method enables the radio.
      *
@@ -509,8 +539,6 @@ private:
 
     enum
     {
-        kMinBE             = 3,   ///< macMinBE (IEEE 802.15.4-2006).
-        kMaxBE             = 5,   ///< macMaxBE (IEEE 802.15.4-2006).
         kUnitBackoffPeriod = 20,  ///< Number of symbols (IEEE 802.15.4-2006).
         kMinBackoff        = 1,   ///< Minimum backoff (milliseconds).
         kAckTimeout        = 16,  ///< Timeout for waiting on an ACK (milliseconds).
@@ -602,6 +630,7 @@ private:
     otRadioCaps        mRadioCaps;
     State              mState;
     uint8_t            mCsmaBackoffs;
+    uint8_t            mMinBackoffExponent;
     uint8_t            mTransmitRetries;
     ShortAddress       mShortAddress;
     ExtAddress         mExtAddress;
@@ -112,6 +112,17 @@ void SubMac::Callbacks::FrameCounterUpdated(uint32_t aFrameCounter)
     Get<KeyManager>().MacFrameCounterUpdated(aFrameCounter);
 }
 
+const Crypto::AesEcb *SubMac::Callbacks::GetCurrentMacKeySchedule(const Key &aCurrKey)
+{
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    return Get<KeyManager>().GetMacKeySchedule(Get<KeyManager>().GetCurrentKeySequence(), aCurrKey);
+#else
+    OT_UNUSED_VARIABLE(aCurrKey);
+
+    return nullptr;
+#endif
+}
+
 #elif OPENTHREAD_RADIO
 
 void SubMac::Callbacks::ReceiveDone(RxFrame *aFrame, otError aError)
@@ -147,6 +158,13 @@ void SubMac::Callbacks::FrameCounterUpdated(uint32_t aFrameCounter)
     OT_UNUSED_VARIABLE(aFrameCounter);
 }
 
+const Crypto::AesEcb *SubMac::Callbacks::GetCurrentMacKeySchedule(const Key &aCurrKey)
+{
+    OT_UNUSED_VARIABLE(aCurrKey);
+
+    return nullptr;
+}
+
 #endif // OPENTHREAD_RADIO
 
 } // namespace Mac
@@ -33,6 +33,8 @@
 
 #include "checksum.hpp"
 
+#include <string.h>
+
 #include "common/code_utils.hpp"
 #include "common/message.hpp"
 #include "net/icmp6.hpp"
@@ -68,6 +70,54 @@ void Checksum::AddUint16(uint16_t aUint16)
 
 void Checksum::AddData(const uint8_t *aBuffer, uint16_t aLength)
 {
+    uint64_t sum = 0;
+    uint16_t value;
+
+    // Align the data on the 16-bit word boundary (of the checksum)
+    // if previously added data had an odd length.
+
+    if (mAtOddIndex && (aLength > 0))
+    {
+        AddUint8(*aBuffer++);
+        aLength--;
+    }
+
+    // The one's complement sum is independent of the byte order, so
+    // the data is added 64-bit word at a time in host byte order with
+    // end-around carry (RFC 1071) and then folded to 16 bits.
+
+    while (aLength >= sizeof(uint64_t))
+    {
+        uint64_t word;
+
+        memcpy(&word, aBuffer, sizeof(word));
+        sum += word;
+
+        if (sum < word)
+        {
+            sum++;
+        }
+
+        aBuffer += sizeof(uint64_t);
+        aLength -= sizeof(uint64_t);
+    }
+
+    sum = (sum & 0xffffffff) + (sum >> 32);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+
+    value = Encoding::BigEndian::HostSwap16(static_cast<uint16_t>(sum));
+
+    mValue += value;
+
+    if (mValue < value)
+    {
+        mValue++;
+    }
+
+    // Add the remaining bytes (if any).
+
     for (uint16_t i = 0; i < aLength; i++)
     {
         AddUint8(aBuffer[i]);
@@ -93,8 +143,7 @@ void Checksum::Calculate(const Ip6::Address &aSource,
                          uint8_t             aIpProto,
                          const Message &     aMessage)
 {
-    Message::Chunk chunk;
-    uint16_t       length = aMessage.GetLength() - aMessage.GetOffset();
+    uint16_t length = aMessage.GetLength() - aMessage.GetOffset();
 
     // Pseudo-header for checksum calculation (RFC-2460).
 
@@ -105,12 +154,9 @@ void Checksum::Calculate(const Ip6::Address &aSource,
 
     // Add message content (from offset to the end) to checksum.
 
-    aMessage.GetFirstChunk(aMessage.GetOffset(), length, chunk);
-
-    while (chunk.GetLength() > 0)
+    for (Message::Cursor cursor(aMessage, aMessage.GetOffset(), length); !cursor.IsAtEnd(); cursor.Advance())
     {
-        AddData(chunk.GetData(), chunk.GetLength());
-        aMessage.GetNextChunk(length, chunk);
+        AddData(cursor.GetData(), cursor.GetLength());
     }
 }
 
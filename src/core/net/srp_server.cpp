@@ -33,12 +33,16 @@
 
 #include "srp_server.hpp"
 
+#include <stddef.h>
+
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
 
+#include "common/hash.hpp"
 #include "common/instance.hpp"
 #include "common/locator-getters.hpp"
 #include "common/logging.hpp"
 #include "common/new.hpp"
+#include "common/numeric_limits.hpp"
 #include "net/dns_headers.hpp"
 #include "thread/network_data_local.hpp"
 #include "thread/network_data_notifier.hpp"
@@ -87,14 +91,22 @@ Server::Server(Instance &aInstance)
     , mMinKeyLease(kDefaultMinKeyLease)
     , mMaxKeyLease(kDefaultMaxKeyLease)
     , mLeaseTimer(aInstance, HandleLeaseTimer, this)
+    , mLeaseHeap(nullptr)
+    , mLeaseHeapSize(0)
+    , mLeaseHeapCapacity(0)
     , mOutstandingUpdatesTimer(aInstance, HandleOutstandingUpdatesTimer, this)
     , mEnabled(false)
 {
+    memset(mNameTable, 0, sizeof(mNameTable));
+    memset(mHostIndex, 0, sizeof(mHostIndex));
+    memset(mServiceIndex, 0, sizeof(mServiceIndex));
+
     IgnoreError(SetDomain(kDefaultDomain));
 }
 
 Server::~Server(void)
 {
+    GetInstance().HeapFree(mLeaseHeap);
     GetInstance().HeapFree(mDomain);
 }
 
@@ -209,41 +221,356 @@ const Server::Host *Server::GetNextHost(const Server::Host *aHost)
 }
 
 // This method adds a SRP service host and takes ownership of it.
-// The caller MUST make sure that there is no existing host with the same hostname.
+// The caller MUST make sure that there is no existing host with the same hostname
+// and that an entry of the lease heap has been reserved for it.
 void Server::AddHost(Host *aHost)
 {
-    OT_ASSERT(mHosts.FindMatching(aHost->GetFullName()) == nullptr);
+    OT_ASSERT(FindHost(aHost->GetFullName()) == nullptr);
     IgnoreError(mHosts.Add(*aHost));
+    IndexHost(*aHost);
+    AddToLeaseHeap(*aHost);
 }
 
 void Server::RemoveAndFreeHost(Host *aHost)
 {
     otLogInfoSrp("[server] fully remove host %s", aHost->GetFullName());
+    RemoveFromLeaseHeap(*aHost);
+    UnindexHost(*aHost);
     IgnoreError(mHosts.Remove(*aHost));
     aHost->Free();
 }
 
-Server::Service *Server::FindService(const char *aFullName)
+void Server::RemoveAndFreeService(Host &aHost, Service &aService)
 {
-    Service *service = nullptr;
+    UnindexService(aService);
+    aHost.RemoveAndFreeService(&aService);
+}
+
+uint32_t Server::HashName(const char *aName)
+{
+    Fnv1aHash hash;
+
+    hash.UpdateString(aName);
+
+    return hash.GetHash();
+}
+
+Server::InternedName &Server::GetInternedName(const char *aName)
+{
+    // `aName` MUST have been returned by `InternName()`.
+    return *reinterpret_cast<InternedName *>(const_cast<char *>(aName) - offsetof(InternedName, mName));
+}
+
+uint16_t Server::GetIndexBucket(const char *aName)
+{
+    return static_cast<uint16_t>(GetInternedName(aName).mHash % kNameIndexSize);
+}
+
+const Server::InternedName *Server::FindInternedName(const char *aName) const
+{
+    uint32_t            hash  = HashName(aName);
+    const InternedName *entry = mNameTable[hash % kNameIndexSize];
+
+    for (; entry != nullptr; entry = entry->mNext)
+    {
+        if (entry->mHash == hash && strcmp(entry->mName, aName) == 0)
+        {
+            break;
+        }
+    }
+
+    return entry;
+}
+
+// This method returns the interned copy of `aName`, or nullptr if no memory
+// is available. Every successful call MUST be paired with `ReleaseName()`.
+const char *Server::InternName(const char *aName)
+{
+    const char *  name  = nullptr;
+    InternedName *entry = const_cast<InternedName *>(FindInternedName(aName));
+
+    if (entry == nullptr)
+    {
+        size_t length = strlen(aName);
+
+        entry = static_cast<InternedName *>(GetInstance().HeapCAlloc(1, offsetof(InternedName, mName) + length + 1));
+        VerifyOrExit(entry != nullptr);
+
+        memcpy(entry->mName, aName, length + 1);
+        entry->mHash = HashName(aName);
+        entry->mNext = mNameTable[entry->mHash % kNameIndexSize];
+
+        mNameTable[entry->mHash % kNameIndexSize] = entry;
+    }
+
+    OT_ASSERT(entry->mRefCount < NumericLimits<uint16_t>::Max());
+    entry->mRefCount++;
+    name = entry->mName;
+
+exit:
+    return name;
+}
+
+void Server::ReleaseName(const char *aName)
+{
+    InternedName & entry = GetInternedName(aName);
+    InternedName **link;
+
+    OT_ASSERT(entry.mRefCount > 0);
+    VerifyOrExit(--entry.mRefCount == 0);
+
+    for (link = &mNameTable[entry.mHash % kNameIndexSize]; *link != nullptr; link = &(*link)->mNext)
+    {
+        if (*link == &entry)
+        {
+            *link = entry.mNext;
+            break;
+        }
+    }
+
+    GetInstance().HeapFree(&entry);
+
+exit:
+    return;
+}
+
+void Server::IndexHost(Host &aHost)
+{
+    uint16_t bucket = GetIndexBucket(aHost.mFullName);
+
+    aHost.mNextInIndex = mHostIndex[bucket];
+    mHostIndex[bucket] = &aHost;
+
+    for (Service *service = aHost.GetNextService(nullptr); service != nullptr; service = service->GetNext())
+    {
+        IndexService(*service);
+    }
+}
+
+void Server::UnindexHost(Host &aHost)
+{
+    Host **link = &mHostIndex[GetIndexBucket(aHost.mFullName)];
+
+    for (; *link != nullptr; link = &(*link)->mNextInIndex)
+    {
+        if (*link == &aHost)
+        {
+            *link = aHost.mNextInIndex;
+            break;
+        }
+    }
 
-    for (Host *host = mHosts.GetHead(); host != nullptr; host = host->GetNext())
+    aHost.mNextInIndex = nullptr;
+
+    for (Service *service = aHost.GetNextService(nullptr); service != nullptr; service = service->GetNext())
+    {
+        UnindexService(*service);
+    }
+}
+
+void Server::IndexService(Service &aService)
+{
+    uint16_t bucket = GetIndexBucket(aService.mFullName);
+
+    aService.mNextInIndex = mServiceIndex[bucket];
+    mServiceIndex[bucket] = &aService;
+}
+
+void Server::UnindexService(Service &aService)
+{
+    Service **link = &mServiceIndex[GetIndexBucket(aService.mFullName)];
+
+    for (; *link != nullptr; link = &(*link)->mNextInIndex)
+    {
+        if (*link == &aService)
+        {
+            *link = aService.mNextInIndex;
+            break;
+        }
+    }
+
+    aService.mNextInIndex = nullptr;
+}
+
+Server::Host *Server::FindHost(const char *aFullName)
+{
+    Host *              host = nullptr;
+    const InternedName *name = FindInternedName(aFullName);
+
+    // A name which is not interned is not used by any host.
+    VerifyOrExit(name != nullptr);
+
+    for (host = mHostIndex[name->mHash % kNameIndexSize]; host != nullptr; host = host->mNextInIndex)
+    {
+        if (host->mFullName == name->mName)
+        {
+            break;
+        }
+    }
+
+exit:
+    return host;
+}
+
+// This method finds a service of the registered hosts by its instance name. The
+// search is restricted to the services of `aHost` if it is not nullptr.
+Server::Service *Server::FindService(const char *aFullName, const Host *aHost)
+{
+    Service *           service = nullptr;
+    const InternedName *name    = FindInternedName(aFullName);
+
+    VerifyOrExit(name != nullptr);
+
+    for (service = mServiceIndex[name->mHash % kNameIndexSize]; service != nullptr; service = service->mNextInIndex)
     {
-        service = host->FindService(aFullName);
-        if (service != nullptr)
+        if (service->mFullName == name->mName && (aHost == nullptr || &service->GetHost() == aHost))
         {
             break;
         }
     }
 
+exit:
     return service;
 }
 
+otError Server::ReserveLeaseHeapEntry(void)
+{
+    otError  error = OT_ERROR_NONE;
+    uint16_t capacity;
+    Host **  heap;
+
+    VerifyOrExit(mLeaseHeapSize == mLeaseHeapCapacity);
+    VerifyOrExit(mLeaseHeapCapacity < kMaxLeaseHeapCapacity, error = OT_ERROR_NO_BUFS);
+
+    capacity = (mLeaseHeapCapacity == 0)
+                   ? static_cast<uint16_t>(kLeaseHeapInitCapacity)
+                   : static_cast<uint16_t>(OT_MIN(2 * mLeaseHeapCapacity, static_cast<int>(kMaxLeaseHeapCapacity)));
+
+    heap = static_cast<Host **>(GetInstance().HeapCAlloc(capacity, sizeof(Host *)));
+    VerifyOrExit(heap != nullptr, error = OT_ERROR_NO_BUFS);
+
+    memcpy(heap, mLeaseHeap, mLeaseHeapSize * sizeof(Host *));
+    GetInstance().HeapFree(mLeaseHeap);
+
+    mLeaseHeap         = heap;
+    mLeaseHeapCapacity = capacity;
+
+exit:
+    return error;
+}
+
+void Server::AddToLeaseHeap(Host &aHost)
+{
+    OT_ASSERT(mLeaseHeapSize < mLeaseHeapCapacity);
+
+    SetLeaseHeapEntry(mLeaseHeapSize++, aHost);
+    MoveUpInLeaseHeap(aHost.mLeaseHeapIndex);
+}
+
+void Server::RemoveFromLeaseHeap(Host &aHost)
+{
+    uint16_t index = aHost.mLeaseHeapIndex;
+
+    VerifyOrExit(index != kNotInLeaseHeap);
+
+    aHost.mLeaseHeapIndex = kNotInLeaseHeap;
+    mLeaseHeapSize--;
+
+    VerifyOrExit(index != mLeaseHeapSize);
+
+    SetLeaseHeapEntry(index, *mLeaseHeap[mLeaseHeapSize]);
+    MoveUpInLeaseHeap(index);
+    MoveDownInLeaseHeap(mLeaseHeap[index]->mLeaseHeapIndex);
+
+exit:
+    return;
+}
+
+void Server::MoveUpInLeaseHeap(uint16_t aIndex)
+{
+    Host &host = *mLeaseHeap[aIndex];
+
+    while (aIndex > 0)
+    {
+        uint16_t parent = (aIndex - 1) / 2;
+
+        if (mLeaseHeap[parent]->mNextExpireTime <= host.mNextExpireTime)
+        {
+            break;
+        }
+
+        SetLeaseHeapEntry(aIndex, *mLeaseHeap[parent]);
+        aIndex = parent;
+    }
+
+    SetLeaseHeapEntry(aIndex, host);
+}
+
+void Server::MoveDownInLeaseHeap(uint16_t aIndex)
+{
+    Host &host = *mLeaseHeap[aIndex];
+
+    while (2 * aIndex + 1 < mLeaseHeapSize)
+    {
+        uint16_t child = 2 * aIndex + 1;
+
+        if ((child + 1 < mLeaseHeapSize) &&
+            (mLeaseHeap[child + 1]->mNextExpireTime < mLeaseHeap[child]->mNextExpireTime))
+        {
+            child++;
+        }
+
+        if (host.mNextExpireTime <= mLeaseHeap[child]->mNextExpireTime)
+        {
+            break;
+        }
+
+        SetLeaseHeapEntry(aIndex, *mLeaseHeap[child]);
+        aIndex = child;
+    }
+
+    SetLeaseHeapEntry(aIndex, host);
+}
+
+void Server::SetLeaseHeapEntry(uint16_t aIndex, Host &aHost)
+{
+    mLeaseHeap[aIndex]    = &aHost;
+    aHost.mLeaseHeapIndex = aIndex;
+}
+
+// This method re-evaluates the lease expiry of a registered host after it
+// has been updated, and re-schedules the lease timer.
+void Server::UpdateLeaseSchedule(Host &aHost)
+{
+    TimeMilli now = TimerMilli::GetNow();
+
+    OT_ASSERT(aHost.mLeaseHeapIndex != kNotInLeaseHeap);
+
+    aHost.mNextExpireTime = (aHost.GetKeyExpireTime() <= now) ? now : ExpireLeases(aHost, now);
+    MoveUpInLeaseHeap(aHost.mLeaseHeapIndex);
+    MoveDownInLeaseHeap(aHost.mLeaseHeapIndex);
+
+    ScheduleLeaseTimer();
+}
+
+void Server::ScheduleLeaseTimer(void)
+{
+    if (mLeaseHeapSize > 0)
+    {
+        mLeaseTimer.FireAt(mLeaseHeap[0]->mNextExpireTime);
+    }
+    else
+    {
+        otLogInfoSrp("[server] lease timer is stopped");
+        mLeaseTimer.Stop();
+    }
+}
+
 bool Server::HasNameConflictsWith(Host &aHost)
 {
     bool           hasConflicts = false;
     const Service *service      = nullptr;
-    Host *         existingHost = mHosts.FindMatching(aHost.GetFullName());
+    Host *         existingHost = FindHost(aHost.GetFullName());
 
     if (existingHost != nullptr && *aHost.GetKey() != *existingHost->GetKey())
     {
@@ -253,7 +580,7 @@ bool Server::HasNameConflictsWith(Host &aHost)
     // Check not only services of this host but all hosts.
     while ((service = aHost.GetNextService(service)) != nullptr)
     {
-        Service *existingService = FindService(service->mFullName);
+        Service *existingService = FindService(service->mFullName, nullptr);
         if (existingService != nullptr && *service->GetHost().GetKey() != *existingService->GetHost().GetKey())
         {
             ExitNow(hasConflicts = true);
@@ -316,7 +643,7 @@ void Server::HandleSrpUpdateResult(otError                  aError,
     aHost.SetLease(grantedLease);
     aHost.SetKeyLease(grantedKeyLease);
 
-    existingHost = mHosts.FindMatching(aHost.GetFullName());
+    existingHost = FindHost(aHost.GetFullName());
 
     if (aHost.GetLease() == 0)
     {
@@ -327,6 +654,7 @@ void Server::HandleSrpUpdateResult(otError                  aError,
             if (existingHost != nullptr)
             {
                 RemoveAndFreeHost(existingHost);
+                ScheduleLeaseTimer();
             }
         }
         else if (existingHost != nullptr)
@@ -343,6 +671,8 @@ void Server::HandleSrpUpdateResult(otError                  aError,
             {
                 service->DeleteResourcesButRetainName();
             }
+
+            UpdateLeaseSchedule(*existingHost);
         }
 
         aHost.Free();
@@ -358,7 +688,7 @@ void Server::HandleSrpUpdateResult(otError                  aError,
         existingHost->CopyResourcesFrom(aHost);
         while ((service = aHost.GetNextService(service)) != nullptr)
         {
-            Service *existingService = existingHost->FindService(service->mFullName);
+            Service *existingService = FindService(service->mFullName, existingHost);
 
             if (service->mIsDeleted)
             {
@@ -369,26 +699,51 @@ void Server::HandleSrpUpdateResult(otError                  aError,
             }
             else
             {
-                Service *newService = existingHost->AddService(service->mFullName);
+                Service *newService = existingService;
+
+                if (newService == nullptr)
+                {
+                    newService = existingHost->AddNewService(service->mFullName);
+
+                    if (newService == nullptr)
+                    {
+                        aError = OT_ERROR_NO_BUFS;
+                        break;
+                    }
+
+                    IndexService(*newService);
+                }
+
+                if ((aError = newService->CopyResourcesFrom(*service)) != OT_ERROR_NONE)
+                {
+                    break;
+                }
 
-                VerifyOrExit(newService != nullptr, aError = OT_ERROR_NO_BUFS);
-                SuccessOrExit(aError = newService->CopyResourcesFrom(*service));
                 otLogInfoSrp("[server] %s service %s", (existingService != nullptr) ? "update existing" : "add new",
                              service->mFullName);
             }
         }
 
+        // The services merged so far are kept even if merging another
+        // one failed, so the update is always freed and the lease of
+        // the existing host rescheduled.
+
         aHost.Free();
+        UpdateLeaseSchedule(*existingHost);
     }
     else
     {
+        if (ReserveLeaseHeapEntry() != OT_ERROR_NONE)
+        {
+            aHost.Free();
+            ExitNow(aError = OT_ERROR_NO_BUFS);
+        }
+
         otLogInfoSrp("[server] add new host %s", aHost.GetFullName());
         AddHost(&aHost);
+        UpdateLeaseSchedule(aHost);
     }
 
-    // Re-schedule the lease timer.
-    HandleLeaseTimer();
-
 exit:
     if (aError == OT_ERROR_NONE && !(grantedLease == hostLease && grantedKeyLease == hostKeyLease))
     {
@@ -438,6 +793,14 @@ void Server::Stop(void)
         mOutstandingUpdates.Pop()->Free();
     }
 
+    memset(mHostIndex, 0, sizeof(mHostIndex));
+    memset(mServiceIndex, 0, sizeof(mServiceIndex));
+
+    GetInstance().HeapFree(mLeaseHeap);
+    mLeaseHeap         = nullptr;
+    mLeaseHeapSize     = 0;
+    mLeaseHeapCapacity = 0;
+
     mLeaseTimer.Stop();
     mOutstandingUpdatesTimer.Stop();
 
@@ -974,7 +1337,7 @@ void Server::HandleUpdate(const Dns::UpdateHeader &aDnsHeader, Host *aHost, cons
 
     if (aHost->GetLease() == 0)
     {
-        Host *existingHost = mHosts.FindMatching(aHost->GetFullName());
+        Host *existingHost = FindHost(aHost->GetFullName());
 
         aHost->ClearResources();
 
@@ -1141,117 +1504,99 @@ void Server::HandleLeaseTimer(Timer &aTimer)
 
 void Server::HandleLeaseTimer(void)
 {
-    TimeMilli now                = TimerMilli::GetNow();
-    TimeMilli earliestExpireTime = now.GetDistantFuture();
-    Host *    host               = mHosts.GetHead();
+    TimeMilli now = TimerMilli::GetNow();
 
-    while (host != nullptr)
+    // Only the hosts at the top of the lease heap have anything expired.
+    while (mLeaseHeapSize > 0 && mLeaseHeap[0]->mNextExpireTime <= now)
     {
-        Host *nextHost = host->GetNext();
+        Host &host = *mLeaseHeap[0];
 
-        if (host->GetKeyExpireTime() <= now)
+        if (host.GetKeyExpireTime() <= now)
         {
-            otLogInfoSrp("[server] KEY LEASE of host %s expired", host->GetFullName());
+            otLogInfoSrp("[server] KEY LEASE of host %s expired", host.GetFullName());
 
             // Removes the whole host and all services if the KEY RR expired.
-            RemoveAndFreeHost(host);
+            RemoveAndFreeHost(&host);
         }
-        else if (host->IsDeleted())
+        else
         {
-            // The host has been deleted, but the hostname & service instance names retain.
-
-            Service *service;
-
-            earliestExpireTime = OT_MIN(earliestExpireTime, host->GetKeyExpireTime());
+            host.mNextExpireTime = ExpireLeases(host, now);
+            MoveDownInLeaseHeap(0);
+        }
+    }
 
-            // Check if any service instance name expired.
-            service = host->GetNextService(nullptr);
-            while (service != nullptr)
-            {
-                OT_ASSERT(service->mIsDeleted);
+    ScheduleLeaseTimer();
+}
 
-                Service *nextService = service->GetNext();
+// This method deletes the resources of a host and its services whose LEASE
+// expired and removes the service instance names whose KEY LEASE expired. The
+// KEY LEASE of the host MUST NOT have expired. It returns the next time at which
+// anything of the host expires, which is always later than `aNow`.
+TimeMilli Server::ExpireLeases(Host &aHost, TimeMilli aNow)
+{
+    TimeMilli earliestExpireTime = aHost.GetKeyExpireTime();
+    Service * service;
 
-                if (service->GetKeyExpireTime() <= now)
-                {
-                    otLogInfoSrp("[server] KEY LEASE of service %s expired", service->mFullName);
-                    host->RemoveAndFreeService(service);
-                }
-                else
-                {
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetKeyExpireTime());
-                }
+    OT_ASSERT(earliestExpireTime > aNow);
 
-                service = nextService;
-            }
-        }
-        else if (host->GetExpireTime() <= now)
+    if (!aHost.IsDeleted())
+    {
+        if (aHost.GetExpireTime() <= aNow)
         {
-            Service *service = nullptr;
-
-            otLogInfoSrp("[server] LEASE of host %s expired", host->GetFullName());
+            otLogInfoSrp("[server] LEASE of host %s expired", aHost.GetFullName());
 
             // If the host expired, delete all resources of this host and its services.
-            host->DeleteResourcesButRetainName();
-            while ((service = host->GetNextService(service)) != nullptr)
+            aHost.DeleteResourcesButRetainName();
+            for (service = aHost.GetNextService(nullptr); service != nullptr; service = service->GetNext())
             {
                 service->DeleteResourcesButRetainName();
             }
-
-            earliestExpireTime = OT_MIN(earliestExpireTime, host->GetKeyExpireTime());
         }
         else
         {
-            // The host doesn't expire, check if any service expired or is explicitly removed.
-
-            OT_ASSERT(!host->IsDeleted());
+            earliestExpireTime = OT_MIN(earliestExpireTime, aHost.GetExpireTime());
+        }
+    }
 
-            Service *service = host->GetNextService(nullptr);
+    service = aHost.GetNextService(nullptr);
 
-            earliestExpireTime = OT_MIN(earliestExpireTime, host->GetExpireTime());
+    while (service != nullptr)
+    {
+        Service *nextService = service->GetNext();
 
-            while (service != nullptr)
+        if (!service->mIsDeleted)
+        {
+            if (service->GetExpireTime() <= aNow)
             {
-                Service *nextService = service->GetNext();
+                otLogInfoSrp("[server] LEASE of service %s expired", service->mFullName);
 
-                if (service->mIsDeleted)
-                {
-                    // The service has been deleted but the name retains.
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetKeyExpireTime());
-                }
-                else if (service->GetExpireTime() <= now)
-                {
-                    otLogInfoSrp("[server] LEASE of service %s expired", service->mFullName);
-
-                    // The service gets expired, delete it.
-                    service->DeleteResourcesButRetainName();
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetKeyExpireTime());
-                }
-                else
-                {
-                    earliestExpireTime = OT_MIN(earliestExpireTime, service->GetExpireTime());
-                }
-
-                service = nextService;
+                // The service gets expired, delete it.
+                service->DeleteResourcesButRetainName();
+            }
+            else
+            {
+                earliestExpireTime = OT_MIN(earliestExpireTime, service->GetExpireTime());
             }
         }
 
-        host = nextHost;
-    }
-
-    if (earliestExpireTime != now.GetDistantFuture())
-    {
-        if (!mLeaseTimer.IsRunning() || earliestExpireTime <= mLeaseTimer.GetFireTime())
+        // The service has been deleted but the name retains until its KEY LEASE expires.
+        if (service->mIsDeleted)
         {
-            otLogInfoSrp("[server] lease timer is scheduled for %u seconds", (earliestExpireTime - now) / 1000);
-            mLeaseTimer.StartAt(earliestExpireTime, 0);
+            if (service->GetKeyExpireTime() <= aNow)
+            {
+                otLogInfoSrp("[server] KEY LEASE of service %s expired", service->mFullName);
+                RemoveAndFreeService(aHost, *service);
+            }
+            else
+            {
+                earliestExpireTime = OT_MIN(earliestExpireTime, service->GetKeyExpireTime());
+            }
         }
+
+        service = nextService;
     }
-    else
-    {
-        otLogInfoSrp("[server] lease timer is stopped");
-        mLeaseTimer.Stop();
-    }
+
+    return earliestExpireTime;
 }
 
 void Server::HandleOutstandingUpdatesTimer(Timer &aTimer)
@@ -1288,7 +1633,11 @@ exit:
 
 void Server::Service::Free(void)
 {
-    GetInstance().HeapFree(mFullName);
+    if (mFullName != nullptr)
+    {
+        Get<Server>().ReleaseName(mFullName);
+    }
+
     GetInstance().HeapFree(mTxtData);
     GetInstance().HeapFree(this);
 }
@@ -1303,6 +1652,7 @@ Server::Service::Service(Instance &aInstance)
     , mTxtData(nullptr)
     , mHost(nullptr)
     , mNext(nullptr)
+    , mNextInIndex(nullptr)
     , mTimeLastUpdate(TimerMilli::GetNow())
 {
 }
@@ -1311,14 +1661,16 @@ otError Server::Service::SetFullName(const char *aFullName)
 {
     OT_ASSERT(aFullName != nullptr);
 
-    otError error    = OT_ERROR_NONE;
-    char *  nameCopy = static_cast<char *>(GetInstance().HeapCAlloc(1, strlen(aFullName) + 1));
+    otError     error = OT_ERROR_NONE;
+    const char *name  = Get<Server>().InternName(aFullName);
 
-    VerifyOrExit(nameCopy != nullptr, error = OT_ERROR_NO_BUFS);
-    strcpy(nameCopy, aFullName);
+    VerifyOrExit(name != nullptr, error = OT_ERROR_NO_BUFS);
 
-    GetInstance().HeapFree(mFullName);
-    mFullName = nameCopy;
+    if (mFullName != nullptr)
+    {
+        Get<Server>().ReleaseName(mFullName);
+    }
+    mFullName = name;
 
 exit:
     return error;
@@ -1435,7 +1787,12 @@ exit:
 void Server::Host::Free(void)
 {
     RemoveAndFreeAllServices();
-    GetInstance().HeapFree(mFullName);
+
+    if (mFullName != nullptr)
+    {
+        Get<Server>().ReleaseName(mFullName);
+    }
+
     GetInstance().HeapFree(this);
 }
 
@@ -1444,9 +1801,12 @@ Server::Host::Host(Instance &aInstance)
     , mFullName(nullptr)
     , mAddressesNum(0)
     , mNext(nullptr)
+    , mNextInIndex(nullptr)
     , mLease(0)
     , mKeyLease(0)
     , mTimeLastUpdate(TimerMilli::GetNow())
+    , mNextExpireTime(mTimeLastUpdate)
+    , mLeaseHeapIndex(kNotInLeaseHeap)
 {
     mKey.Clear();
 }
@@ -1455,17 +1815,16 @@ otError Server::Host::SetFullName(const char *aFullName)
 {
     OT_ASSERT(aFullName != nullptr);
 
-    otError error    = OT_ERROR_NONE;
-    char *  nameCopy = static_cast<char *>(GetInstance().HeapCAlloc(1, strlen(aFullName) + 1));
+    otError     error = OT_ERROR_NONE;
+    const char *name  = Get<Server>().InternName(aFullName);
 
-    VerifyOrExit(nameCopy != nullptr, error = OT_ERROR_NO_BUFS);
-    strcpy(nameCopy, aFullName);
+    VerifyOrExit(name != nullptr, error = OT_ERROR_NO_BUFS);
 
     if (mFullName != nullptr)
     {
-        GetInstance().HeapFree(mFullName);
+        Get<Server>().ReleaseName(mFullName);
     }
-    mFullName = nameCopy;
+    mFullName = name;
 
 exit:
     return error;
@@ -1508,14 +1867,24 @@ Server::Service *Server::Host::AddService(const char *aFullName)
 
     VerifyOrExit(service == nullptr);
 
-    service = Service::New(GetInstance(), aFullName);
+    service = AddNewService(aFullName);
+
+exit:
+    return service;
+}
+
+// Add a new service entry to the host. The caller MUST make sure that there
+// is no existing service with the same name.
+Server::Service *Server::Host::AddNewService(const char *aFullName)
+{
+    Service *service = Service::New(GetInstance(), aFullName);
+
     if (service != nullptr)
     {
         IgnoreError(mServices.Add(*service));
         service->mHost = this;
     }
 
-exit:
     return service;
 }
 
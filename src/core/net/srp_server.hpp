@@ -62,6 +62,9 @@
 #include "net/udp6.hpp"
 
 namespace ot {
+
+class SrpServerTester;
+
 namespace Srp {
 
 /**
@@ -71,6 +74,7 @@ namespace Srp {
 class Server : public InstanceLocator, private NonCopyable
 {
     friend class ot::Notifier;
+    friend class ot::SrpServerTester;
 
 public:
     class Host;
@@ -84,6 +88,7 @@ public:
     {
         friend class LinkedListEntry<Service>;
         friend class Server;
+        friend class ot::SrpServerTester;
 
     public:
         /**
@@ -207,7 +212,7 @@ public:
         void    ClearResources(void);
         void    DeleteResourcesButRetainName(void);
 
-        char *           mFullName;
+        const char *     mFullName; // Interned in the server name table.
         uint16_t         mPriority;
         uint16_t         mWeight;
         uint16_t         mPort;
@@ -215,6 +220,7 @@ public:
         uint8_t *        mTxtData;
         otSrpServerHost *mHost;
         Service *        mNext;
+        Service *        mNextInIndex; // Next service in the same bucket of the service instance name index.
         TimeMilli        mTimeLastUpdate;
         bool             mIsDeleted;
     };
@@ -227,6 +233,7 @@ public:
     {
         friend class LinkedListEntry<Host>;
         friend class Server;
+        friend class ot::SrpServerTester;
 
     public:
         /**
@@ -356,6 +363,7 @@ public:
         void     SetKeyLease(uint32_t aKeyLease);
         Service *GetNextService(Service *aService) { return aService ? aService->GetNext() : mServices.GetHead(); }
         Service *AddService(const char *aFullName);
+        Service *AddNewService(const char *aFullName);
         void     RemoveAndFreeService(Service *aService);
         void     RemoveAndFreeAllServices(void);
         void     ClearResources(void);
@@ -364,15 +372,18 @@ public:
         Service *FindService(const char *aFullName);
         otError  AddIp6Address(const Ip6::Address &aIp6Address);
 
-        char *       mFullName;
+        const char * mFullName; // Interned in the server name table.
         Ip6::Address mAddresses[kMaxAddressesNum];
         uint8_t      mAddressesNum;
         Host *       mNext;
+        Host *       mNextInIndex; // Next host in the same bucket of the host name index.
 
         Dns::Ecdsa256KeyRecord mKey;
         uint32_t               mLease;    // The LEASE time in seconds.
         uint32_t               mKeyLease; // The KEY-LEASE time in seconds.
         TimeMilli              mTimeLastUpdate;
+        TimeMilli              mNextExpireTime; // Earliest LEASE or KEY-LEASE expiry of the host and its services.
+        uint16_t               mLeaseHeapIndex; // Position in the lease expiry heap.
         LinkedList<Service>    mServices;
     };
 
@@ -490,6 +501,14 @@ private:
         kUdpPayloadSize = Ip6::Ip6::kMaxDatagramLength - sizeof(Ip6::Udp::Header), // Max UDP payload size
     };
 
+    enum : uint16_t
+    {
+        kNameIndexSize         = OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE,
+        kNotInLeaseHeap        = 0xffff,
+        kLeaseHeapInitCapacity = 16,
+        kMaxLeaseHeapCapacity  = kNotInLeaseHeap,
+    };
+
     enum : uint32_t
     {
         kDefaultMinLease             = 60u * 30,        // Default minimum lease time, 30 min (in seconds).
@@ -533,6 +552,21 @@ private:
         UpdateMetadata *  mNext;
     };
 
+    /**
+     * This structure holds a name in the interned name storage.
+     *
+     * Names of hosts and service instances are stored once and shared by reference count, so that processing an
+     * update of an already registered host does not allocate its names again.
+     *
+     */
+    struct InternedName
+    {
+        InternedName *mNext;     // Next name in the same bucket of the name table.
+        uint32_t      mHash;     // Hash of `mName`.
+        uint16_t      mRefCount; // Number of hosts and services which use the name.
+        char          mName[1];  // The null-terminated name (allocated with the entry).
+    };
+
     void     Start(void);
     void     Stop(void);
     void     HandleNotifierEvents(Events aEvents);
@@ -587,10 +621,34 @@ private:
                                                          uint16_t &               aOffset);
     static bool    IsValidDeleteAllRecord(const Dns::ResourceRecord &aRecord);
 
+    static uint32_t      HashName(const char *aName);
+    static InternedName &GetInternedName(const char *aName);
+    static uint16_t      GetIndexBucket(const char *aName);
+    const char *         InternName(const char *aName);
+    void                 ReleaseName(const char *aName);
+    const InternedName * FindInternedName(const char *aName) const;
+
+    void     IndexHost(Host &aHost);
+    void     UnindexHost(Host &aHost);
+    void     IndexService(Service &aService);
+    void     UnindexService(Service &aService);
+    Host *   FindHost(const char *aFullName);
+    Service *FindService(const char *aFullName, const Host *aHost);
+
+    otError   ReserveLeaseHeapEntry(void);
+    void      AddToLeaseHeap(Host &aHost);
+    void      RemoveFromLeaseHeap(Host &aHost);
+    void      MoveUpInLeaseHeap(uint16_t aIndex);
+    void      MoveDownInLeaseHeap(uint16_t aIndex);
+    void      SetLeaseHeapEntry(uint16_t aIndex, Host &aHost);
+    void      UpdateLeaseSchedule(Host &aHost);
+    TimeMilli ExpireLeases(Host &aHost, TimeMilli aNow);
+    void      ScheduleLeaseTimer(void);
+
     void        HandleUpdate(const Dns::UpdateHeader &aDnsHeader, Host *aHost, const Ip6::MessageInfo &aMessageInfo);
     void        AddHost(Host *aHost);
     void        RemoveAndFreeHost(Host *aHost);
-    Service *   FindService(const char *aFullName);
+    void        RemoveAndFreeService(Host &aHost, Service &aService);
     bool        HasNameConflictsWith(Host &aHost);
     void        SendResponse(const Dns::UpdateHeader &   aHeader,
                              Dns::UpdateHeader::Response aResponseCode,
@@ -623,6 +681,14 @@ private:
     LinkedList<Host> mHosts;
     TimerMilli       mLeaseTimer;
 
+    InternedName *mNameTable[kNameIndexSize];
+    Host *        mHostIndex[kNameIndexSize];
+    Service *     mServiceIndex[kNameIndexSize];
+
+    Host **  mLeaseHeap; // Registered hosts ordered by `mNextExpireTime`, allocated from the heap.
+    uint16_t mLeaseHeapSize;
+    uint16_t mLeaseHeapCapacity;
+
     TimerMilli                 mOutstandingUpdatesTimer;
     LinkedList<UpdateMetadata> mOutstandingUpdates;
 
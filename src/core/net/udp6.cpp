@@ -34,11 +34,13 @@
 #include "udp6.hpp"
 
 #include <stdio.h>
+#include <string.h>
 
 #include <openthread/platform/udp.h>
 
 #include "common/code_utils.hpp"
 #include "common/encoding.hpp"
+#include "common/hash.hpp"
 #include "common/instance.hpp"
 #include "common/locator-getters.hpp"
 #include "net/checksum.hpp"
@@ -184,6 +186,10 @@ Udp::Udp(Instance &aInstance)
     , mUdpForwarder(nullptr)
 #endif
 {
+    for (uint8_t indexNum = 0; indexNum < kNumSocketIndexes; indexNum++)
+    {
+        mSocketIndexes[indexNum].Init(mSocketIndexSlots[indexNum], kSocketIndexSize);
+    }
 }
 
 otError Udp::AddReceiver(Receiver &aReceiver)
@@ -248,6 +254,8 @@ otError Udp::Bind(SocketHandle &aSocket, const SockAddr &aSockAddr)
     }
 #endif
 
+    RebuildSocketIndex();
+
 exit:
     return error;
 }
@@ -273,6 +281,8 @@ void Udp::SetBackboneSocket(SocketHandle &aSocket)
     {
         mSockets.Push(aSocket);
     }
+
+    RebuildSocketIndex();
 }
 
 const Udp::SocketHandle *Udp::GetBackboneSockets(void) const
@@ -397,7 +407,9 @@ void Udp::AddSocket(SocketHandle &aSocket)
     }
 #endif
 exit:
-    return;
+    // The socket address may have been cleared by re-opening an
+    // already open socket, so the index is rebuilt in either case.
+    RebuildSocketIndex();
 }
 
 void Udp::RemoveSocket(SocketHandle &aSocket)
@@ -416,21 +428,143 @@ void Udp::RemoveSocket(SocketHandle &aSocket)
     }
 #endif
 
+    RebuildSocketIndex();
+
 exit:
     return;
 }
 
-uint16_t Udp::GetEphemeralPort(void)
+uint32_t Udp::HashPort(uint16_t aPort)
 {
-    uint16_t rval = mEphemeralPort;
+    Fnv1aHash hash;
+
+    hash.UpdateUint16(aPort);
+
+    return hash.GetHash();
+}
+
+void Udp::RebuildSocketIndex(void)
+{
+    uint8_t indexNum = 0;
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    const SocketHandle *backboneSockets = GetBackboneSockets();
+#endif
 
-    if (mEphemeralPort < kDynamicPortMax)
+    // The index is rebuilt whenever a socket is added, removed, moved
+    // or bound. Sockets are added in `mSockets` order, so sockets with
+    // the same port are found in list order, as a walk of the list
+    // would find them.
+
+    for (HashIndex<SocketHandle> &index : mSocketIndexes)
     {
-        mEphemeralPort++;
+        index.Clear();
     }
-    else
+
+    for (SocketHandle *socket = mSockets.GetHead(); socket != nullptr; socket = socket->GetNext())
+    {
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+        if (socket == backboneSockets)
+        {
+            indexNum = 1;
+        }
+#endif
+
+        mSocketIndexes[indexNum].Add(*socket, HashPort(socket->GetSockName().mPort));
+    }
+}
+
+Udp::SocketHandle *Udp::FindSocket(const MessageInfo &aMessageInfo)
+{
+    SocketHandle *socket   = nullptr;
+    uint8_t       indexNum = 0;
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+    if (aMessageInfo.IsHostInterface())
+    {
+        indexNum = 1;
+    }
+#endif
+
+    if (!mSocketIndexes[indexNum].IsUsable())
+    {
+        SocketHandle *prev;
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+        const SocketHandle *socketsBegin, *socketsEnd;
+
+        if (!aMessageInfo.IsHostInterface())
+        {
+            socketsBegin = mSockets.GetHead();
+            socketsEnd   = GetBackboneSockets();
+        }
+        else
+        {
+            socketsBegin = GetBackboneSockets();
+            socketsEnd   = nullptr;
+        }
+
+        socket = mSockets.FindMatching(socketsBegin, socketsEnd, aMessageInfo, prev);
+#else
+        socket = mSockets.FindMatching(aMessageInfo, prev);
+#endif
+        ExitNow();
+    }
+
+    socket = mSocketIndexes[indexNum].FindMatching(HashPort(aMessageInfo.GetSockPort()), aMessageInfo);
+
+exit:
+    return socket;
+}
+
+bool Udp::IsPortInUse(uint16_t aPort) const
+{
+    bool inUse = false;
+
+    for (const HashIndex<SocketHandle> &index : mSocketIndexes)
     {
-        mEphemeralPort = kDynamicPortMin;
+        if (!index.IsUsable())
+        {
+            ExitNow(inUse = mSockets.ContainsMatching(aPort));
+        }
+    }
+
+    for (const HashIndex<SocketHandle> &index : mSocketIndexes)
+    {
+        if (index.FindMatching(HashPort(aPort), aPort) != nullptr)
+        {
+            ExitNow(inUse = true);
+        }
+    }
+
+exit:
+    return inUse;
+}
+
+uint16_t Udp::GetEphemeralPort(void)
+{
+    uint16_t rval;
+
+    // Ports already bound by an open socket are skipped, so the
+    // returned port is only reused once the whole dynamic range has
+    // been handed out and every port in it is in use.
+
+    for (uint16_t i = 0; i <= kDynamicPortMax - kDynamicPortMin; i++)
+    {
+        rval = mEphemeralPort;
+
+        if (mEphemeralPort < kDynamicPortMax)
+        {
+            mEphemeralPort++;
+        }
+        else
+        {
+            mEphemeralPort = kDynamicPortMin;
+        }
+
+        if (!IsPortInUse(rval))
+        {
+            break;
+        }
     }
 
     return rval;
@@ -505,29 +639,7 @@ exit:
 
 void Udp::HandlePayload(Message &aMessage, MessageInfo &aMessageInfo)
 {
-    SocketHandle *socket;
-    SocketHandle *prev;
-
-#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
-    {
-        const SocketHandle *socketsBegin, *socketsEnd;
-
-        if (!aMessageInfo.IsHostInterface())
-        {
-            socketsBegin = mSockets.GetHead();
-            socketsEnd   = GetBackboneSockets();
-        }
-        else
-        {
-            socketsBegin = GetBackboneSockets();
-            socketsEnd   = nullptr;
-        }
-
-        socket = mSockets.FindMatching(socketsBegin, socketsEnd, aMessageInfo, prev);
-    }
-#else
-    socket = mSockets.FindMatching(aMessageInfo, prev);
-#endif
+    SocketHandle *socket = FindSocket(aMessageInfo);
 
     VerifyOrExit(socket != nullptr);
 
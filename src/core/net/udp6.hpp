@@ -40,6 +40,7 @@
 #include <openthread/platform/udp.h>
 
 #include "common/clearable.hpp"
+#include "common/hash_index.hpp"
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
@@ -75,6 +76,7 @@ public:
     {
         friend class Udp;
         friend class LinkedList<SocketHandle>;
+        friend class HashIndex<SocketHandle>;
 
     public:
         /**
@@ -120,6 +122,7 @@ public:
 
     private:
         bool Matches(const MessageInfo &aMessageInfo) const;
+        bool Matches(uint16_t aSockPort) const { return GetSockName().mPort == aSockPort; }
 
         void HandleUdpReceive(Message &aMessage, const MessageInfo &aMessageInfo)
         {
@@ -604,8 +607,23 @@ private:
         kDynamicPortMax = 65535, ///< Service Name and Transport Protocol Port Number Registry
     };
 
+    enum
+    {
+        kSocketIndexSize = OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE,
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
+        kNumSocketIndexes = 2, // Thread and Backbone sockets are indexed separately.
+#else
+        kNumSocketIndexes = 1,
+#endif
+    };
+
     void AddSocket(SocketHandle &aSocket);
     void RemoveSocket(SocketHandle &aSocket);
+
+    static uint32_t HashPort(uint16_t aPort);
+    void            RebuildSocketIndex(void);
+    SocketHandle *  FindSocket(const MessageInfo &aMessageInfo);
+    bool            IsPortInUse(uint16_t aPort) const;
 #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
     bool ShouldUsePlatformUdp(const SocketHandle &aSocket) const;
 #endif
@@ -619,6 +637,8 @@ private:
     uint16_t                 mEphemeralPort;
     LinkedList<Receiver>     mReceivers;
     LinkedList<SocketHandle> mSockets;
+    HashIndex<SocketHandle>  mSocketIndexes[kNumSocketIndexes];
+    SocketHandle *           mSocketIndexSlots[kNumSocketIndexes][kSocketIndexSize];
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_BACKBONE_ROUTER_ENABLE
     SocketHandle *mPrevBackboneSockets;
 #endif
@@ -39,6 +39,7 @@
 #include "common/code_utils.hpp"
 #include "common/debug.hpp"
 #include "common/encoding.hpp"
+#include "common/hash.hpp"
 #include "common/instance.hpp"
 #include "common/locator-getters.hpp"
 #include "common/logging.hpp"
@@ -57,8 +58,14 @@ AddressResolver::AddressResolver(Instance &aInstance)
     , mAddressQuery(UriPath::kAddressQuery, &AddressResolver::HandleAddressQuery, this)
     , mAddressNotification(UriPath::kAddressNotify, &AddressResolver::HandleAddressNotification, this)
     , mCacheEntryPool(aInstance)
+    , mCachedList(kCachedListId)
+    , mSnoopedList(kSnoopedListId)
+    , mQueryList(kQueryListId)
+    , mQueryRetryList(kQueryRetryListId)
     , mIcmpHandler(&AddressResolver::HandleIcmpReceive, this)
 {
+    ClearCacheIndex();
+
     Get<Tmf::TmfAgent>().AddResource(mAddressError);
     Get<Tmf::TmfAgent>().AddResource(mAddressQuery);
     Get<Tmf::TmfAgent>().AddResource(mAddressNotification);
@@ -84,6 +91,8 @@ void AddressResolver::Clear(void)
             mCacheEntryPool.Free(*entry);
         }
     }
+
+    ClearCacheIndex();
 }
 
 otError AddressResolver::GetNextCacheEntry(EntryInfo &aInfo, Iterator &aIterator) const
@@ -209,18 +218,112 @@ void AddressResolver::Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId)
     }
 }
 
+AddressResolver::CacheEntryList &AddressResolver::GetList(ListId aListId)
+{
+    CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
+
+    return *lists[aListId];
+}
+
 AddressResolver::CacheEntry *AddressResolver::FindCacheEntry(const Ip6::Address &aEid,
                                                              CacheEntryList *&   aList,
                                                              CacheEntry *&       aPrevEntry)
 {
-    CacheEntry *    entry   = nullptr;
-    CacheEntryList *lists[] = {&mCachedList, &mSnoopedList, &mQueryList, &mQueryRetryList};
+    CacheEntry *entry = FindInCacheIndex(aEid);
 
-    for (CacheEntryList *list : lists)
+    VerifyOrExit(entry != nullptr);
+
+    aList      = &GetList(entry->GetListId());
+    aPrevEntry = (aList->GetHead() == entry) ? nullptr : entry->GetPrev();
+
+exit:
+    return entry;
+}
+
+uint16_t AddressResolver::GetCacheIndexSlot(const Ip6::Address &aEid)
+{
+    Fnv1aHash hash;
+
+    // EIDs mostly share their prefix, so all bytes are mixed in.
+    hash.Update(aEid.mFields.m8, sizeof(aEid.mFields.m8));
+
+    return hash.GetBucket(kCacheIndexSize);
+}
+
+void AddressResolver::ClearCacheIndex(void)
+{
+    for (uint16_t &slot : mCacheIndex)
+    {
+        slot = kCacheIndexEmptySlot;
+    }
+}
+
+void AddressResolver::AddToCacheIndex(const CacheEntry &aEntry)
+{
+    uint16_t slot = GetCacheIndexSlot(aEntry.GetTarget());
+
+    // The index uses open addressing with linear probing. It has
+    // more slots than there are cache entries, so an empty slot
+    // is always found.
+
+    while (mCacheIndex[slot] != kCacheIndexEmptySlot)
+    {
+        slot = (slot + 1) % kCacheIndexSize;
+    }
+
+    mCacheIndex[slot] = mCacheEntryPool.GetIndexOf(aEntry);
+}
+
+void AddressResolver::RemoveFromCacheIndex(const CacheEntry &aEntry)
+{
+    uint16_t entryIndex = mCacheEntryPool.GetIndexOf(aEntry);
+    uint16_t slot       = GetCacheIndexSlot(aEntry.GetTarget());
+    uint16_t hole;
+
+    while (mCacheIndex[slot] != entryIndex)
+    {
+        VerifyOrExit(mCacheIndex[slot] != kCacheIndexEmptySlot);
+        slot = (slot + 1) % kCacheIndexSize;
+    }
+
+    // Remove the entry and shift back any following entries in the
+    // probe sequence whose home slot is not between the hole and
+    // their current slot, so that no lookup is cut short by the
+    // new empty slot.
+
+    hole = slot;
+
+    for (slot = (slot + 1) % kCacheIndexSize; mCacheIndex[slot] != kCacheIndexEmptySlot;
+         slot = (slot + 1) % kCacheIndexSize)
+    {
+        uint16_t home = GetCacheIndexSlot(mCacheEntryPool.GetEntryAt(mCacheIndex[slot]).GetTarget());
+
+        if ((slot + kCacheIndexSize - home) % kCacheIndexSize >= (slot + kCacheIndexSize - hole) % kCacheIndexSize)
+        {
+            mCacheIndex[hole] = mCacheIndex[slot];
+            hole              = slot;
+        }
+    }
+
+    mCacheIndex[hole] = kCacheIndexEmptySlot;
+
+exit:
+    return;
+}
+
+AddressResolver::CacheEntry *AddressResolver::FindInCacheIndex(const Ip6::Address &aEid)
+{
+    CacheEntry *entry = nullptr;
+
+    for (uint16_t slot = GetCacheIndexSlot(aEid); mCacheIndex[slot] != kCacheIndexEmptySlot;
+         slot          = (slot + 1) % kCacheIndexSize)
     {
-        aList = list;
-        entry = aList->FindMatching(aEid, aPrevEntry);
-        VerifyOrExit(entry == nullptr);
+        CacheEntry &candidate = mCacheEntryPool.GetEntryAt(mCacheIndex[slot]);
+
+        if (candidate.Matches(aEid))
+        {
+            ExitNow(entry = &candidate);
+        }
     }
 
 exit:
@@ -320,6 +423,7 @@ void AddressResolver::RemoveCacheEntry(CacheEntry &    aEntry,
                                        Reason          aReason)
 {
     aList.PopAfter(aPrevEntry);
+    RemoveFromCacheIndex(aEntry);
 
     if (&aList == &mQueryList)
     {
@@ -398,6 +502,7 @@ void AddressResolver::AddSnoopedCacheEntry(const Ip6::Address &aEid, Mac::ShortA
     }
 
     mSnoopedList.Push(*entry);
+    AddToCacheIndex(*entry);
 
     LogCacheEntryChange(kEntryAdded, kReasonSnoop, *entry);
 
@@ -428,6 +533,8 @@ void AddressResolver::RestartAddressQueries(void)
 
     for (CacheEntry *entry = mQueryList.GetHead(); entry != nullptr; entry = entry->GetNext())
     {
+        entry->SetListId(kQueryListId);
+
         IgnoreError(SendAddressQuery(entry->GetTarget()));
 
         entry->SetTimeout(kAddressQueryTimeout);
@@ -503,10 +610,17 @@ otError AddressResolver::Resolve(const Ip6::Address &aEid, Mac::ShortAddress &aR
     entry->SetTimeout(kAddressQueryTimeout);
 
     error = SendAddressQuery(aEid);
-    VerifyOrExit(error == OT_ERROR_NONE, mCacheEntryPool.Free(*entry));
+
+    if (error != OT_ERROR_NONE)
+    {
+        RemoveFromCacheIndex(*entry);
+        mCacheEntryPool.Free(*entry);
+        ExitNow();
+    }
 
     if (list == nullptr)
     {
+        AddToCacheIndex(*entry);
         LogCacheEntryChange(kEntryAdded, kReasonQueryRequest, *entry);
     }
 
@@ -1046,6 +1160,7 @@ void AddressResolver::CacheEntry::Init(Instance &aInstance)
 {
     InstanceLocatorInit::Init(aInstance);
     mNextIndex = kNoNextIndex;
+    mPrevIndex = kNoNextIndex;
 }
 
 AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void)
@@ -1058,10 +1173,22 @@ const AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetNext(void) co
     return (mNextIndex == kNoNextIndex) ? nullptr : &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mNextIndex);
 }
 
+AddressResolver::CacheEntry *AddressResolver::CacheEntry::GetPrev(void)
+{
+    return &Get<AddressResolver>().GetCacheEntryPool().GetEntryAt(mPrevIndex);
+}
+
 void AddressResolver::CacheEntry::SetNext(CacheEntry *aEntry)
 {
+    CacheEntryPool &pool = Get<AddressResolver>().GetCacheEntryPool();
+
     VerifyOrExit(aEntry != nullptr, mNextIndex = kNoNextIndex);
-    mNextIndex = Get<AddressResolver>().GetCacheEntryPool().GetIndexOf(*aEntry);
+    mNextIndex = pool.GetIndexOf(*aEntry);
+
+    // Every link in a list is made through `SetNext()`, so the
+    // previous index of any entry which is not the head of its list
+    // is kept up to date here.
+    aEntry->mPrevIndex = pool.GetIndexOf(*this);
 
 exit:
     return;
@@ -40,6 +40,7 @@
 #include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
 #include "common/time_ticker.hpp"
 #include "common/timer.hpp"
 #include "mac/mac.hpp"
@@ -65,6 +66,7 @@ namespace ot {
 class AddressResolver : public InstanceLocator, private NonCopyable
 {
     friend class TimeTicker;
+    friend class AddressResolverTester;
 
 public:
     /**
@@ -216,6 +218,22 @@ private:
         kSnoopBlockEvictionTimeout     = OPENTHREAD_CONFIG_TMF_SNOOP_CACHE_ENTRY_TIMEOUT,         // in seconds
         kIteratorListIndex             = 0,
         kIteratorEntryIndex            = 1,
+        kCacheIndexSize                = 2 * kCacheEntries, // Number of slots in the EID hash index.
+        kCacheIndexEmptySlot           = 0xffff,            // Value indicating an unused slot in the hash index.
+    };
+
+    static_assert(kCacheEntries < kCacheIndexEmptySlot, "TMF_ADDRESS_CACHE_ENTRIES is too large");
+    static_assert(kCacheIndexSize <= NumericLimits<uint16_t>::Max(),
+                  "TMF_ADDRESS_CACHE_ENTRIES is too large for the EID hash index");
+
+    // The lists of cache entries (the order MUST match the order
+    // of lists in `GetList()`).
+    enum ListId : uint8_t
+    {
+        kCachedListId,
+        kSnoopedListId,
+        kQueryListId,
+        kQueryRetryListId,
     };
 
     class CacheEntry : public InstanceLocatorInit
@@ -227,6 +245,13 @@ private:
         const CacheEntry *GetNext(void) const;
         void              SetNext(CacheEntry *aEntry);
 
+        // The previous entry is only valid when the entry is not
+        // the head of its list.
+        CacheEntry *GetPrev(void);
+
+        ListId GetListId(void) const { return mListId; }
+        void   SetListId(ListId aListId) { mListId = aListId; }
+
         const Ip6::Address &GetTarget(void) const { return mTarget; }
         void                SetTarget(const Ip6::Address &aTarget) { mTarget = aTarget; }
 
@@ -264,6 +289,8 @@ private:
         Ip6::Address      mTarget;
         Mac::ShortAddress mRloc16;
         uint16_t          mNextIndex;
+        uint16_t          mPrevIndex;
+        ListId            mListId;
         union
         {
             struct
@@ -283,7 +310,24 @@ private:
     };
 
     typedef Pool<CacheEntry, kCacheEntries> CacheEntryPool;
-    typedef LinkedList<CacheEntry>          CacheEntryList;
+
+    class CacheEntryList : public LinkedList<CacheEntry>
+    {
+    public:
+        explicit CacheEntryList(ListId aListId)
+            : mListId(aListId)
+        {
+        }
+
+        void Push(CacheEntry &aEntry)
+        {
+            aEntry.SetListId(mListId);
+            LinkedList<CacheEntry>::Push(aEntry);
+        }
+
+    private:
+        ListId mListId;
+    };
 
     enum EntryChange
     {
@@ -309,6 +353,13 @@ private:
     void        Remove(Mac::ShortAddress aRloc16, bool aMatchRouterId);
     void        Remove(const Ip6::Address &aEid, Reason aReason);
     CacheEntry *FindCacheEntry(const Ip6::Address &aEid, CacheEntryList *&aList, CacheEntry *&aPrevEntry);
+    CacheEntryList &GetList(ListId aListId);
+
+    static uint16_t GetCacheIndexSlot(const Ip6::Address &aEid);
+    void            ClearCacheIndex(void);
+    void            AddToCacheIndex(const CacheEntry &aEntry);
+    void            RemoveFromCacheIndex(const CacheEntry &aEntry);
+    CacheEntry *    FindInCacheIndex(const Ip6::Address &aEid);
     CacheEntry *NewCacheEntry(bool aSnoopedEntry);
     void        RemoveCacheEntry(CacheEntry &aEntry, CacheEntryList &aList, CacheEntry *aPrevEntry, Reason aReason);
 
@@ -353,6 +404,7 @@ private:
     CacheEntryList mSnoopedList;
     CacheEntryList mQueryList;
     CacheEntryList mQueryRetryList;
+    uint16_t       mCacheIndex[kCacheIndexSize];
 
     Ip6::Icmp::Handler mIcmpHandler;
 };
@@ -34,6 +34,7 @@
 #include "child_table.hpp"
 
 #include "common/code_utils.hpp"
+#include "common/hash.hpp"
 #include "common/instance.hpp"
 #include "common/locator-getters.hpp"
 
@@ -77,6 +78,8 @@ ChildTable::ChildTable(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mMaxChildrenAllowed(kMaxChildren)
 {
+    ResetIndex();
+
     for (Child &child : mChildren)
     {
         child.Init(aInstance);
@@ -86,12 +89,20 @@ ChildTable::ChildTable(Instance &aInstance)
 
 void ChildTable::Clear(void)
 {
+    ResetIndex();
+
     for (Child &child : mChildren)
     {
         child.Clear();
     }
 }
 
+void ChildTable::ClearChild(Child &aChild)
+{
+    RemoveFromIndex(aChild);
+    aChild.Clear();
+}
+
 Child *ChildTable::GetChildAtIndex(uint16_t aChildIndex)
 {
     Child *child = nullptr;
@@ -108,7 +119,7 @@ Child *ChildTable::GetNewChild(void)
     Child *child = FindChild(Child::AddressMatcher(Child::kInStateInvalid));
 
     VerifyOrExit(child != nullptr);
-    child->Clear();
+    ClearChild(*child);
 
 exit:
     return child;
@@ -118,6 +129,11 @@ const Child *ChildTable::FindChild(const Child::AddressMatcher &aMatcher) const
 {
     const Child *child = mChildren;
 
+    if (CanUseIndex(aMatcher))
+    {
+        ExitNow(child = FindChildInIndex(aMatcher));
+    }
+
     for (uint16_t num = mMaxChildrenAllowed; num != 0; num--, child++)
     {
         if (child->Matches(aMatcher))
@@ -132,6 +148,151 @@ exit:
     return child;
 }
 
+const Child *ChildTable::FindChildInIndex(const Child::AddressMatcher &aMatcher) const
+{
+    const Child *child = nullptr;
+
+    if (aMatcher.mShortAddress != Mac::kShortAddrInvalid)
+    {
+        uint16_t childId = Mle::Mle::ChildIdFromRloc16(aMatcher.mShortAddress);
+
+        // Entries with Child ID zero (no RLOC16 assigned yet) are not
+        // in the Child ID index.
+        VerifyOrExit(childId != 0);
+
+        for (uint16_t index = mChildIdHeads[GetChildIdBucket(childId)]; index != kInvalidIndex;
+             index          = mIndexEntries[index].mNextByChildId)
+        {
+            if (mChildren[index].Matches(aMatcher))
+            {
+                ExitNow(child = &mChildren[index]);
+            }
+        }
+    }
+    else
+    {
+        for (uint16_t index = mExtAddressHeads[GetExtAddressBucket(*aMatcher.mExtAddress)]; index != kInvalidIndex;
+             index          = mIndexEntries[index].mNextByExtAddress)
+        {
+            if (mChildren[index].Matches(aMatcher))
+            {
+                ExitNow(child = &mChildren[index]);
+            }
+        }
+    }
+
+exit:
+    return child;
+}
+
+bool ChildTable::CanUseIndex(const Child::AddressMatcher &aMatcher)
+{
+    bool canUse = false;
+
+    VerifyOrExit((aMatcher.mShortAddress != Mac::kShortAddrInvalid) || (aMatcher.mExtAddress != nullptr));
+
+    switch (aMatcher.mStateFilter)
+    {
+    case Child::kInStateInvalid:
+    case Child::kInStateAnyExceptValidOrRestoring:
+    case Child::kInStateAny:
+        break;
+
+    default:
+        canUse = true;
+        break;
+    }
+
+exit:
+    return canUse;
+}
+
+uint16_t ChildTable::GetExtAddressBucket(const Mac::ExtAddress &aExtAddress)
+{
+    Fnv1aHash hash;
+
+    hash.Update(aExtAddress.m8, sizeof(aExtAddress.m8));
+
+    return hash.GetBucket(kNumExtAddressBuckets);
+}
+
+void ChildTable::ResetIndex(void)
+{
+    for (IndexEntry &entry : mIndexEntries)
+    {
+        entry.mIsIndexed = false;
+    }
+
+    for (uint16_t &head : mChildIdHeads)
+    {
+        head = kInvalidIndex;
+    }
+
+    for (uint16_t &head : mExtAddressHeads)
+    {
+        head = kInvalidIndex;
+    }
+}
+
+void ChildTable::AddToIndex(const Child &aChild)
+{
+    uint16_t    index   = GetChildIndex(aChild);
+    IndexEntry &entry   = mIndexEntries[index];
+    uint16_t    childId = Mle::Mle::ChildIdFromRloc16(aChild.GetRloc16());
+    uint16_t &  extHead = mExtAddressHeads[GetExtAddressBucket(aChild.GetExtAddress())];
+
+    OT_ASSERT(!entry.mIsIndexed);
+
+    if (childId != 0)
+    {
+        uint16_t &childIdHead = mChildIdHeads[GetChildIdBucket(childId)];
+
+        entry.mNextByChildId = childIdHead;
+        childIdHead          = index;
+    }
+
+    entry.mNextByExtAddress = extHead;
+    extHead                 = index;
+    entry.mIsIndexed        = true;
+}
+
+void ChildTable::RemoveFromIndex(const Child &aChild)
+{
+    uint16_t    index   = GetChildIndex(aChild);
+    IndexEntry &entry   = mIndexEntries[index];
+    uint16_t    childId = Mle::Mle::ChildIdFromRloc16(aChild.GetRloc16());
+
+    VerifyOrExit(entry.mIsIndexed);
+
+    if (childId != 0)
+    {
+        Unlink(mChildIdHeads[GetChildIdBucket(childId)], &IndexEntry::mNextByChildId, index);
+    }
+
+    Unlink(mExtAddressHeads[GetExtAddressBucket(aChild.GetExtAddress())], &IndexEntry::mNextByExtAddress, index);
+    entry.mIsIndexed = false;
+
+exit:
+    return;
+}
+
+void ChildTable::Unlink(uint16_t &aHead, uint16_t IndexEntry::*aNext, uint16_t aIndex)
+{
+    for (uint16_t *prevNext = &aHead; *prevNext != kInvalidIndex; prevNext = &(mIndexEntries[*prevNext].*aNext))
+    {
+        if (*prevNext == aIndex)
+        {
+            *prevNext = mIndexEntries[aIndex].*aNext;
+            ExitNow();
+        }
+    }
+
+    OT_ASSERT(false);
+
+exit:
+    return;
+}
+
 Child *ChildTable::FindChild(uint16_t aRloc16, Child::StateFilter aFilter)
 {
     return FindChild(Child::AddressMatcher(aRloc16, aFilter));
@@ -237,7 +398,7 @@ void ChildTable::Restore(void)
             foundDuplicate = true;
         }
 
-        child->Clear();
+        ClearChild(*child);
 
         child->SetExtAddress(childInfo.GetExtAddress());
         child->GetLinkInfo().Clear();
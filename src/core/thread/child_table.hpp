@@ -52,6 +52,7 @@ namespace ot {
 class ChildTable : public InstanceLocator, private NonCopyable
 {
     friend class NeighborTable;
+    friend class Child;
     class IteratorBuilder;
 
 public:
@@ -309,6 +310,30 @@ private:
         kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
     };
 
+    // Children are indexed by Child ID and by extended address. Both
+    // indexes are hashed into as many buckets as there are child table
+    // entries, so their size follows `OPENTHREAD_CONFIG_MLE_MAX_CHILDREN`
+    // rather than the number of Child IDs. Each index is a set of
+    // singly linked chains of child table indices. An entry is added to the indexes when its
+    // RLOC16 or extended address is set and removed when it is cleared,
+    // so lookups with a state filter that excludes `kStateInvalid` can
+    // use the indexes, while lookups that may match a cleared entry
+    // scan the table.
+
+    enum : uint16_t
+    {
+        kNumChildIdBuckets    = kMaxChildren,
+        kNumExtAddressBuckets = kMaxChildren,
+        kInvalidIndex         = 0xffff,
+    };
+
+    struct IndexEntry
+    {
+        uint16_t mNextByChildId;
+        uint16_t mNextByExtAddress;
+        bool     mIsIndexed;
+    };
+
     class IteratorBuilder : public InstanceLocator
     {
     public:
@@ -331,10 +356,23 @@ private:
     }
 
     const Child *FindChild(const Child::AddressMatcher &aMatcher) const;
+    const Child *FindChildInIndex(const Child::AddressMatcher &aMatcher) const;
+    void         ClearChild(Child &aChild);
+    void         ResetIndex(void);
+    void         AddToIndex(const Child &aChild);
+    void         RemoveFromIndex(const Child &aChild);
     void         RefreshStoredChildren(void);
 
-    uint16_t mMaxChildrenAllowed;
-    Child    mChildren[kMaxChildren];
+    static bool     CanUseIndex(const Child::AddressMatcher &aMatcher);
+    static uint16_t GetChildIdBucket(uint16_t aChildId) { return aChildId % kNumChildIdBuckets; }
+    static uint16_t GetExtAddressBucket(const Mac::ExtAddress &aExtAddress);
+    void            Unlink(uint16_t &aHead, uint16_t IndexEntry::*aNext, uint16_t aIndex);
+
+    uint16_t   mMaxChildrenAllowed;
+    Child      mChildren[kMaxChildren];
+    IndexEntry mIndexEntries[kMaxChildren];
+    uint16_t   mChildIdHeads[kNumChildIdBuckets];
+    uint16_t   mExtAddressHeads[kNumExtAddressBuckets];
 };
 
 } // namespace ot
@@ -34,6 +34,7 @@
 #include "common/logging.hpp"
 #include "common/time.hpp"
 #include "mac/mac.hpp"
+#include "thread/child_table.hpp"
 
 namespace ot {
 
@@ -67,6 +68,7 @@ CslTxScheduler::CslTxScheduler(Instance &aInstance)
     , mCallbacks(aInstance)
 {
     InitFrameRequestAhead();
+    mWindowHeap.Clear();
 }
 
 void CslTxScheduler::InitFrameRequestAhead(void)
@@ -78,6 +80,12 @@ void CslTxScheduler::InitFrameRequestAhead(void)
     mCslFrameRequestAheadUs = OPENTHREAD_CONFIG_MAC_CSL_REQUEST_AHEAD_US + busTxTimeUs;
 }
 
+void CslTxScheduler::Update(Child &aChild)
+{
+    UpdateTxWindow(aChild);
+    Update();
+}
+
 void CslTxScheduler::Update(void)
 {
     if (mCslTxMessage == nullptr)
@@ -109,6 +117,28 @@ void CslTxScheduler::Clear(void)
     mFrameContext.mMessageNextOffset = 0;
     mCslTxChild                      = nullptr;
     mCslTxMessage                    = nullptr;
+    mWindowHeap.Clear();
+}
+
+bool CslTxScheduler::IsCslTxCandidate(const Child &aChild) const
+{
+    return !aChild.IsStateInvalid() && aChild.IsCslSynchronized() && (aChild.GetIndirectMessageCount() > 0);
+}
+
+void CslTxScheduler::UpdateTxWindow(Child &aChild)
+{
+    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+
+    if (IsCslTxCandidate(aChild))
+    {
+        // The window is (re)computed from the child's latest CSL IE,
+        // so a re-synchronization also corrects any accumulated drift.
+        mWindowHeap.Update(childIndex, GetNextCslTxWindow(aChild, otPlatRadioGetNow(&GetInstance())));
+    }
+    else
+    {
+        mWindowHeap.Remove(childIndex);
+    }
 }
 
 /**
@@ -116,47 +146,59 @@ void CslTxScheduler::Clear(void)
  * and requests `Mac` to do CSL tx at specific time. It shouldn't be called
  * when `Mac` is already starting to do the CSL tx (indicated by `mCslTxMessage`).
  *
+ * The nearest window is at the top of `mWindowHeap`. Windows which have
+ * already passed are moved to the child's next window (all of them are
+ * necessarily before any window still in the future, so they are all
+ * found at the top), and entries of children which are no longer CSL tx
+ * candidates are dropped.
+ *
  */
 void CslTxScheduler::RescheduleCslTx(void)
 {
-    uint32_t minDelayTime = Time::kMaxDuration;
-    Child *  bestChild    = nullptr;
+    uint64_t radioNow  = otPlatRadioGetNow(&GetInstance());
+    Child *  bestChild = nullptr;
 
-    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+    while (!mWindowHeap.IsEmpty())
     {
-        uint32_t delay;
-        uint32_t cslTxDelay;
+        WindowHeap::Entry &top   = mWindowHeap.GetTop();
+        Child &            child = *Get<ChildTable>().GetChildAtIndex(top.mChildIndex);
 
-        if (!child.IsCslSynchronized() || child.GetIndirectMessageCount() == 0)
+        if (!IsCslTxCandidate(child))
         {
-            continue;
+            mWindowHeap.Remove(top.mChildIndex);
         }
-
-        delay = GetNextCslTransmissionDelay(child, cslTxDelay);
-
-        if (delay < minDelayTime)
+        else if (top.mTxWindow < radioNow + mCslFrameRequestAheadUs)
         {
-            minDelayTime = delay;
-            bestChild    = &child;
+            top.mTxWindow = GetNextCslTxWindow(child, radioNow);
+            mWindowHeap.HandleTopUpdated();
+        }
+        else
+        {
+            bestChild = &child;
+            Get<Mac::Mac>().RequestCslFrameTransmission(
+                static_cast<uint32_t>(top.mTxWindow - radioNow - mCslFrameRequestAheadUs) / 1000UL);
+            break;
         }
-    }
-
-    if (bestChild != nullptr)
-    {
-        Get<Mac::Mac>().RequestCslFrameTransmission(minDelayTime / 1000UL);
     }
 
     mCslTxChild = bestChild;
 }
 
-uint32_t CslTxScheduler::GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx) const
+uint64_t CslTxScheduler::GetNextCslTxWindow(const Child &aChild, uint64_t aRadioNow) const
 {
-    uint64_t radioNow      = otPlatRadioGetNow(&GetInstance());
     uint32_t periodInUs    = aChild.GetCslPeriod() * kUsPerTenSymbols;
     uint64_t firstTxWindow = aChild.GetLastRxTimestamp() + aChild.GetCslPhase() * kUsPerTenSymbols;
-    uint64_t nextTxWindow  = radioNow - (radioNow % periodInUs) + (firstTxWindow % periodInUs);
+    uint64_t nextTxWindow  = aRadioNow - (aRadioNow % periodInUs) + (firstTxWindow % periodInUs);
 
-    while (nextTxWindow < radioNow + mCslFrameRequestAheadUs) nextTxWindow += periodInUs;
+    while (nextTxWindow < aRadioNow + mCslFrameRequestAheadUs) nextTxWindow += periodInUs;
+
+    return nextTxWindow;
+}
+
+uint32_t CslTxScheduler::GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx) const
+{
+    uint64_t radioNow     = otPlatRadioGetNow(&GetInstance());
+    uint64_t nextTxWindow = GetNextCslTxWindow(aChild, radioNow);
 
     aDelayFromLastRx = static_cast<uint32_t>(nextTxWindow - aChild.GetLastRxTimestamp());
 
@@ -221,11 +263,18 @@ void CslTxScheduler::HandleSentFrame(const Mac::TxFrame &aFrame, otError aError)
 {
     Child *child = mCslTxChild;
 
-    VerifyOrExit(child != nullptr); // The result is no longer interested by upper layer
-
-    mCslTxChild   = nullptr;
     mCslTxMessage = nullptr;
 
+    if (child == nullptr)
+    {
+        // The result is no longer interested by upper layer (the CSL
+        // tx was pre-empted), so move on to the next nearest window.
+        RescheduleCslTx();
+        ExitNow();
+    }
+
+    mCslTxChild = nullptr;
+
     HandleSentFrame(aFrame, aError, *child);
 
 exit:
@@ -252,6 +301,7 @@ void CslTxScheduler::HandleSentFrame(const Mac::TxFrame &aFrame, otError aError,
             // CSL transmission attempts reach max, consider child out of sync
             aChild.SetCslSynchronized(false);
             aChild.ResetCslTxAttempts();
+            mWindowHeap.Remove(Get<ChildTable>().GetChildIndex(aChild));
         }
 
         OT_FALL_THROUGH;
@@ -294,6 +344,140 @@ exit:
     return;
 }
 
+//---------------------------------------------------------
+
+void CslTxScheduler::WindowHeap::Clear(void)
+{
+    for (uint16_t &slot : mSlots)
+    {
+        slot = kInvalidHeapSlot;
+    }
+
+    mSize = 0;
+}
+
+const CslTxScheduler::WindowHeap::Entry *CslTxScheduler::WindowHeap::Find(uint16_t aChildIndex) const
+{
+    return (mSlots[aChildIndex] == kInvalidHeapSlot) ? nullptr : &mEntries[mSlots[aChildIndex]];
+}
+
+void CslTxScheduler::WindowHeap::Update(uint16_t aChildIndex, uint64_t aTxWindow)
+{
+    uint16_t slot = mSlots[aChildIndex];
+    uint64_t oldTxWindow;
+
+    if (slot == kInvalidHeapSlot)
+    {
+        OT_ASSERT(mSize < kMaxChildren);
+
+        slot                = mSize++;
+        mEntries[slot]      = {aTxWindow, aChildIndex};
+        mSlots[aChildIndex] = slot;
+        SiftUp(slot);
+        ExitNow();
+    }
+
+    oldTxWindow              = mEntries[slot].mTxWindow;
+    mEntries[slot].mTxWindow = aTxWindow;
+
+    if (aTxWindow < oldTxWindow)
+    {
+        SiftUp(slot);
+    }
+    else
+    {
+        SiftDown(slot);
+    }
+
+exit:
+    return;
+}
+
+void CslTxScheduler::WindowHeap::Remove(uint16_t aChildIndex)
+{
+    uint16_t slot = mSlots[aChildIndex];
+
+    VerifyOrExit(slot != kInvalidHeapSlot);
+
+    mSlots[aChildIndex] = kInvalidHeapSlot;
+    mSize--;
+
+    VerifyOrExit(slot != mSize);
+
+    // Move the last entry into the vacated slot and restore the heap
+    // property in whichever direction it is violated.
+
+    Move(slot, mEntries[mSize]);
+
+    if ((slot > 0) && (mEntries[slot].mTxWindow < mEntries[(slot - 1) / 2].mTxWindow))
+    {
+        SiftUp(slot);
+    }
+    else
+    {
+        SiftDown(slot);
+    }
+
+exit:
+    return;
+}
+
+void CslTxScheduler::WindowHeap::SiftUp(uint16_t aSlot)
+{
+    while (aSlot > 0)
+    {
+        uint16_t parent = (aSlot - 1) / 2;
+
+        VerifyOrExit(mEntries[aSlot].mTxWindow < mEntries[parent].mTxWindow);
+        Swap(aSlot, parent);
+        aSlot = parent;
+    }
+
+exit:
+    return;
+}
+
+void CslTxScheduler::WindowHeap::SiftDown(uint16_t aSlot)
+{
+    while (true)
+    {
+        uint16_t smallest = aSlot;
+        uint16_t left     = 2 * aSlot + 1;
+        uint16_t right    = left + 1;
+
+        if ((left < mSize) && (mEntries[left].mTxWindow < mEntries[smallest].mTxWindow))
+        {
+            smallest = left;
+        }
+
+        if ((right < mSize) && (mEntries[right].mTxWindow < mEntries[smallest].mTxWindow))
+        {
+            smallest = right;
+        }
+
+        VerifyOrExit(smallest != aSlot);
+        Swap(aSlot, smallest);
+        aSlot = smallest;
+    }
+
+exit:
+    return;
+}
+
+void CslTxScheduler::WindowHeap::Swap(uint16_t aSlot, uint16_t aOtherSlot)
+{
+    Entry entry = mEntries[aSlot];
+
+    Move(aSlot, mEntries[aOtherSlot]);
+    Move(aOtherSlot, entry);
+}
+
+void CslTxScheduler::WindowHeap::Move(uint16_t aSlot, const Entry &aEntry)
+{
+    mEntries[aSlot]            = aEntry;
+    mSlots[aEntry.mChildIndex] = aSlot;
+}
+
 } // namespace ot
 
 #endif // !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
@@ -62,6 +62,7 @@ class CslTxScheduler : public InstanceLocator, private NonCopyable
 {
     friend class Mac::Mac;
     friend class IndirectSender;
+    friend class CslTxSchedulerTester;
 
 public:
     enum
@@ -174,14 +175,20 @@ public:
     explicit CslTxScheduler(Instance &aInstance);
 
     /**
-     * This method updates the next CSL transmission (finds the nearest child).
+     * This method updates the next CSL transmission window of a given child and then the next CSL transmission
+     * (finds the nearest child).
+     *
+     * It MUST be called whenever the CSL synchronization state (period, phase, last rx timestamp) or the number of
+     * queued indirect messages of the child changes, so that the child's entry in the window heap is kept up to date.
      *
      * It would then request the `Mac` to do the CSL tx. If the last CSL tx has been fired at `Mac` but hasn't been
      * done yet, and it's aborted, this method would set `mCslTxChild` to `nullptr` to notify the `HandleTransmitDone`
      * that the operation has been aborted.
      *
+     * @param[in]  aChild   The child whose CSL state or queued messages changed.
+     *
      */
-    void Update(void);
+    void Update(Child &aChild);
 
     /**
      * This method clears all the states inside `CslTxScheduler` and the related states in each child.
@@ -190,9 +197,59 @@ public:
     void Clear(void);
 
 private:
+    enum
+    {
+        kMaxChildren     = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+        kInvalidHeapSlot = 0xffff,
+    };
+
+    static_assert(kMaxChildren < kInvalidHeapSlot, "kInvalidHeapSlot conflicts with max children");
+
+    /**
+     * This class implements a binary min-heap of the next CSL tx windows of the children which are CSL synchronized
+     * and have queued indirect messages.
+     *
+     * Children are referred to by their index in `ChildTable` (and not by a pointer into the `Child` object, since a
+     * `Child` entry is wiped when it is cleared or reused), and each child's position in the heap is tracked so that
+     * its window can be updated or removed in O(log n).
+     *
+     */
+    class WindowHeap
+    {
+    public:
+        struct Entry
+        {
+            uint64_t mTxWindow;   ///< The radio time (in microseconds) of the next CSL tx window.
+            uint16_t mChildIndex; ///< The child index in `ChildTable`.
+        };
+
+        void         Clear(void);
+        bool         IsEmpty(void) const { return mSize == 0; }
+        uint16_t     GetSize(void) const { return mSize; }
+        Entry &      GetTop(void) { return mEntries[0]; }
+        const Entry *Find(uint16_t aChildIndex) const;
+        void         Update(uint16_t aChildIndex, uint64_t aTxWindow);
+        void         Remove(uint16_t aChildIndex);
+        void         HandleTopUpdated(void) { SiftDown(0); }
+
+    private:
+        void SiftUp(uint16_t aSlot);
+        void SiftDown(uint16_t aSlot);
+        void Swap(uint16_t aSlot, uint16_t aOtherSlot);
+        void Move(uint16_t aSlot, const Entry &aEntry);
+
+        Entry    mEntries[kMaxChildren];
+        uint16_t mSlots[kMaxChildren]; // Heap slot of each child index, or `kInvalidHeapSlot`.
+        uint16_t mSize;
+    };
+
     void InitFrameRequestAhead(void);
+    void Update(void);
+    void UpdateTxWindow(Child &aChild);
     void RescheduleCslTx(void);
+    bool IsCslTxCandidate(const Child &aChild) const;
 
+    uint64_t GetNextCslTxWindow(const Child &aChild, uint64_t aRadioNow) const;
     uint32_t GetNextCslTransmissionDelay(const Child &aChild, uint32_t &aDelayFromLastRx) const;
 
     // Callbacks from `Mac`
@@ -206,6 +263,7 @@ private:
     Message *               mCslTxMessage;
     Callbacks::FrameContext mFrameContext;
     Callbacks               mCallbacks;
+    WindowHeap              mWindowHeap;
 };
 
 #endif // !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
@@ -69,6 +69,7 @@ IndirectSender::IndirectSender(Instance &aInstance)
     , mCslTxScheduler(aInstance)
 #endif
 {
+    mChildrenWithMessages.Clear();
 }
 
 void IndirectSender::Stop(void)
@@ -78,9 +79,11 @@ void IndirectSender::Stop(void)
     for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
     {
         child.SetIndirectMessage(nullptr);
+        child.SetFirstQueuedMessage(nullptr);
         mSourceMatchController.ResetMessageCount(child);
     }
 
+    mChildrenWithMessages.Clear();
     mDataPollHandler.Clear();
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     mCslTxScheduler.Clear();
@@ -100,7 +103,9 @@ void IndirectSender::AddMessageForSleepyChild(Message &aMessage, Child &aChild)
     VerifyOrExit(!aMessage.GetChildMask(childIndex));
 
     aMessage.SetChildMask(childIndex);
+    HandleMessageQueuedForChild(aMessage, aChild);
     mSourceMatchController.IncrementMessageCount(aChild);
+    mChildrenWithMessages.Set(childIndex, true);
 
     if ((aMessage.GetType() != Message::kTypeSupervision) && (aChild.GetIndirectMessageCount() > 1))
     {
@@ -127,6 +132,7 @@ otError IndirectSender::RemoveMessageFromSleepyChild(Message &aMessage, Child &a
 
     aMessage.ClearChildMask(childIndex);
     mSourceMatchController.DecrementMessageCount(aChild);
+    HandleMessageUnqueuedForChild(aMessage, aChild);
 
     RequestMessageUpdate(aChild);
 
@@ -136,16 +142,28 @@ exit:
 
 void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
 {
+    uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    uint16_t remaining  = aChild.GetIndirectMessageCount();
     Message *message;
     Message *nextMessage;
 
-    VerifyOrExit(aChild.GetIndirectMessageCount() > 0);
+    VerifyOrExit(remaining > 0);
+
+    // Messages queued for the child all follow its first queued
+    // message, so the scan starts there and ends once every one of
+    // them has been visited.
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = nextMessage)
+    for (message = aChild.GetFirstQueuedMessage(); (message != nullptr) && (remaining > 0); message = nextMessage)
     {
         nextMessage = message->GetNext();
 
-        message->ClearChildMask(Get<ChildTable>().GetChildIndex(aChild));
+        if (!message->GetChildMask(childIndex))
+        {
+            continue;
+        }
+
+        remaining--;
+        message->ClearChildMask(childIndex);
 
         if (!message->IsChildPending() && !message->GetDirectTransmission())
         {
@@ -160,11 +178,12 @@ void IndirectSender::ClearAllMessagesForSleepyChild(Child &aChild)
     }
 
     aChild.SetIndirectMessage(nullptr);
+    aChild.SetFirstQueuedMessage(nullptr);
     mSourceMatchController.ResetMessageCount(aChild);
 
     mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
 exit:
@@ -194,22 +213,26 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
     if (!aOldMode.IsRxOnWhenIdle() && aChild.IsRxOnWhenIdle() && (aChild.GetIndirectMessageCount() > 0))
     {
         uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+        uint16_t remaining  = aChild.GetIndirectMessageCount();
 
-        for (Message *message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+        for (Message *message = aChild.GetFirstQueuedMessage(); (message != nullptr) && (remaining > 0);
+             message          = message->GetNext())
         {
             if (message->GetChildMask(childIndex))
             {
+                remaining--;
                 message->ClearChildMask(childIndex);
                 message->SetDirectTransmission();
             }
         }
 
         aChild.SetIndirectMessage(nullptr);
+        aChild.SetFirstQueuedMessage(nullptr);
         mSourceMatchController.ResetMessageCount(aChild);
 
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
     }
 
@@ -223,21 +246,94 @@ void IndirectSender::HandleChildModeChange(Child &aChild, Mle::DeviceMode aOldMo
 
 Message *IndirectSender::FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly)
 {
-    Message *message;
+    Message *message = aChild.GetFirstQueuedMessage();
+
+    if (aSupervisionTypeOnly && (message != nullptr))
+    {
+        message = FindQueuedMessage(message, aChild, aSupervisionTypeOnly);
+    }
+
+    return message;
+}
+
+Message *IndirectSender::FindQueuedMessage(Message *aStart, Child &aChild, bool aSupervisionTypeOnly)
+{
     uint16_t childIndex = Get<ChildTable>().GetChildIndex(aChild);
+    uint16_t remaining  = aChild.GetIndirectMessageCount();
+    Message *message;
+
+    // Find the first message at or after `aStart` in the send queue
+    // which is queued for the child. The scan stops early once all
+    // the messages queued for the child have been visited.
 
-    for (message = Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+    for (message = aStart; (message != nullptr) && (remaining > 0); message = message->GetNext())
     {
-        if (message->GetChildMask(childIndex) &&
-            (!aSupervisionTypeOnly || (message->GetType() == Message::kTypeSupervision)))
+        if (!message->GetChildMask(childIndex))
         {
-            break;
+            continue;
         }
+
+        if (!aSupervisionTypeOnly || (message->GetType() == Message::kTypeSupervision))
+        {
+            ExitNow();
+        }
+
+        remaining--;
     }
 
+    message = nullptr;
+
+exit:
     return message;
 }
 
+void IndirectSender::HandleMessageQueuedForChild(Message &aMessage, Child &aChild)
+{
+    // This method is called after `aMessage` is marked for `aChild`
+    // (before its queued message count is incremented). It keeps the
+    // child's first queued message up to date. The send queue is
+    // ordered by priority and a message is appended at the tail of its
+    // priority level, so `aMessage` can only become the first message
+    // if it has a higher priority or if it was not added at the tail.
+
+    Message *first = aChild.GetFirstQueuedMessage();
+    Message *next;
+
+    if ((first == nullptr) || (aChild.GetIndirectMessageCount() == 0) || (aMessage.GetPriority() > first->GetPriority()))
+    {
+        ExitNow(first = &aMessage);
+    }
+
+    VerifyOrExit(aMessage.GetPriority() == first->GetPriority());
+
+    next = aMessage.GetNext();
+    VerifyOrExit((next != nullptr) && (next->GetPriority() == aMessage.GetPriority()));
+
+    for (Message *message = Get<MeshForwarder>().mSendQueue.GetHeadForPriority(aMessage.GetPriority());
+         message != first; message = message->GetNext())
+    {
+        if (message == &aMessage)
+        {
+            ExitNow(first = &aMessage);
+        }
+    }
+
+exit:
+    aChild.SetFirstQueuedMessage(first);
+}
+
+void IndirectSender::HandleMessageUnqueuedForChild(Message &aMessage, Child &aChild)
+{
+    // This method is called after `aMessage` is unmarked for `aChild`
+    // (and its queued message count is decremented).
+
+    VerifyOrExit(aChild.GetFirstQueuedMessage() == &aMessage);
+    aChild.SetFirstQueuedMessage(FindQueuedMessage(aMessage.GetNext(), aChild, /* aSupervisionTypeOnly */ false));
+
+exit:
+    return;
+}
+
 void IndirectSender::RequestMessageUpdate(Child &aChild)
 {
     Message *curMessage = aChild.GetIndirectMessage();
@@ -264,7 +360,7 @@ void IndirectSender::RequestMessageUpdate(Child &aChild)
         aChild.SetWaitingForMessageUpdate(true);
         mDataPollHandler.RequestFrameChange(DataPollHandler::kPurgeFrame, aChild);
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
 
         ExitNow();
@@ -296,7 +392,7 @@ void IndirectSender::RequestMessageUpdate(Child &aChild)
     aChild.SetWaitingForMessageUpdate(true);
     mDataPollHandler.RequestFrameChange(DataPollHandler::kReplaceFrame, aChild);
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
 exit:
@@ -322,7 +418,7 @@ void IndirectSender::UpdateIndirectMessage(Child &aChild)
     aChild.SetIndirectTxSuccess(true);
 
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-    mCslTxScheduler.Update();
+    mCslTxScheduler.Update(aChild);
 #endif
 
     if (message != nullptr)
@@ -464,7 +560,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         aChild.SetIndirectFragmentOffset(nextOffset);
         mDataPollHandler.HandleNewFrame(aChild);
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
-        mCslTxScheduler.Update();
+        mCslTxScheduler.Update(aChild);
 #endif
         ExitNow();
     }
@@ -529,6 +625,7 @@ void IndirectSender::HandleSentFrameToChild(const Mac::TxFrame &aFrame,
         {
             message->ClearChildMask(childIndex);
             mSourceMatchController.DecrementMessageCount(aChild);
+            HandleMessageUnqueuedForChild(*message, aChild);
         }
 
         if (!message->GetDirectTransmission() && !message->IsChildPending())
@@ -549,14 +646,25 @@ exit:
 
 void IndirectSender::ClearMessagesForRemovedChildren(void)
 {
-    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptValidOrRestoring))
+    // Only the children which had a message queued since they were
+    // last visited here are checked. Entries of children with no
+    // queued message left are cleared from the mask along the way.
+
+    for (uint16_t childIndex = 0; mChildrenWithMessages.FindNextSet(childIndex); childIndex++)
     {
+        Child &child = *Get<ChildTable>().GetChildAtIndex(childIndex);
+
         if (child.GetIndirectMessageCount() == 0)
         {
+            mChildrenWithMessages.Set(childIndex, false);
             continue;
         }
 
-        ClearAllMessagesForSleepyChild(child);
+        if (!child.IsStateValidOrRestoring())
+        {
+            ClearAllMessagesForSleepyChild(child);
+            mChildrenWithMessages.Set(childIndex, false);
+        }
     }
 }
 
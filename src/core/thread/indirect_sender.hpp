@@ -41,6 +41,7 @@
 #include "common/non_copyable.hpp"
 #include "mac/data_poll_handler.hpp"
 #include "mac/mac_frame.hpp"
+#include "thread/child_mask.hpp"
 #include "thread/csl_tx_scheduler.hpp"
 #include "thread/indirect_sender_frame_context.hpp"
 #include "thread/mle_types.hpp"
@@ -66,6 +67,7 @@ class Child;
 class IndirectSender : public InstanceLocator, public IndirectSenderBase, private NonCopyable
 {
     friend class Instance;
+    friend class IndirectSenderTester;
     friend class DataPollHandler::Callbacks;
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     friend class CslTxScheduler::Callbacks;
@@ -81,6 +83,7 @@ public:
     class ChildInfo
     {
         friend class IndirectSender;
+        friend class IndirectSenderTester;
         friend class DataPollHandler;
         friend class CslTxScheduler;
         friend class SourceMatchController;
@@ -98,6 +101,9 @@ public:
         Message *GetIndirectMessage(void) { return mIndirectMessage; }
         void     SetIndirectMessage(Message *aMessage) { mIndirectMessage = aMessage; }
 
+        Message *GetFirstQueuedMessage(void) { return mFirstQueuedMessage; }
+        void     SetFirstQueuedMessage(Message *aMessage) { mFirstQueuedMessage = aMessage; }
+
         uint16_t GetIndirectFragmentOffset(void) const { return mIndirectFragmentOffset; }
         void     SetIndirectFragmentOffset(uint16_t aFragmentOffset) { mIndirectFragmentOffset = aFragmentOffset; }
 
@@ -120,6 +126,7 @@ public:
         const Mac::Address &GetMacAddress(Mac::Address &aMacAddress) const;
 
         Message *mIndirectMessage;             // Current indirect message.
+        Message *mFirstQueuedMessage;          // First message in send queue (order) queued for the child.
         uint16_t mIndirectFragmentOffset : 14; // 6LoWPAN fragment offset for the indirect message.
         bool     mIndirectTxSuccess : 1;       // Indicates tx success/failure of current indirect message.
         bool     mWaitingForMessageUpdate : 1; // Indicates waiting for updating the indirect message.
@@ -220,12 +227,16 @@ private:
 
     void     UpdateIndirectMessage(Child &aChild);
     Message *FindIndirectMessage(Child &aChild, bool aSupervisionTypeOnly = false);
+    Message *FindQueuedMessage(Message *aStart, Child &aChild, bool aSupervisionTypeOnly);
+    void     HandleMessageQueuedForChild(Message &aMessage, Child &aChild);
+    void     HandleMessageUnqueuedForChild(Message &aMessage, Child &aChild);
     void     RequestMessageUpdate(Child &aChild);
     uint16_t PrepareDataFrame(Mac::TxFrame &aFrame, Child &aChild, Message &aMessage);
     void     PrepareEmptyFrame(Mac::TxFrame &aFrame, Child &aChild, bool aAckRequest);
     void     ClearMessagesForRemovedChildren(void);
 
     bool                  mEnabled;
+    ChildMask             mChildrenWithMessages; // May include children whose messages were all removed.
     SourceMatchController mSourceMatchController;
     DataPollHandler       mDataPollHandler;
 #if !OPENTHREAD_MTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
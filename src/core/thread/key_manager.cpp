@@ -33,6 +33,8 @@
 
 #include "key_manager.hpp"
 
+#include <limits.h>
+
 #include "common/code_utils.hpp"
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
@@ -59,6 +61,7 @@ const uint8_t KeyManager::kTrelInfoString[] = {'T', 'h', 'r', 'e', 'a', 'd', 'O'
 KeyManager::KeyManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mKeySequence(0)
+    , mKeyRingTasklet(aInstance, KeyManager::HandleKeyRingTasklet, this)
     , mMleFrameCounter(0)
     , mStoredMacFrameCounter(0)
     , mStoredMleFrameCounter(0)
@@ -78,6 +81,8 @@ KeyManager::KeyManager(Instance &aInstance)
 
     mMacFrameCounters.Reset();
     mPskc.Clear();
+    InvalidateKeyRing();
+    ResetKeyRingCounters();
 }
 
 void KeyManager::Start(void)
@@ -107,6 +112,7 @@ otError KeyManager::SetMasterKey(const MasterKey &aKey)
     SuccessOrExit(Get<Notifier>().Update(mMasterKey, aKey, kEventMasterKeyChanged));
     Get<Notifier>().Signal(kEventThreadKeySeqCounterChanged);
     mKeySequence = 0;
+    InvalidateKeyRing();
     UpdateKeyMaterial();
 
     // reset parent frame counters
@@ -168,28 +174,137 @@ void KeyManager::ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aTrelKey)
 }
 #endif
 
+void KeyManager::InvalidateKeyRing(void)
+{
+    for (KeyRingEntry &entry : mKeyRing)
+    {
+        entry.mHasKeys = false;
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+        entry.mHasTrelKey = false;
+#endif
+    }
+}
+
+bool KeyManager::HasKeys(uint32_t aKeySequence) const
+{
+    const KeyRingEntry &entry = GetKeyRingEntry(aKeySequence);
+
+    return entry.mHasKeys && (entry.mKeySequence == aKeySequence);
+}
+
+KeyManager::KeyRingEntry &KeyManager::PrepareKeys(uint32_t aKeySequence)
+{
+    KeyRingEntry &entry = GetKeyRingEntry(aKeySequence);
+    HashKeys      hashKeys;
+
+    VerifyOrExit(!HasKeys(aKeySequence));
+
+    ComputeKeys(aKeySequence, hashKeys);
+
+    entry.mKeySequence = aKeySequence;
+    entry.mMleKey      = hashKeys.mKeys.mMleKey;
+    entry.mMacKey      = hashKeys.mKeys.mMacKey;
+    entry.mHasKeys     = true;
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    entry.mHasTrelKey = false;
+#endif
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE && OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    entry.mMacKeySchedule.SetKey(entry.mMacKey.GetKey(), CHAR_BIT * Mac::Key::kSize);
+#endif
+
+exit:
+    return entry;
+}
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+bool KeyManager::HasTrelKey(uint32_t aKeySequence) const
+{
+    return HasKeys(aKeySequence) && GetKeyRingEntry(aKeySequence).mHasTrelKey;
+}
+
+void KeyManager::PrepareTrelKey(KeyRingEntry &aEntry)
+{
+    VerifyOrExit(!aEntry.mHasTrelKey);
+
+    ComputeTrelKey(aEntry.mKeySequence, aEntry.mTrelKey);
+    aEntry.mHasTrelKey = true;
+
+exit:
+    return;
+}
+#endif
+
+KeyManager::KeyRingEntry &KeyManager::RefreshKeys(uint32_t aKeySequence)
+{
+    if (!HasKeys(aKeySequence))
+    {
+        mKeyRingCounters.mRefreshes++;
+    }
+
+    return PrepareKeys(aKeySequence);
+}
+
 void KeyManager::UpdateKeyMaterial(void)
 {
-    HashKeys cur;
+    // The keys of the current key sequence are needed right away.
+
+    KeyRingEntry &entry = PrepareKeys(mKeySequence);
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    PrepareTrelKey(entry);
+#else
+    OT_UNUSED_VARIABLE(entry);
+#endif
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
-    HashKeys prev;
-    HashKeys next;
+    // `SubMac` secures and verifies frames with the previous, current
+    // and next MAC keys, so the adjacent keys are also prepared now
+    // (unless already in the key ring, e.g., after a key rotation).
+    //
+    // Unlike the MLE and TREL keys, the adjacent MAC keys are not
+    // derived lazily from `mKeyRingTasklet`. Deferring them would
+    // leave `SubMac` either with stale keys while `Mac` already uses
+    // the key index of the new key sequence, or with the current key
+    // in place of the adjacent ones, so frames secured with the
+    // previous or next key would be dropped until the tasklet runs.
+    // The cost is one extra HMAC computation on a rotation to the
+    // next key sequence, and two on any other key sequence change
+    // (e.g., a new master key or a jump in the key sequence).
+
+    RefreshKeys(mKeySequence - 1);
+    RefreshKeys(mKeySequence + 1);
+
+    Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1,
+                                 GetKeyRingEntry(mKeySequence - 1).mMacKey, GetKeyRingEntry(mKeySequence).mMacKey,
+                                 GetKeyRingEntry(mKeySequence + 1).mMacKey);
 #endif
 
-    ComputeKeys(mKeySequence, cur);
-    mMleKey = cur.mKeys.mMleKey;
+    // The remaining keys of the adjacent key sequences (used by MLE
+    // and TREL) are prepared later from `mKeyRingTasklet`.
 
-#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
-    ComputeKeys(mKeySequence - 1, prev);
-    ComputeKeys(mKeySequence + 1, next);
+    mKeyRingTasklet.Post();
+}
 
-    Get<Mac::SubMac>().SetMacKey(Mac::Frame::kKeyIdMode1, (mKeySequence & 0x7f) + 1, prev.mKeys.mMacKey,
-                                 cur.mKeys.mMacKey, next.mKeys.mMacKey);
-#endif
+void KeyManager::HandleKeyRingTasklet(Tasklet &aTasklet)
+{
+    aTasklet.GetOwner<KeyManager>().HandleKeyRingTasklet();
+}
+
+void KeyManager::HandleKeyRingTasklet(void)
+{
+    const uint32_t keySequences[] = {mKeySequence - 1, mKeySequence + 1};
+
+    for (uint32_t keySequence : keySequences)
+    {
+        KeyRingEntry &entry = RefreshKeys(keySequence);
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
-    ComputeTrelKey(mKeySequence, mTrelKey);
+        PrepareTrelKey(entry);
+#else
+        OT_UNUSED_VARIABLE(entry);
 #endif
+    }
 }
 
 void KeyManager::SetCurrentKeySequence(uint32_t aKeySequence)
@@ -222,20 +337,100 @@ exit:
 
 const Mle::Key &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 {
-    HashKeys hashKeys;
+    const Mle::Key *key;
+    HashKeys        hashKeys;
+
+    if (HasKeys(aKeySequence))
+    {
+        mKeyRingCounters.mHits++;
+        ExitNow(key = &GetKeyRingEntry(aKeySequence).mMleKey);
+    }
+
+    mKeyRingCounters.mMisses++;
+
+    if (IsInKeyRing(aKeySequence))
+    {
+        ExitNow(key = &PrepareKeys(aKeySequence).mMleKey);
+    }
 
     ComputeKeys(aKeySequence, hashKeys);
     mTemporaryMleKey = hashKeys.mKeys.mMleKey;
+    key              = &mTemporaryMleKey;
 
-    return mTemporaryMleKey;
+exit:
+    return *key;
 }
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+const Mac::Key &KeyManager::GetTemporaryMacKey(uint32_t aKeySequence)
+{
+    const Mac::Key *key;
+    HashKeys        hashKeys;
+
+    if (HasKeys(aKeySequence))
+    {
+        mKeyRingCounters.mHits++;
+        ExitNow(key = &GetKeyRingEntry(aKeySequence).mMacKey);
+    }
+
+    mKeyRingCounters.mMisses++;
+
+    if (IsInKeyRing(aKeySequence))
+    {
+        ExitNow(key = &PrepareKeys(aKeySequence).mMacKey);
+    }
+
+    ComputeKeys(aKeySequence, hashKeys);
+    mTemporaryMacKey = hashKeys.mKeys.mMacKey;
+    key              = &mTemporaryMacKey;
+
+exit:
+    return *key;
+}
+#endif
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE && OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+const Crypto::AesEcb *KeyManager::GetMacKeySchedule(uint32_t aKeySequence, const Mac::Key &aMacKey) const
+{
+    const Crypto::AesEcb *keySchedule = nullptr;
+    const KeyRingEntry &  entry       = GetKeyRingEntry(aKeySequence);
+
+    VerifyOrExit(HasKeys(aKeySequence));
+    VerifyOrExit(entry.mMacKey == aMacKey);
+
+    keySchedule = &entry.mMacKeySchedule;
+
+exit:
+    return keySchedule;
+}
+#endif
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
 const Mac::Key &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence)
 {
+    const Mac::Key *key;
+
+    if (HasTrelKey(aKeySequence))
+    {
+        mKeyRingCounters.mHits++;
+        ExitNow(key = &GetKeyRingEntry(aKeySequence).mTrelKey);
+    }
+
+    mKeyRingCounters.mMisses++;
+
+    if (IsInKeyRing(aKeySequence))
+    {
+        KeyRingEntry &entry = PrepareKeys(aKeySequence);
+
+        PrepareTrelKey(entry);
+        ExitNow(key = &entry.mTrelKey);
+    }
+
     ComputeTrelKey(aKeySequence, mTemporaryTrelKey);
+    key = &mTemporaryTrelKey;
 
-    return mTemporaryTrelKey;
+exit:
+    return *key;
 }
 #endif
 
@@ -39,13 +39,16 @@
 #include <stdint.h>
 
 #include <openthread/dataset.h>
+#include <openthread/thread.h>
 
 #include "common/clearable.hpp"
 #include "common/equatable.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/random.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "crypto/hmac_sha256.hpp"
 #include "mac/mac_types.hpp"
 #include "thread/mle_types.hpp"
@@ -216,11 +219,13 @@ public:
      * @returns The current TREL MAC key.
      *
      */
-    const Mac::Key &GetCurrentTrelMacKey(void) const { return mTrelKey; }
+    const Mac::Key &GetCurrentTrelMacKey(void) const { return GetKeyRingEntry(mKeySequence).mTrelKey; }
 
     /**
      * This method returns a temporary MAC key for TREL radio link computed from the given key sequence.
      *
+     * The key is taken from the key ring when @p aKeySequence is the previous or next key sequence.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns The temporary TREL MAC key.
@@ -229,17 +234,33 @@ public:
     const Mac::Key &GetTemporaryTrelMacKey(uint32_t aKeySequence);
 #endif
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+    /**
+     * This method returns a temporary MAC key for 15.4 radio link computed from the given key sequence.
+     *
+     * The key is taken from the key ring when @p aKeySequence is the previous or next key sequence.
+     *
+     * @param[in]  aKeySequence  The key sequence value.
+     *
+     * @returns The temporary 15.4 MAC key.
+     *
+     */
+    const Mac::Key &GetTemporaryMacKey(uint32_t aKeySequence);
+#endif
+
     /**
      * This method returns the current MLE key.
      *
      * @returns The current MLE key.
      *
      */
-    const Mle::Key &GetCurrentMleKey(void) const { return mMleKey; }
+    const Mle::Key &GetCurrentMleKey(void) const { return GetKeyRingEntry(mKeySequence).mMleKey; }
 
     /**
      * This method returns a temporary MLE key computed from the given key sequence.
      *
+     * The key is taken from the key ring when @p aKeySequence is the previous or next key sequence.
+     *
      * @param[in]  aKeySequence  The key sequence value.
      *
      * @returns The temporary MLE key.
@@ -247,6 +268,37 @@ public:
      */
     const Mle::Key &GetTemporaryMleKey(uint32_t aKeySequence);
 
+    /**
+     * This method returns the key ring counters.
+     *
+     * @returns A reference to the key ring counters.
+     *
+     */
+    const otKeyRingCounters &GetKeyRingCounters(void) const { return mKeyRingCounters; }
+
+    /**
+     * This method resets the key ring counters.
+     *
+     */
+    void ResetKeyRingCounters(void) { memset(&mKeyRingCounters, 0, sizeof(mKeyRingCounters)); }
+
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE && OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    /**
+     * This method returns the expanded AES key schedule of a 15.4 MAC key.
+     *
+     * Key schedules are kept in the key ring along with the previous, current and next keys. The cached key is
+     * compared against @p aMacKey, so a schedule is never returned for a different key (e.g., one set directly on
+     * `SubMac`).
+     *
+     * @param[in]  aKeySequence  The key sequence of @p aMacKey.
+     * @param[in]  aMacKey       The MAC key.
+     *
+     * @returns A pointer to the key schedule of @p aMacKey, or `nullptr` if it is not cached.
+     *
+     */
+    const Crypto::AesEcb *GetMacKeySchedule(uint32_t aKeySequence, const Mac::Key &aMacKey) const;
+#endif
+
 #if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
     /**
      * This method returns the current MAC Frame Counter value for 15.4 radio link.
@@ -508,6 +560,32 @@ private:
         kOneHourIntervalInMsec     = 3600u * 1000u,
     };
 
+    enum
+    {
+        // The key ring holds the keys of the previous, current and next
+        // key sequence. Entries are indexed by the low bits of the key
+        // sequence, so a power of two is used to keep three consecutive
+        // key sequences in distinct entries across a wrap-around.
+        kKeyRingSize = 4,
+    };
+
+    struct KeyRingEntry
+    {
+        uint32_t mKeySequence;
+        Mle::Key mMleKey;
+        Mac::Key mMacKey;
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+        Mac::Key mTrelKey;
+#endif
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE && OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+        Crypto::AesEcb mMacKeySchedule;
+#endif
+        bool mHasKeys : 1;
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+        bool mHasTrelKey : 1;
+#endif
+    };
+
     OT_TOOL_PACKED_BEGIN
     struct Keys
     {
@@ -527,6 +605,23 @@ private:
     void ComputeTrelKey(uint32_t aKeySequence, Mac::Key &aTrelKey);
 #endif
 
+    KeyRingEntry &      GetKeyRingEntry(uint32_t aKeySequence) { return mKeyRing[aKeySequence & (kKeyRingSize - 1)]; }
+    const KeyRingEntry &GetKeyRingEntry(uint32_t aKeySequence) const
+    {
+        return mKeyRing[aKeySequence & (kKeyRingSize - 1)];
+    }
+    bool          IsInKeyRing(uint32_t aKeySequence) const { return (aKeySequence - (mKeySequence - 1)) <= 2; }
+    bool          HasKeys(uint32_t aKeySequence) const;
+    KeyRingEntry &PrepareKeys(uint32_t aKeySequence);
+    KeyRingEntry &RefreshKeys(uint32_t aKeySequence);
+    void          InvalidateKeyRing(void);
+#if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
+    bool HasTrelKey(uint32_t aKeySequence) const;
+    void PrepareTrelKey(KeyRingEntry &aEntry);
+#endif
+    static void HandleKeyRingTasklet(Tasklet &aTasklet);
+    void        HandleKeyRingTasklet(void);
+
     void        StartKeyRotationTimer(void);
     static void HandleKeyRotationTimer(Timer &aTimer);
     void        HandleKeyRotationTimer(void);
@@ -540,15 +635,20 @@ private:
 
     MasterKey mMasterKey;
 
-    uint32_t mKeySequence;
-    Mle::Key mMleKey;
-    Mle::Key mTemporaryMleKey;
+    uint32_t          mKeySequence;
+    KeyRingEntry      mKeyRing[kKeyRingSize];
+    Tasklet           mKeyRingTasklet;
+    otKeyRingCounters mKeyRingCounters;
+    Mle::Key          mTemporaryMleKey;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
-    Mac::Key mTrelKey;
     Mac::Key mTemporaryTrelKey;
 #endif
 
+#if OPENTHREAD_CONFIG_RADIO_LINK_IEEE_802_15_4_ENABLE
+    Mac::Key mTemporaryMacKey;
+#endif
+
     Mac::LinkFrameCounters mMacFrameCounters;
     uint32_t               mMleFrameCounter;
     uint32_t               mStoredMacFrameCounter;
@@ -52,7 +52,183 @@ namespace Lowpan {
 
 Lowpan::Lowpan(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mCompressionCacheVersion(0)
+    , mCompressionCacheNext(0)
 {
+    ClearCompressionCache();
+}
+
+void Lowpan::ClearCompressionCache(void)
+{
+    for (CompressionTemplate &entry : mCompressionCache)
+    {
+        entry.mValid = false;
+    }
+}
+
+bool Lowpan::CompressionTemplate::Matches(const Ip6::Header & aIp6Header,
+                                          const Mac::Address &aMacSource,
+                                          const Mac::Address &aMacDest,
+                                          bool                aNextHeaderCompressed) const
+{
+    return mValid && (mNextHeader == aIp6Header.GetNextHeader()) && (mHopLimit == aIp6Header.GetHopLimit()) &&
+           (mNextHeaderCompressed == aNextHeaderCompressed) && (mDestination == aIp6Header.GetDestination()) &&
+           (mSource == aIp6Header.GetSource()) && (mMacDest == aMacDest) && (mMacSource == aMacSource);
+}
+
+const Lowpan::CompressionTemplate &Lowpan::GetCompressionTemplate(const Ip6::Header & aIp6Header,
+                                                                  const Mac::Address &aMacSource,
+                                                                  const Mac::Address &aMacDest,
+                                                                  bool                aNextHeaderCompressed)
+{
+    uint8_t              version = Get<NetworkData::Leader>().GetVersion();
+    CompressionTemplate *entry;
+
+    if (version != mCompressionCacheVersion)
+    {
+        // The contexts may have changed along with the Network Data.
+        ClearCompressionCache();
+        mCompressionCacheVersion = version;
+    }
+
+    for (CompressionTemplate &cached : mCompressionCache)
+    {
+        if (cached.Matches(aIp6Header, aMacSource, aMacDest, aNextHeaderCompressed))
+        {
+            ExitNow(entry = &cached);
+        }
+    }
+
+    entry                 = &mCompressionCache[mCompressionCacheNext];
+    mCompressionCacheNext = (mCompressionCacheNext + 1) % kCompressionCacheSize;
+
+    // The template buffer is large enough for any base header, so
+    // computing it can not fail.
+    IgnoreError(ComputeCompressionTemplate(aIp6Header, aMacSource, aMacDest, aNextHeaderCompressed, *entry));
+
+exit:
+    return *entry;
+}
+
+otError Lowpan::ComputeCompressionTemplate(const Ip6::Header &  aIp6Header,
+                                           const Mac::Address & aMacSource,
+                                           const Mac::Address & aMacDest,
+                                           bool                 aNextHeaderCompressed,
+                                           CompressionTemplate &aTemplate)
+{
+    otError              error       = OT_ERROR_NONE;
+    NetworkData::Leader &networkData = Get<NetworkData::Leader>();
+    BufferWriter         buf(aTemplate.mInline, sizeof(aTemplate.mInline));
+    uint16_t             hcCtl = 0;
+    Context              srcContext, dstContext;
+    bool                 srcContextValid, dstContextValid;
+
+    aTemplate.mValid = false;
+
+    srcContextValid =
+        (networkData.GetContext(aIp6Header.GetSource(), srcContext) == OT_ERROR_NONE && srcContext.mCompressFlag);
+
+    if (!srcContextValid)
+    {
+        IgnoreError(networkData.GetContext(0, srcContext));
+    }
+
+    dstContextValid = (networkData.GetContext(aIp6Header.GetDestination(), dstContext) == OT_ERROR_NONE &&
+                       dstContext.mCompressFlag);
+
+    if (!dstContextValid)
+    {
+        IgnoreError(networkData.GetContext(0, dstContext));
+    }
+
+    // Context Identifier
+    if (srcContext.mContextId != 0 || dstContext.mContextId != 0)
+    {
+        hcCtl |= kHcContextId;
+        aTemplate.mContextId = ((srcContext.mContextId << 4) | dstContext.mContextId) & 0xff;
+    }
+
+    // Next Header
+    if (aNextHeaderCompressed)
+    {
+        hcCtl |= kHcNextHeader;
+    }
+    else
+    {
+        SuccessOrExit(error = buf.Write(static_cast<uint8_t>(aIp6Header.GetNextHeader())));
+    }
+
+    // Hop Limit
+    switch (aIp6Header.GetHopLimit())
+    {
+    case 1:
+        hcCtl |= kHcHopLimit1;
+        break;
+
+    case 64:
+        hcCtl |= kHcHopLimit64;
+        break;
+
+    case 255:
+        hcCtl |= kHcHopLimit255;
+        break;
+
+    default:
+        SuccessOrExit(error = buf.Write(aIp6Header.GetHopLimit()));
+        break;
+    }
+
+    // Source Address
+    if (aIp6Header.GetSource().IsUnspecified())
+    {
+        hcCtl |= kHcSrcAddrContext;
+    }
+    else if (aIp6Header.GetSource().IsLinkLocal())
+    {
+        SuccessOrExit(error = CompressSourceIid(aMacSource, aIp6Header.GetSource(), srcContext, hcCtl, buf));
+    }
+    else if (srcContextValid)
+    {
+        hcCtl |= kHcSrcAddrContext;
+        SuccessOrExit(error = CompressSourceIid(aMacSource, aIp6Header.GetSource(), srcContext, hcCtl, buf));
+    }
+    else
+    {
+        SuccessOrExit(error = buf.Write(aIp6Header.GetSource().mFields.m8, sizeof(aIp6Header.GetSource())));
+    }
+
+    // Destination Address
+    if (aIp6Header.GetDestination().IsMulticast())
+    {
+        SuccessOrExit(error = CompressMulticast(aIp6Header.GetDestination(), hcCtl, buf));
+    }
+    else if (aIp6Header.GetDestination().IsLinkLocal())
+    {
+        SuccessOrExit(error = CompressDestinationIid(aMacDest, aIp6Header.GetDestination(), dstContext, hcCtl, buf));
+    }
+    else if (dstContextValid)
+    {
+        hcCtl |= kHcDstAddrContext;
+        SuccessOrExit(error = CompressDestinationIid(aMacDest, aIp6Header.GetDestination(), dstContext, hcCtl, buf));
+    }
+    else
+    {
+        SuccessOrExit(error = buf.Write(&aIp6Header.GetDestination(), sizeof(aIp6Header.GetDestination())));
+    }
+
+    aTemplate.mSource               = aIp6Header.GetSource();
+    aTemplate.mDestination          = aIp6Header.GetDestination();
+    aTemplate.mMacSource            = aMacSource;
+    aTemplate.mMacDest              = aMacDest;
+    aTemplate.mNextHeader           = aIp6Header.GetNextHeader();
+    aTemplate.mHopLimit             = aIp6Header.GetHopLimit();
+    aTemplate.mNextHeaderCompressed = aNextHeaderCompressed;
+    aTemplate.mHcCtl                = hcCtl;
+    aTemplate.mInlineLength         = static_cast<uint8_t>(buf.GetWritePointer() - aTemplate.mInline);
+    aTemplate.mValid                = true;
+
+exit:
+    return error;
 }
 
 void Lowpan::CopyContext(const Context &aContext, Ip6::Address &aAddress)
@@ -261,47 +437,47 @@ otError Lowpan::Compress(Message &           aMessage,
                          BufferWriter &      aBuf,
                          uint8_t &           aHeaderDepth)
 {
-    otError              error       = OT_ERROR_NONE;
-    NetworkData::Leader &networkData = Get<NetworkData::Leader>();
-    uint16_t             startOffset = aMessage.GetOffset();
-    BufferWriter         buf         = aBuf;
-    uint16_t             hcCtl       = kHcDispatch;
-    Ip6::Header          ip6Header;
-    uint8_t *            ip6HeaderBytes = reinterpret_cast<uint8_t *>(&ip6Header);
-    Context              srcContext, dstContext;
-    bool                 srcContextValid, dstContextValid;
-    uint8_t              nextHeader;
-    uint8_t              ecn;
-    uint8_t              dscp;
-    uint8_t              headerDepth    = 0;
-    uint8_t              headerMaxDepth = aHeaderDepth;
+    otError                    error       = OT_ERROR_NONE;
+    uint16_t                   startOffset = aMessage.GetOffset();
+    BufferWriter               buf         = aBuf;
+    uint16_t                   hcCtl       = kHcDispatch;
+    Ip6::Header                ip6Header;
+    uint8_t *                  ip6HeaderBytes = reinterpret_cast<uint8_t *>(&ip6Header);
+    const CompressionTemplate *compressionTemplate;
+    bool                       nextHeaderCompressed;
+    uint8_t                    nextHeader;
+    uint8_t                    ecn;
+    uint8_t                    dscp;
+    uint8_t                    headerDepth    = 0;
+    uint8_t                    headerMaxDepth = aHeaderDepth;
 
     SuccessOrExit(error = aMessage.Read(aMessage.GetOffset(), ip6Header));
 
-    srcContextValid =
-        (networkData.GetContext(ip6Header.GetSource(), srcContext) == OT_ERROR_NONE && srcContext.mCompressFlag);
-
-    if (!srcContextValid)
+    switch (ip6Header.GetNextHeader())
     {
-        IgnoreError(networkData.GetContext(0, srcContext));
-    }
-
-    dstContextValid =
-        (networkData.GetContext(ip6Header.GetDestination(), dstContext) == OT_ERROR_NONE && dstContext.mCompressFlag);
+    case Ip6::kProtoHopOpts:
+    case Ip6::kProtoUdp:
+    case Ip6::kProtoIp6:
+        nextHeaderCompressed = (headerDepth + 1 < headerMaxDepth);
+        break;
 
-    if (!dstContextValid)
-    {
-        IgnoreError(networkData.GetContext(0, dstContext));
+    default:
+        nextHeaderCompressed = false;
+        break;
     }
 
+    // Contexts, Next Header, Hop Limit and addresses are the same for
+    // all datagrams of a flow, so their compression result is cached.
+    compressionTemplate = &GetCompressionTemplate(ip6Header, aMacSource, aMacDest, nextHeaderCompressed);
+    hcCtl |= compressionTemplate->mHcCtl;
+
     // Lowpan HC Control Bits
     SuccessOrExit(error = buf.Advance(sizeof(hcCtl)));
 
     // Context Identifier
-    if (srcContext.mContextId != 0 || dstContext.mContextId != 0)
+    if (hcCtl & kHcContextId)
     {
-        hcCtl |= kHcContextId;
-        SuccessOrExit(error = buf.Write(((srcContext.mContextId << 4) | dstContext.mContextId) & 0xff));
+        SuccessOrExit(error = buf.Write(compressionTemplate->mContextId));
     }
 
     dscp = ((ip6HeaderBytes[0] << 2) & 0x3c) | (ip6HeaderBytes[1] >> 6);
@@ -339,81 +515,8 @@ otError Lowpan::Compress(Message &           aMessage,
         SuccessOrExit(error = buf.Write(ip6HeaderBytes + 2, 2));
     }
 
-    // Next Header
-    switch (ip6Header.GetNextHeader())
-    {
-    case Ip6::kProtoHopOpts:
-    case Ip6::kProtoUdp:
-    case Ip6::kProtoIp6:
-        if (headerDepth + 1 < headerMaxDepth)
-        {
-            hcCtl |= kHcNextHeader;
-            break;
-        }
-        OT_FALL_THROUGH;
-
-    default:
-        SuccessOrExit(error = buf.Write(static_cast<uint8_t>(ip6Header.GetNextHeader())));
-        break;
-    }
-
-    // Hop Limit
-    switch (ip6Header.GetHopLimit())
-    {
-    case 1:
-        hcCtl |= kHcHopLimit1;
-        break;
-
-    case 64:
-        hcCtl |= kHcHopLimit64;
-        break;
-
-    case 255:
-        hcCtl |= kHcHopLimit255;
-        break;
-
-    default:
-        SuccessOrExit(error = buf.Write(ip6Header.GetHopLimit()));
-        break;
-    }
-
-    // Source Address
-    if (ip6Header.GetSource().IsUnspecified())
-    {
-        hcCtl |= kHcSrcAddrContext;
-    }
-    else if (ip6Header.GetSource().IsLinkLocal())
-    {
-        SuccessOrExit(error = CompressSourceIid(aMacSource, ip6Header.GetSource(), srcContext, hcCtl, buf));
-    }
-    else if (srcContextValid)
-    {
-        hcCtl |= kHcSrcAddrContext;
-        SuccessOrExit(error = CompressSourceIid(aMacSource, ip6Header.GetSource(), srcContext, hcCtl, buf));
-    }
-    else
-    {
-        SuccessOrExit(error = buf.Write(ip6Header.GetSource().mFields.m8, sizeof(ip6Header.GetSource())));
-    }
-
-    // Destination Address
-    if (ip6Header.GetDestination().IsMulticast())
-    {
-        SuccessOrExit(error = CompressMulticast(ip6Header.GetDestination(), hcCtl, buf));
-    }
-    else if (ip6Header.GetDestination().IsLinkLocal())
-    {
-        SuccessOrExit(error = CompressDestinationIid(aMacDest, ip6Header.GetDestination(), dstContext, hcCtl, buf));
-    }
-    else if (dstContextValid)
-    {
-        hcCtl |= kHcDstAddrContext;
-        SuccessOrExit(error = CompressDestinationIid(aMacDest, ip6Header.GetDestination(), dstContext, hcCtl, buf));
-    }
-    else
-    {
-        SuccessOrExit(error = buf.Write(&ip6Header.GetDestination(), sizeof(ip6Header.GetDestination())));
-    }
+    // Next Header, Hop Limit, Source and Destination Address
+    SuccessOrExit(error = buf.Write(compressionTemplate->mInline, compressionTemplate->mInlineLength));
 
     headerDepth++;
 
@@ -311,6 +311,16 @@ public:
      */
     int DecompressUdpHeader(Ip6::Udp::Header &aUdpHeader, const uint8_t *aBuf, uint16_t aBufLength);
 
+    /**
+     * This method clears the LOWPAN_IPHC compression cache.
+     *
+     * Cached entries are automatically invalidated when the Network Data version changes. This method MUST be called
+     * when the Network Data is replaced without a version increment (e.g., on reset or when new Network Data is
+     * received from the Leader).
+     *
+     */
+    void ClearCompressionCache(void);
+
 private:
     enum
     {
@@ -359,6 +369,45 @@ private:
         kUdpDispatchMask = 0xf8,
         kUdpChecksum     = 1 << 2,
         kUdpPortMask     = 3 << 0,
+
+        kCompressionCacheSize = OPENTHREAD_CONFIG_6LOWPAN_COMPRESSION_CACHE_SIZE,
+    };
+
+    static_assert(kCompressionCacheSize > 0, "OPENTHREAD_CONFIG_6LOWPAN_COMPRESSION_CACHE_SIZE must be non-zero");
+
+    /**
+     * This class represents the LOWPAN_IPHC compression result for the base IPv6 header of a flow.
+     *
+     * It holds everything except the Traffic Class and Flow Label (which are compressed per datagram): the
+     * LOWPAN_IPHC control bits, the Context Identifier Extension, and the in-line Next Header, Hop Limit and
+     * source and destination address fields.
+     *
+     */
+    class CompressionTemplate
+    {
+    public:
+        enum
+        {
+            kMaxInlineLength = sizeof(uint8_t) + sizeof(uint8_t) + 2 * sizeof(Ip6::Address),
+        };
+
+        bool Matches(const Ip6::Header & aIp6Header,
+                     const Mac::Address &aMacSource,
+                     const Mac::Address &aMacDest,
+                     bool                aNextHeaderCompressed) const;
+
+        Ip6::Address mSource;
+        Ip6::Address mDestination;
+        Mac::Address mMacSource;
+        Mac::Address mMacDest;
+        uint8_t      mNextHeader;
+        uint8_t      mHopLimit;
+        bool         mNextHeaderCompressed : 1;
+        bool         mValid : 1;
+        uint16_t     mHcCtl;
+        uint8_t      mContextId;
+        uint8_t      mInlineLength;
+        uint8_t      mInline[kMaxInlineLength];
     };
 
     otError Compress(Message &           aMessage,
@@ -381,12 +430,27 @@ private:
     otError CompressMulticast(const Ip6::Address &aIpAddr, uint16_t &aHcCtl, BufferWriter &aBuf);
     otError CompressUdp(Message &aMessage, BufferWriter &aBuf);
 
+    const CompressionTemplate &GetCompressionTemplate(const Ip6::Header & aIp6Header,
+                                                      const Mac::Address &aMacSource,
+                                                      const Mac::Address &aMacDest,
+                                                      bool                aNextHeaderCompressed);
+
+    otError ComputeCompressionTemplate(const Ip6::Header &  aIp6Header,
+                                       const Mac::Address & aMacSource,
+                                       const Mac::Address & aMacDest,
+                                       bool                 aNextHeaderCompressed,
+                                       CompressionTemplate &aTemplate);
+
     int     DecompressExtensionHeader(Message &aMessage, const uint8_t *aBuf, uint16_t aBufLength);
     int     DecompressUdpHeader(Message &aMessage, const uint8_t *aBuf, uint16_t aBufLength, uint16_t aDatagramLength);
     otError DispatchToNextHeader(uint8_t aDispatch, uint8_t &aNextHeader);
 
     static void    CopyContext(const Context &aContext, Ip6::Address &aAddress);
     static otError ComputeIid(const Mac::Address &aMacAddr, const Context &aContext, Ip6::Address &aIpAddress);
+
+    CompressionTemplate mCompressionCache[kCompressionCacheSize];
+    uint8_t             mCompressionCacheVersion;
+    uint8_t             mCompressionCacheNext;
 };
 
 /**
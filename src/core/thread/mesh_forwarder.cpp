@@ -81,6 +81,7 @@ void ThreadLinkInfo::SetFrom(const Mac::RxFrame &aFrame)
 
 MeshForwarder::MeshForwarder(Instance &aInstance)
     : InstanceLocator(aInstance)
+    , mReassemblyTimer(aInstance, MeshForwarder::HandleReassemblyTimer, this)
     , mMessageNextOffset(0)
     , mSendMessage(nullptr)
     , mMeshSource()
@@ -89,6 +90,8 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
     , mEnabled(false)
     , mTxPaused(false)
     , mSendBusy(false)
+    , mSendFragment(false)
+    , mFragmentPipelined(false)
     , mScheduleTransmissionTask(aInstance, MeshForwarder::ScheduleTransmissionTask, this)
 #if OPENTHREAD_FTD
     , mIndirectSender(aInstance)
@@ -139,6 +142,9 @@ void MeshForwarder::Stop(void)
         message->Free();
     }
 
+    mReassemblyTable.Clear();
+    mReassemblyTimer.Stop();
+
 #if OPENTHREAD_FTD
     mIndirectSender.Stop();
     mFragmentPriorityList.Clear();
@@ -201,8 +207,11 @@ void MeshForwarder::RemoveMessage(Message &aMessage)
     if (queue == &mSendQueue)
     {
 #if OPENTHREAD_FTD
-        for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+        // Only the children for which the message is scheduled are visited.
+        for (uint16_t childIndex = 0; aMessage.GetChildMask().FindNextSet(childIndex); childIndex++)
         {
+            Child &child = *Get<ChildTable>().GetChildAtIndex(childIndex);
+
             IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(aMessage, child));
         }
 #endif
@@ -236,7 +245,8 @@ void MeshForwarder::ScheduleTransmissionTask(void)
 {
     VerifyOrExit(!mSendBusy && !mTxPaused);
 
-    mSendMessage = GetDirectTransmission();
+    mFragmentPipelined = false;
+    mSendMessage       = GetDirectTransmission();
     VerifyOrExit(mSendMessage != nullptr);
 
     if (mSendMessage->GetOffset() == 0)
@@ -310,6 +320,15 @@ Message *MeshForwarder::GetDirectTransmission(void)
 #endif
 
         default:
+#if OPENTHREAD_FTD
+            if (curMessage->IsChildPending())
+            {
+                // Only drop the direct transmission, the message stays
+                // queued for indirect transmission to sleepy children.
+                curMessage->ClearDirectTransmission();
+                continue;
+            }
+#endif
             mSendQueue.Dequeue(*curMessage);
             LogMessage(kMessageDrop, *curMessage, nullptr, error);
             curMessage->Free();
@@ -470,6 +489,8 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
     Mac::TxFrame *frame         = nullptr;
     bool          addFragHeader = false;
 
+    mSendFragment = false;
+
     VerifyOrExit(mEnabled && (mSendMessage != nullptr));
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
@@ -491,6 +512,12 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
 
     mSendBusy = true;
 
+    if (mFragmentPipelined)
+    {
+        mFragmentPipelined = false;
+        mFragmentTxCounters.mTxPipelined++;
+    }
+
     switch (mSendMessage->GetType())
     {
     case Message::kTypeIp6:
@@ -515,6 +542,8 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
             ExitNow(frame = nullptr);
         }
 
+        mSendFragment = (mSendMessage->GetOffset() != 0) || (mMessageNextOffset < mSendMessage->GetLength());
+
         OT_ASSERT(frame->GetLength() != 7);
         break;
 
@@ -955,10 +984,17 @@ exit:
 
 void MeshForwarder::UpdateSendMessage(otError aFrameTxError, Mac::Address &aMacDest, Neighbor *aNeighbor)
 {
+    bool pipelined = false;
+
     VerifyOrExit(mSendMessage != nullptr);
 
     OT_ASSERT(mSendMessage->GetDirectTransmission());
 
+    if (mSendFragment)
+    {
+        mFragmentTxCounters.mTxFragments++;
+    }
+
     if (aFrameTxError != OT_ERROR_NONE)
     {
         // If the transmission of any fragment frame fails,
@@ -967,11 +1003,21 @@ void MeshForwarder::UpdateSendMessage(otError aFrameTxError, Mac::Address &aMacD
 
         mSendMessage->SetTxSuccess(false);
 
+        if (mSendFragment)
+        {
+            mFragmentTxCounters.mTxFailures++;
+        }
+
 #if OPENTHREAD_CONFIG_DROP_MESSAGE_ON_FRAGMENT_TX_FAILURE
 
         // We set the NextOffset to end of message to avoid sending
         // any remaining fragments in the message.
 
+        if (mMessageNextOffset < mSendMessage->GetLength())
+        {
+            mFragmentTxCounters.mDatagramsAborted++;
+        }
+
         mMessageNextOffset = mSendMessage->GetLength();
 #endif
     }
@@ -1046,9 +1092,54 @@ void MeshForwarder::UpdateSendMessage(otError aFrameTxError, Mac::Address &aMacD
         mSendMessage       = nullptr;
         mMessageNextOffset = 0;
     }
+#if OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_TX_PIPELINE_ENABLE
+    else if (ShouldPipelineNextFragment())
+    {
+        // The remaining fragments go to the same MAC destination as
+        // the first one, so the route lookup done by
+        // `ScheduleTransmissionTask()` is skipped and the next fragment
+        // is requested right away. `Mac` starts it from its transmit
+        // done callback unless a higher priority MAC operation is
+        // pending. A higher priority message in the send queue stops
+        // the pipelining, see `ShouldPipelineNextFragment()`.
+
+        mFragmentPipelined = true;
+        pipelined          = true;
+        Get<Mac::Mac>().RequestDirectFrameTransmission();
+    }
+#endif
+
+exit:
+    if (!pipelined)
+    {
+        mScheduleTransmissionTask.Post();
+    }
+}
+
+bool MeshForwarder::ShouldPipelineNextFragment(void) const
+{
+    bool shouldPipeline = false;
+
+    VerifyOrExit(mEnabled && !mTxPaused && mSendFragment && mSendMessage->GetDirectTransmission() &&
+                 (mSendMessage->GetOffset() != 0) &&
+                 (mSendMessage->GetSubType() != Message::kSubTypeMleDiscoverRequest));
+
+    // The send queue is ordered by priority, so only the messages
+    // ahead of the ones with the priority of `mSendMessage` are
+    // checked. A higher priority direct message (e.g. MLE) must go
+    // through `ScheduleTransmissionTask()` to be sent between the
+    // fragments, as it would without pipelining.
+
+    for (const Message *message = mSendQueue.GetHead();
+         (message != nullptr) && (message->GetPriority() > mSendMessage->GetPriority()); message = message->GetNext())
+    {
+        VerifyOrExit(!message->GetDirectTransmission());
+    }
+
+    shouldPipeline = true;
 
 exit:
-    mScheduleTransmissionTask.Post();
+    return shouldPipeline;
 }
 
 void MeshForwarder::HandleReceivedFrame(Mac::RxFrame &aFrame)
@@ -1120,10 +1211,11 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
                                    const Mac::Address &  aMacDest,
                                    const ThreadLinkInfo &aLinkInfo)
 {
-    otError                error = OT_ERROR_NONE;
-    Lowpan::FragmentHeader fragmentHeader;
-    uint16_t               fragmentHeaderLength;
-    Message *              message = nullptr;
+    otError                 error = OT_ERROR_NONE;
+    Lowpan::FragmentHeader  fragmentHeader;
+    uint16_t                fragmentHeaderLength;
+    Message *               message = nullptr;
+    ReassemblyTable::Entry *entry   = nullptr;
 
     // Check the fragment header
     SuccessOrExit(error = fragmentHeader.ParseFrom(aFrame, aFrameLength, fragmentHeaderLength));
@@ -1177,7 +1269,6 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
         SuccessOrExit(error);
 
         message->SetDatagramTag(fragmentHeader.GetDatagramTag());
-        message->SetTimeout(kReassemblyTimeout);
         message->SetLinkInfo(aLinkInfo);
 
         VerifyOrExit(Get<Ip6::Filter>().Accept(*message), error = OT_ERROR_DROP);
@@ -1195,23 +1286,25 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
             ClearReassemblyList();
         }
 
-        mReassemblyList.Enqueue(*message);
-
-        Get<TimeTicker>().RegisterReceiver(TimeTicker::kMeshForwarder);
+        entry = AddToReassemblyTable(*message, aMacSource);
+        VerifyOrExit(entry != nullptr, error = OT_ERROR_NO_BUFS);
     }
     else // Received frame is a "next fragment".
     {
-        for (message = mReassemblyList.GetHead(); message; message = message->GetNext())
+        entry = mReassemblyTable.Find(aMacSource, fragmentHeader.GetDatagramTag());
+
+        // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
+        if ((entry != nullptr) && (entry->GetMessage().GetLength() == fragmentHeader.GetDatagramSize()) &&
+            (entry->GetMessage().GetOffset() == fragmentHeader.GetDatagramOffset()) &&
+            (entry->GetMessage().GetOffset() + aFrameLength <= fragmentHeader.GetDatagramSize()) &&
+            (entry->GetMessage().IsLinkSecurityEnabled() == aLinkInfo.IsLinkSecurityEnabled()))
         {
-            // Security Check: only consider reassembly buffers that had the same Security Enabled setting.
-            if (message->GetLength() == fragmentHeader.GetDatagramSize() &&
-                message->GetDatagramTag() == fragmentHeader.GetDatagramTag() &&
-                message->GetOffset() == fragmentHeader.GetDatagramOffset() &&
-                message->GetOffset() + aFrameLength <= fragmentHeader.GetDatagramSize() &&
-                message->IsLinkSecurityEnabled() == aLinkInfo.IsLinkSecurityEnabled())
-            {
-                break;
-            }
+            message = &entry->GetMessage();
+        }
+        else
+        {
+            entry = nullptr;
+            mReassemblyCounters.mUnmatched++;
         }
 
         // For a sleepy-end-device, if we receive a new (secure) next fragment
@@ -1233,7 +1326,7 @@ void MeshForwarder::HandleFragment(const uint8_t *       aFrame,
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_ENABLE
         message->AddLqi(aLinkInfo.GetLqi());
 #endif
-        message->SetTimeout(kReassemblyTimeout);
+        entry->SetDeadline(TimerMilli::GetNow() + Time::SecToMsec(kReassemblyTimeout));
     }
 
 exit:
@@ -1242,7 +1335,9 @@ exit:
     {
         if (message->GetOffset() >= message->GetLength())
         {
+            mReassemblyTable.Remove(*entry);
             mReassemblyList.Dequeue(*message);
+            mReassemblyCounters.mCompleted++;
             IgnoreError(HandleDatagram(*message, aLinkInfo, aMacSource));
         }
     }
@@ -1254,24 +1349,110 @@ exit:
     }
 }
 
-void MeshForwarder::ClearReassemblyList(void)
+MeshForwarder::ReassemblyTable::Entry *MeshForwarder::AddToReassemblyTable(Message &           aMessage,
+                                                                           const Mac::Address &aMacSource)
 {
-    Message *message;
-    Message *next;
+    TimeMilli               deadline = TimerMilli::GetNow() + Time::SecToMsec(kReassemblyTimeout);
+    ReassemblyTable::Entry *entry;
+    uint8_t                 count;
+
+    // A new first fragment with the tag of a datagram still being
+    // reassembled restarts that datagram.
 
-    for (message = mReassemblyList.GetHead(); message; message = next)
+    entry = mReassemblyTable.Find(aMacSource, aMessage.GetDatagramTag());
+
+    if (entry != nullptr)
     {
-        next = message->GetNext();
-        mReassemblyList.Dequeue(*message);
+        mReassemblyCounters.mEvicted++;
+        RemoveFromReassembly(*entry, OT_ERROR_NO_FRAME_RECEIVED);
+    }
+
+    // Limit the number of datagrams from the same source, so that a
+    // single source cannot take over the reassembly table. The oldest
+    // datagram (the one least recently updated) is dropped, as it is
+    // the most likely one to have lost a fragment.
+
+    entry = mReassemblyTable.FindOldest(&aMacSource, count);
+
+    if (count >= OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_PER_SOURCE)
+    {
+        mReassemblyCounters.mSourceLimited++;
+        RemoveFromReassembly(*entry, OT_ERROR_NO_BUFS);
+    }
+
+    if (mReassemblyTable.IsFull())
+    {
+        mReassemblyCounters.mEvicted++;
+        RemoveFromReassembly(*mReassemblyTable.FindOldest(nullptr, count), OT_ERROR_NO_BUFS);
+    }
+
+    entry = mReassemblyTable.Add(aMessage, aMacSource, aMessage.GetDatagramTag(), deadline);
+    VerifyOrExit(entry != nullptr);
+
+    mReassemblyList.Enqueue(aMessage);
+    mReassemblyCounters.mStarted++;
+    mReassemblyTimer.FireAtIfEarlier(deadline);
+
+exit:
+    return entry;
+}
+
+void MeshForwarder::RemoveFromReassembly(ReassemblyTable::Entry &aEntry, otError aError)
+{
+    Message &message = aEntry.GetMessage();
+
+    mReassemblyTable.Remove(aEntry);
+    mReassemblyList.Dequeue(message);
+
+    LogMessage(kMessageReassemblyDrop, message, nullptr, aError);
+
+    if (message.GetType() == Message::kTypeIp6)
+    {
+        mIpCounters.mRxFailure++;
+    }
+
+    message.Free();
+}
 
-        LogMessage(kMessageReassemblyDrop, *message, nullptr, OT_ERROR_NO_FRAME_RECEIVED);
+void MeshForwarder::ClearReassemblyList(void)
+{
+    for (ReassemblyTable::Entry &entry : mReassemblyTable)
+    {
+        if (entry.IsInUse())
+        {
+            mReassemblyCounters.mEvicted++;
+            RemoveFromReassembly(entry, OT_ERROR_NO_FRAME_RECEIVED);
+        }
+    }
+
+    mReassemblyTimer.Stop();
+}
+
+void MeshForwarder::HandleReassemblyTimer(Timer &aTimer)
+{
+    aTimer.GetOwner<MeshForwarder>().HandleReassemblyTimer();
+}
+
+void MeshForwarder::HandleReassemblyTimer(void)
+{
+    TimeMilli now = TimerMilli::GetNow();
 
-        if (message->GetType() == Message::kTypeIp6)
+    for (ReassemblyTable::Entry &entry : mReassemblyTable)
+    {
+        if (!entry.IsInUse())
         {
-            mIpCounters.mRxFailure++;
+            continue;
         }
 
-        message->Free();
+        if (entry.GetDeadline() <= now)
+        {
+            mReassemblyCounters.mTimedOut++;
+            RemoveFromReassembly(entry, OT_ERROR_REASSEMBLY_TIMEOUT);
+        }
+        else
+        {
+            mReassemblyTimer.FireAtIfEarlier(entry.GetDeadline());
+        }
     }
 }
 
@@ -1283,41 +1464,144 @@ void MeshForwarder::HandleTimeTick(void)
     contineRxingTicks = mFragmentPriorityList.UpdateOnTimeTick();
 #endif
 
-    contineRxingTicks = UpdateReassemblyList() || contineRxingTicks;
-
     if (!contineRxingTicks)
     {
         Get<TimeTicker>().UnregisterReceiver(TimeTicker::kMeshForwarder);
     }
 }
 
-bool MeshForwarder::UpdateReassemblyList(void)
+//---------------------------------------------------------------------------------------------------------------------
+// ReassemblyTable
+
+bool MeshForwarder::ReassemblyTable::Entry::IsFromSource(const Mac::Address &aSource) const
 {
-    Message *next = nullptr;
+    return mSource == aSource;
+}
 
-    for (Message *message = mReassemblyList.GetHead(); message; message = next)
+void MeshForwarder::ReassemblyTable::Clear(void)
+{
+    for (uint8_t index = 0; index < kNumEntries; index++)
     {
-        next = message->GetNext();
+        mEntries[index].mMessage = nullptr;
+        mEntries[index].mNext    = index + 1;
+    }
+
+    mEntries[kNumEntries - 1].mNext = kInvalidIndex;
 
-        if (message->GetTimeout() > 0)
+    memset(mBuckets, kInvalidIndex, sizeof(mBuckets));
+    mFreeHead   = 0;
+    mNumEntries = 0;
+}
+
+uint8_t MeshForwarder::ReassemblyTable::GetBucket(const Mac::Address &aSource, uint16_t aTag)
+{
+    uint16_t hash = aTag;
+
+    if (aSource.IsShort())
+    {
+        hash ^= aSource.GetShort();
+    }
+    else if (aSource.IsExtended())
+    {
+        for (uint8_t byte : aSource.GetExtended().m8)
         {
-            message->DecrementTimeout();
+            hash = static_cast<uint16_t>((hash << 3) ^ (hash >> 13) ^ byte);
         }
-        else
+    }
+
+    return static_cast<uint8_t>((hash ^ (hash >> 8)) & (kNumBuckets - 1));
+}
+
+MeshForwarder::ReassemblyTable::Entry *MeshForwarder::ReassemblyTable::Find(const Mac::Address &aSource,
+                                                                            uint16_t            aTag)
+{
+    Entry *entry = nullptr;
+
+    for (uint8_t index = mBuckets[GetBucket(aSource, aTag)]; index != kInvalidIndex; index = mEntries[index].mNext)
+    {
+        if ((mEntries[index].mDatagramTag == aTag) && mEntries[index].IsFromSource(aSource))
         {
-            mReassemblyList.Dequeue(*message);
+            entry = &mEntries[index];
+            break;
+        }
+    }
 
-            LogMessage(kMessageReassemblyDrop, *message, nullptr, OT_ERROR_REASSEMBLY_TIMEOUT);
-            if (message->GetType() == Message::kTypeIp6)
-            {
-                mIpCounters.mRxFailure++;
-            }
+    return entry;
+}
+
+MeshForwarder::ReassemblyTable::Entry *MeshForwarder::ReassemblyTable::Add(Message &           aMessage,
+                                                                           const Mac::Address &aSource,
+                                                                           uint16_t            aTag,
+                                                                           TimeMilli           aDeadline)
+{
+    Entry * entry = nullptr;
+    uint8_t bucket;
+
+    VerifyOrExit(mFreeHead != kInvalidIndex);
+
+    bucket    = GetBucket(aSource, aTag);
+    entry     = &mEntries[mFreeHead];
+    mFreeHead = entry->mNext;
+
+    entry->mMessage     = &aMessage;
+    entry->mDeadline    = aDeadline;
+    entry->mSource      = aSource;
+    entry->mDatagramTag = aTag;
+    entry->mNext        = mBuckets[bucket];
+    mBuckets[bucket]    = static_cast<uint8_t>(entry - mEntries);
+    mNumEntries++;
+
+exit:
+    return entry;
+}
+
+void MeshForwarder::ReassemblyTable::Remove(Entry &aEntry)
+{
+    uint8_t  index = static_cast<uint8_t>(&aEntry - mEntries);
+    uint8_t *prev  = &mBuckets[GetBucket(aEntry.mSource, aEntry.mDatagramTag)];
+
+    OT_ASSERT(aEntry.IsInUse());
+
+    while (*prev != index)
+    {
+        OT_ASSERT(*prev != kInvalidIndex);
+        prev = &mEntries[*prev].mNext;
+    }
+
+    *prev = aEntry.mNext;
+
+    aEntry.mMessage = nullptr;
+    aEntry.mNext    = mFreeHead;
+    mFreeHead       = index;
+    mNumEntries--;
+}
+
+MeshForwarder::ReassemblyTable::Entry *MeshForwarder::ReassemblyTable::FindOldest(const Mac::Address *aSource,
+                                                                                  uint8_t &           aCount)
+{
+    // Finds the entry with the earliest deadline (from `aSource` if
+    // not `nullptr`), and counts the matching entries.
 
-            message->Free();
+    Entry *oldest = nullptr;
+
+    aCount = 0;
+
+    for (Entry &entry : mEntries)
+    {
+        if (!entry.IsInUse() || ((aSource != nullptr) && !entry.IsFromSource(*aSource)))
+        {
+            continue;
+        }
+
+        aCount++;
+
+        if ((oldest == nullptr) || (entry.mDeadline < oldest->mDeadline))
+        {
+            oldest = &entry;
         }
     }
 
-    return mReassemblyList.GetHead() != nullptr;
+    return oldest;
 }
 
 otError MeshForwarder::FrameToMessage(const uint8_t *     aFrame,
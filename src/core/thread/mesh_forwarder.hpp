@@ -41,6 +41,7 @@
 #include "common/non_copyable.hpp"
 #include "common/tasklet.hpp"
 #include "common/time_ticker.hpp"
+#include "common/timer.hpp"
 #include "mac/channel_mask.hpp"
 #include "mac/data_poll_sender.hpp"
 #include "mac/mac.hpp"
@@ -151,6 +152,10 @@ class MeshForwarder : public InstanceLocator, private NonCopyable
     friend class Instance;
     friend class DataPollSender;
     friend class IndirectSender;
+    friend class IndirectSenderTester;
+    friend class CslTxSchedulerTester;
+    friend class FragmentTxTester;
+    friend class ReassemblyTester;
     friend class Mle::DiscoverScanner;
     friend class TimeTicker;
 
@@ -286,10 +291,31 @@ public:
     const otIpCounters &GetCounters(void) const { return mIpCounters; }
 
     /**
-     * This method resets the IP level counters.
+     * This method returns a reference to the 6LoWPAN reassembly counters.
+     *
+     * @returns A reference to the 6LoWPAN reassembly counters.
      *
      */
-    void ResetCounters(void) { memset(&mIpCounters, 0, sizeof(mIpCounters)); }
+    const otReassemblyCounters &GetReassemblyCounters(void) const { return mReassemblyCounters; }
+
+    /**
+     * This method returns a reference to the 6LoWPAN fragment transmit counters.
+     *
+     * @returns A reference to the 6LoWPAN fragment transmit counters.
+     *
+     */
+    const otFragmentTxCounters &GetFragmentTxCounters(void) const { return mFragmentTxCounters; }
+
+    /**
+     * This method resets the IP level counters (including the 6LoWPAN reassembly and fragment transmit counters).
+     *
+     */
+    void ResetCounters(void)
+    {
+        memset(&mIpCounters, 0, sizeof(mIpCounters));
+        memset(&mReassemblyCounters, 0, sizeof(mReassemblyCounters));
+        memset(&mFragmentTxCounters, 0, sizeof(mFragmentTxCounters));
+    }
 
 #if OPENTHREAD_FTD
     /**
@@ -336,6 +362,62 @@ private:
         kMessageEvict,           ///< Indicates that the message was evicted.
     };
 
+    // Index of the datagrams in the reassembly list, keyed by the
+    // fragment source and datagram tag. Entries are chained per hash
+    // bucket in a fixed array, so the memory used is bounded.
+    class ReassemblyTable
+    {
+    public:
+        class Entry
+        {
+            friend class ReassemblyTable;
+
+        public:
+            bool      IsInUse(void) const { return (mMessage != nullptr); }
+            Message & GetMessage(void) const { return *mMessage; }
+            TimeMilli GetDeadline(void) const { return mDeadline; }
+            void      SetDeadline(TimeMilli aDeadline) { mDeadline = aDeadline; }
+            bool      IsFromSource(const Mac::Address &aSource) const;
+
+        private:
+            Message *    mMessage;
+            TimeMilli    mDeadline;
+            Mac::Address mSource;
+            uint16_t     mDatagramTag;
+            uint8_t      mNext;
+        };
+
+        ReassemblyTable(void) { Clear(); }
+
+        void   Clear(void);
+        bool   IsEmpty(void) const { return (mNumEntries == 0); }
+        bool   IsFull(void) const { return (mNumEntries == kNumEntries); }
+        Entry *Find(const Mac::Address &aSource, uint16_t aTag);
+        Entry *Add(Message &aMessage, const Mac::Address &aSource, uint16_t aTag, TimeMilli aDeadline);
+        void   Remove(Entry &aEntry);
+        Entry *FindOldest(const Mac::Address *aSource, uint8_t &aCount);
+
+        Entry *begin(void) { return &mEntries[0]; }
+        Entry *end(void) { return &mEntries[kNumEntries]; }
+
+    private:
+        enum : uint8_t
+        {
+            kNumEntries   = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES,
+            kNumBuckets   = 16, // Must be a power of two.
+            kInvalidIndex = 0xff,
+        };
+
+        static_assert(OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES < 0xff, "Too many reassembly entries");
+
+        static uint8_t GetBucket(const Mac::Address &aSource, uint16_t aTag);
+
+        Entry   mEntries[kNumEntries];
+        uint8_t mBuckets[kNumBuckets];
+        uint8_t mFreeHead;
+        uint8_t mNumEntries;
+    };
+
 #if OPENTHREAD_FTD
     class FragmentPriorityList : public Clearable<FragmentPriorityList>
     {
@@ -438,7 +520,10 @@ private:
     otError UpdateIp6Route(Message &aMessage);
     otError UpdateIp6RouteFtd(Ip6::Header &ip6Header, Message &aMessage);
     otError UpdateMeshRoute(Message &aMessage);
-    bool    UpdateReassemblyList(void);
+
+    ReassemblyTable::Entry *AddToReassemblyTable(Message &aMessage, const Mac::Address &aMacSource);
+    void                    RemoveFromReassembly(ReassemblyTable::Entry &aEntry, otError aError);
+
     void    UpdateFragmentPriority(Lowpan::FragmentHeader &aFragmentHeader,
                                    uint16_t                aFragmentLength,
                                    uint16_t                aSrcRloc16,
@@ -454,8 +539,11 @@ private:
     void          UpdateNeighborLinkFailures(Neighbor &aNeighbor, otError aError, bool aAllowNeighborRemove);
     void          HandleSentFrame(Mac::TxFrame &aFrame, otError aError);
     void          UpdateSendMessage(otError aFrameTxError, Mac::Address &aMacDest, Neighbor *aNeighbor);
+    bool          ShouldPipelineNextFragment(void) const;
 
     void        HandleTimeTick(void);
+    static void HandleReassemblyTimer(Timer &aTimer);
+    void        HandleReassemblyTimer(void);
     static void ScheduleTransmissionTask(Tasklet &aTasklet);
     void        ScheduleTransmissionTask(void);
 
@@ -540,10 +628,12 @@ private:
                        otLogLevel          aLogLevel);
 #endif // #if (OPENTHREAD_CONFIG_LOG_LEVEL >= OT_LOG_LEVEL_NOTE) && (OPENTHREAD_CONFIG_LOG_MAC == 1)
 
-    PriorityQueue mSendQueue;
-    MessageQueue  mReassemblyList;
-    uint16_t      mFragTag;
-    uint16_t      mMessageNextOffset;
+    PriorityQueue   mSendQueue;
+    MessageQueue    mReassemblyList;
+    ReassemblyTable mReassemblyTable;
+    TimerMilli      mReassemblyTimer;
+    uint16_t        mFragTag;
+    uint16_t        mMessageNextOffset;
 
     Message *mSendMessage;
 
@@ -555,10 +645,14 @@ private:
     bool         mEnabled : 1;
     bool         mTxPaused : 1;
     bool         mSendBusy : 1;
+    bool         mSendFragment : 1;
+    bool         mFragmentPipelined : 1;
 
     Tasklet mScheduleTransmissionTask;
 
-    otIpCounters mIpCounters;
+    otIpCounters         mIpCounters;
+    otReassemblyCounters mReassemblyCounters;
+    otFragmentTxCounters mFragmentTxCounters;
 
 #if OPENTHREAD_FTD
     FragmentPriorityList mFragmentPriorityList;
@@ -309,23 +309,25 @@ void MeshForwarder::RemoveMessages(Child &aChild, Message::SubType aSubType)
 
 void MeshForwarder::RemoveDataResponseMessages(void)
 {
-    Ip6::Header ip6Header;
+    Message *nextMessage;
 
-    for (Message *message = mSendQueue.GetHead(); message; message = message->GetNext())
+    for (Message *message = mSendQueue.GetHead(); message != nullptr; message = nextMessage)
     {
+        nextMessage = message->GetNext();
+
         if (message->GetSubType() != Message::kSubTypeMleDataResponse)
         {
             continue;
         }
 
-        IgnoreError(message->Read(0, ip6Header));
+        // The message is removed from every sleepy child it is queued
+        // for (a multicast Data Response may be queued for several of
+        // them) before it is freed.
 
-        if (!(ip6Header.GetDestination().IsMulticast()))
+        for (uint16_t childIndex = 0; message->GetChildMask().FindNextSet(childIndex); childIndex++)
         {
-            for (Child &child : Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
-            {
-                IgnoreError(mIndirectSender.RemoveMessageFromSleepyChild(*message, child));
-            }
+            IgnoreError(
+                mIndirectSender.RemoveMessageFromSleepyChild(*message, *Get<ChildTable>().GetChildAtIndex(childIndex)));
         }
 
         if (mSendMessage == message)
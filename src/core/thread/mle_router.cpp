@@ -601,26 +601,29 @@ void MleRouter::HandleLinkRequest(const Message &aMessage, const Ip6::MessageInf
         if (IsActiveRouter(sourceAddress))
         {
             Mac::ExtAddress extAddr;
+            Router *        router;
 
             aMessageInfo.GetPeerAddr().GetIid().ConvertToExtAddress(extAddr);
 
-            neighbor = mRouterTable.GetRouter(RouterIdFromRloc16(sourceAddress));
-            VerifyOrExit(neighbor != nullptr, error = OT_ERROR_PARSE);
-            VerifyOrExit(!neighbor->IsStateLinkRequest(), error = OT_ERROR_ALREADY);
+            router = mRouterTable.GetRouter(RouterIdFromRloc16(sourceAddress));
+            VerifyOrExit(router != nullptr, error = OT_ERROR_PARSE);
+            VerifyOrExit(!router->IsStateLinkRequest(), error = OT_ERROR_ALREADY);
 
-            if (!neighbor->IsStateValid())
+            if (!router->IsStateValid())
             {
-                neighbor->SetExtAddress(extAddr);
-                neighbor->GetLinkInfo().Clear();
-                neighbor->GetLinkInfo().AddRss(aMessageInfo.GetThreadLinkInfo()->GetRss());
-                neighbor->ResetLinkFailures();
-                neighbor->SetLastHeard(TimerMilli::GetNow());
-                neighbor->SetState(Neighbor::kStateLinkRequest);
+                router->SetExtAddress(extAddr);
+                router->GetLinkInfo().Clear();
+                router->GetLinkInfo().AddRss(aMessageInfo.GetThreadLinkInfo()->GetRss());
+                router->ResetLinkFailures();
+                router->SetLastHeard(TimerMilli::GetNow());
+                router->SetState(Neighbor::kStateLinkRequest);
             }
             else
             {
-                VerifyOrExit(neighbor->GetExtAddress() == extAddr);
+                VerifyOrExit(router->GetExtAddress() == extAddr);
             }
+
+            neighbor = router;
         }
 
         break;
@@ -1795,7 +1798,7 @@ void MleRouter::HandleTimeTick(void)
         {
             otLogInfoMle("Child CSL synchronization expired");
             child.SetCslSynchronized(false);
-            Get<CslTxScheduler>().Update();
+            Get<CslTxScheduler>().Update(child);
         }
 #endif
 
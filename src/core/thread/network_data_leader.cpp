@@ -64,6 +64,7 @@ void LeaderBase::Reset(void)
     mVersion       = Random::NonCrypto::GetUint8();
     mStableVersion = Random::NonCrypto::GetUint8();
     mLength        = 0;
+    Get<Lowpan::Lowpan>().ClearCompressionCache();
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
@@ -462,6 +463,7 @@ otError LeaderBase::SetNetworkData(uint8_t        aVersion,
 
     otDumpDebgNetData("set network data", mTlvs, mLength);
 
+    Get<Lowpan::Lowpan>().ClearCompressionCache();
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 
 exit:
@@ -61,6 +61,7 @@ public:
         : Coap::Coap(aInstance)
     {
         SetInterceptor(&Filter, this);
+        SetResourceIndex(mResourceIndex, kResourceIndexSize);
     }
 
     /**
@@ -82,7 +83,14 @@ public:
     bool IsTmfMessage(const Ip6::MessageInfo &aMessageInfo) const;
 
 private:
+    enum
+    {
+        kResourceIndexSize = OPENTHREAD_CONFIG_TMF_RESOURCE_INDEX_SIZE,
+    };
+
     static otError Filter(const ot::Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo, void *aContext);
+
+    const ot::Coap::Resource *mResourceIndex[kResourceIndexSize];
 };
 
 } // namespace Tmf
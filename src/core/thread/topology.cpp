@@ -282,6 +282,32 @@ void Child::Clear(void)
     Init(instance);
 }
 
+void Child::SetExtAddress(const Mac::ExtAddress &aAddress)
+{
+#if OPENTHREAD_FTD
+    ChildTable &childTable = Get<ChildTable>();
+
+    childTable.RemoveFromIndex(*this);
+    Neighbor::SetExtAddress(aAddress);
+    childTable.AddToIndex(*this);
+#else
+    Neighbor::SetExtAddress(aAddress);
+#endif
+}
+
+void Child::SetRloc16(uint16_t aRloc16)
+{
+#if OPENTHREAD_FTD
+    ChildTable &childTable = Get<ChildTable>();
+
+    childTable.RemoveFromIndex(*this);
+    Neighbor::SetRloc16(aRloc16);
+    childTable.AddToIndex(*this);
+#else
+    Neighbor::SetRloc16(aRloc16);
+#endif
+}
+
 void Child::ClearIp6Addresses(void)
 {
     mMeshLocalIid.Clear();
@@ -61,6 +61,8 @@ namespace ot {
 class LinkMetricsSeriesInfo; ///< Forward declaration for including each other with `link_metrics.hpp`
 #endif
 
+class ChildTable;
+
 /**
  * This class represents a Thread neighbor.
  *
@@ -180,6 +182,8 @@ public:
         bool Matches(const Neighbor &aNeighbor) const;
 
     private:
+        friend class ot::ChildTable;
+
         AddressMatcher(StateFilter aStateFilter, Mac::ShortAddress aShortAddress, const Mac::ExtAddress *aExtAddress)
             : mStateFilter(aStateFilter)
             , mShortAddress(aShortAddress)
@@ -375,14 +379,6 @@ public:
      */
     const Mac::ExtAddress &GetExtAddress(void) const { return mMacAddr; }
 
-    /**
-     * This method sets the Extended Address.
-     *
-     * @param[in]  aAddress  The Extended Address value to set.
-     *
-     */
-    void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
-
     /**
      * This method gets the key sequence value.
      *
@@ -488,14 +484,6 @@ public:
      */
     uint8_t GetRouterId(void) const { return mRloc16 >> Mle::kRouterIdOffset; }
 
-    /**
-     * This method sets the RLOC16 value.
-     *
-     * @param[in]  aRloc16  The RLOC16 value.
-     *
-     */
-    void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
-
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     /**
      * This method clears the last received fragment tag.
@@ -768,6 +756,13 @@ protected:
      */
     void Init(Instance &aInstance);
 
+    // The address setters are only accessible through `Child` and
+    // `Router`, since setting the address of a child also updates the
+    // child table indexes.
+
+    void SetExtAddress(const Mac::ExtAddress &aAddress) { mMacAddr = aAddress; }
+    void SetRloc16(uint16_t aRloc16) { mRloc16 = aRloc16; }
+
 private:
     Mac::ExtAddress mMacAddr;   ///< The IEEE 802.15.4 Extended Address
     TimeMilli       mLastHeard; ///< Time when last heard.
@@ -1021,6 +1016,26 @@ public:
      */
     void Clear(void);
 
+    /**
+     * This method sets the Extended Address.
+     *
+     * On FTD, the child table extended address index is updated along with the Extended Address.
+     *
+     * @param[in]  aAddress  The Extended Address value to set.
+     *
+     */
+    void SetExtAddress(const Mac::ExtAddress &aAddress);
+
+    /**
+     * This method sets the RLOC16 value.
+     *
+     * On FTD, the child table Child ID index is updated along with the RLOC16.
+     *
+     * @param[in]  aRloc16  The RLOC16 value.
+     *
+     */
+    void SetRloc16(uint16_t aRloc16);
+
     /**
      * This method clears the IPv6 address list for the child.
      *
@@ -1331,6 +1346,22 @@ private:
 class Router : public Neighbor
 {
 public:
+    /**
+     * This method sets the Extended Address.
+     *
+     * @param[in]  aAddress  The Extended Address value to set.
+     *
+     */
+    void SetExtAddress(const Mac::ExtAddress &aAddress) { Neighbor::SetExtAddress(aAddress); }
+
+    /**
+     * This method sets the RLOC16 value.
+     *
+     * @param[in]  aRloc16  The RLOC16 value.
+     *
+     */
+    void SetRloc16(uint16_t aRloc16) { Neighbor::SetRloc16(aRloc16); }
+
     /**
      * This class represents diagnostic information for a Thread Router.
      *
@@ -50,6 +50,10 @@ void Flash::Init(void)
 
     mSwapSize = otPlatFlashGetSwapSize(&GetInstance());
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    mCompacting = false;
+#endif
+
     for (mSwapIndex = 0;; mSwapIndex++)
     {
         uint32_t swapMarker;
@@ -82,6 +86,10 @@ void Flash::Init(void)
         }
     }
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    BuildIndex();
+#endif
+
     SanitizeFreeSpace();
 
 exit:
@@ -122,6 +130,10 @@ otError Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueL
     uint32_t     offset;
     RecordHeader record;
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    VerifyOrExit(!mIndexValid, error = GetFromIndex(aKey, aIndex, aValue, aValueLength));
+#endif
+
     for (offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
     {
         otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
@@ -162,6 +174,9 @@ otError Flash::Get(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueL
         *aValueLength = valueLength;
     }
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+exit:
+#endif
     return error;
 }
 
@@ -198,8 +213,43 @@ otError Flash::Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t a
     record.SetAddCompleteFlag();
     otPlatFlashWrite(&GetInstance(), mSwapIndex, mSwapUsed, &record, sizeof(RecordHeader));
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    if (mIndexValid)
+    {
+        if (aFirst)
+        {
+            // The new record replaces all previous values of the key, which `Swap()` would discard anyway. Deleting
+            // them right away keeps the index free of stale records.
+            for (int position; (position = FindEntry(aKey, 0)) >= 0;)
+            {
+                if (mCompacting && GetEntryOffset(position) < mCompactOffset)
+                {
+                    DeleteCopiedRecord(aKey, 0);
+                }
+
+                mLiveSize -= MarkRecordDeleted(GetEntryOffset(position));
+                RemoveEntry(position);
+            }
+        }
+
+        AppendEntry(aKey, mSwapUsed, record.GetSize());
+    }
+#endif
+
     mSwapUsed += record.GetSize();
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    if (!mCompacting && ShouldStartCompaction())
+    {
+        StartCompaction();
+    }
+
+    if (mCompacting)
+    {
+        ContinueCompaction();
+    }
+#endif
+
 exit:
     return error;
 }
@@ -225,6 +275,14 @@ exit:
 
 void Flash::Swap(void)
 {
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    if (!mCompacting)
+    {
+        StartCompaction();
+    }
+
+    CompactRecords(UINT32_MAX);
+#else
     uint8_t  dstIndex  = !mSwapIndex;
     uint32_t dstOffset = kSwapMarkerSize;
     Record   record;
@@ -253,6 +311,7 @@ exit:
 
     mSwapIndex = dstIndex;
     mSwapUsed  = dstOffset;
+#endif // OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
 }
 
 otError Flash::Delete(uint16_t aKey, int aIndex)
@@ -260,6 +319,13 @@ otError Flash::Delete(uint16_t aKey, int aIndex)
     otError      error = OT_ERROR_NOT_FOUND;
     int          index = 0; // This must be initalized to 0. See [Note] below.
     RecordHeader record;
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    int numCopiesDeleted = 0;
+#endif
+
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    VerifyOrExit(!mIndexValid, error = DeleteFromIndex(aKey, aIndex));
+#endif
 
     for (uint32_t offset = kSwapMarkerSize; offset < mSwapUsed; offset += record.GetSize())
     {
@@ -277,6 +343,13 @@ otError Flash::Delete(uint16_t aKey, int aIndex)
 
         if ((aIndex == index) || (aIndex == -1))
         {
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+            if (mCompacting && (offset < mCompactOffset) && !DoesValidRecordExist(offset + record.GetSize(), aKey))
+            {
+                DeleteCopiedRecord(aKey, static_cast<uint16_t>(index - numCopiesDeleted));
+                numCopiesDeleted++;
+            }
+#endif
             record.SetDeleted();
             otPlatFlashWrite(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
             error = OT_ERROR_NONE;
@@ -295,6 +368,9 @@ otError Flash::Delete(uint16_t aKey, int aIndex)
         index++;
     }
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+exit:
+#endif
     return error;
 }
 
@@ -305,8 +381,309 @@ void Flash::Wipe(void)
 
     mSwapIndex = 0;
     mSwapUsed  = sizeof(sSwapActive);
+
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    mCompacting = false;
+    BuildIndex();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+
+void Flash::BuildIndex(void)
+{
+    RecordHeader record;
+
+    mIndexLength = 0;
+    mLiveSize    = 0;
+    mIndexValid  = (mSwapSize <= kMaxIndexedSwapSize);
+
+    for (uint32_t offset = kSwapMarkerSize; mIndexValid && offset < mSwapUsed; offset += record.GetSize())
+    {
+        otPlatFlashRead(&GetInstance(), mSwapIndex, offset, &record, sizeof(record));
+
+        if (!record.IsValid())
+        {
+            continue;
+        }
+
+        if (record.IsFirst())
+        {
+            // Older records of the key are left behind when a `Set()` was interrupted or written without the index.
+            // Delete them now so that they cannot reappear once the newer values are deleted.
+            for (int position; (position = FindEntry(record.GetKey(), 0)) >= 0;)
+            {
+                mLiveSize -= MarkRecordDeleted(GetEntryOffset(position));
+                RemoveEntry(position);
+            }
+        }
+
+        AppendEntry(record.GetKey(), offset, record.GetSize());
+    }
 }
 
+void Flash::InvalidateIndex(void)
+{
+    mIndexValid  = false;
+    mIndexLength = 0;
+    mLiveSize    = 0;
+}
+
+int Flash::FindEntry(uint16_t aKey, int aIndex) const
+{
+    int position = -1;
+
+    for (int i = 0; i < mIndexLength; i++)
+    {
+        if ((mIndex[i].mKey == aKey) && (aIndex-- == 0))
+        {
+            ExitNow(position = i);
+        }
+    }
+
+exit:
+    return position;
+}
+
+int Flash::FindEntryByOffset(uint32_t aOffset) const
+{
+    // Entries are appended in flash order, so the index is sorted by offset.
+    uint16_t offset   = static_cast<uint16_t>(aOffset >> 2);
+    int      low      = 0;
+    int      high     = mIndexLength - 1;
+    int      position = -1;
+
+    while (low <= high)
+    {
+        int middle = (low + high) / 2;
+
+        if (mIndex[middle].mOffset == offset)
+        {
+            ExitNow(position = middle);
+        }
+
+        if (mIndex[middle].mOffset < offset)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle - 1;
+        }
+    }
+
+exit:
+    return position;
+}
+
+void Flash::AppendEntry(uint16_t aKey, uint32_t aOffset, uint16_t aSize)
+{
+    if (mIndexLength >= kMaxIndexEntries)
+    {
+        InvalidateIndex();
+        ExitNow();
+    }
+
+    mIndex[mIndexLength].mKey    = aKey;
+    mIndex[mIndexLength].mOffset = static_cast<uint16_t>(aOffset >> 2);
+    mIndexLength++;
+    mLiveSize += aSize;
+
+exit:
+    return;
+}
+
+void Flash::RemoveEntry(int aPosition)
+{
+    mIndexLength--;
+    memmove(&mIndex[aPosition], &mIndex[aPosition + 1], (mIndexLength - aPosition) * sizeof(mIndex[0]));
+}
+
+uint16_t Flash::MarkRecordDeleted(uint32_t aOffset)
+{
+    RecordHeader record;
+
+    otPlatFlashRead(&GetInstance(), mSwapIndex, aOffset, &record, sizeof(record));
+    record.SetDeleted();
+    otPlatFlashWrite(&GetInstance(), mSwapIndex, aOffset, &record, sizeof(record));
+
+    return record.GetSize();
+}
+
+void Flash::MarkRecordFirst(uint32_t aOffset)
+{
+    RecordHeader record;
+
+    otPlatFlashRead(&GetInstance(), mSwapIndex, aOffset, &record, sizeof(record));
+    record.SetFirst();
+    otPlatFlashWrite(&GetInstance(), mSwapIndex, aOffset, &record, sizeof(record));
+}
+
+otError Flash::GetFromIndex(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const
+{
+    otError      error       = OT_ERROR_NONE;
+    uint16_t     valueLength = 0;
+    int          position    = FindEntry(aKey, aIndex);
+    RecordHeader record;
+
+    VerifyOrExit(position >= 0, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(aValueLength != nullptr);
+
+    otPlatFlashRead(&GetInstance(), mSwapIndex, GetEntryOffset(position), &record, sizeof(record));
+    valueLength = record.GetLength();
+
+    if (aValue)
+    {
+        uint16_t readLength = (*aValueLength > valueLength) ? valueLength : *aValueLength;
+
+        otPlatFlashRead(&GetInstance(), mSwapIndex, GetEntryOffset(position) + sizeof(record), aValue, readLength);
+    }
+
+exit:
+    if (aValueLength)
+    {
+        *aValueLength = valueLength;
+    }
+
+    return error;
+}
+
+otError Flash::DeleteFromIndex(uint16_t aKey, int aIndex)
+{
+    otError error    = OT_ERROR_NONE;
+    int     position = FindEntry(aKey, (aIndex == -1) ? 0 : aIndex);
+
+    VerifyOrExit(position >= 0, error = OT_ERROR_NOT_FOUND);
+
+    do
+    {
+        uint32_t offset = GetEntryOffset(position);
+
+        if (mCompacting && offset < mCompactOffset)
+        {
+            // Earlier values of the key were removed from the index along with their copies.
+            DeleteCopiedRecord(aKey, (aIndex == -1) ? 0 : static_cast<uint16_t>(aIndex));
+        }
+
+        mLiveSize -= MarkRecordDeleted(offset);
+        RemoveEntry(position);
+    } while ((aIndex == -1) && (position = FindEntry(aKey, 0)) >= 0);
+
+    if ((aIndex == 0) && (position = FindEntry(aKey, 0)) >= 0)
+    {
+        MarkRecordFirst(GetEntryOffset(position));
+    }
+
+exit:
+    return error;
+}
+
+bool Flash::IsRecordLive(uint32_t aOffset, const RecordHeader &aRecord) const
+{
+    bool isLive;
+
+    if (mIndexValid)
+    {
+        isLive = (FindEntryByOffset(aOffset) >= 0);
+    }
+    else
+    {
+        isLive = aRecord.IsValid() && !DoesValidRecordExist(aOffset + aRecord.GetSize(), aRecord.GetKey());
+    }
+
+    return isLive;
+}
+
+bool Flash::ShouldStartCompaction(void) const
+{
+    uint32_t threshold = mSwapSize / 100 * kCompactionThreshold;
+
+    // Only compact when it brings the usage back below the threshold, otherwise every write would restart it.
+    return mIndexValid && (kCompactionThreshold > 0) && (mSwapUsed >= threshold) &&
+           (kSwapMarkerSize + mLiveSize < threshold);
+}
+
+void Flash::StartCompaction(void)
+{
+    otPlatFlashErase(&GetInstance(), !mSwapIndex);
+
+    mCompacting       = true;
+    mCompactOffset    = kSwapMarkerSize;
+    mCompactDstOffset = kSwapMarkerSize;
+}
+
+void Flash::CompactRecords(uint32_t aMaxRecords)
+{
+    Record record;
+
+    while (mCompacting && (mCompactOffset < mSwapUsed) && (aMaxRecords-- > 0))
+    {
+        otPlatFlashRead(&GetInstance(), mSwapIndex, mCompactOffset, &record, sizeof(RecordHeader));
+
+        if (!record.IsAddBeginSet())
+        {
+            mCompactOffset = mSwapUsed;
+            break;
+        }
+
+        if (IsRecordLive(mCompactOffset, record))
+        {
+            otPlatFlashRead(&GetInstance(), mSwapIndex, mCompactOffset, &record, record.GetSize());
+            otPlatFlashWrite(&GetInstance(), !mSwapIndex, mCompactDstOffset, &record, record.GetSize());
+            mCompactDstOffset += record.GetSize();
+        }
+
+        mCompactOffset += record.GetSize();
+    }
+
+    if (mCompacting && (mCompactOffset >= mSwapUsed))
+    {
+        FinishCompaction();
+    }
+}
+
+void Flash::DeleteCopiedRecord(uint16_t aKey, uint16_t aOrdinal)
+{
+    RecordHeader record;
+
+    // A record deleted after it was copied is also marked deleted in the inactive swap area, so the compaction can
+    // go on without erasing that area again. The valid copies of a key are in the same order as its live records
+    // below `mCompactOffset`, so the copy is found by the ordinal of the record among them.
+
+    for (uint32_t offset = kSwapMarkerSize; offset < mCompactDstOffset; offset += record.GetSize())
+    {
+        otPlatFlashRead(&GetInstance(), !mSwapIndex, offset, &record, sizeof(record));
+
+        if ((record.GetKey() != aKey) || !record.IsValid())
+        {
+            continue;
+        }
+
+        if (aOrdinal-- == 0)
+        {
+            record.SetDeleted();
+            otPlatFlashWrite(&GetInstance(), !mSwapIndex, offset, &record, sizeof(record));
+            break;
+        }
+    }
+}
+
+void Flash::FinishCompaction(void)
+{
+    uint8_t dstIndex = !mSwapIndex;
+
+    otPlatFlashWrite(&GetInstance(), dstIndex, 0, &sSwapActive, sizeof(sSwapActive));
+    otPlatFlashWrite(&GetInstance(), mSwapIndex, 0, &sSwapInactive, sizeof(sSwapInactive));
+
+    mSwapIndex  = dstIndex;
+    mSwapUsed   = mCompactDstOffset;
+    mCompacting = false;
+
+    BuildIndex();
+}
+
+#endif // OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+
 } // namespace ot
 
 #endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
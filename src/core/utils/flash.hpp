@@ -55,6 +55,14 @@ public:
      */
     explicit Flash(Instance &aInstance)
         : InstanceLocator(aInstance)
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+        , mIndexLength(0)
+        , mIndexValid(false)
+        , mLiveSize(0)
+        , mCompacting(false)
+        , mCompactOffset(0)
+        , mCompactDstOffset(0)
+#endif
     {
     }
 
@@ -134,12 +142,54 @@ public:
      */
     void Wipe(void);
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    /**
+     * This method indicates whether the RAM index is in use.
+     *
+     * The index is not used when the flash area holds more live records than `OPENTHREAD_CONFIG_FLASH_INDEX_MAX_ENTRIES`
+     * and every access then scans the flash area.
+     *
+     * @retval TRUE   The RAM index is in use.
+     * @retval FALSE  The RAM index is not in use.
+     *
+     */
+    bool IsIndexValid(void) const { return mIndexValid; }
+
+    /**
+     * This method indicates whether a background compaction of the swap area is in progress.
+     *
+     * @retval TRUE   A compaction is in progress.
+     * @retval FALSE  No compaction is in progress.
+     *
+     */
+    bool IsCompacting(void) const { return mCompacting; }
+
+    /**
+     * This method performs one step of an ongoing background compaction.
+     *
+     * A step copies at most `OPENTHREAD_CONFIG_FLASH_COMPACTION_STEP_RECORDS` records. Once all live records are copied,
+     * the inactive swap area becomes the active one.
+     *
+     */
+    void ContinueCompaction(void) { CompactRecords(kCompactionStepRecords); }
+#endif
+
 private:
     enum
     {
         kSwapMarkerSize = 4, // in bytes
     };
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    enum : uint32_t
+    {
+        kMaxIndexEntries       = OPENTHREAD_CONFIG_FLASH_INDEX_MAX_ENTRIES,
+        kCompactionThreshold   = OPENTHREAD_CONFIG_FLASH_COMPACTION_THRESHOLD,
+        kCompactionStepRecords = OPENTHREAD_CONFIG_FLASH_COMPACTION_STEP_RECORDS,
+        kMaxIndexedSwapSize    = 0x40000, // Offsets are indexed in 4-byte words.
+    };
+#endif
+
     static const uint32_t sSwapActive   = 0xbe5cc5ee;
     static const uint32_t sSwapInactive = 0xbe5cc5ec;
 
@@ -220,14 +270,52 @@ private:
         uint8_t mData[kMaxDataSize];
     } OT_TOOL_PACKED_END;
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    struct IndexEntry
+    {
+        uint16_t mKey;
+        uint16_t mOffset; // Offset of the record in 4-byte words.
+    };
+#endif
+
     otError Add(uint16_t aKey, bool aFirst, const uint8_t *aValue, uint16_t aValueLength);
     bool    DoesValidRecordExist(uint32_t aOffset, uint16_t aKey) const;
     void    SanitizeFreeSpace(void);
     void    Swap(void);
 
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    void     BuildIndex(void);
+    void     InvalidateIndex(void);
+    int      FindEntry(uint16_t aKey, int aIndex) const;
+    int      FindEntryByOffset(uint32_t aOffset) const;
+    void     AppendEntry(uint16_t aKey, uint32_t aOffset, uint16_t aSize);
+    void     RemoveEntry(int aPosition);
+    uint32_t GetEntryOffset(int aPosition) const { return static_cast<uint32_t>(mIndex[aPosition].mOffset) << 2; }
+    uint16_t MarkRecordDeleted(uint32_t aOffset);
+    void     MarkRecordFirst(uint32_t aOffset);
+    otError  GetFromIndex(uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength) const;
+    otError  DeleteFromIndex(uint16_t aKey, int aIndex);
+    bool     IsRecordLive(uint32_t aOffset, const RecordHeader &aRecord) const;
+    bool     ShouldStartCompaction(void) const;
+    void     StartCompaction(void);
+    void     DeleteCopiedRecord(uint16_t aKey, uint16_t aOrdinal);
+    void     CompactRecords(uint32_t aMaxRecords);
+    void     FinishCompaction(void);
+#endif
+
     uint32_t mSwapSize;
     uint32_t mSwapUsed;
     uint8_t  mSwapIndex;
+
+#if OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    IndexEntry mIndex[kMaxIndexEntries];
+    uint16_t   mIndexLength;
+    bool       mIndexValid;
+    uint32_t   mLiveSize;         // Total size of the live records in the active swap area.
+    bool       mCompacting;       // Whether live records are being copied to the inactive swap area.
+    uint32_t   mCompactOffset;    // Offset of the next record to copy in the active swap area.
+    uint32_t   mCompactDstOffset; // Offset of the next copied record in the inactive swap area.
+#endif
 };
 
 } // namespace ot
@@ -145,6 +145,41 @@ int otSysMainloopPoll(otSysMainloopContext *aMainloop);
  */
 void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMainloop);
 
+/**
+ * This structure represents the counters of the platform Thread network interface TUN device.
+ *
+ */
+typedef struct otSysTunCounters
+{
+    uint64_t mReadWakeups;        ///< Number of mainloop iterations which read packets from the TUN device.
+    uint64_t mReadPackets;        ///< Number of packets read from the TUN device.
+    uint64_t mReadDrops;          ///< Number of packets read from the TUN device which could not be sent.
+    uint64_t mReadBatchLimitHits; ///< Number of mainloop iterations which read the maximum number of packets.
+    uint64_t mReadMaxBatch;       ///< Maximum number of packets read in one mainloop iteration.
+    uint64_t mWritePackets;       ///< Number of packets written to the TUN device.
+    uint64_t mWriteErrors;        ///< Number of packets which failed to be written to the TUN device.
+} otSysTunCounters;
+
+/**
+ * This function gets the counters of the platform Thread network interface TUN device.
+ *
+ * The average number of packets read per mainloop wakeup is `mReadPackets / mReadWakeups`.
+ *
+ * @note This function is only available when the platform network interface is enabled.
+ *
+ * @returns A pointer to the TUN device counters.
+ *
+ */
+const otSysTunCounters *otSysGetTunCounters(void);
+
+/**
+ * This function resets the counters of the platform Thread network interface TUN device.
+ *
+ * @note This function is only available when the platform network interface is enabled.
+ *
+ */
+void otSysResetTunCounters(void);
+
 /**
  * This method returns the radio url help string.
  *
@@ -170,6 +170,8 @@ exit:
     return error;
 }
 
+static void handleInfraIfEvent(otInstance *aInstance, void *aContext, uint32_t aEvents);
+
 void platformInfraIfInit(otInstance *aInstance, const char *aIfName)
 {
     OT_UNUSED_VARIABLE(aInstance);
@@ -240,12 +242,14 @@ void platformInfraIfInit(otInstance *aInstance, const char *aIfName)
 
     sInfraIfIcmp6Socket = sock;
     SuccessOrDie(InitLinkLocalAddress());
+    SuccessOrDie(platformMainloopAddFd(sInfraIfIcmp6Socket, OT_POSIX_MAINLOOP_EVENT_READ, handleInfraIfEvent, nullptr));
 }
 
 void platformInfraIfDeinit(void)
 {
     if (sInfraIfIcmp6Socket != -1)
     {
+        platformMainloopRemoveFd(sInfraIfIcmp6Socket);
         close(sInfraIfIcmp6Socket);
         sInfraIfIcmp6Socket = -1;
     }
@@ -253,18 +257,7 @@ void platformInfraIfDeinit(void)
     sInfraIfIndex = 0;
 }
 
-void platformInfraIfUpdateFdSet(fd_set &aReadFdSet, int &aMaxFd)
-{
-    VerifyOrExit(sInfraIfIcmp6Socket != -1);
-
-    FD_SET(sInfraIfIcmp6Socket, &aReadFdSet);
-    aMaxFd = OT_MAX(aMaxFd, sInfraIfIcmp6Socket);
-
-exit:
-    return;
-}
-
-void platformInfraIfProcess(otInstance *aInstance, const fd_set &aReadFdSet)
+static void handleInfraIfEvent(otInstance *aInstance, void *aContext, uint32_t aEvents)
 {
     otError  error = OT_ERROR_NONE;
     uint8_t  buffer[1500];
@@ -281,9 +274,11 @@ void platformInfraIfProcess(otInstance *aInstance, const fd_set &aReadFdSet)
     struct sockaddr_in6 srcAddr;
     struct in6_addr     dstAddr;
 
+    OT_UNUSED_VARIABLE(aContext);
+
     // It is not an error when there is no input data on the socket.
     VerifyOrExit(sInfraIfIcmp6Socket != -1);
-    VerifyOrExit(FD_ISSET(sInfraIfIcmp6Socket, &aReadFdSet));
+    VerifyOrExit(aEvents & OT_POSIX_MAINLOOP_EVENT_READ);
 
     memset(&srcAddr, 0, sizeof(srcAddr));
     memset(&dstAddr, 0, sizeof(dstAddr));
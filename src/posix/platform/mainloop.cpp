@@ -0,0 +1,502 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the mainloop event source registry.
+ *
+ *   Platform modules register their file descriptors once (instead of adding them to the fd sets in every mainloop
+ *   iteration). With `OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE` the registrations are kept in an epoll instance
+ *   and only the epoll file descriptor is added to the select() fd sets of `otSysMainloopContext`.
+ *
+ */
+
+#include "openthread-posix-config.h"
+#include "platform-posix.h"
+
+#include <assert.h>
+#include <unistd.h>
+
+#include <openthread/thread.h>
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#include <sys/epoll.h>
+#endif
+
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+#include <fcntl.h>
+#include <sched.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+#include <openthread/tasklet.h>
+#endif
+
+#include "common/code_utils.hpp"
+
+namespace {
+
+struct EventSource
+{
+    int                     mFd;
+    uint32_t                mEvents;
+    platformMainloopHandler mHandler;
+    void *                  mContext;
+};
+
+EventSource sEventSources[OPENTHREAD_POSIX_CONFIG_MAINLOOP_MAX_SOURCES];
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+enum
+{
+    kMaxEpollEvents = 16, ///< Maximum number of events retrieved by one `epoll_wait()` call.
+};
+
+int sEpollFd = -1;
+
+uint32_t ToEpollEvents(uint32_t aEvents)
+{
+    uint32_t events = 0;
+
+    if (aEvents & OT_POSIX_MAINLOOP_EVENT_READ)
+    {
+        events |= EPOLLIN;
+    }
+
+    if (aEvents & OT_POSIX_MAINLOOP_EVENT_WRITE)
+    {
+        events |= EPOLLOUT;
+    }
+
+    if (aEvents & OT_POSIX_MAINLOOP_EVENT_EDGE_TRIGGERED)
+    {
+        events |= EPOLLET;
+    }
+
+    // `EPOLLERR` is always reported.
+
+    return events;
+}
+
+uint32_t FromEpollEvents(uint32_t aEvents)
+{
+    uint32_t events = 0;
+
+    if (aEvents & (EPOLLIN | EPOLLHUP))
+    {
+        events |= OT_POSIX_MAINLOOP_EVENT_READ;
+    }
+
+    if (aEvents & EPOLLOUT)
+    {
+        events |= OT_POSIX_MAINLOOP_EVENT_WRITE;
+    }
+
+    if (aEvents & EPOLLERR)
+    {
+        events |= OT_POSIX_MAINLOOP_EVENT_ERROR;
+    }
+
+    return events;
+}
+
+otError EpollControl(int aOperation, uint16_t aIndex)
+{
+    // The epoll data holds both the index of the event source and its
+    // file descriptor, so that an event for a source which is removed
+    // (and possibly reused) while processing a batch of events can be
+    // detected.
+
+    struct epoll_event event;
+
+    event.events   = ToEpollEvents(sEventSources[aIndex].mEvents);
+    event.data.u64 = (static_cast<uint64_t>(sEventSources[aIndex].mFd) << 32) | aIndex;
+
+    return (epoll_ctl(sEpollFd, aOperation, sEventSources[aIndex].mFd, &event) == 0) ? OT_ERROR_NONE
+                                                                                     : OT_ERROR_FAILED;
+}
+#endif // OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+// The wakeup file descriptors are written by other threads posting
+// tasklet entries, to interrupt the mainloop. On Linux a single eventfd
+// is used for both ends, otherwise a non-blocking pipe.
+//
+// `sWakeupWriteFd` is read by the posting threads, so it is only
+// accessed atomically. Each posting thread counts itself in
+// `sWakeupWriters` while it uses the descriptor, and `DeinitWakeup()`
+// unpublishes the descriptor and waits for the count to drop to zero
+// before closing it. A descriptor number reused after the close thus
+// never receives a stray wakeup.
+
+int sWakeupReadFd  = -1;
+int sWakeupWriteFd = -1;
+int sWakeupWriters = 0;
+
+void HandleWakeup(otInstance *aInstance, void *aContext, uint32_t aEvents)
+{
+    uint64_t value;
+
+    OT_UNUSED_VARIABLE(aInstance);
+    OT_UNUSED_VARIABLE(aContext);
+    OT_UNUSED_VARIABLE(aEvents);
+
+    // Only drain the wakeup, the posted entries are run by `otTaskletsProcess()`.
+
+    while (read(sWakeupReadFd, &value, sizeof(value)) > 0)
+    {
+    }
+}
+
+void InitWakeup(void)
+{
+#ifdef __linux__
+    sWakeupReadFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    VerifyOrDie(sWakeupReadFd != -1, OT_EXIT_ERROR_ERRNO);
+    __atomic_store_n(&sWakeupWriteFd, sWakeupReadFd, __ATOMIC_SEQ_CST);
+#else
+    int fds[2];
+
+    VerifyOrDie(pipe(fds) == 0, OT_EXIT_ERROR_ERRNO);
+
+    for (int fd : fds)
+    {
+        VerifyOrDie(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == 0, OT_EXIT_ERROR_ERRNO);
+        VerifyOrDie(fcntl(fd, F_SETFD, FD_CLOEXEC) == 0, OT_EXIT_ERROR_ERRNO);
+    }
+
+    sWakeupReadFd = fds[0];
+    __atomic_store_n(&sWakeupWriteFd, fds[1], __ATOMIC_SEQ_CST);
+#endif
+
+    SuccessOrDie(platformMainloopAddFd(sWakeupReadFd, OT_POSIX_MAINLOOP_EVENT_READ, HandleWakeup, nullptr));
+}
+
+void DeinitWakeup(void)
+{
+    int writeFd;
+
+    VerifyOrExit(sWakeupReadFd != -1);
+
+    platformMainloopRemoveFd(sWakeupReadFd);
+
+    writeFd = __atomic_exchange_n(&sWakeupWriteFd, -1, __ATOMIC_SEQ_CST);
+
+    while (__atomic_load_n(&sWakeupWriters, __ATOMIC_SEQ_CST) != 0)
+    {
+        sched_yield();
+    }
+
+    if (writeFd != sWakeupReadFd)
+    {
+        close(writeFd);
+    }
+
+    close(sWakeupReadFd);
+    sWakeupReadFd = -1;
+
+exit:
+    return;
+}
+#endif // OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+
+EventSource *FindEventSource(int aFd)
+{
+    EventSource *source = nullptr;
+
+    for (EventSource &entry : sEventSources)
+    {
+        if ((entry.mHandler != nullptr) && (entry.mFd == aFd))
+        {
+            ExitNow(source = &entry);
+        }
+    }
+
+exit:
+    return source;
+}
+
+void Dispatch(otInstance *aInstance, EventSource &aSource, uint32_t aEvents)
+{
+    aEvents &= (aSource.mEvents | OT_POSIX_MAINLOOP_EVENT_ERROR);
+
+    if (aEvents != 0)
+    {
+        aSource.mHandler(aInstance, aSource.mContext, aEvents);
+    }
+}
+
+} // namespace
+
+void platformMainloopInit(void)
+{
+    for (EventSource &entry : sEventSources)
+    {
+        entry.mFd      = -1;
+        entry.mHandler = nullptr;
+    }
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    assert(sEpollFd == -1);
+    sEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrDie(sEpollFd != -1, OT_EXIT_ERROR_ERRNO);
+#endif
+
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    InitWakeup();
+#endif
+}
+
+void platformMainloopDeinit(void)
+{
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    DeinitWakeup();
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    if (sEpollFd != -1)
+    {
+        close(sEpollFd);
+        sEpollFd = -1;
+    }
+#endif
+
+    for (EventSource &entry : sEventSources)
+    {
+        entry.mFd      = -1;
+        entry.mHandler = nullptr;
+    }
+}
+
+otError platformMainloopAddFd(int aFd, uint32_t aEvents, platformMainloopHandler aHandler, void *aContext)
+{
+    otError      error  = OT_ERROR_NONE;
+    EventSource *source = nullptr;
+
+    VerifyOrExit((aFd >= 0) && (aHandler != nullptr), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(FindEventSource(aFd) == nullptr, error = OT_ERROR_ALREADY);
+
+    for (EventSource &entry : sEventSources)
+    {
+        if (entry.mHandler == nullptr)
+        {
+            source = &entry;
+            break;
+        }
+    }
+
+    VerifyOrExit(source != nullptr, error = OT_ERROR_NO_BUFS);
+
+    source->mFd      = aFd;
+    source->mEvents  = aEvents;
+    source->mHandler = aHandler;
+    source->mContext = aContext;
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    error = EpollControl(EPOLL_CTL_ADD, static_cast<uint16_t>(source - sEventSources));
+
+    if (error != OT_ERROR_NONE)
+    {
+        source->mFd      = -1;
+        source->mHandler = nullptr;
+    }
+#endif
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        otLogWarnPlat("Failed to register fd %d with mainloop: %s", aFd, otThreadErrorToString(error));
+    }
+
+    return error;
+}
+
+otError platformMainloopUpdateFd(int aFd, uint32_t aEvents)
+{
+    otError      error  = OT_ERROR_NONE;
+    EventSource *source = FindEventSource(aFd);
+
+    VerifyOrExit(source != nullptr, error = OT_ERROR_NOT_FOUND);
+    VerifyOrExit(source->mEvents != aEvents);
+
+    source->mEvents = aEvents;
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    error = EpollControl(EPOLL_CTL_MOD, static_cast<uint16_t>(source - sEventSources));
+#endif
+
+exit:
+    return error;
+}
+
+void platformMainloopRemoveFd(int aFd)
+{
+    EventSource *source = FindEventSource(aFd);
+
+    VerifyOrExit(source != nullptr);
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    epoll_ctl(sEpollFd, EPOLL_CTL_DEL, aFd, nullptr);
+#endif
+
+    source->mFd      = -1;
+    source->mHandler = nullptr;
+
+exit:
+    return;
+}
+
+void platformMainloopUpdateFdSet(otSysMainloopContext *aMainloop)
+{
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    FD_SET(sEpollFd, &aMainloop->mReadFdSet);
+    aMainloop->mMaxFd = OT_MAX(aMainloop->mMaxFd, sEpollFd);
+#else
+    for (const EventSource &entry : sEventSources)
+    {
+        if (entry.mHandler == nullptr)
+        {
+            continue;
+        }
+
+        if (entry.mEvents & OT_POSIX_MAINLOOP_EVENT_READ)
+        {
+            FD_SET(entry.mFd, &aMainloop->mReadFdSet);
+        }
+
+        if (entry.mEvents & OT_POSIX_MAINLOOP_EVENT_WRITE)
+        {
+            FD_SET(entry.mFd, &aMainloop->mWriteFdSet);
+        }
+
+        if (entry.mEvents & OT_POSIX_MAINLOOP_EVENT_ERROR)
+        {
+            FD_SET(entry.mFd, &aMainloop->mErrorFdSet);
+        }
+
+        aMainloop->mMaxFd = OT_MAX(aMainloop->mMaxFd, entry.mFd);
+    }
+#endif
+}
+
+void platformMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMainloop)
+{
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+    struct epoll_event events[kMaxEpollEvents];
+    int                count;
+
+    VerifyOrExit(FD_ISSET(sEpollFd, &aMainloop->mReadFdSet));
+
+    count = epoll_wait(sEpollFd, events, kMaxEpollEvents, 0);
+
+    if (count < 0)
+    {
+        VerifyOrDie(errno == EINTR, OT_EXIT_ERROR_ERRNO);
+        ExitNow();
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        uint16_t     index  = static_cast<uint16_t>(events[i].data.u64 & 0xffff);
+        int          fd     = static_cast<int>(events[i].data.u64 >> 32);
+        EventSource &source = sEventSources[index];
+
+        // Skip the event if the source was removed by a handler
+        // called earlier in this batch.
+
+        if ((source.mHandler == nullptr) || (source.mFd != fd))
+        {
+            continue;
+        }
+
+        Dispatch(aInstance, source, FromEpollEvents(events[i].events));
+    }
+
+exit:
+    return;
+#else
+    for (EventSource &entry : sEventSources)
+    {
+        uint32_t events = 0;
+
+        if (entry.mHandler == nullptr)
+        {
+            continue;
+        }
+
+        if (FD_ISSET(entry.mFd, &aMainloop->mReadFdSet))
+        {
+            events |= OT_POSIX_MAINLOOP_EVENT_READ;
+        }
+
+        if (FD_ISSET(entry.mFd, &aMainloop->mWriteFdSet))
+        {
+            events |= OT_POSIX_MAINLOOP_EVENT_WRITE;
+        }
+
+        if (FD_ISSET(entry.mFd, &aMainloop->mErrorFdSet))
+        {
+            events |= OT_POSIX_MAINLOOP_EVENT_ERROR;
+        }
+
+        Dispatch(aInstance, entry, events);
+    }
+#endif
+}
+
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+void otTaskletsSignalPendingFromThread(otInstance *aInstance)
+{
+    uint64_t value = 1;
+    ssize_t  rval;
+    int      writeFd;
+
+    OT_UNUSED_VARIABLE(aInstance);
+
+    __atomic_add_fetch(&sWakeupWriters, 1, __ATOMIC_SEQ_CST);
+
+    // Nothing to wake up before the mainloop is initialized or after
+    // it is torn down.
+
+    writeFd = __atomic_load_n(&sWakeupWriteFd, __ATOMIC_SEQ_CST);
+    VerifyOrExit(writeFd != -1);
+
+    // A full pipe (`EAGAIN`) means a wakeup is already pending.
+
+    do
+    {
+        rval = write(writeFd, &value, sizeof(value));
+    } while ((rval == -1) && (errno == EINTR));
+
+    VerifyOrDie((rval == sizeof(value)) || (errno == EAGAIN), OT_EXIT_ERROR_ERRNO);
+
+exit:
+    __atomic_sub_fetch(&sWakeupWriters, 1, __ATOMIC_SEQ_CST);
+}
+#endif
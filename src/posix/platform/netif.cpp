@@ -245,6 +245,7 @@ enum
 #endif
 
 static constexpr size_t kMaxIp6Size = OPENTHREAD_CONFIG_IP6_MAX_DATAGRAM_LENGTH;
+static otSysTunCounters sTunCounters;
 #if defined(RTM_NEWLINK) && defined(RTM_DELLINK)
 static bool sIsSyncingState = false;
 #endif
@@ -548,7 +549,9 @@ static void processReceive(otMessage *aMessage, void *aContext)
     length += 4;
 #endif
 
-    VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); error = OT_ERROR_FAILED);
+    VerifyOrExit(write(sTunFd, packet, length) == length, perror("write"); sTunCounters.mWriteErrors++;
+                 error = OT_ERROR_FAILED);
+    sTunCounters.mWritePackets++;
 
 exit:
     otMessageFree(aMessage);
@@ -563,37 +566,30 @@ exit:
     }
 }
 
-static void processTransmit(otInstance *aInstance)
+static otError transmitPacket(otInstance *aInstance, char *aPacket, ssize_t aLength)
 {
     otMessage *message = nullptr;
-    ssize_t    rval;
-    char       packet[kMaxIp6Size];
-    otError    error  = OT_ERROR_NONE;
-    size_t     offset = 0;
-
-    assert(sInstance == aInstance);
-
-    rval = read(sTunFd, packet, sizeof(packet));
-    VerifyOrExit(rval > 0, error = OT_ERROR_FAILED);
+    otError    error   = OT_ERROR_NONE;
+    size_t     offset  = 0;
 
     message = otIp6NewMessage(aInstance, nullptr);
     VerifyOrExit(message != nullptr, error = OT_ERROR_NO_BUFS);
 
 #if defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
     // BSD tunnel drivers have (for legacy reasons), may have a 4-byte header on them
-    if ((rval >= 4) && (packet[0] == 0) && (packet[1] == 0))
+    if ((aLength >= 4) && (aPacket[0] == 0) && (aPacket[1] == 0))
     {
-        rval -= 4;
+        aLength -= 4;
         offset = 4;
     }
 #endif
 
 #if OPENTHREAD_POSIX_LOG_TUN_PACKETS
-    otLogInfoPlat("Packet to NCP (%hu bytes)", static_cast<uint16_t>(rval));
-    otDumpInfo(OT_LOG_REGION_PLATFORM, "", &packet[offset], static_cast<size_t>(rval));
+    otLogInfoPlat("Packet to NCP (%hu bytes)", static_cast<uint16_t>(aLength));
+    otDumpInfo(OT_LOG_REGION_PLATFORM, "", &aPacket[offset], static_cast<size_t>(aLength));
 #endif
 
-    SuccessOrExit(error = otMessageAppend(message, &packet[offset], static_cast<uint16_t>(rval)));
+    SuccessOrExit(error = otMessageAppend(message, &aPacket[offset], static_cast<uint16_t>(aLength)));
 
     error   = otIp6Send(aInstance, message);
     message = nullptr;
@@ -612,6 +608,78 @@ exit:
     {
         otLogWarnPlat("%s: %s", __func__, otThreadErrorToString(error));
     }
+
+    return error;
+}
+
+static void processTransmit(otInstance *aInstance)
+{
+    char     packet[kMaxIp6Size];
+    uint32_t count = 0;
+    otError  error;
+
+    assert(sInstance == aInstance);
+
+    // Drain up to `OPENTHREAD_POSIX_CONFIG_NETIF_TUN_READ_BATCH_SIZE`
+    // packets per mainloop wakeup. The TUN fd is level-triggered, so
+    // any remaining packets are read in the next iteration (after
+    // tasklets had a chance to run and free up message buffers).
+
+    while (count < OPENTHREAD_POSIX_CONFIG_NETIF_TUN_READ_BATCH_SIZE)
+    {
+        ssize_t rval = read(sTunFd, packet, sizeof(packet));
+
+        if (rval <= 0)
+        {
+            if ((rval < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+            {
+                otLogWarnPlat("%s: read: %s", __func__, strerror(errno));
+            }
+
+            break;
+        }
+
+        count++;
+        error = transmitPacket(aInstance, packet, rval);
+
+        if (error != OT_ERROR_NONE)
+        {
+            sTunCounters.mReadDrops++;
+        }
+
+        if (error == OT_ERROR_NO_BUFS)
+        {
+            break;
+        }
+    }
+
+    VerifyOrExit(count > 0);
+
+    sTunCounters.mReadWakeups++;
+    sTunCounters.mReadPackets += count;
+
+    if (count > sTunCounters.mReadMaxBatch)
+    {
+        sTunCounters.mReadMaxBatch = count;
+    }
+
+    if (count == OPENTHREAD_POSIX_CONFIG_NETIF_TUN_READ_BATCH_SIZE)
+    {
+        sTunCounters.mReadBatchLimitHits++;
+    }
+
+exit:
+    return;
+}
+
+const otSysTunCounters *otSysGetTunCounters(void)
+{
+    return &sTunCounters;
+}
+
+void otSysResetTunCounters(void)
+{
+    memset(&sTunCounters, 0, sizeof(sTunCounters));
 }
 
 #define kAddAddress true
@@ -1118,6 +1186,7 @@ void platformNetifDeinit(void)
 {
     if (sTunFd != -1)
     {
+        platformMainloopRemoveFd(sTunFd);
         close(sTunFd);
         sTunFd = -1;
 
@@ -1134,6 +1203,7 @@ void platformNetifDeinit(void)
 
     if (sNetlinkFd != -1)
     {
+        platformMainloopRemoveFd(sNetlinkFd);
         close(sNetlinkFd);
         sNetlinkFd = -1;
     }
@@ -1141,6 +1211,7 @@ void platformNetifDeinit(void)
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
     if (sMLDMonitorFd != -1)
     {
+        platformMainloopRemoveFd(sMLDMonitorFd);
         close(sMLDMonitorFd);
         sMLDMonitorFd = -1;
     }
@@ -1296,7 +1367,20 @@ static void platformConfigureTunDevice(otInstance *aInstance,
         strncpy(ifr.ifr_name, "wpan%d", IFNAMSIZ);
     }
 
+#if OPENTHREAD_POSIX_CONFIG_NETIF_TUN_NAPI_ENABLE && defined(IFF_NAPI)
+    // Let the kernel batch the packets written to the TUN device (GRO)
+    // when supported, fall back to a plain TUN device otherwise.
+    ifr.ifr_flags = static_cast<short>(ifr.ifr_flags | IFF_NAPI);
+
+    if (ioctl(sTunFd, TUNSETIFF, static_cast<void *>(&ifr)) != 0)
+    {
+        otLogNotePlat("TUN device does not support IFF_NAPI: %s", strerror(errno));
+        ifr.ifr_flags = static_cast<short>(ifr.ifr_flags & ~IFF_NAPI);
+        VerifyOrDie(ioctl(sTunFd, TUNSETIFF, static_cast<void *>(&ifr)) == 0, OT_EXIT_ERROR_ERRNO);
+    }
+#else
     VerifyOrDie(ioctl(sTunFd, TUNSETIFF, static_cast<void *>(&ifr)) == 0, OT_EXIT_ERROR_ERRNO);
+#endif
     VerifyOrDie(ioctl(sTunFd, TUNSETLINK, ARPHRD_VOID) == 0, OT_EXIT_ERROR_ERRNO);
 
     strncpy(deviceName, ifr.ifr_name, deviceNameLen);
@@ -1447,118 +1531,82 @@ static void platformConfigureNetLink(void)
 #endif // defined(__APPLE__) || defined(__NetBSD__) || defined(__FreeBSD__)
 }
 
-void platformNetifInit(otInstance *aInstance, const char *aInterfaceName)
+static void handleTunEvent(otInstance *aInstance, void *aContext, uint32_t aEvents)
 {
-    sIpFd = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_IP, kSocketNonBlock);
-    VerifyOrDie(sIpFd >= 0, OT_EXIT_ERROR_ERRNO);
-
-    platformConfigureNetLink();
-    platformConfigureTunDevice(aInstance, aInterfaceName, gNetifName, sizeof(gNetifName));
-
-    gNetifIndex = if_nametoindex(gNetifName);
-    VerifyOrDie(gNetifIndex > 0, OT_EXIT_FAILURE);
-
-#if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
-    platformUdpInit(gNetifName);
-#endif
-#if OPENTHREAD_POSIX_USE_MLD_MONITOR
-    mldListenerInit();
-#endif
-
-    otIp6SetReceiveFilterEnabled(aInstance, true);
-    otIcmp6SetEchoMode(aInstance, OT_ICMP6_ECHO_HANDLER_DISABLED);
-    otIp6SetReceiveCallback(aInstance, processReceive, aInstance);
-    otIp6SetAddressCallback(aInstance, processAddressChange, aInstance);
-#if OPENTHREAD_POSIX_MULTICAST_PROMISCUOUS_REQUIRED
-    otIp6SetMulticastPromiscuousEnabled(aInstance, true);
-#endif
-
-    sInstance = aInstance;
-}
-
-void platformNetifUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aErrorFdSet, int *aMaxFd)
-{
-    OT_UNUSED_VARIABLE(aWriteFdSet);
-
-    VerifyOrExit(gNetifIndex > 0);
-
-    assert(sTunFd >= 0);
-    assert(sNetlinkFd >= 0);
-    assert(sIpFd >= 0);
-
-    FD_SET(sTunFd, aReadFdSet);
-    FD_SET(sTunFd, aErrorFdSet);
-    FD_SET(sNetlinkFd, aReadFdSet);
-    FD_SET(sNetlinkFd, aErrorFdSet);
-#if OPENTHREAD_POSIX_USE_MLD_MONITOR
-    FD_SET(sMLDMonitorFd, aReadFdSet);
-    FD_SET(sMLDMonitorFd, aErrorFdSet);
-#endif
-
-    if (sTunFd > *aMaxFd)
-    {
-        *aMaxFd = sTunFd;
-    }
+    OT_UNUSED_VARIABLE(aContext);
 
-    if (sNetlinkFd > *aMaxFd)
+    if (aEvents & OT_POSIX_MAINLOOP_EVENT_ERROR)
     {
-        *aMaxFd = sNetlinkFd;
+        close(sTunFd);
+        DieNow(OT_EXIT_FAILURE);
     }
 
-#if OPENTHREAD_POSIX_USE_MLD_MONITOR
-    if (sMLDMonitorFd > *aMaxFd)
-    {
-        *aMaxFd = sMLDMonitorFd;
-    }
-#endif
-exit:
-    return;
+    processTransmit(aInstance);
 }
 
-void platformNetifProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, const fd_set *aErrorFdSet)
+static void handleNetlinkEvent(otInstance *aInstance, void *aContext, uint32_t aEvents)
 {
-    OT_UNUSED_VARIABLE(aWriteFdSet);
-    VerifyOrExit(gNetifIndex > 0);
-
-    if (FD_ISSET(sTunFd, aErrorFdSet))
-    {
-        close(sTunFd);
-        DieNow(OT_EXIT_FAILURE);
-    }
+    OT_UNUSED_VARIABLE(aContext);
 
-    if (FD_ISSET(sNetlinkFd, aErrorFdSet))
+    if (aEvents & OT_POSIX_MAINLOOP_EVENT_ERROR)
     {
         close(sNetlinkFd);
         DieNow(OT_EXIT_FAILURE);
     }
 
+    processNetlinkEvent(aInstance);
+}
+
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
-    if (FD_ISSET(sMLDMonitorFd, aErrorFdSet))
+static void handleMLDEvent(otInstance *aInstance, void *aContext, uint32_t aEvents)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    if (aEvents & OT_POSIX_MAINLOOP_EVENT_ERROR)
     {
         close(sMLDMonitorFd);
         DieNow(OT_EXIT_FAILURE);
     }
+
+    processMLDEvent(aInstance);
+}
 #endif
 
-    if (FD_ISSET(sTunFd, aReadFdSet))
-    {
-        processTransmit(sInstance);
-    }
+void platformNetifInit(otInstance *aInstance, const char *aInterfaceName)
+{
+    const uint32_t kEvents = OT_POSIX_MAINLOOP_EVENT_READ | OT_POSIX_MAINLOOP_EVENT_ERROR;
 
-    if (FD_ISSET(sNetlinkFd, aReadFdSet))
-    {
-        processNetlinkEvent(sInstance);
-    }
+    sIpFd = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_IP, kSocketNonBlock);
+    VerifyOrDie(sIpFd >= 0, OT_EXIT_ERROR_ERRNO);
+
+    platformConfigureNetLink();
+    platformConfigureTunDevice(aInstance, aInterfaceName, gNetifName, sizeof(gNetifName));
+
+    gNetifIndex = if_nametoindex(gNetifName);
+    VerifyOrDie(gNetifIndex > 0, OT_EXIT_FAILURE);
+
+#if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
+    platformUdpInit(aInstance, gNetifName);
+#endif
+#if OPENTHREAD_POSIX_USE_MLD_MONITOR
+    mldListenerInit();
+#endif
 
+    SuccessOrDie(platformMainloopAddFd(sTunFd, kEvents, handleTunEvent, nullptr));
+    SuccessOrDie(platformMainloopAddFd(sNetlinkFd, kEvents, handleNetlinkEvent, nullptr));
 #if OPENTHREAD_POSIX_USE_MLD_MONITOR
-    if (FD_ISSET(sMLDMonitorFd, aReadFdSet))
-    {
-        processMLDEvent(sInstance);
-    }
+    SuccessOrDie(platformMainloopAddFd(sMLDMonitorFd, kEvents, handleMLDEvent, nullptr));
 #endif
 
-exit:
-    return;
+    otIp6SetReceiveFilterEnabled(aInstance, true);
+    otIcmp6SetEchoMode(aInstance, OT_ICMP6_ECHO_HANDLER_DISABLED);
+    otIp6SetReceiveCallback(aInstance, processReceive, aInstance);
+    otIp6SetAddressCallback(aInstance, processAddressChange, aInstance);
+#if OPENTHREAD_POSIX_MULTICAST_PROMISCUOUS_REQUIRED
+    otIp6SetMulticastPromiscuousEnabled(aInstance, true);
+#endif
+
+    sInstance = aInstance;
 }
 
 otError otPlatGetNetif(otInstance *aInstance, const char **outNetIfName, unsigned int *outNetIfIndex)
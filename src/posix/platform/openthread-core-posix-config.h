@@ -44,6 +44,26 @@
 #define OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS 256
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+ *
+ * Define to 1 to enable `otTaskletsPostFromThread()`, which posts tasklet entries from any thread.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+#define OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+ *
+ * Define to 1 to keep the expanded AES key schedules of the MAC keys.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_LOG_PLATFORM
  *
@@ -156,6 +176,36 @@
 #define OPENTHREAD_CONFIG_TMF_ADDRESS_CACHE_ENTRIES 32
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+ *
+ * Specifies the number of hash buckets used to look up names of the SRP server.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE
+#define OPENTHREAD_CONFIG_SRP_SERVER_NAME_INDEX_SIZE 128
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES
+ *
+ * Maximum number of cached responses for CoAP Confirmable messages.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES
+#define OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES 64
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS
+ *
+ * Number of outstanding CoAP requests per CoAP agent that are indexed by token, message ID and retransmission deadline.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS
+#define OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS 64
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
  *
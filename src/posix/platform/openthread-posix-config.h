@@ -121,6 +121,86 @@
 #define OPENTHREAD_POSIX_CONFIG_MAX_MULTICAST_FORWARDING_CACHE_TABLE (OPENTHREAD_CONFIG_MAX_MULTICAST_LISTENERS * 10)
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_TUN_READ_BATCH_SIZE
+ *
+ * This setting configures the maximum number of packets read from the TUN device in one mainloop iteration.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_TUN_READ_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_TUN_READ_BATCH_SIZE 16
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_NETIF_TUN_NAPI_ENABLE
+ *
+ * Define as 1 to request NAPI (`IFF_NAPI`) on the Linux TUN device, so that the kernel batches the packets written
+ * to it. The TUN device is created without it if the kernel does not support it.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_NETIF_TUN_NAPI_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_NETIF_TUN_NAPI_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+ *
+ * Define as 1 to use epoll (Linux only) to wait on the file descriptors registered with the mainloop event source
+ * registry. The registrations are kept in the kernel and only the epoll file descriptor is added to the select()
+ * file descriptor sets of `otSysMainloopContext`.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE 0
+#endif
+
+#if OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE && !defined(__linux__)
+#error "OPENTHREAD_POSIX_CONFIG_MAINLOOP_EPOLL_ENABLE is only supported on Linux."
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_MAINLOOP_MAX_SOURCES
+ *
+ * This setting configures the maximum number of file descriptors that can be registered with the mainloop event
+ * source registry.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_MAINLOOP_MAX_SOURCES
+#define OPENTHREAD_POSIX_CONFIG_MAINLOOP_MAX_SOURCES 32
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_MAX_RECORDS
+ *
+ * Define the maximum number of values held by the settings file.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_MAX_RECORDS
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_MAX_RECORDS 256
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD
+ *
+ * Define the size (in bytes) above which the append-only settings file is compacted, once it holds more stale than
+ * live data.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD 4096
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_SETTINGS_SYNC_INTERVAL
+ *
+ * Define the time window (in milliseconds) over which writes to the settings file are coalesced into a single
+ * `fsync()`. Settings written within the window may be lost on power loss, so the default of 0 syncs every write.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_SETTINGS_SYNC_INTERVAL
+#define OPENTHREAD_POSIX_CONFIG_SETTINGS_SYNC_INTERVAL 0
+#endif
+
 #ifdef __APPLE__
 
 /**
@@ -99,6 +99,104 @@ struct RadioProcessContext
     const fd_set *mWriteFdSet;
 };
 
+/**
+ * This enumeration defines the events a mainloop event source can be registered for.
+ *
+ */
+enum
+{
+    OT_POSIX_MAINLOOP_EVENT_READ  = 1 << 0, ///< The file descriptor is readable.
+    OT_POSIX_MAINLOOP_EVENT_WRITE = 1 << 1, ///< The file descriptor is writable.
+    OT_POSIX_MAINLOOP_EVENT_ERROR = 1 << 2, ///< An error condition happened on the file descriptor.
+
+    /**
+     * Only report an event when the file descriptor becomes ready (edge-triggered). The handler MUST then drain the
+     * file descriptor (e.g. read until `EAGAIN`). This flag is ignored when the mainloop uses select().
+     *
+     */
+    OT_POSIX_MAINLOOP_EVENT_EDGE_TRIGGERED = 1 << 3,
+};
+
+/**
+ * This function pointer is called when a registered file descriptor is ready.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ * @param[in]  aContext   The context pointer given when the file descriptor was registered.
+ * @param[in]  aEvents    A bitmask of `OT_POSIX_MAINLOOP_EVENT_*` with the events that happened.
+ *
+ */
+typedef void (*platformMainloopHandler)(otInstance *aInstance, void *aContext, uint32_t aEvents);
+
+/**
+ * This function initializes the mainloop event source registry.
+ *
+ */
+void platformMainloopInit(void);
+
+/**
+ * This function deinitializes the mainloop event source registry.
+ *
+ */
+void platformMainloopDeinit(void);
+
+/**
+ * This function registers a file descriptor with the mainloop.
+ *
+ * The registration is persistent: the file descriptor is watched in every mainloop iteration until it is removed
+ * with `platformMainloopRemoveFd()`, which MUST be called before the file descriptor is closed.
+ *
+ * @param[in]  aFd        The file descriptor.
+ * @param[in]  aEvents    A bitmask of `OT_POSIX_MAINLOOP_EVENT_*` with the events to watch.
+ * @param[in]  aHandler   The function to call when the file descriptor is ready.
+ * @param[in]  aContext   An arbitrary context pointer passed to @p aHandler.
+ *
+ * @retval OT_ERROR_NONE          Successfully registered the file descriptor.
+ * @retval OT_ERROR_ALREADY       The file descriptor is already registered.
+ * @retval OT_ERROR_NO_BUFS       The maximum number of registered file descriptors is reached.
+ * @retval OT_ERROR_INVALID_ARGS  @p aFd or @p aHandler is invalid.
+ * @retval OT_ERROR_FAILED        The kernel rejected the registration.
+ *
+ */
+otError platformMainloopAddFd(int aFd, uint32_t aEvents, platformMainloopHandler aHandler, void *aContext);
+
+/**
+ * This function changes the events watched on a registered file descriptor.
+ *
+ * @param[in]  aFd        The file descriptor.
+ * @param[in]  aEvents    A bitmask of `OT_POSIX_MAINLOOP_EVENT_*` with the events to watch.
+ *
+ * @retval OT_ERROR_NONE       Successfully updated the events.
+ * @retval OT_ERROR_NOT_FOUND  The file descriptor is not registered.
+ * @retval OT_ERROR_FAILED     The kernel rejected the change.
+ *
+ */
+otError platformMainloopUpdateFd(int aFd, uint32_t aEvents);
+
+/**
+ * This function unregisters a file descriptor from the mainloop.
+ *
+ * @param[in]  aFd  The file descriptor.
+ *
+ */
+void platformMainloopRemoveFd(int aFd);
+
+/**
+ * This function updates the file descriptor sets with the file descriptors registered with the mainloop.
+ *
+ * @param[inout]  aMainloop  A pointer to the mainloop context.
+ *
+ */
+void platformMainloopUpdateFdSet(otSysMainloopContext *aMainloop);
+
+/**
+ * This function calls the handlers of the registered file descriptors which are ready.
+ *
+ * @param[in]  aInstance  The OpenThread instance structure.
+ * @param[in]  aMainloop  A pointer to the mainloop context.
+ *
+ */
+void platformMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMainloop);
+
 /**
  * This function initializes the alarm service used by OpenThread.
  *
@@ -153,6 +251,20 @@ int32_t platformAlarmGetNext(void);
  */
 void platformAlarmAdvanceNow(uint64_t aDelta);
 
+/**
+ * This function updates the timeout so that pending settings writes are synced in time.
+ *
+ * @param[inout]  aTimeout  A pointer to the timeout of the mainloop.
+ *
+ */
+void platformSettingsUpdateTimeout(struct timeval *aTimeout);
+
+/**
+ * This function syncs pending settings writes once their coalescing window expired.
+ *
+ */
+void platformSettingsProcess(void);
+
 /**
  * This function initializes the radio service used by OpenThread.
  *
@@ -250,27 +362,6 @@ void platformUartProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, co
  */
 void platformNetifInit(otInstance *aInstance, const char *aInterfaceName);
 
-/**
- * This function updates the file descriptor sets with file descriptors used by platform netif module.
- *
- * @param[inout]  aReadFdSet    A pointer to the read file descriptors.
- * @param[inout]  aWriteFdSet   A pointer to the write file descriptors.
- * @param[inout]  aErrorFdSet   A pointer to the error file descriptors.
- * @param[inout]  aMaxFd        A pointer to the max file descriptor.
- *
- */
-void platformNetifUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *aErrorFdSet, int *aMaxFd);
-
-/**
- * This function performs platform netif processing.
- *
- * @param[in]   aReadFdSet      A pointer to the read file descriptors.
- * @param[in]   aWriteFdSet     A pointer to the write file descriptors.
- * @param[in]   aErrorFdSet     A pointer to the error file descriptors.
- *
- */
-void platformNetifProcess(const fd_set *aReadFdSet, const fd_set *aWriteFdSet, const fd_set *aErrorFdSet);
-
 /**
  * This function performs notifies state changes to platform netif.
  *
@@ -361,28 +452,13 @@ void virtualTimeRadioSpinelProcess(otInstance *aInstance, const struct VirtualTi
 /**
  * This function initializes platform UDP driver.
  *
- * @param[in]   aIfName   The name of Thread's platform network interface.
- *
- */
-void platformUdpInit(const char *aIfName);
-
-/**
- * This function performs platform UDP driver processing.
+ * UDP sockets opened before this call are not watched by the mainloop until it is called.
  *
- * @param[in]   aInstance   The OpenThread instance structure.
- * @param[in]   aReadFdSet  A pointer to the read file descriptors.
+ * @param[in]   aInstance   A pointer to the OpenThread instance.
+ * @param[in]   aIfName     The name of Thread's platform network interface.
  *
  */
-void platformUdpProcess(otInstance *aInstance, const fd_set *aReadSet);
-
-/**
- * This function updates the file descriptor sets with file descriptors used by the platform UDP driver.
- *
- * @param[in]     aInstance    The OpenThread instance structure.
- * @param[inout]  aReadFdSet   A pointer to the read file descriptors.
- * @param[inout]  aMaxFd       A pointer to the max file descriptor.
- */
-void platformUdpUpdateFdSet(otInstance *aInstance, fd_set *aReadFdSet, int *aMaxFd);
+void platformUdpInit(otInstance *aInstance, const char *aIfName);
 
 enum SocketBlockOption
 {
@@ -514,24 +590,6 @@ void platformInfraIfInit(otInstance *aInstance, const char *aIfName);
  */
 void platformInfraIfDeinit(void);
 
-/**
- * This function updates the read fd set.
- *
- * @param[out]  aReadFdSet  The fd set to be updated.
- * @param[out]  aMaxFd      The maximum fd to be updated.
- *
- */
-void platformInfraIfUpdateFdSet(fd_set &aReadFdSet, int &aMaxFd);
-
-/**
- * This function processes possible events on the infrastructure interface.
- *
- * @param[in]  aInstance   The OpenThread instance.
- * @param[in]  aReadFdSet  The fd set which may contain read vents.
- *
- */
-void platformInfraIfProcess(otInstance *aInstance, const fd_set &aReadFdSet);
-
 /**
  * This function returns the index of the infrastructure interface.
  *
@@ -42,6 +42,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <time.h>
 #include <unistd.h>
 
 #include <openthread/platform/misc.h>
@@ -50,12 +51,69 @@
 
 #include "common/code_utils.hpp"
 #include "common/encoding.hpp"
+#include "common/logging.hpp"
 
-static const size_t kMaxFileNameSize = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
+/*
+ * The settings file is an append-only log of records. Every `otPlatSettingsSet()`, `otPlatSettingsAdd()` and
+ * `otPlatSettingsDelete()` appends a single record, and an in-memory index maps each live value to its offset in the
+ * file. Once the file grows beyond `OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD` and holds more stale than
+ * live bytes, the live values are copied to the swap file which then atomically replaces the data file.
+ *
+ * Each record carries a CRC-32 over its header and value. On start-up the log is replayed up to the first torn or
+ * corrupted record and the file is truncated there, so a power loss at any point leaves the settings in the state
+ * after the last complete record. A log holding more values than the index, or a malformed legacy file, is a
+ * configuration error rather than corruption: initialization fails and the file is left untouched.
+ *
+ */
 
-static int sSettingsFd = -1;
+static const size_t   kMaxFileNameSize    = sizeof(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH) + 32;
+static const uint16_t kMaxRecords         = OPENTHREAD_POSIX_CONFIG_SETTINGS_MAX_RECORDS;
+static const off_t    kCompactionSize     = OPENTHREAD_POSIX_CONFIG_SETTINGS_COMPACTION_THRESHOLD;
+static const uint32_t kSyncInterval       = OPENTHREAD_POSIX_CONFIG_SETTINGS_SYNC_INTERVAL;
+static const uint8_t  kMagic[]            = {'O', 'T', 'S', 'L', 'O', 'G', 0, 1};
+static const size_t   kCrcCoveredSize     = 8; ///< Number of header bytes covered by the record CRC.
+static const size_t   kCopyBlockSize      = 512;
+static const uint32_t kCrcInitValue       = 0xffffffff;
+static const uint32_t kCrcNibbleTable[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+};
+
+enum RecordOp : uint8_t
+{
+    kRecordOpAdd    = 1,
+    kRecordOpSet    = 2,
+    kRecordOpDelete = 3,
+};
 
-static otError platformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd);
+OT_TOOL_PACKED_BEGIN
+struct RecordHeader
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    uint8_t  mOp;
+    uint8_t  mReserved;
+    int16_t  mIndex;
+    uint32_t mCrc;
+} OT_TOOL_PACKED_END;
+
+static_assert(sizeof(RecordHeader) == 12, "RecordHeader must be 12 bytes");
+static_assert(offsetof(RecordHeader, mCrc) == kCrcCoveredSize, "CRC must follow the covered header fields");
+
+struct IndexEntry
+{
+    uint16_t mKey;
+    uint16_t mLength;
+    off_t    mOffset; ///< Offset of the value in the settings file.
+};
+
+static int        sSettingsFd = -1;
+static IndexEntry sIndex[kMaxRecords];
+static uint16_t   sIndexLength;
+static off_t      sFileSize;     ///< Offset at which the next record is appended.
+static off_t      sLiveSize;     ///< Size the settings file would have right after compaction.
+static bool       sSyncPending;  ///< Whether appended records are waiting for `fsync()`.
+static uint64_t   sSyncDeadline; ///< Time (in milliseconds) when pending records must be synced.
 
 static void getSettingsFileName(otInstance *aInstance, char aFileName[kMaxFileNameSize], bool aSwap)
 {
@@ -68,74 +126,461 @@ static void getSettingsFileName(otInstance *aInstance, char aFileName[kMaxFileNa
              offset == nullptr ? "0" : offset, nodeId, (aSwap ? "swap" : "data"));
 }
 
-static int swapOpen(otInstance *aInstance)
+static uint32_t crcUpdate(uint32_t aCrc, const void *aData, size_t aLength)
 {
-    char fileName[kMaxFileNameSize];
-    int  fd;
+    const uint8_t *bytes = static_cast<const uint8_t *>(aData);
 
-    getSettingsFileName(aInstance, fileName, true);
+    for (size_t i = 0; i < aLength; i++)
+    {
+        aCrc ^= bytes[i];
+        aCrc = (aCrc >> 4) ^ kCrcNibbleTable[aCrc & 0x0f];
+        aCrc = (aCrc >> 4) ^ kCrcNibbleTable[aCrc & 0x0f];
+    }
 
-    fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
-    VerifyOrDie(fd != -1, OT_EXIT_ERROR_ERRNO);
+    return aCrc;
+}
 
-    return fd;
+static uint64_t getNowMs(void)
+{
+    struct timespec now;
+
+    VerifyOrDie(clock_gettime(CLOCK_MONOTONIC, &now) == 0, OT_EXIT_ERROR_ERRNO);
+
+    return static_cast<uint64_t>(now.tv_sec) * 1000 + static_cast<uint64_t>(now.tv_nsec) / 1000000;
+}
+
+static off_t getRecordSize(uint16_t aLength)
+{
+    return static_cast<off_t>(sizeof(RecordHeader)) + aLength;
+}
+
+static void readAt(int aFd, void *aBuffer, size_t aLength, off_t aOffset)
+{
+    VerifyOrDie(pread(aFd, aBuffer, aLength, aOffset) == static_cast<ssize_t>(aLength), OT_EXIT_FAILURE);
+}
+
+static void writeAt(int aFd, const void *aBuffer, size_t aLength, off_t aOffset)
+{
+    VerifyOrDie(pwrite(aFd, aBuffer, aLength, aOffset) == static_cast<ssize_t>(aLength), OT_EXIT_ERROR_ERRNO);
+}
+
+static void syncNow(void)
+{
+    VerifyOrDie(fsync(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+    sSyncPending = false;
+}
+
+/**
+ * This function syncs the settings directory, so that a `rename()` of the swap file survives a power loss.
+ *
+ */
+static void syncDirectory(void)
+{
+    int dirFd = open(OPENTHREAD_CONFIG_POSIX_SETTINGS_PATH, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+
+    VerifyOrDie(dirFd != -1, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(fsync(dirFd) == 0, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(close(dirFd) == 0, OT_EXIT_ERROR_ERRNO);
+}
+
+static void scheduleSync(void)
+{
+    if (kSyncInterval == 0)
+    {
+        syncNow();
+    }
+    else if (!sSyncPending)
+    {
+        sSyncPending  = true;
+        sSyncDeadline = getNowMs() + kSyncInterval;
+    }
 }
 
 /**
- * This function reads @p aLength bytes from the data file and appends to the swap file.
+ * This function finds the position in the index of the @p aIndex-th value of @p aKey.
  *
- * @param[in]   aFd     The file descriptor of the current swap file.
- * @param[in]   aLength Number of bytes to copy.
+ * @returns The position in `sIndex`, or -1 if not found.
  *
  */
-static void swapWrite(otInstance *aInstance, int aFd, uint16_t aLength)
+static int findEntry(uint16_t aKey, int aIndex)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    for (int i = 0; i < sIndexLength; i++)
+    {
+        if (sIndex[i].mKey != aKey)
+        {
+            continue;
+        }
 
-    const size_t kBlockSize = 512;
-    uint8_t      buffer[kBlockSize];
+        if (aIndex-- == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/**
+ * This function indicates whether @p aKey has exactly one value and it equals @p aValue.
+ *
+ */
+static bool hasSingleValue(uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    bool    isSame   = false;
+    int     position = findEntry(aKey, 0);
+    uint8_t buffer[kCopyBlockSize];
+
+    VerifyOrExit(position >= 0 && sIndex[position].mLength == aValueLength && findEntry(aKey, 1) < 0);
+
+    for (uint16_t compared = 0; compared < aValueLength;)
+    {
+        uint16_t count = aValueLength - compared;
+
+        if (count > sizeof(buffer))
+        {
+            count = sizeof(buffer);
+        }
+
+        readAt(sSettingsFd, buffer, count, sIndex[position].mOffset + compared);
+        VerifyOrExit(memcmp(buffer, aValue + compared, count) == 0);
+        compared += count;
+    }
+
+    isSame = true;
+
+exit:
+    return isSame;
+}
+
+static uint16_t countEntries(uint16_t aKey)
+{
+    uint16_t count = 0;
+
+    for (int i = 0; i < sIndexLength; i++)
+    {
+        if (sIndex[i].mKey == aKey)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+static void removeEntry(int aPosition)
+{
+    sLiveSize -= getRecordSize(sIndex[aPosition].mLength);
+    sIndexLength--;
+    memmove(&sIndex[aPosition], &sIndex[aPosition + 1], (sIndexLength - aPosition) * sizeof(sIndex[0]));
+}
+
+static void clearIndex(void)
+{
+    sIndexLength = 0;
+    sLiveSize    = sizeof(kMagic);
+}
+
+/**
+ * This function applies a record to the in-memory index.
+ *
+ * It is shared by the live write path and by the log replay on start-up, so both always agree on the resulting state.
+ *
+ * @param[in]  aHeader  The record header.
+ * @param[in]  aOffset  The offset of the record value in the settings file.
+ *
+ * @retval OT_ERROR_NONE       The record was applied.
+ * @retval OT_ERROR_NOT_FOUND  A delete record did not match any value.
+ * @retval OT_ERROR_NO_BUFS    The index has no room for another value.
+ * @retval OT_ERROR_PARSE      The record operation is invalid.
+ *
+ */
+static otError applyRecord(const RecordHeader &aHeader, off_t aOffset)
+{
+    otError error = OT_ERROR_NONE;
+    int     position;
 
-    while (aLength > 0)
+    switch (aHeader.mOp)
     {
-        uint16_t count = aLength >= sizeof(buffer) ? sizeof(buffer) : aLength;
-        ssize_t  rval  = read(sSettingsFd, buffer, count);
+    case kRecordOpSet:
+        VerifyOrExit(sIndexLength - countEntries(aHeader.mKey) < kMaxRecords, error = OT_ERROR_NO_BUFS);
+
+        while ((position = findEntry(aHeader.mKey, 0)) >= 0)
+        {
+            removeEntry(position);
+        }
+
+        // fall through
+
+    case kRecordOpAdd:
+        VerifyOrExit(sIndexLength < kMaxRecords, error = OT_ERROR_NO_BUFS);
 
-        VerifyOrDie(rval > 0, OT_EXIT_FAILURE);
-        count = static_cast<uint16_t>(rval);
-        rval  = write(aFd, buffer, count);
-        assert(rval == count);
-        VerifyOrDie(rval == count, OT_EXIT_FAILURE);
-        aLength -= count;
+        sIndex[sIndexLength].mKey    = aHeader.mKey;
+        sIndex[sIndexLength].mLength = aHeader.mLength;
+        sIndex[sIndexLength].mOffset = aOffset;
+        sIndexLength++;
+        sLiveSize += getRecordSize(aHeader.mLength);
+        break;
+
+    case kRecordOpDelete:
+        VerifyOrExit(aHeader.mLength == 0, error = OT_ERROR_PARSE);
+
+        if (aHeader.mIndex == -1)
+        {
+            VerifyOrExit((position = findEntry(aHeader.mKey, 0)) >= 0, error = OT_ERROR_NOT_FOUND);
+
+            do
+            {
+                removeEntry(position);
+            } while ((position = findEntry(aHeader.mKey, 0)) >= 0);
+        }
+        else
+        {
+            VerifyOrExit((position = findEntry(aHeader.mKey, aHeader.mIndex)) >= 0, error = OT_ERROR_NOT_FOUND);
+            removeEntry(position);
+        }
+
+        break;
+
+    default:
+        error = OT_ERROR_PARSE;
+        break;
     }
+
+exit:
+    return error;
 }
 
-static void swapPersist(otInstance *aInstance, int aFd)
+/**
+ * This function rewrites the live values into the swap file and atomically replaces the data file with it.
+ *
+ */
+static void compact(otInstance *aInstance)
 {
-    char swapFile[kMaxFileNameSize];
-    char dataFile[kMaxFileNameSize];
+    char    swapFile[kMaxFileNameSize];
+    char    dataFile[kMaxFileNameSize];
+    int     swapFd;
+    off_t   offset = sizeof(kMagic);
+    uint8_t buffer[kCopyBlockSize];
 
     getSettingsFileName(aInstance, swapFile, true);
     getSettingsFileName(aInstance, dataFile, false);
 
-    VerifyOrDie(0 == close(sSettingsFd), OT_EXIT_ERROR_ERRNO);
-    VerifyOrDie(0 == fsync(aFd), OT_EXIT_ERROR_ERRNO);
-    VerifyOrDie(0 == rename(swapFile, dataFile), OT_EXIT_ERROR_ERRNO);
+    swapFd = open(swapFile, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    VerifyOrDie(swapFd != -1, OT_EXIT_ERROR_ERRNO);
+
+    writeAt(swapFd, kMagic, sizeof(kMagic), 0);
+
+    for (int i = 0; i < sIndexLength; i++)
+    {
+        IndexEntry & entry = sIndex[i];
+        RecordHeader header;
+        off_t        valueOffset = offset + static_cast<off_t>(sizeof(header));
+
+        header.mKey      = entry.mKey;
+        header.mLength   = entry.mLength;
+        header.mOp       = kRecordOpAdd;
+        header.mReserved = 0;
+        header.mIndex    = 0;
+        header.mCrc      = crcUpdate(kCrcInitValue, &header, kCrcCoveredSize);
+
+        for (uint16_t copied = 0; copied < entry.mLength;)
+        {
+            uint16_t count = entry.mLength - copied;
+
+            if (count > sizeof(buffer))
+            {
+                count = sizeof(buffer);
+            }
+
+            readAt(sSettingsFd, buffer, count, entry.mOffset + copied);
+            writeAt(swapFd, buffer, count, valueOffset + copied);
+            header.mCrc = crcUpdate(header.mCrc, buffer, count);
+            copied += count;
+        }
+
+        header.mCrc = ~header.mCrc;
+        writeAt(swapFd, &header, sizeof(header), offset);
+
+        entry.mOffset = valueOffset;
+        offset        = valueOffset + entry.mLength;
+    }
+
+    VerifyOrDie(fsync(swapFd) == 0, OT_EXIT_ERROR_ERRNO);
+    VerifyOrDie(rename(swapFile, dataFile) == 0, OT_EXIT_ERROR_ERRNO);
+    syncDirectory();
+    VerifyOrDie(close(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+
+    sSettingsFd  = swapFd;
+    sFileSize    = offset;
+    sSyncPending = false;
+    assert(sFileSize == sLiveSize);
+}
+
+/**
+ * This function appends a record to the settings file and applies it to the index.
+ *
+ */
+static otError appendRecord(otInstance *   aInstance,
+                            RecordOp       aOp,
+                            uint16_t       aKey,
+                            int            aIndex,
+                            const uint8_t *aValue,
+                            uint16_t       aValueLength)
+{
+    otError      error = OT_ERROR_NONE;
+    RecordHeader header;
+
+    header.mKey      = aKey;
+    header.mLength   = aValueLength;
+    header.mOp       = aOp;
+    header.mReserved = 0;
+    header.mIndex    = static_cast<int16_t>(aIndex);
+    header.mCrc      = crcUpdate(kCrcInitValue, &header, kCrcCoveredSize);
+    header.mCrc      = ~crcUpdate(header.mCrc, aValue, aValueLength);
+
+    // Validate against the index before touching the file, so that a failed request leaves no record behind.
+    SuccessOrExit(error = applyRecord(header, sFileSize + static_cast<off_t>(sizeof(header))));
+
+    writeAt(sSettingsFd, &header, sizeof(header), sFileSize);
+
+    if (aValueLength > 0)
+    {
+        writeAt(sSettingsFd, aValue, aValueLength, sFileSize + static_cast<off_t>(sizeof(header)));
+    }
+
+    sFileSize += getRecordSize(aValueLength);
+    scheduleSync();
+
+    if (sFileSize >= kCompactionSize && sFileSize - sLiveSize > sLiveSize)
+    {
+        compact(aInstance);
+    }
 
-    sSettingsFd = aFd;
+exit:
+    return error;
 }
 
-static void swapDiscard(otInstance *aInstance, int aFd)
+/**
+ * This function replays the records of the settings file into the index.
+ *
+ * Replay stops at the first torn or corrupted record and the file is truncated there. An intact record which cannot
+ * be applied, e.g. because it does not fit in the index, terminates the program without modifying the file, since the
+ * records after it are still valid.
+ *
+ */
+static void replayLog(off_t aSize)
 {
-    char swapFileName[kMaxFileNameSize];
+    off_t   offset = sizeof(kMagic);
+    uint8_t buffer[kCopyBlockSize];
+
+    clearIndex();
+
+    while (offset < aSize)
+    {
+        RecordHeader header;
+        uint32_t     crc;
+        off_t        valueOffset = offset + static_cast<off_t>(sizeof(header));
+
+        VerifyOrExit(valueOffset <= aSize);
+        readAt(sSettingsFd, &header, sizeof(header), offset);
+        VerifyOrExit(valueOffset + header.mLength <= aSize);
+
+        crc = crcUpdate(kCrcInitValue, &header, kCrcCoveredSize);
 
-    VerifyOrDie(0 == close(aFd), OT_EXIT_ERROR_ERRNO);
-    getSettingsFileName(aInstance, swapFileName, true);
-    VerifyOrDie(0 == unlink(swapFileName), OT_EXIT_ERROR_ERRNO);
+        for (uint16_t checked = 0; checked < header.mLength;)
+        {
+            uint16_t count = header.mLength - checked;
+
+            if (count > sizeof(buffer))
+            {
+                count = sizeof(buffer);
+            }
+
+            readAt(sSettingsFd, buffer, count, valueOffset + checked);
+            crc = crcUpdate(crc, buffer, count);
+            checked += count;
+        }
+
+        VerifyOrExit(~crc == header.mCrc);
+
+        switch (applyRecord(header, valueOffset))
+        {
+        case OT_ERROR_NONE:
+        case OT_ERROR_NOT_FOUND:
+            break;
+
+        case OT_ERROR_NO_BUFS:
+            // The file was written with a larger index. Truncating it would lose keys and frame counters.
+            otLogCritPlat("Settings log record at offset %ld exceeds the %u value index", static_cast<long>(offset),
+                          kMaxRecords);
+            DieNow(OT_EXIT_FAILURE);
+
+        default:
+            // The record is intact, so it was written by an incompatible version rather than torn.
+            otLogCritPlat("Settings log record at offset %ld is invalid", static_cast<long>(offset));
+            DieNow(OT_EXIT_FAILURE);
+        }
+
+        offset = valueOffset + header.mLength;
+    }
+
+exit:
+    sFileSize = offset;
+
+    if (offset < aSize)
+    {
+        otLogWarnPlat("Settings log truncated at offset %ld of %ld", static_cast<long>(offset),
+                      static_cast<long>(aSize));
+        VerifyOrDie(ftruncate(sSettingsFd, offset) == 0, OT_EXIT_ERROR_ERRNO);
+        syncNow();
+    }
+}
+
+/**
+ * This function imports a settings file in the legacy `[key][length][value]` format into the index.
+ *
+ * @retval OT_ERROR_NONE      The file was parsed successfully.
+ * @retval OT_ERROR_PARSE     The file is malformed.
+ * @retval OT_ERROR_NO_BUFS   The file holds more values than the index.
+ *
+ */
+static otError importLegacy(off_t aSize)
+{
+    otError error  = OT_ERROR_NONE;
+    off_t   offset = 0;
+
+    clearIndex();
+
+    while (offset < aSize)
+    {
+        uint16_t     key;
+        uint16_t     length;
+        RecordHeader header;
+
+        VerifyOrExit(offset + static_cast<off_t>(sizeof(key) + sizeof(length)) <= aSize, error = OT_ERROR_PARSE);
+        readAt(sSettingsFd, &key, sizeof(key), offset);
+        readAt(sSettingsFd, &length, sizeof(length), offset + static_cast<off_t>(sizeof(key)));
+        offset += sizeof(key) + sizeof(length);
+        VerifyOrExit(offset + length <= aSize, error = OT_ERROR_PARSE);
+
+        header.mKey      = key;
+        header.mLength   = length;
+        header.mOp       = kRecordOpAdd;
+        header.mReserved = 0;
+        header.mIndex    = 0;
+        header.mCrc      = 0;
+        SuccessOrExit(error = applyRecord(header, offset));
+
+        offset += length;
+    }
+
+exit:
+    return error;
 }
 
 void otPlatSettingsInit(otInstance *aInstance)
 {
-    otError error = OT_ERROR_NONE;
+    off_t size;
 
     {
         struct stat st;
@@ -151,30 +596,47 @@ void otPlatSettingsInit(otInstance *aInstance)
 
         getSettingsFileName(aInstance, fileName, false);
         sSettingsFd = open(fileName, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+
+        // A swap file is only left behind by an interrupted compaction, the data file is still authoritative.
+        getSettingsFileName(aInstance, fileName, true);
+        unlink(fileName);
     }
 
     VerifyOrDie(sSettingsFd != -1, OT_EXIT_ERROR_ERRNO);
 
-    for (off_t size = lseek(sSettingsFd, 0, SEEK_END), offset = lseek(sSettingsFd, 0, SEEK_SET); offset < size;)
-    {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+    sSyncPending = false;
+    size         = lseek(sSettingsFd, 0, SEEK_END);
+    VerifyOrDie(size >= 0, OT_EXIT_ERROR_ERRNO);
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+    if (size == 0)
+    {
+        // The magic is written through the swap file, so the data file never holds a torn magic.
+        clearIndex();
+        compact(aInstance);
+    }
+    else
+    {
+        uint8_t magic[sizeof(kMagic)];
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+        if (size >= static_cast<off_t>(sizeof(magic)) &&
+            pread(sSettingsFd, magic, sizeof(magic), 0) == static_cast<ssize_t>(sizeof(magic)) &&
+            memcmp(magic, kMagic, sizeof(magic)) == 0)
+        {
+            replayLog(size);
+        }
+        else
+        {
+            otError error = importLegacy(size);
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-    }
+            if (error != OT_ERROR_NONE)
+            {
+                // Compacting now would replace the user's settings with whatever was parsed so far.
+                otLogCritPlat("Cannot import legacy settings file: %s", otThreadErrorToString(error));
+                DieNow(OT_EXIT_FAILURE);
+            }
 
-exit:
-    if (error == OT_ERROR_PARSE)
-    {
-        VerifyOrDie(ftruncate(sSettingsFd, 0) == 0, OT_EXIT_ERROR_ERRNO);
+            compact(aInstance);
+        }
     }
 }
 
@@ -183,230 +645,479 @@ void otPlatSettingsDeinit(otInstance *aInstance)
     OT_UNUSED_VARIABLE(aInstance);
 
     assert(sSettingsFd != -1);
+
+    if (sSyncPending)
+    {
+        syncNow();
+    }
+
     VerifyOrDie(close(sSettingsFd) == 0, OT_EXIT_ERROR_ERRNO);
+    sSettingsFd = -1;
 }
 
 otError otPlatSettingsGet(otInstance *aInstance, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    otError     error  = OT_ERROR_NOT_FOUND;
-    const off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t       offset = lseek(sSettingsFd, 0, SEEK_SET);
+    otError error    = OT_ERROR_NONE;
+    int     position = findEntry(aKey, aIndex);
 
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+    VerifyOrExit(aIndex >= 0 && position >= 0, error = OT_ERROR_NOT_FOUND);
 
-    while (offset < size)
+    if (aValueLength)
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
-
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+        const IndexEntry &entry = sIndex[position];
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
-
-        if (key == aKey)
+        if (aValue)
         {
-            if (aIndex == 0)
-            {
-                error = OT_ERROR_NONE;
-
-                if (aValueLength)
-                {
-                    if (aValue)
-                    {
-                        uint16_t readLength = (length <= *aValueLength ? length : *aValueLength);
-
-                        VerifyOrExit(read(sSettingsFd, aValue, readLength) == readLength, error = OT_ERROR_PARSE);
-                    }
-
-                    *aValueLength = length;
-                }
+            uint16_t readLength = (entry.mLength <= *aValueLength ? entry.mLength : *aValueLength);
 
-                break;
-            }
-            else
-            {
-                --aIndex;
-            }
+            readAt(sSettingsFd, aValue, readLength, entry.mOffset);
         }
 
-        offset += sizeof(key) + sizeof(length) + length;
-        VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
+        *aValueLength = entry.mLength;
     }
 
 exit:
-    VerifyOrDie(error != OT_ERROR_PARSE, OT_EXIT_FAILURE);
     return error;
 }
 
 otError otPlatSettingsSet(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
 {
-    int swapFd = -1;
+    otError error = OT_ERROR_NONE;
 
-    switch (platformSettingsDelete(aInstance, aKey, -1, &swapFd))
-    {
-    case OT_ERROR_NONE:
-    case OT_ERROR_NOT_FOUND:
-        break;
+    // Skip the write if the key already holds exactly this value, which is common for periodically saved settings.
+    VerifyOrExit(!hasSingleValue(aKey, aValue, aValueLength));
+    error = appendRecord(aInstance, kRecordOpSet, aKey, 0, aValue, aValueLength);
 
-    default:
-        assert(false);
-        break;
-    }
+exit:
+    return error;
+}
+
+otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    return appendRecord(aInstance, kRecordOpAdd, aKey, 0, aValue, aValueLength);
+}
 
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
+otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+{
+    otError error = OT_ERROR_NOT_FOUND;
 
-    swapPersist(aInstance, swapFd);
+    VerifyOrExit(aIndex >= -1 && aIndex <= INT16_MAX);
+    error = appendRecord(aInstance, kRecordOpDelete, aKey, aIndex, nullptr, 0);
 
-    return OT_ERROR_NONE;
+exit:
+    return error;
 }
 
-otError otPlatSettingsAdd(otInstance *aInstance, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+void otPlatSettingsWipe(otInstance *aInstance)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    clearIndex();
+    compact(aInstance);
+}
+
+void platformSettingsUpdateTimeout(struct timeval *aTimeout)
+{
+    uint64_t now;
+    uint64_t remaining = 0;
 
-    off_t size   = lseek(sSettingsFd, 0, SEEK_END);
-    int   swapFd = swapOpen(aInstance);
+    VerifyOrExit(sSyncPending);
 
-    if (size > 0)
+    now = getNowMs();
+
+    if (sSyncDeadline > now)
     {
-        VerifyOrDie(0 == lseek(sSettingsFd, 0, SEEK_SET), OT_EXIT_ERROR_ERRNO);
-        swapWrite(aInstance, swapFd, static_cast<uint16_t>(size));
+        remaining = sSyncDeadline - now;
     }
 
-    VerifyOrDie(write(swapFd, &aKey, sizeof(aKey)) == sizeof(aKey) &&
-                    write(swapFd, &aValueLength, sizeof(aValueLength)) == sizeof(aValueLength) &&
-                    write(swapFd, aValue, aValueLength) == aValueLength,
-                OT_EXIT_FAILURE);
+    if (static_cast<uint64_t>(aTimeout->tv_sec) * 1000 + static_cast<uint64_t>(aTimeout->tv_usec) / 1000 > remaining)
+    {
+        aTimeout->tv_sec  = static_cast<time_t>(remaining / 1000);
+        aTimeout->tv_usec = static_cast<suseconds_t>((remaining % 1000) * 1000);
+    }
 
-    swapPersist(aInstance, swapFd);
+exit:
+    return;
+}
 
-    return OT_ERROR_NONE;
+void platformSettingsProcess(void)
+{
+    VerifyOrExit(sSyncPending && getNowMs() >= sSyncDeadline);
+    syncNow();
+
+exit:
+    return;
 }
 
-otError otPlatSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex)
+#ifndef SELF_TEST
+#define SELF_TEST 0
+#endif
+
+#if SELF_TEST
+
+#include <sys/wait.h>
+
+void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
+{
+    OT_UNUSED_VARIABLE(aInstance);
+
+    memset(aIeeeEui64, 0, sizeof(uint64_t));
+}
+
+static off_t getDataFileSize(otInstance *aInstance)
 {
-    return platformSettingsDelete(aInstance, aKey, aIndex, nullptr);
+    char        fileName[kMaxFileNameSize];
+    struct stat st;
+
+    getSettingsFileName(aInstance, fileName, false);
+    assert(stat(fileName, &st) == 0);
+
+    return st.st_size;
 }
 
 /**
- * This function removes a setting either from swap file or persisted file.
+ * This function verifies that `otPlatSettingsInit()` terminates the program, and leaves the data file unchanged.
  *
- * @param[in]  aInstance  The OpenThread instance structure.
- * @param[in]  aKey       The key associated with the requested setting.
- * @param[in]  aIndex     The index of the value to be removed. If set to -1, all values for this aKey will be removed.
- * @param[out] aSwapFd    A optional pointer to receive file descriptor of the generated swap file descriptor.
- *
- * @note
- *   If @p aSwapFd is null, operate deleting on the setting file.
- *   If @p aSwapFd is not null, operate on the swap file, and aSwapFd will point to the swap file descriptor.
+ */
+static void verifyInitFails(otInstance *aInstance)
+{
+    off_t size = getDataFileSize(aInstance);
+    pid_t pid  = fork();
+    int   status;
+
+    assert(pid != -1);
+
+    if (pid == 0)
+    {
+        otPlatSettingsInit(aInstance);
+        _exit(OT_EXIT_SUCCESS);
+    }
+
+    assert(waitpid(pid, &status, 0) == pid);
+    assert(WIFEXITED(status) && WEXITSTATUS(status) == OT_EXIT_FAILURE);
+    assert(getDataFileSize(aInstance) == size);
+}
+
+/**
+ * This function truncates the data file to @p aSize bytes.
  *
- * @retval OT_ERROR_NONE        The given key and index was found and removed successfully.
- * @retval OT_ERROR_NOT_FOUND   The given key or index was not found in the setting store.
+ */
+static void truncateDataFile(otInstance *aInstance, off_t aSize)
+{
+    char fileName[kMaxFileNameSize];
+
+    getSettingsFileName(aInstance, fileName, false);
+    assert(truncate(fileName, aSize) == 0);
+}
+
+/**
+ * This function computes a signature of the settings visible through `otPlatSettingsGet()` for a few keys.
  *
  */
-static otError platformSettingsDelete(otInstance *aInstance, uint16_t aKey, int aIndex, int *aSwapFd)
+static uint32_t getSettingsSignature(otInstance *aInstance)
 {
-    OT_UNUSED_VARIABLE(aInstance);
+    uint32_t signature = kCrcInitValue;
+
+    for (uint16_t key = 0; key < 3; key++)
+    {
+        for (int index = 0; index < 4; index++)
+        {
+            uint8_t  value[64];
+            uint16_t length = sizeof(value);
+            otError  error  = otPlatSettingsGet(aInstance, key, index, value, &length);
 
-    otError error  = OT_ERROR_NOT_FOUND;
-    off_t   size   = lseek(sSettingsFd, 0, SEEK_END);
-    off_t   offset = lseek(sSettingsFd, 0, SEEK_SET);
-    int     swapFd = swapOpen(aInstance);
+            signature = crcUpdate(signature, &error, sizeof(error));
 
-    assert(swapFd != -1);
-    assert(offset == 0);
-    VerifyOrExit(offset == 0 && size >= 0, error = OT_ERROR_PARSE);
+            if (error == OT_ERROR_NONE)
+            {
+                assert(length <= sizeof(value));
+                signature = crcUpdate(signature, &length, sizeof(length));
+                signature = crcUpdate(signature, value, length);
+            }
+        }
+    }
+
+    return signature;
+}
 
-    while (offset < size)
+/**
+ * This function simulates a power loss at every byte of the settings log and verifies the recovered state.
+ *
+ */
+static void testPowerLoss(otInstance *aInstance, const uint8_t *aData)
+{
+    const size_t kNumOps = 12;
+    off_t        sizes[kNumOps + 1];
+    uint32_t     signatures[kNumOps + 1];
+    uint8_t      log[kCompactionSize];
+    char         fileName[kMaxFileNameSize];
+    off_t        logSize;
+    int          fd;
+
+    otPlatSettingsWipe(aInstance);
+    sizes[0]      = getDataFileSize(aInstance);
+    signatures[0] = getSettingsSignature(aInstance);
+
+    for (size_t op = 0; op < kNumOps; op++)
     {
-        uint16_t key;
-        uint16_t length;
-        ssize_t  rval;
+        switch (op)
+        {
+        case 0:
+            assert(otPlatSettingsSet(aInstance, 0, aData, 20) == OT_ERROR_NONE);
+            break;
+        case 1:
+            assert(otPlatSettingsAdd(aInstance, 1, aData, 10) == OT_ERROR_NONE);
+            break;
+        case 2:
+            assert(otPlatSettingsAdd(aInstance, 1, aData + 5, 30) == OT_ERROR_NONE);
+            break;
+        case 3:
+            assert(otPlatSettingsSet(aInstance, 0, aData + 1, 45) == OT_ERROR_NONE);
+            break;
+        case 4:
+            assert(otPlatSettingsAdd(aInstance, 1, aData + 2, 0) == OT_ERROR_NONE);
+            break;
+        case 5:
+            assert(otPlatSettingsDelete(aInstance, 1, 0) == OT_ERROR_NONE);
+            break;
+        case 6:
+            assert(otPlatSettingsAdd(aInstance, 2, aData, 60) == OT_ERROR_NONE);
+            break;
+        case 7:
+            assert(otPlatSettingsSet(aInstance, 1, aData + 4, 16) == OT_ERROR_NONE);
+            break;
+        case 8:
+            assert(otPlatSettingsDelete(aInstance, 0, -1) == OT_ERROR_NONE);
+            break;
+        case 9:
+            assert(otPlatSettingsAdd(aInstance, 2, aData, 8) == OT_ERROR_NONE);
+            break;
+        case 10:
+            assert(otPlatSettingsAdd(aInstance, 0, aData + 7, 33) == OT_ERROR_NONE);
+            break;
+        case 11:
+            assert(otPlatSettingsDelete(aInstance, 2, 1) == OT_ERROR_NONE);
+            break;
+        }
 
-        rval = read(sSettingsFd, &key, sizeof(key));
-        VerifyOrExit(rval == sizeof(key), error = OT_ERROR_PARSE);
+        sizes[op + 1]      = getDataFileSize(aInstance);
+        signatures[op + 1] = getSettingsSignature(aInstance);
+        assert(sizes[op + 1] > sizes[op]);
+        assert(signatures[op + 1] != signatures[op]);
+    }
 
-        rval = read(sSettingsFd, &length, sizeof(length));
-        VerifyOrExit(rval == sizeof(length), error = OT_ERROR_PARSE);
+    otPlatSettingsDeinit(aInstance);
 
-        offset += sizeof(key) + sizeof(length) + length;
+    getSettingsFileName(aInstance, fileName, false);
+    fd = open(fileName, O_RDONLY);
+    assert(fd != -1);
+    logSize = read(fd, log, sizeof(log));
+    assert(logSize == sizes[kNumOps]);
+    close(fd);
 
-        if (aKey == key)
+    for (int garbage = 0; garbage < 2; garbage++)
+    {
+        for (off_t cut = 0; cut <= logSize; cut++)
         {
-            if (aIndex == 0)
+            size_t expected = 0;
+
+            // The data file is created and wiped through an atomic rename, so it is never torn inside the magic.
+            if ((cut > 0 || garbage) && cut < static_cast<off_t>(sizeof(kMagic)))
             {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                swapWrite(aInstance, swapFd, static_cast<uint16_t>(size - offset));
-                error = OT_ERROR_NONE;
-                break;
+                continue;
             }
-            else if (aIndex == -1)
+
+            while (expected < kNumOps && sizes[expected + 1] <= cut)
             {
-                VerifyOrExit(offset == lseek(sSettingsFd, length, SEEK_CUR), error = OT_ERROR_PARSE);
-                error = OT_ERROR_NONE;
-                continue;
+                expected++;
             }
-            else
+
+            fd = open(fileName, O_RDWR | O_TRUNC);
+            assert(fd != -1);
+            assert(write(fd, log, static_cast<size_t>(cut)) == cut);
+
+            if (garbage)
             {
-                --aIndex;
+                uint8_t tail[sizeof(RecordHeader) + 4];
+
+                memset(tail, 0xa5, sizeof(tail));
+                assert(write(fd, tail, sizeof(tail)) == static_cast<ssize_t>(sizeof(tail)));
             }
+
+            close(fd);
+
+            otPlatSettingsInit(aInstance);
+            assert(getSettingsSignature(aInstance) == signatures[expected]);
+            assert(getDataFileSize(aInstance) == sizes[expected]);
+            otPlatSettingsDeinit(aInstance);
         }
+    }
 
-        rval = write(swapFd, &key, sizeof(key));
-        assert(rval == sizeof(key));
-        VerifyOrDie(rval == sizeof(key), OT_EXIT_FAILURE);
+    otPlatSettingsInit(aInstance);
+}
 
-        rval = write(swapFd, &length, sizeof(length));
-        assert(rval == sizeof(length));
-        VerifyOrDie(rval == sizeof(length), OT_EXIT_FAILURE);
+static void testCompaction(otInstance *aInstance, const uint8_t *aData, uint16_t aDataLength)
+{
+    char     fileName[kMaxFileNameSize];
+    uint8_t  value[64];
+    uint16_t length;
+    int      fd;
 
-        swapWrite(aInstance, swapFd, length);
-    }
+    otPlatSettingsWipe(aInstance);
+    assert(otPlatSettingsAdd(aInstance, 1, aData, 3) == OT_ERROR_NONE);
 
-exit:
-    VerifyOrDie(error != OT_ERROR_PARSE, OT_EXIT_FAILURE);
+    for (int i = 0; i < 1000; i++)
+    {
+        assert(otPlatSettingsSet(aInstance, 0, aData + (i % 8), aDataLength - 8) == OT_ERROR_NONE);
+        assert(getDataFileSize(aInstance) < kCompactionSize + getRecordSize(aDataLength));
+    }
 
-    if (aSwapFd != nullptr)
+    // a stale swap file from an interrupted compaction must be ignored
+    otPlatSettingsDeinit(aInstance);
+    getSettingsFileName(aInstance, fileName, true);
+    fd = open(fileName, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    assert(fd != -1);
+    assert(write(fd, aData, aDataLength) == aDataLength);
+    close(fd);
+    otPlatSettingsInit(aInstance);
+    assert(access(fileName, F_OK) != 0);
+
+    length = sizeof(value);
+    assert(otPlatSettingsGet(aInstance, 0, 0, value, &length) == OT_ERROR_NONE);
+    assert(length == aDataLength - 8);
+    assert(0 == memcmp(value, aData + (999 % 8), length));
+    assert(otPlatSettingsGet(aInstance, 0, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+    length = sizeof(value);
+    assert(otPlatSettingsGet(aInstance, 1, 0, value, &length) == OT_ERROR_NONE);
+    assert(length == 3);
+    assert(0 == memcmp(value, aData, length));
+
+    // setting an identical value does not grow the log
     {
-        *aSwapFd = swapFd;
+        off_t size = getDataFileSize(aInstance);
+
+        assert(otPlatSettingsSet(aInstance, 0, aData + (999 % 8), aDataLength - 8) == OT_ERROR_NONE);
+        assert(getDataFileSize(aInstance) == size);
     }
-    else if (error == OT_ERROR_NONE)
+
+    otPlatSettingsWipe(aInstance);
+}
+
+static void testLegacyImport(otInstance *aInstance, const uint8_t *aData)
+{
+    char     fileName[kMaxFileNameSize];
+    uint8_t  value[64];
+    uint16_t length;
+    uint8_t  magic[sizeof(kMagic)];
+    int      fd;
+
+    otPlatSettingsDeinit(aInstance);
+
+    getSettingsFileName(aInstance, fileName, false);
+    fd = open(fileName, O_RDWR | O_TRUNC);
+    assert(fd != -1);
+
+    for (uint16_t i = 0; i < 3; i++)
     {
-        swapPersist(aInstance, swapFd);
+        uint16_t key  = (i == 2 ? 5 : 4);
+        uint16_t size = static_cast<uint16_t>(10 + i);
+
+        assert(write(fd, &key, sizeof(key)) == sizeof(key));
+        assert(write(fd, &size, sizeof(size)) == sizeof(size));
+        assert(write(fd, aData + i, size) == size);
     }
-    else if (error == OT_ERROR_NOT_FOUND)
+
+    close(fd);
+
+    otPlatSettingsInit(aInstance);
+
+    length = sizeof(value);
+    assert(otPlatSettingsGet(aInstance, 4, 1, value, &length) == OT_ERROR_NONE);
+    assert(length == 11);
+    assert(0 == memcmp(value, aData + 1, length));
+    length = sizeof(value);
+    assert(otPlatSettingsGet(aInstance, 5, 0, value, &length) == OT_ERROR_NONE);
+    assert(length == 12);
+    assert(0 == memcmp(value, aData + 2, length));
+
+    fd = open(fileName, O_RDONLY);
+    assert(fd != -1);
+    assert(read(fd, magic, sizeof(magic)) == static_cast<ssize_t>(sizeof(magic)));
+    assert(0 == memcmp(magic, kMagic, sizeof(magic)));
+    close(fd);
+
+    // a malformed legacy file is kept for the user to recover instead of being discarded
+    otPlatSettingsDeinit(aInstance);
+    fd = open(fileName, O_RDWR | O_TRUNC);
+    assert(fd != -1);
+
     {
-        swapDiscard(aInstance, swapFd);
+        uint16_t key  = 4;
+        uint16_t size = 20;
+
+        assert(write(fd, &key, sizeof(key)) == sizeof(key));
+        assert(write(fd, &size, sizeof(size)) == sizeof(size));
+        assert(write(fd, aData, size - 1) == size - 1);
     }
 
-    return error;
+    close(fd);
+    verifyInitFails(aInstance);
+    truncateDataFile(aInstance, 0);
+    otPlatSettingsInit(aInstance);
+
+    otPlatSettingsWipe(aInstance);
 }
 
-void otPlatSettingsWipe(otInstance *aInstance)
+static void testCapacity(otInstance *aInstance, const uint8_t *aData)
 {
-    OT_UNUSED_VARIABLE(aInstance);
-    VerifyOrDie(0 == ftruncate(sSettingsFd, 0), OT_EXIT_ERROR_ERRNO);
-}
+    otPlatSettingsWipe(aInstance);
 
-#ifndef SELF_TEST
-#define SELF_TEST 0
-#endif
+    for (uint16_t i = 0; i < kMaxRecords; i++)
+    {
+        assert(otPlatSettingsAdd(aInstance, i % 4, aData, 1) == OT_ERROR_NONE);
+    }
 
-#if SELF_TEST
+    assert(otPlatSettingsAdd(aInstance, 0, aData, 1) == OT_ERROR_NO_BUFS);
+    assert(otPlatSettingsSet(aInstance, 10, aData, 1) == OT_ERROR_NO_BUFS);
 
-void otPlatRadioGetIeeeEui64(otInstance *aInstance, uint8_t *aIeeeEui64)
-{
-    OT_UNUSED_VARIABLE(aInstance);
+    // replacing all values of a key frees room for the new one
+    assert(otPlatSettingsSet(aInstance, 0, aData, 2) == OT_ERROR_NONE);
+    assert(otPlatSettingsGet(aInstance, 0, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+    assert(otPlatSettingsAdd(aInstance, 10, aData, 1) == OT_ERROR_NONE);
 
-    memset(aIeeeEui64, 0, sizeof(uint64_t));
+    // a log written with a larger index fails to load and is left untouched
+    {
+        RecordHeader header;
+        off_t        size;
+
+        otPlatSettingsWipe(aInstance);
+
+        for (uint16_t i = 0; i < kMaxRecords; i++)
+        {
+            assert(otPlatSettingsAdd(aInstance, 0, aData, 1) == OT_ERROR_NONE);
+        }
+
+        size             = getDataFileSize(aInstance);
+        header.mKey      = 1;
+        header.mLength   = 1;
+        header.mOp       = kRecordOpAdd;
+        header.mReserved = 0;
+        header.mIndex    = 0;
+        header.mCrc      = ~crcUpdate(crcUpdate(kCrcInitValue, &header, kCrcCoveredSize), aData, 1);
+        writeAt(sSettingsFd, &header, sizeof(header), size);
+        writeAt(sSettingsFd, aData, 1, size + static_cast<off_t>(sizeof(header)));
+
+        otPlatSettingsDeinit(aInstance);
+        verifyInitFails(aInstance);
+        assert(getDataFileSize(aInstance) == size + getRecordSize(1));
+
+        truncateDataFile(aInstance, size);
+        otPlatSettingsInit(aInstance);
+        assert(otPlatSettingsGet(aInstance, 0, kMaxRecords - 1, nullptr, nullptr) == OT_ERROR_NONE);
+        assert(otPlatSettingsGet(aInstance, 1, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
+    }
+
+    otPlatSettingsWipe(aInstance);
 }
 
 int main()
@@ -544,6 +1255,12 @@ int main()
         assert(otPlatSettingsGet(instance, 0, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND);
     }
     otPlatSettingsWipe(instance);
+
+    testPowerLoss(instance, data);
+    testCompaction(instance, data, sizeof(data));
+    testLegacyImport(instance, data);
+    testCapacity(instance, data);
+
     otPlatSettingsDeinit(instance);
 
     return 0;
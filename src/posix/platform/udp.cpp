@@ -228,6 +228,36 @@ exit:
     return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
 }
 
+static void handleUdpEvent(otInstance *aInstance, void *aContext, uint32_t aEvents)
+{
+    otUdpSocket *     socket      = static_cast<otUdpSocket *>(aContext);
+    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    otMessageInfo     messageInfo;
+    otMessage *       message = nullptr;
+    uint8_t           payload[kMaxUdpSize];
+    uint16_t          length = sizeof(payload);
+
+    VerifyOrExit(aEvents & OT_POSIX_MAINLOOP_EVENT_READ);
+
+    memset(&messageInfo, 0, sizeof(messageInfo));
+    messageInfo.mSockPort = socket->mSockName.mPort;
+
+    SuccessOrExit(receivePacket(FdFromHandle(socket->mHandle), payload, length, messageInfo));
+
+    message = otUdpNewMessage(aInstance, &msgSettings);
+    VerifyOrExit(message != nullptr);
+
+    SuccessOrExit(otMessageAppend(message, payload, length));
+
+    socket->mHandler(socket->mContext, message, &messageInfo);
+
+exit:
+    if (message != nullptr)
+    {
+        otMessageFree(message);
+    }
+}
+
 otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
 {
     otError error = OT_ERROR_NONE;
@@ -238,6 +268,15 @@ otError otPlatUdpSocket(otUdpSocket *aUdpSocket)
     fd = SocketWithCloseExec(AF_INET6, SOCK_DGRAM, IPPROTO_UDP, kSocketNonBlock);
     VerifyOrExit(fd >= 0, error = OT_ERROR_FAILED);
 
+    // The socket is only watched once the Thread network interface is
+    // known, see `platformUdpInit()`.
+    if (platformMainloopAddFd(fd, (gNetifIndex != 0) ? OT_POSIX_MAINLOOP_EVENT_READ : 0, handleUdpEvent, aUdpSocket) !=
+        OT_ERROR_NONE)
+    {
+        close(fd);
+        ExitNow(error = OT_ERROR_FAILED);
+    }
+
     aUdpSocket->mHandle = FdToHandle(fd);
 
 exit:
@@ -254,6 +293,7 @@ otError otPlatUdpClose(otUdpSocket *aUdpSocket)
     VerifyOrExit(aUdpSocket->mHandle != nullptr);
 
     fd = FdFromHandle(aUdpSocket->mHandle);
+    platformMainloopRemoveFd(fd);
     VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = nullptr;
@@ -538,33 +578,7 @@ exit:
     return error;
 }
 
-void platformUdpUpdateFdSet(otInstance *aInstance, fd_set *aReadFdSet, int *aMaxFd)
-{
-    VerifyOrExit(gNetifIndex != 0);
-
-    for (otUdpSocket *socket = otUdpGetSockets(aInstance); socket != nullptr; socket = socket->mNext)
-    {
-        int fd;
-
-        if (socket->mHandle == nullptr)
-        {
-            continue;
-        }
-
-        fd = FdFromHandle(socket->mHandle);
-        FD_SET(fd, aReadFdSet);
-
-        if (aMaxFd != nullptr && *aMaxFd < fd)
-        {
-            *aMaxFd = fd;
-        }
-    }
-
-exit:
-    return;
-}
-
-void platformUdpInit(const char *aIfName)
+void platformUdpInit(otInstance *aInstance, const char *aIfName)
 {
     if (aIfName == nullptr)
     {
@@ -581,52 +595,14 @@ void platformUdpInit(const char *aIfName)
     }
 
     assert(gNetifIndex != 0);
-}
-
-void platformUdpProcess(otInstance *aInstance, const fd_set *aReadFdSet)
-{
-    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
 
     for (otUdpSocket *socket = otUdpGetSockets(aInstance); socket != nullptr; socket = socket->mNext)
     {
-        int fd = FdFromHandle(socket->mHandle);
-
-        if (fd > 0 && FD_ISSET(fd, aReadFdSet))
+        if (socket->mHandle != nullptr)
         {
-            otMessageInfo messageInfo;
-            otMessage *   message = nullptr;
-            uint8_t       payload[kMaxUdpSize];
-            uint16_t      length = sizeof(payload);
-
-            memset(&messageInfo, 0, sizeof(messageInfo));
-            messageInfo.mSockPort = socket->mSockName.mPort;
-
-            if (OT_ERROR_NONE != receivePacket(fd, payload, length, messageInfo))
-            {
-                continue;
-            }
-
-            message = otUdpNewMessage(aInstance, &msgSettings);
-
-            if (message == nullptr)
-            {
-                continue;
-            }
-
-            if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
-            {
-                otMessageFree(message);
-                continue;
-            }
-
-            socket->mHandler(socket->mContext, message, &messageInfo);
-            otMessageFree(message);
-            // only process one socket a time
-            break;
+            SuccessOrDie(platformMainloopUpdateFd(FdFromHandle(socket->mHandle), OT_POSIX_MAINLOOP_EVENT_READ));
         }
     }
-
-    return;
 }
 
 #endif // #if OPENTHREAD_CONFIG_PLATFORM_UDP_ENABLE
@@ -0,0 +1,326 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "common/instance.hpp"
+#include "common/random.hpp"
+#include "thread/address_resolver.hpp"
+#include "thread/mle.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+class AddressResolverTester
+{
+public:
+    enum
+    {
+        kCacheEntries  = AddressResolver::kCacheEntries,
+        kIndexSize     = AddressResolver::kCacheIndexSize,
+        kNumEids       = 3 * kCacheEntries,
+        kNumRloc16s    = 4,
+        kNumOperations = 20000,
+        kNumHomeSlots  = 3,
+        kFirstHomeSlot = kIndexSize - 2, // The probe sequences wrap around the end of the index.
+    };
+
+    static void TestCacheIndexCollisions(void)
+    {
+        Instance *        instance = testInitInstance();
+        AddressResolver * resolver;
+        Ip6::Address      eids[kNumEids];
+        Mac::ShortAddress rloc16;
+
+        VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+        resolver = &instance->Get<AddressResolver>();
+
+        // All EIDs hash to one of a few adjacent home slots, so every
+        // index operation works on long colliding probe sequences.
+
+        GenerateCollidingEids(eids, kNumEids);
+
+        for (uint16_t i = 0; i < kCacheEntries; i++)
+        {
+            AddEntry(*resolver, eids[i], GetRloc16(i));
+            VerifyCacheIndex(*resolver, eids, kNumEids);
+        }
+
+        VerifyOrQuit(CountEntries(*resolver) == kCacheEntries, "Cache entries were not all added");
+
+        // Remove entries from the middle of the probe sequences, which
+        // requires the following entries to be shifted back.
+
+        for (uint16_t i = 0; i < kCacheEntries; i += 3)
+        {
+            resolver->Remove(eids[i]);
+            VerifyOrQuit(resolver->FindInCacheIndex(eids[i]) == nullptr, "Removed EID is still in the index");
+            VerifyCacheIndex(*resolver, eids, kNumEids);
+        }
+
+        // Entries sharing the same RLOC16 are all removed together.
+
+        rloc16 = GetRloc16(1);
+        resolver->Remove(rloc16);
+        VerifyCacheIndex(*resolver, eids, kNumEids);
+
+        for (uint16_t i = 0; i < kNumEids; i++)
+        {
+            CacheEntry *entry = resolver->FindInCacheIndex(eids[i]);
+
+            VerifyOrQuit((entry == nullptr) || (entry->GetRloc16() != rloc16), "Entry with removed RLOC16 remains");
+        }
+
+        resolver->Remove(Mle::Mle::RouterIdFromRloc16(GetRloc16(0)));
+        VerifyCacheIndex(*resolver, eids, kNumEids);
+
+        resolver->Clear();
+        VerifyOrQuit(CountEntries(*resolver) == 0, "Clear() did not remove all entries");
+        VerifyCacheIndex(*resolver, eids, kNumEids);
+
+        testFreeInstance(instance);
+
+        printf("TestCacheIndexCollisions passed\n");
+    }
+
+    static void TestCacheIndexRandomOperations(void)
+    {
+        Instance *       instance = testInitInstance();
+        AddressResolver *resolver;
+        Ip6::Address     eids[kNumEids];
+
+        VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+        resolver = &instance->Get<AddressResolver>();
+
+        GenerateCollidingEids(eids, kNumEids);
+
+        for (uint32_t i = 0; i < kNumOperations; i++)
+        {
+            const Ip6::Address &eid = eids[Random::NonCrypto::GetUint16() % kNumEids];
+            Mac::ShortAddress   rloc16;
+
+            switch (Random::NonCrypto::GetUint8() % 8)
+            {
+            case 0:
+            case 1:
+            case 2:
+                AddEntry(*resolver, eid, GetRloc16(Random::NonCrypto::GetUint8()));
+                break;
+
+            case 3:
+                // Move a snooped or cached entry to the head of the cached list.
+                IgnoreError(resolver->Resolve(eid, rloc16, /* aAllowAddressQuery */ false));
+                break;
+
+            case 4:
+            case 5:
+                resolver->Remove(eid);
+                VerifyOrQuit(resolver->FindInCacheIndex(eid) == nullptr, "Removed EID is still in the index");
+                break;
+
+            case 6:
+                resolver->Remove(GetRloc16(Random::NonCrypto::GetUint8()));
+                break;
+
+            case 7:
+                if ((Random::NonCrypto::GetUint8() % 16) == 0)
+                {
+                    resolver->Remove(Mle::Mle::RouterIdFromRloc16(GetRloc16(Random::NonCrypto::GetUint8())));
+                }
+                break;
+            }
+
+            VerifyCacheIndex(*resolver, eids, kNumEids);
+        }
+
+        resolver->Clear();
+        VerifyCacheIndex(*resolver, eids, kNumEids);
+
+        testFreeInstance(instance);
+
+        printf("TestCacheIndexRandomOperations passed\n");
+    }
+
+private:
+    typedef AddressResolver::CacheEntry     CacheEntry;
+    typedef AddressResolver::CacheEntryList CacheEntryList;
+
+    static Mac::ShortAddress GetRloc16(uint8_t aIndex)
+    {
+        // Children of two routers, so both RLOC16 and router ID
+        // removals match several entries.
+        static const Mac::ShortAddress kRloc16s[kNumRloc16s] = {0x0400, 0x0401, 0x0402, 0x0800};
+
+        return kRloc16s[aIndex % kNumRloc16s];
+    }
+
+    static void GenerateCollidingEids(Ip6::Address *aEids, uint16_t aNumEids)
+    {
+        uint16_t numEids = 0;
+
+        for (uint32_t iid = 1; numEids < aNumEids; iid++)
+        {
+            Ip6::Address eid;
+            uint16_t     slot;
+
+            SuccessOrQuit(eid.FromString("fd00:1234::"), "Ip6::Address::FromString() failed");
+            eid.mFields.m32[3] = HostSwap32(iid);
+
+            slot = AddressResolver::GetCacheIndexSlot(eid);
+
+            if ((slot + kIndexSize - kFirstHomeSlot) % kIndexSize < kNumHomeSlots)
+            {
+                aEids[numEids++] = eid;
+            }
+        }
+    }
+
+    static void AddEntry(AddressResolver &aResolver, const Ip6::Address &aEid, Mac::ShortAddress aRloc16)
+    {
+        // Same as a received message being snooped: an existing entry
+        // is updated, otherwise a new one is added.
+
+        if (aResolver.UpdateCacheEntry(aEid, aRloc16) == OT_ERROR_NOT_FOUND)
+        {
+            aResolver.AddSnoopedCacheEntry(aEid, aRloc16);
+        }
+    }
+
+    static uint16_t CountEntries(AddressResolver &aResolver)
+    {
+        uint16_t count = 0;
+
+        for (uint8_t listId = AddressResolver::kCachedListId; listId <= AddressResolver::kQueryRetryListId; listId++)
+        {
+            for (CacheEntry *entry = aResolver.GetList(static_cast<AddressResolver::ListId>(listId)).GetHead();
+                 entry != nullptr; entry = entry->GetNext())
+            {
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+    // The reference (scan of all the lists) implementation.
+    static CacheEntry *FindByScan(AddressResolver &aResolver, const Ip6::Address &aEid)
+    {
+        CacheEntry *entry = nullptr;
+
+        for (uint8_t listId = AddressResolver::kCachedListId; listId <= AddressResolver::kQueryRetryListId; listId++)
+        {
+            for (entry = aResolver.GetList(static_cast<AddressResolver::ListId>(listId)).GetHead(); entry != nullptr;
+                 entry = entry->GetNext())
+            {
+                if (entry->Matches(aEid))
+                {
+                    ExitNow();
+                }
+            }
+        }
+
+    exit:
+        return entry;
+    }
+
+    static void VerifyCacheIndex(AddressResolver &aResolver, const Ip6::Address *aEids, uint16_t aNumEids)
+    {
+        uint16_t numSlotsInUse = 0;
+
+        // Every entry on a list is found through the index, with the
+        // list and previous entry that `FindCacheEntry()` derives.
+
+        for (uint8_t listId = AddressResolver::kCachedListId; listId <= AddressResolver::kQueryRetryListId; listId++)
+        {
+            CacheEntryList &list = aResolver.GetList(static_cast<AddressResolver::ListId>(listId));
+            CacheEntry *    prev = nullptr;
+
+            for (CacheEntry *entry = list.GetHead(); entry != nullptr; prev = entry, entry = entry->GetNext())
+            {
+                CacheEntryList *foundList;
+                CacheEntry *    foundPrev;
+
+                VerifyOrQuit(aResolver.FindCacheEntry(entry->GetTarget(), foundList, foundPrev) == entry,
+                             "Entry on a list is not found through the index");
+                VerifyOrQuit(foundList == &list, "Index returned an entry with an incorrect list");
+                VerifyOrQuit(foundPrev == prev, "Index returned an entry with an incorrect previous entry");
+            }
+        }
+
+        // Every slot in use refers to a distinct entry on a list and is
+        // reachable from the home slot of its EID without crossing an
+        // empty slot.
+
+        for (uint16_t slot = 0; slot < kIndexSize; slot++)
+        {
+            uint16_t entryIndex = aResolver.mCacheIndex[slot];
+
+            if (entryIndex == AddressResolver::kCacheIndexEmptySlot)
+            {
+                continue;
+            }
+
+            numSlotsInUse++;
+
+            VerifyOrQuit(entryIndex < kCacheEntries, "Index slot refers to an invalid entry");
+
+            const Ip6::Address &target = aResolver.mCacheEntryPool.GetEntryAt(entryIndex).GetTarget();
+
+            VerifyOrQuit(FindByScan(aResolver, target) == &aResolver.mCacheEntryPool.GetEntryAt(entryIndex),
+                         "Index slot refers to an entry which is not on a list");
+
+            for (uint16_t probe = AddressResolver::GetCacheIndexSlot(target); probe != slot;
+                 probe          = (probe + 1) % kIndexSize)
+            {
+                VerifyOrQuit(aResolver.mCacheIndex[probe] != AddressResolver::kCacheIndexEmptySlot,
+                             "Index entry is not reachable from its home slot");
+            }
+        }
+
+        VerifyOrQuit(numSlotsInUse == CountEntries(aResolver), "Index and lists have a different number of entries");
+
+        // Lookups of EIDs which are not in the cache fail.
+
+        for (uint16_t i = 0; i < aNumEids; i++)
+        {
+            VerifyOrQuit(aResolver.FindInCacheIndex(aEids[i]) == FindByScan(aResolver, aEids[i]),
+                         "FindInCacheIndex() does not match list scan");
+        }
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::AddressResolverTester::TestCacheIndexCollisions();
+    ot::AddressResolverTester::TestCacheIndexRandomOperations();
+    printf("All tests passed\n");
+    return 0;
+}
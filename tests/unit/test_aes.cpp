@@ -26,10 +26,16 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <limits.h>
+
+#include <chrono>
+
 #include <openthread/config.h>
 
 #include "common/debug.hpp"
+#include "common/instance.hpp"
 #include "crypto/aes_ccm.hpp"
+#include "thread/key_manager.hpp"
 
 #include "test_platform.h"
 #include "test_util.h"
@@ -137,10 +143,315 @@ void TestMacCommandFrame()
     VerifyOrQuit(memcmp(test, decrypted, sizeof(decrypted)) == 0, "TestMacCommandFrame decrypt failed");
 }
 
+enum
+{
+    kFrameHeaderLength  = 23,
+    kFramePayloadLength = 96,
+    kFrameTagLength     = 4,
+    kFrameLength        = kFrameHeaderLength + kFramePayloadLength + kFrameTagLength,
+    kBatchSize          = 8,
+};
+
+static const uint8_t kKey[] = {
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+};
+
+struct TestFrame
+{
+    uint8_t mPsdu[kFrameLength];
+    uint8_t mNonce[ot::Crypto::AesCcm::kNonceSize];
+};
+
+static void InitTestFrames(TestFrame *aFrames, uint16_t aNumFrames)
+{
+    static uint8_t sSeed = 0;
+
+    for (uint16_t i = 0; i < aNumFrames; i++)
+    {
+        for (uint8_t &byte : aFrames[i].mPsdu)
+        {
+            byte = sSeed++;
+        }
+
+        for (uint8_t &byte : aFrames[i].mNonce)
+        {
+            byte = static_cast<uint8_t>(sSeed++ * 7);
+        }
+    }
+}
+
+static void ProcessTestFrame(ot::Crypto::AesCcm &aAesCcm, TestFrame &aFrame, ot::Crypto::AesCcm::Mode aMode)
+{
+    uint8_t *payload = aFrame.mPsdu + kFrameHeaderLength;
+
+    aAesCcm.Init(kFrameHeaderLength, kFramePayloadLength, kFrameTagLength, aFrame.mNonce, sizeof(aFrame.mNonce));
+    aAesCcm.Header(aFrame.mPsdu, kFrameHeaderLength);
+    aAesCcm.Payload(payload, payload, kFramePayloadLength, aMode);
+    aAesCcm.Finalize(payload + kFramePayloadLength);
+}
+
+static void InitBatchEntry(ot::Crypto::AesCcm::BatchEntry &aEntry, TestFrame &aFrame)
+{
+    aEntry.mHeader        = aFrame.mPsdu;
+    aEntry.mHeaderLength  = kFrameHeaderLength;
+    aEntry.mPayload       = aFrame.mPsdu + kFrameHeaderLength;
+    aEntry.mPayloadLength = kFramePayloadLength;
+    aEntry.mNonce         = aFrame.mNonce;
+    aEntry.mTag           = aFrame.mPsdu + kFrameHeaderLength + kFramePayloadLength;
+    aEntry.mTagLength     = kFrameTagLength;
+}
+
+/**
+ * Verifies that an already expanded key schedule gives the same result as setting the key.
+ */
+void TestAesCcmKeySchedule(void)
+{
+    ot::Crypto::AesEcb keySchedule;
+    ot::Crypto::AesCcm aesCcm;
+    TestFrame          frame;
+    TestFrame          expected;
+
+    InitTestFrames(&frame, 1);
+    expected = frame;
+
+    aesCcm.SetKey(kKey, sizeof(kKey));
+    ProcessTestFrame(aesCcm, expected, ot::Crypto::AesCcm::kEncrypt);
+
+    keySchedule.SetKey(kKey, CHAR_BIT * sizeof(kKey));
+    aesCcm.SetKey(keySchedule);
+    ProcessTestFrame(aesCcm, frame, ot::Crypto::AesCcm::kEncrypt);
+
+    VerifyOrQuit(memcmp(frame.mPsdu, expected.mPsdu, sizeof(frame.mPsdu)) == 0,
+                 "AesCcm with key schedule does not match");
+
+    // Setting a raw key again after a key schedule must use the new key.
+
+    aesCcm.SetKey(kKey, sizeof(kKey));
+    ProcessTestFrame(aesCcm, expected, ot::Crypto::AesCcm::kDecrypt);
+    aesCcm.SetKey(keySchedule);
+    ProcessTestFrame(aesCcm, frame, ot::Crypto::AesCcm::kDecrypt);
+
+    VerifyOrQuit(memcmp(frame.mPsdu, expected.mPsdu, sizeof(frame.mPsdu)) == 0,
+                 "AesCcm decrypt with key schedule does not match");
+
+    printf("TestAesCcmKeySchedule passed\n");
+}
+
+/**
+ * Verifies `AesCcm::ProcessBatch()` against single frame processing.
+ */
+void TestAesCcmBatch(void)
+{
+    ot::Crypto::AesEcb             keySchedule;
+    ot::Crypto::AesCcm             aesCcm;
+    TestFrame                      frames[kBatchSize];
+    TestFrame                      expected[kBatchSize];
+    TestFrame                      plain[kBatchSize];
+    ot::Crypto::AesCcm::BatchEntry entries[kBatchSize];
+
+    InitTestFrames(frames, kBatchSize);
+    memcpy(plain, frames, sizeof(plain));
+    memcpy(expected, frames, sizeof(expected));
+
+    aesCcm.SetKey(kKey, sizeof(kKey));
+
+    for (TestFrame &frame : expected)
+    {
+        ProcessTestFrame(aesCcm, frame, ot::Crypto::AesCcm::kEncrypt);
+    }
+
+    keySchedule.SetKey(kKey, CHAR_BIT * sizeof(kKey));
+
+    for (uint16_t i = 0; i < kBatchSize; i++)
+    {
+        InitBatchEntry(entries[i], frames[i]);
+    }
+
+    VerifyOrQuit(ot::Crypto::AesCcm::ProcessBatch(keySchedule, entries, kBatchSize, ot::Crypto::AesCcm::kEncrypt) ==
+                     OT_ERROR_NONE,
+                 "ProcessBatch() encrypt failed");
+    VerifyOrQuit(memcmp(frames, expected, sizeof(frames)) == 0, "ProcessBatch() encrypt does not match");
+
+    // Corrupt the tag of one frame, decrypt and verify that only this frame fails.
+
+    frames[3].mPsdu[kFrameLength - 1] ^= 0x01;
+
+    VerifyOrQuit(ot::Crypto::AesCcm::ProcessBatch(keySchedule, entries, kBatchSize, ot::Crypto::AesCcm::kDecrypt) ==
+                     OT_ERROR_SECURITY,
+                 "ProcessBatch() did not detect the corrupted tag");
+
+    for (uint16_t i = 0; i < kBatchSize; i++)
+    {
+        VerifyOrQuit(entries[i].mError == ((i == 3) ? OT_ERROR_SECURITY : OT_ERROR_NONE),
+                     "ProcessBatch() entry error is incorrect");
+        VerifyOrQuit(memcmp(frames[i].mPsdu, plain[i].mPsdu, kFrameHeaderLength + kFramePayloadLength) == 0,
+                     "ProcessBatch() decrypt does not match");
+    }
+
+    printf("TestAesCcmBatch passed\n");
+}
+
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+static void ProcessTasklets(ot::Instance &aInstance)
+{
+    while (otTaskletsArePending(&aInstance))
+    {
+        otTaskletsProcess(&aInstance);
+    }
+}
+
+/**
+ * Verifies the MAC key schedules kept by `KeyManager`.
+ */
+void TestMacKeySchedule(void)
+{
+    ot::Instance *            instance = static_cast<ot::Instance *>(testInitInstance());
+    ot::Crypto::AesCcm        aesCcm;
+    const ot::Crypto::AesEcb *keySchedule;
+    ot::Mac::Key              otherKey;
+    ot::MasterKey             masterKey;
+    TestFrame                 frame;
+    TestFrame                 expected;
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    ot::KeyManager &  keyManager = instance->Get<ot::KeyManager>();
+    ot::Mac::SubMac & subMac     = instance->Get<ot::Mac::SubMac>();
+    const ot::Mac::Key *keys[]   = {&subMac.GetPreviousMacKey(), &subMac.GetCurrentMacKey(), &subMac.GetNextMacKey()};
+
+    keyManager.SetCurrentKeySequence(10);
+    ProcessTasklets(*instance);
+
+    for (uint8_t i = 0; i < OT_ARRAY_LENGTH(keys); i++)
+    {
+        uint32_t keySequence = 9 + i;
+
+        keySchedule = keyManager.GetMacKeySchedule(keySequence, *keys[i]);
+        VerifyOrQuit(keySchedule != nullptr, "GetMacKeySchedule() failed");
+
+        InitTestFrames(&frame, 1);
+        expected = frame;
+
+        aesCcm.SetKey(*keys[i]);
+        ProcessTestFrame(aesCcm, expected, ot::Crypto::AesCcm::kEncrypt);
+
+        aesCcm.SetKey(*keySchedule);
+        ProcessTestFrame(aesCcm, frame, ot::Crypto::AesCcm::kEncrypt);
+
+        VerifyOrQuit(memcmp(frame.mPsdu, expected.mPsdu, sizeof(frame.mPsdu)) == 0,
+                     "MAC key schedule does not match the MAC key");
+    }
+
+    // Key sequences outside of (previous, current, next) and keys that do
+    // not match the key sequence are not cached.
+
+    VerifyOrQuit(keyManager.GetMacKeySchedule(8, *keys[0]) == nullptr, "GetMacKeySchedule() returned stale entry");
+    VerifyOrQuit(keyManager.GetMacKeySchedule(12, *keys[2]) == nullptr, "GetMacKeySchedule() returned stale entry");
+    VerifyOrQuit(keyManager.GetMacKeySchedule(10, *keys[0]) == nullptr, "GetMacKeySchedule() ignored the key");
+
+    memset(&otherKey, 0, sizeof(otherKey));
+    VerifyOrQuit(keyManager.GetMacKeySchedule(10, otherKey) == nullptr, "GetMacKeySchedule() ignored the key");
+
+    // The schedules follow the key sequence.
+
+    keyManager.SetCurrentKeySequence(11);
+    ProcessTasklets(*instance);
+
+    otherKey = subMac.GetNextMacKey();
+    VerifyOrQuit(keyManager.GetMacKeySchedule(12, otherKey) != nullptr, "GetMacKeySchedule() failed after key switch");
+
+    // A new master key invalidates all schedules.
+
+    memset(&masterKey, 0x5a, sizeof(masterKey));
+    SuccessOrQuit(keyManager.SetMasterKey(masterKey), "SetMasterKey() failed");
+    ProcessTasklets(*instance);
+
+    VerifyOrQuit(keyManager.GetMacKeySchedule(12, otherKey) == nullptr,
+                 "GetMacKeySchedule() returned stale entry after master key change");
+
+    testFreeInstance(instance);
+
+    printf("TestMacKeySchedule passed\n");
+}
+#endif
+
+/**
+ * Measures the AES-CCM frame rate when expanding the key per frame, when using a cached key schedule and when
+ * processing frames in batches.
+ */
+void BenchmarkAesCcm(void)
+{
+    enum
+    {
+        kNumFrames = 8192,
+    };
+
+    static TestFrame   frames[kBatchSize];
+    ot::Crypto::AesEcb keySchedule;
+    uint32_t           numFrames = 0;
+
+    InitTestFrames(frames, kBatchSize);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        ot::Crypto::AesCcm aesCcm;
+
+        aesCcm.SetKey(kKey, sizeof(kKey));
+        ProcessTestFrame(aesCcm, frames[i % kBatchSize], ot::Crypto::AesCcm::kEncrypt);
+    }
+
+    auto perFrameKeyDuration = std::chrono::steady_clock::now() - start;
+
+    keySchedule.SetKey(kKey, CHAR_BIT * sizeof(kKey));
+
+    start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < kNumFrames; i++)
+    {
+        ot::Crypto::AesCcm aesCcm;
+
+        aesCcm.SetKey(keySchedule);
+        ProcessTestFrame(aesCcm, frames[i % kBatchSize], ot::Crypto::AesCcm::kEncrypt);
+    }
+
+    auto keyScheduleDuration = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+
+    while (numFrames < kNumFrames)
+    {
+        ot::Crypto::AesCcm::BatchEntry entries[kBatchSize];
+
+        for (uint16_t i = 0; i < kBatchSize; i++)
+        {
+            InitBatchEntry(entries[i], frames[i]);
+        }
+
+        IgnoreError(ot::Crypto::AesCcm::ProcessBatch(keySchedule, entries, kBatchSize, ot::Crypto::AesCcm::kEncrypt));
+        numFrames += kBatchSize;
+    }
+
+    auto batchDuration = std::chrono::steady_clock::now() - start;
+
+    printf("AES-CCM %u byte frames: per-frame key %.0f frames/s, key schedule %.0f frames/s, batch of %u %.0f "
+           "frames/s\n",
+           kFrameLength, kNumFrames / std::chrono::duration<double>(perFrameKeyDuration).count(),
+           kNumFrames / std::chrono::duration<double>(keyScheduleDuration).count(), kBatchSize,
+           kNumFrames / std::chrono::duration<double>(batchDuration).count());
+}
+
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
+    TestAesCcmKeySchedule();
+    TestAesCcmBatch();
+#if OPENTHREAD_CONFIG_MAC_KEY_SCHEDULE_CACHE_ENABLE
+    TestMacKeySchedule();
+#endif
+    BenchmarkAesCcm();
     printf("All tests passed\n");
     return 0;
 }
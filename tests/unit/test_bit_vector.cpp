@@ -0,0 +1,128 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/bit_vector.hpp"
+#include "common/instance.hpp"
+#include "common/random.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+template <uint16_t N> void TestBitVector(void)
+{
+    BitVector<N> bitVector;
+    bool         reference[N];
+    uint16_t     numSet = 0;
+
+    printf("TestBitVector<%u>", N);
+
+    VerifyOrQuit(sizeof(bitVector) == (N + 7) / 8, "BitVector uses more RAM than needed");
+
+    bitVector.Clear();
+    memset(reference, 0, sizeof(reference));
+
+    VerifyOrQuit(!bitVector.HasAny(), "HasAny() failed after Clear()");
+    VerifyOrQuit(bitVector.GetNumSet() == 0, "GetNumSet() failed after Clear()");
+
+    for (uint16_t i = 0; i < 4 * N; i++)
+    {
+        uint16_t index = Random::NonCrypto::GetUint16() % N;
+        bool     value = (Random::NonCrypto::GetUint8() % 2) == 0;
+
+        bitVector.Set(index, value);
+        reference[index] = value;
+
+        numSet = 0;
+
+        for (uint16_t j = 0; j < N; j++)
+        {
+            VerifyOrQuit(bitVector.Get(j) == reference[j], "Get() failed");
+            numSet += reference[j] ? 1 : 0;
+        }
+
+        VerifyOrQuit(bitVector.GetNumSet() == numSet, "GetNumSet() failed");
+        VerifyOrQuit(bitVector.HasAny() == (numSet != 0), "HasAny() failed");
+
+        // `FindNextSet()` must visit exactly the set indexes, in order.
+
+        {
+            uint16_t next    = 0;
+            uint16_t visited = 0;
+
+            for (uint16_t index = 0; bitVector.FindNextSet(index); index++)
+            {
+                VerifyOrQuit(index < N, "FindNextSet() returned an out of range index");
+                VerifyOrQuit(reference[index], "FindNextSet() returned a clear index");
+
+                for (; next < index; next++)
+                {
+                    VerifyOrQuit(!reference[next], "FindNextSet() skipped a set index");
+                }
+
+                next = index + 1;
+                visited++;
+            }
+
+            VerifyOrQuit(visited == numSet, "FindNextSet() did not visit all set indexes");
+        }
+    }
+
+    for (uint16_t j = 0; j < N; j++)
+    {
+        bitVector.Set(j, true);
+    }
+
+    VerifyOrQuit(bitVector.GetNumSet() == N, "GetNumSet() failed with all indexes set");
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    otInstance *instance = testInitInstance();
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    ot::TestBitVector<1>();
+    ot::TestBitVector<10>();
+    ot::TestBitVector<32>();
+    ot::TestBitVector<33>();
+    ot::TestBitVector<511>();
+
+    testFreeInstance(instance);
+
+    printf("All tests passed\n");
+    return 0;
+}
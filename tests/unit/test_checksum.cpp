@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+
 #include "common/encoding.hpp"
 #include "common/instance.hpp"
 #include "common/message.hpp"
@@ -296,6 +298,125 @@ public:
         VerifyOrQuit(checksum.GetValue() == CalculateChecksum(kTestVector, sizeof(kTestVector)),
                      "Checksum::AddData() failed");
     }
+
+    static uint16_t CalculateScalar(const uint8_t *aBuffer, uint16_t aLength, bool aAtOddIndex)
+    {
+        // Calculates the checksum adding one byte at a time.
+
+        Checksum checksum;
+
+        checksum.mAtOddIndex = aAtOddIndex;
+
+        for (uint16_t i = 0; i < aLength; i++)
+        {
+            checksum.AddUint8(aBuffer[i]);
+        }
+
+        return checksum.GetValue();
+    }
+
+    static void TestAddDataEquivalence(void)
+    {
+        enum : uint16_t
+        {
+            kMaxLength     = 1500,
+            kNumIterations = 5000,
+        };
+
+        Instance *instance = static_cast<Instance *>(testInitInstance());
+        uint8_t   buffer[kMaxLength + sizeof(uint64_t)];
+
+        VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+        for (uint16_t iter = 0; iter < kNumIterations; iter++)
+        {
+            uint16_t length     = Random::NonCrypto::GetUint16InRange(0, kMaxLength + 1);
+            uint8_t  align      = Random::NonCrypto::GetUint8InRange(0, sizeof(uint64_t));
+            uint16_t split      = Random::NonCrypto::GetUint16InRange(0, length + 1);
+            bool     atOddIndex = (Random::NonCrypto::GetUint8() & 1) != 0;
+            uint8_t *data       = &buffer[align];
+            Checksum checksum;
+
+            // Mostly use random data, but also include all-ones data
+            // to exercise the carry handling.
+
+            if ((iter % 4) == 0)
+            {
+                memset(data, 0xff, length);
+            }
+            else
+            {
+                Random::NonCrypto::FillBuffer(data, length);
+            }
+
+            // Add the data in two parts (split at a random index) on a
+            // possibly unaligned address and odd starting index.
+
+            checksum.mAtOddIndex = atOddIndex;
+            checksum.AddData(data, split);
+            checksum.AddData(data + split, length - split);
+
+            VerifyOrQuit(checksum.GetValue() == CalculateScalar(data, length, atOddIndex),
+                         "Checksum::AddData() does not match scalar calculation");
+            VerifyOrQuit(checksum.mAtOddIndex == (atOddIndex != ((length % 2) != 0)),
+                         "Checksum::AddData() odd index is incorrect");
+
+            if (!atOddIndex)
+            {
+                VerifyOrQuit(checksum.GetValue() == CalculateChecksum(data, length),
+                             "Checksum::AddData() does not match RFC-1071 calculation");
+            }
+        }
+
+        testFreeInstance(instance);
+    }
+
+    static void BenchmarkAddData(void)
+    {
+        enum : uint16_t
+        {
+            kLength        = 1280,
+            kNumIterations = 20000,
+        };
+
+        Instance *instance    = static_cast<Instance *>(testInitInstance());
+        uint8_t   buffer[kLength];
+        uint16_t  scalarValue = 0;
+        uint16_t  value       = 0;
+
+        VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+        Random::NonCrypto::FillBuffer(buffer, sizeof(buffer));
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t i = 0; i < kNumIterations; i++)
+        {
+            scalarValue ^= CalculateScalar(buffer, kLength, false);
+        }
+
+        auto scalarDuration = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+
+        for (uint16_t i = 0; i < kNumIterations; i++)
+        {
+            Checksum checksum;
+
+            checksum.AddData(buffer, kLength);
+            value ^= checksum.GetValue();
+        }
+
+        auto duration = std::chrono::steady_clock::now() - start;
+
+        VerifyOrQuit(value == scalarValue, "Checksum::AddData() does not match scalar calculation");
+
+        printf("Checksum over %u bytes: scalar %.1f ns, word-at-a-time %.1f ns\n", kLength,
+               std::chrono::duration<double, std::nano>(scalarDuration).count() / kNumIterations,
+               std::chrono::duration<double, std::nano>(duration).count() / kNumIterations);
+
+        testFreeInstance(instance);
+    }
 };
 
 } // namespace ot
@@ -303,6 +424,8 @@ public:
 int main(void)
 {
     ot::ChecksumTester::TestExampleVector();
+    ot::ChecksumTester::TestAddDataEquivalence();
+    ot::ChecksumTester::BenchmarkAddData();
     ot::TestUdpMessageChecksum();
     ot::TestIcmp6MessageChecksum();
     printf("All tests passed\n");
@@ -28,11 +28,14 @@
 
 #include "test_platform.h"
 
+#include <chrono>
+
 #include <openthread/config.h>
 
 #include "test_util.h"
 #include "common/code_utils.hpp"
 #include "common/instance.hpp"
+#include "common/random.hpp"
 #include "thread/child_table.hpp"
 
 namespace ot {
@@ -41,7 +44,9 @@ static ot::Instance *sInstance;
 
 enum
 {
-    kMaxChildren = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+    kMaxChildren  = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+    kNumLookups   = 20000,
+    kNumRandomOps = 2000,
 };
 
 struct TestChild
@@ -392,11 +397,208 @@ void TestChildTable(void)
     testFreeInstance(sInstance);
 }
 
+// Finds a child by scanning the whole child table (reference for the indexed lookups).
+static bool ChildMatchesAddress(const Child &aChild, const Mac::Address &aAddress, Child::StateFilter aFilter)
+{
+    return aChild.MatchesFilter(aFilter) && (aAddress.IsShort() ? (aChild.GetRloc16() == aAddress.GetShort())
+                                                                 : (aChild.GetExtAddress() == aAddress.GetExtended()));
+}
+
+static Child *FindChildByScan(ChildTable &aTable, const Mac::Address &aAddress, Child::StateFilter aFilter)
+{
+    Child *child = nullptr;
+
+    for (uint16_t index = 0; index < aTable.GetMaxChildrenAllowed(); index++)
+    {
+        Child *entry = aTable.GetChildAtIndex(index);
+
+        if (ChildMatchesAddress(*entry, aAddress, aFilter))
+        {
+            child = entry;
+            break;
+        }
+    }
+
+    return child;
+}
+
+static void GenerateExtAddress(Mac::ExtAddress &aExtAddress, uint16_t aSeed)
+{
+    memset(&aExtAddress, 0, sizeof(aExtAddress));
+    aExtAddress.m8[0] = 0x12;
+    aExtAddress.m8[6] = static_cast<uint8_t>(aSeed >> 8);
+    aExtAddress.m8[7] = static_cast<uint8_t>(aSeed & 0xff);
+}
+
+static void VerifyLookupsMatchScan(ChildTable &aTable, const Mac::Address &aAddress)
+{
+    for (Child::StateFilter filter : kAllFilters)
+    {
+        Child *child = aTable.FindChild(aAddress, filter);
+
+        // With duplicate addresses, any matching entry may be returned.
+
+        if (FindChildByScan(aTable, aAddress, filter) == nullptr)
+        {
+            VerifyOrQuit(child == nullptr, "FindChild() found a child not found by a full table scan");
+        }
+        else
+        {
+            VerifyOrQuit(child != nullptr, "FindChild() failed to find a child found by a full table scan");
+            VerifyOrQuit(ChildMatchesAddress(*child, aAddress, filter), "FindChild() returned incorrect child");
+        }
+    }
+}
+
+void TestChildTableIndex(void)
+{
+    // Children are re-addressed, removed and re-added at random and all
+    // lookups are checked against a full table scan.
+
+    const Child::State kStates[] = {Child::kStateValid, Child::kStateRestored, Child::kStateParentRequest,
+                                    Child::kStateChildIdRequest, Child::kStateInvalid};
+
+    ChildTable *table;
+
+    printf("Test ChildTable index against full table scan");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    table = &sInstance->Get<ChildTable>();
+
+    for (uint16_t i = 0; i < kNumRandomOps; i++)
+    {
+        Child *         child = table->GetChildAtIndex(Random::NonCrypto::GetUint16() % kMaxChildren);
+        Mac::ExtAddress extAddress;
+        Mac::Address    address;
+
+        switch (Random::NonCrypto::GetUint8() % 4)
+        {
+        case 0:
+            // Use a small range of Child IDs and extended addresses so
+            // that entries often share a Child ID or an address.
+            child->SetRloc16(0x0401 + (Random::NonCrypto::GetUint16() % (2 * kMaxChildren)));
+            break;
+
+        case 1:
+            GenerateExtAddress(extAddress, Random::NonCrypto::GetUint16() % (2 * kMaxChildren));
+            child->SetExtAddress(extAddress);
+            break;
+
+        case 2:
+            child->SetState(kStates[Random::NonCrypto::GetUint8() % OT_ARRAY_LENGTH(kStates)]);
+            break;
+
+        case 3:
+            if ((child = table->GetNewChild()) != nullptr)
+            {
+                child->SetState(Child::kStateValid);
+                GenerateExtAddress(extAddress, i);
+                child->SetExtAddress(extAddress);
+                child->SetRloc16(0x0401 + (i % (2 * kMaxChildren)));
+            }
+            break;
+        }
+
+        for (uint16_t seed = 0; seed < 2 * kMaxChildren; seed++)
+        {
+            address.SetShort(0x0401 + seed);
+            VerifyLookupsMatchScan(*table, address);
+
+            GenerateExtAddress(extAddress, seed);
+            address.SetExtended(extAddress);
+            VerifyLookupsMatchScan(*table, address);
+        }
+    }
+
+    table->Clear();
+
+    for (Child::StateFilter filter : kAllFilters)
+    {
+        VerifyOrQuit(!table->HasChildren(filter), "HasChildren() failed after Clear()");
+    }
+
+    testFreeInstance(sInstance);
+
+    printf(" -- PASS\n");
+}
+
+void BenchmarkChildTable(void)
+{
+    ChildTable *    table;
+    Mac::ExtAddress extAddress;
+    Mac::Address    addresses[kMaxChildren];
+    uint32_t        hash     = 0;
+    uint32_t        scanHash = 0;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    table = &sInstance->Get<ChildTable>();
+
+    for (uint16_t i = 0; i < kMaxChildren; i++)
+    {
+        Child *child = table->GetNewChild();
+
+        VerifyOrQuit(child != nullptr, "GetNewChild() failed");
+        child->SetState(Child::kStateValid);
+        child->SetRloc16(0x0401 + i);
+        GenerateExtAddress(extAddress, i);
+        child->SetExtAddress(extAddress);
+
+        // Alternate between RLOC16 and extended address lookups, as
+        // done for received frames.
+        if (i % 2)
+        {
+            addresses[i].SetShort(child->GetRloc16());
+        }
+        else
+        {
+            addresses[i].SetExtended(extAddress);
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint16_t i = 0; i < kNumLookups; i++)
+    {
+        for (const Mac::Address &address : addresses)
+        {
+            scanHash += FindChildByScan(*table, address, Child::kInStateAnyExceptInvalid)->GetRloc16();
+        }
+    }
+
+    auto scanDuration = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+
+    for (uint16_t i = 0; i < kNumLookups; i++)
+    {
+        for (const Mac::Address &address : addresses)
+        {
+            hash += table->FindChild(address, Child::kInStateAnyExceptInvalid)->GetRloc16();
+        }
+    }
+
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    VerifyOrQuit(hash == scanHash, "FindChild() does not match full table scan");
+
+    printf("Child lookup with %d children: full scan %.1f ns, indexed %.1f ns\n", kMaxChildren,
+           std::chrono::duration<double, std::nano>(scanDuration).count() / (kNumLookups * kMaxChildren),
+           std::chrono::duration<double, std::nano>(duration).count() / (kNumLookups * kMaxChildren));
+
+    testFreeInstance(sInstance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestChildTable();
+    ot::TestChildTableIndex();
+    ot::BenchmarkChildTable();
     printf("\nAll tests passed.\n");
     return 0;
 }
@@ -0,0 +1,843 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <chrono>
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "coap/coap.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/uri_paths.hpp"
+
+namespace ot {
+
+enum
+{
+    kMaxPendingRequests = OPENTHREAD_CONFIG_COAP_MAX_PENDING_REQUESTS,
+    kNumRequests        = kMaxPendingRequests + 8, // Requests beyond the pending request entries are unindexed.
+    kTokenLength        = 4,
+    kPeerPort           = 61631,
+    kNumDispatchRounds  = 20000,
+    kMaxCachedResponses = OPENTHREAD_CONFIG_COAP_SERVER_MAX_CACHED_RESPONSES,
+    kResourceIndexSize  = 64,
+};
+
+static const char *const kUriPaths[] = {
+    UriPath::kAddressQuery, UriPath::kAddressNotify, UriPath::kAddressError, UriPath::kAddressRelease,
+    UriPath::kAddressSolicit, UriPath::kActiveGet, UriPath::kActiveSet, UriPath::kDatasetChanged, UriPath::kEnergyScan,
+    UriPath::kEnergyReport, UriPath::kPendingGet, UriPath::kPendingSet, UriPath::kServerData, UriPath::kAnnounceBegin,
+    UriPath::kProxyRx, UriPath::kProxyTx, UriPath::kRelayRx, UriPath::kRelayTx, UriPath::kJoinerFinalize,
+    UriPath::kJoinerEntrust, UriPath::kLeaderPetition, UriPath::kLeaderKeepAlive, UriPath::kPanIdConflict,
+    UriPath::kPanIdQuery, UriPath::kCommissionerGet, UriPath::kCommissionerKeepAlive, UriPath::kCommissionerPetition,
+    UriPath::kCommissionerSet, UriPath::kDiagnosticGetRequest, UriPath::kDiagnosticGetQuery,
+    UriPath::kDiagnosticGetAnswer, UriPath::kDiagnosticReset, UriPath::kMlr, UriPath::kDuaRegistrationRequest,
+    UriPath::kDuaRegistrationNotify, UriPath::kBackboneQuery, UriPath::kBackboneAnswer, UriPath::kBackboneMlr,
+    "app/sensors/temperature", "app/sensors/humidity", "app/lights/1", "app/lights/2",
+};
+
+struct RequestResult
+{
+    uint16_t mMessageId;     // Message ID assigned when the request was sent.
+    uint16_t mTransmissions; // Number of times the request was passed to the sender.
+    uint16_t mHandlerCalls;  // Number of times the response handler was invoked.
+    otError  mResult;        // The result passed to the response handler.
+};
+
+static Instance *    sInstance;
+static RequestResult sResults[kNumRequests];
+static uint16_t      sLastMessageId;
+static uint32_t      sNow;
+static uint32_t      sAlarmFireTime;
+static bool          sAlarmOn;
+
+static void TestAlarmStop(otInstance *)
+{
+    sAlarmOn = false;
+}
+
+static void TestAlarmStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn       = true;
+    sAlarmFireTime = aT0 + aDt;
+}
+
+static uint32_t TestAlarmGetNow(void)
+{
+    return sNow;
+}
+
+static void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t end = sNow + aDuration;
+
+    while (sNow != end)
+    {
+        sNow++;
+
+        if (sAlarmOn && (static_cast<int32_t>(sNow - sAlarmFireTime) >= 0))
+        {
+            sAlarmOn = false;
+            otPlatAlarmMilliFired(sInstance);
+        }
+    }
+}
+
+static void SetRequestToken(Coap::Message &aMessage, uint16_t aIndex)
+{
+    uint8_t token[kTokenLength] = {static_cast<uint8_t>(aIndex >> 8), static_cast<uint8_t>(aIndex & 0xff), 0x5a,
+                                   0xa5};
+
+    SuccessOrQuit(aMessage.SetToken(token, sizeof(token)), "SetToken() failed");
+}
+
+class TestCoap : public Coap::CoapBase
+{
+public:
+    explicit TestCoap(Instance &aInstance)
+        : Coap::CoapBase(aInstance, &TestCoap::Send)
+    {
+    }
+
+    using Coap::CoapBase::Receive;
+
+    void SetResourceIndexSize(uint16_t aNumSlots)
+    {
+        VerifyOrQuit(aNumSlots <= kResourceIndexSize, "resource index size is too large");
+        SetResourceIndex(mResourceIndexSlots, aNumSlots);
+    }
+
+private:
+    const Coap::Resource *mResourceIndexSlots[kResourceIndexSize];
+
+    static otError Send(CoapBase &, ot::Message &aMessage, const Ip6::MessageInfo &)
+    {
+        Coap::Message &message = static_cast<Coap::Message &>(aMessage);
+
+        SuccessOrQuit(message.ParseHeader(), "ParseHeader() failed on a sent message");
+
+        if (message.IsConfirmable() && (message.GetTokenLength() == kTokenLength))
+        {
+            const uint8_t *token = static_cast<const Coap::Message &>(message).GetToken();
+            uint16_t       index = static_cast<uint16_t>((token[0] << 8) | token[1]);
+
+            if (index < kNumRequests)
+            {
+                sResults[index].mTransmissions++;
+            }
+        }
+
+        sLastMessageId = message.GetMessageId();
+        message.Free();
+
+        return OT_ERROR_NONE;
+    }
+};
+
+static uint32_t sRequestCounts[OT_ARRAY_LENGTH(kUriPaths)];
+static uint32_t sDefaultHandlerCount;
+
+static void HandleRequest(void *aContext, otMessage *, const otMessageInfo *)
+{
+    sRequestCounts[reinterpret_cast<uintptr_t>(aContext)]++;
+}
+
+static void HandleDefaultRequest(void *, otMessage *, const otMessageInfo *)
+{
+    sDefaultHandlerCount++;
+}
+
+static void HandleResponse(void *aContext, otMessage *, const otMessageInfo *, otError aResult)
+{
+    RequestResult *result = static_cast<RequestResult *>(aContext);
+
+    result->mHandlerCalls++;
+    result->mResult = aResult;
+}
+
+static void PrepareMessageInfo(Ip6::MessageInfo &aMessageInfo)
+{
+    SuccessOrQuit(aMessageInfo.GetPeerAddr().FromString("fd00::1234"), "FromString() failed");
+    SuccessOrQuit(aMessageInfo.GetSockAddr().FromString("fd00::1"), "FromString() failed");
+    aMessageInfo.SetPeerPort(kPeerPort);
+}
+
+static void SendRequests(TestCoap &aCoap, const Ip6::MessageInfo &aMessageInfo)
+{
+    memset(sResults, 0, sizeof(sResults));
+
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        Coap::Message *message = aCoap.NewMessage();
+
+        VerifyOrQuit(message != nullptr, "NewMessage() failed");
+        message->Init(Coap::kTypeConfirmable, Coap::kCodePost);
+        SetRequestToken(*message, i);
+
+        SuccessOrQuit(aCoap.SendMessage(*message, aMessageInfo, HandleResponse, &sResults[i]), "SendMessage() failed");
+        sResults[i].mMessageId = sLastMessageId;
+    }
+}
+
+static void ReceiveResponse(TestCoap &              aCoap,
+                            const Ip6::MessageInfo &aMessageInfo,
+                            Coap::Type              aType,
+                            Coap::Code              aCode,
+                            uint16_t                aMessageId,
+                            int32_t                 aTokenIndex)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != nullptr, "NewMessage() failed");
+    message->Init(aType, aCode);
+    message->SetMessageId(aMessageId);
+
+    if (aTokenIndex >= 0)
+    {
+        SetRequestToken(*message, static_cast<uint16_t>(aTokenIndex));
+    }
+
+    message->Finish();
+    aCoap.Receive(*message, aMessageInfo);
+    message->Free();
+}
+
+void TestCoapResponseMatching(void)
+{
+    TestCoap *       coap;
+    Ip6::MessageInfo messageInfo;
+    Ip6::MessageInfo otherPeerInfo;
+    RequestResult    lateResult;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    coap = new TestCoap(*sInstance);
+    PrepareMessageInfo(messageInfo);
+    PrepareMessageInfo(otherPeerInfo);
+    otherPeerInfo.SetPeerPort(kPeerPort + 1);
+
+    SendRequests(*coap, messageInfo);
+
+    // Responses from another peer, with an unknown token or an
+    // unknown message ID must not match any pending request.
+
+    ReceiveResponse(*coap, otherPeerInfo, Coap::kTypeAck, Coap::kCodeChanged, sResults[0].mMessageId, 0);
+    ReceiveResponse(*coap, messageInfo, Coap::kTypeNonConfirmable, Coap::kCodeChanged, 0, kNumRequests);
+    ReceiveResponse(*coap, messageInfo, Coap::kTypeAck, Coap::kCodeEmpty, sResults[0].mMessageId + kNumRequests, -1);
+
+    for (const RequestResult &result : sResults)
+    {
+        VerifyOrQuit(result.mHandlerCalls == 0, "unrelated response matched a pending request");
+    }
+
+    // Answer the requests in reverse order, alternating piggybacked
+    // responses with empty ACKs followed by separate responses.
+
+    for (int32_t i = kNumRequests - 1; i >= 0; i--)
+    {
+        RequestResult &result = sResults[i];
+
+        if (i % 2 == 0)
+        {
+            ReceiveResponse(*coap, messageInfo, Coap::kTypeAck, Coap::kCodeChanged, result.mMessageId, i);
+        }
+        else
+        {
+            ReceiveResponse(*coap, messageInfo, Coap::kTypeAck, Coap::kCodeEmpty, result.mMessageId, -1);
+            VerifyOrQuit(result.mHandlerCalls == 0, "empty ACK finalized the transaction");
+            ReceiveResponse(*coap, messageInfo, Coap::kTypeNonConfirmable, Coap::kCodeChanged, 0, i);
+        }
+
+        VerifyOrQuit(result.mHandlerCalls == 1, "response did not match its request");
+        VerifyOrQuit(result.mResult == OT_ERROR_NONE, "response handler got an unexpected result");
+    }
+
+    VerifyOrQuit(coap->GetRequestMessages().GetHead() == nullptr, "pending requests are not empty");
+
+    // A response whose token matches several pending requests goes to
+    // the oldest one, whether it is indexed or not. Once the oldest
+    // request completes, its freed entry indexes a new request which
+    // is newer than the unindexed ones.
+
+    memset(sResults, 0, sizeof(sResults));
+    memset(&lateResult, 0, sizeof(lateResult));
+
+    for (RequestResult &result : sResults)
+    {
+        Coap::Message *message = coap->NewMessage();
+
+        VerifyOrQuit(message != nullptr, "NewMessage() failed");
+        message->Init(Coap::kTypeConfirmable, Coap::kCodePost);
+        SetRequestToken(*message, 0);
+        SuccessOrQuit(coap->SendMessage(*message, messageInfo, HandleResponse, &result), "SendMessage() failed");
+    }
+
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        ReceiveResponse(*coap, messageInfo, Coap::kTypeNonConfirmable, Coap::kCodeChanged, 0, 0);
+
+        for (uint16_t j = 0; j < kNumRequests; j++)
+        {
+            VerifyOrQuit(sResults[j].mHandlerCalls == ((j <= i) ? 1 : 0), "response did not match the oldest request");
+        }
+
+        VerifyOrQuit(lateResult.mHandlerCalls == 0, "response matched a newer request");
+
+        if (i == 0)
+        {
+            Coap::Message *message = coap->NewMessage();
+
+            VerifyOrQuit(message != nullptr, "NewMessage() failed");
+            message->Init(Coap::kTypeConfirmable, Coap::kCodePost);
+            SetRequestToken(*message, 0);
+            SuccessOrQuit(coap->SendMessage(*message, messageInfo, HandleResponse, &lateResult),
+                          "SendMessage() failed");
+        }
+    }
+
+    ReceiveResponse(*coap, messageInfo, Coap::kTypeNonConfirmable, Coap::kCodeChanged, 0, 0);
+    VerifyOrQuit(lateResult.mHandlerCalls == 1, "response did not match the last request");
+    VerifyOrQuit(coap->GetRequestMessages().GetHead() == nullptr, "pending requests are not empty");
+
+    // Requests beyond the pending request entries (the 17th and later
+    // with the default configuration) do not fail and are all aborted
+    // along with the indexed ones.
+
+    SendRequests(*coap, messageInfo);
+    coap->ClearRequestsAndResponses();
+    VerifyOrQuit(coap->GetRequestMessages().GetHead() == nullptr, "pending requests are not empty");
+
+    for (const RequestResult &result : sResults)
+    {
+        VerifyOrQuit(result.mHandlerCalls == 1, "pending request was not aborted");
+        VerifyOrQuit(result.mResult == OT_ERROR_ABORT, "response handler got an unexpected result");
+    }
+
+    delete coap;
+    testFreeInstance(sInstance);
+
+    printf("TestCoapResponseMatching passed\n");
+}
+
+void TestCoapRetransmission(void)
+{
+    const uint8_t    kMaxRetransmit = Coap::TxParameters::GetDefault().mMaxRetransmit;
+    TestCoap *       coap;
+    Ip6::MessageInfo messageInfo;
+
+    g_testPlatAlarmStop    = TestAlarmStop;
+    g_testPlatAlarmStartAt = TestAlarmStartAt;
+    g_testPlatAlarmGetNow  = TestAlarmGetNow;
+
+    sNow     = 0;
+    sAlarmOn = false;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    coap = new TestCoap(*sInstance);
+    PrepareMessageInfo(messageInfo);
+
+    SendRequests(*coap, messageInfo);
+
+    // The first (indexed) and last (unindexed) requests get
+    // acknowledged, so they must not be retransmitted but still time
+    // out waiting for their response.
+
+    ReceiveResponse(*coap, messageInfo, Coap::kTypeAck, Coap::kCodeEmpty, sResults[0].mMessageId, -1);
+    ReceiveResponse(*coap, messageInfo, Coap::kTypeAck, Coap::kCodeEmpty, sResults[kNumRequests - 1].mMessageId, -1);
+
+    AdvanceTime(1000);
+
+    for (const RequestResult &result : sResults)
+    {
+        VerifyOrQuit(result.mTransmissions == 1, "request retransmitted before its timeout");
+    }
+
+    // Maximum wait is `ACK_TIMEOUT * ACK_RANDOM_FACTOR * (2^(MAX_RETRANSMIT + 1) - 1)`.
+
+    AdvanceTime(3000 * ((1u << (kMaxRetransmit + 1)) - 1));
+
+    for (uint16_t i = 0; i < kNumRequests; i++)
+    {
+        const RequestResult &result = sResults[i];
+
+        VerifyOrQuit(result.mTransmissions == (((i == 0) || (i == kNumRequests - 1)) ? 1 : 1 + kMaxRetransmit),
+                     "unexpected number of transmissions");
+        VerifyOrQuit(result.mHandlerCalls == 1, "request did not time out");
+        VerifyOrQuit(result.mResult == OT_ERROR_RESPONSE_TIMEOUT, "response handler got an unexpected result");
+    }
+
+    VerifyOrQuit(coap->GetRequestMessages().GetHead() == nullptr, "pending requests are not empty");
+    VerifyOrQuit(!sAlarmOn, "retransmission timer still running");
+
+    delete coap;
+    testFreeInstance(sInstance);
+
+    g_testPlatAlarmStop    = nullptr;
+    g_testPlatAlarmStartAt = nullptr;
+    g_testPlatAlarmGetNow  = nullptr;
+
+    printf("TestCoapRetransmission passed\n");
+}
+
+static Coap::Message *NewRequest(TestCoap &aCoap, const char *aUriPath)
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != nullptr, "NewMessage() failed");
+    SuccessOrQuit(message->Init(Coap::kTypeNonConfirmable, Coap::kCodePost, aUriPath), "Init() failed");
+    message->SetMessageId(0);
+    message->Finish();
+
+    return message;
+}
+
+static void ReceiveRequest(TestCoap &aCoap, Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    aMessage.SetOffset(0);
+    aCoap.Receive(aMessage, aMessageInfo);
+}
+
+static void ReceiveRequest(TestCoap &aCoap, const char *aUriPath, const Ip6::MessageInfo &aMessageInfo)
+{
+    Coap::Message *message = NewRequest(aCoap, aUriPath);
+
+    ReceiveRequest(aCoap, *message, aMessageInfo);
+    message->Free();
+}
+
+static void VerifyRequestCounts(const uint32_t (&aExpected)[OT_ARRAY_LENGTH(kUriPaths)], uint32_t aExpectedDefault)
+{
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(kUriPaths); i++)
+    {
+        VerifyOrQuit(sRequestCounts[i] == aExpected[i], "request dispatched to the wrong resource");
+    }
+
+    VerifyOrQuit(sDefaultHandlerCount == aExpectedDefault, "default handler call count is incorrect");
+}
+
+void TestCoapResourceDispatch(uint16_t aResourceIndexSize)
+{
+    TestCoap *       coap;
+    Ip6::MessageInfo messageInfo;
+    Coap::Resource * resources[OT_ARRAY_LENGTH(kUriPaths)];
+    uint32_t         expected[OT_ARRAY_LENGTH(kUriPaths)];
+    uint32_t         expectedDefault = 0;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    coap = new TestCoap(*sInstance);
+    coap->SetResourceIndexSize(aResourceIndexSize);
+    PrepareMessageInfo(messageInfo);
+    coap->SetDefaultHandler(HandleDefaultRequest, nullptr);
+
+    memset(sRequestCounts, 0, sizeof(sRequestCounts));
+    memset(expected, 0, sizeof(expected));
+    sDefaultHandlerCount = 0;
+
+    for (uintptr_t i = 0; i < OT_ARRAY_LENGTH(kUriPaths); i++)
+    {
+        resources[i] = new Coap::Resource(kUriPaths[i], HandleRequest, reinterpret_cast<void *>(i));
+        coap->AddResource(*resources[i]);
+    }
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(kUriPaths); i++)
+    {
+        ReceiveRequest(*coap, kUriPaths[i], messageInfo);
+        expected[i]++;
+    }
+
+    // The hash mixed in while reading the Uri-Path options matches the
+    // hash of the URI path string the resources are indexed by.
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(kUriPaths); i++)
+    {
+        Coap::Message *message = NewRequest(*coap, kUriPaths[i]);
+        char           uriPath[Coap::Message::kMaxReceivedUriPath + 1];
+        Fnv1aHash      optionsHash;
+        Fnv1aHash      stringHash;
+
+        SuccessOrQuit(message->ReadUriPathOptions(uriPath, optionsHash), "ReadUriPathOptions() failed");
+        stringHash.UpdateString(kUriPaths[i]);
+        VerifyOrQuit(strcmp(uriPath, kUriPaths[i]) == 0, "URI path read from the options is incorrect");
+        VerifyOrQuit(optionsHash.GetHash() == stringHash.GetHash(), "URI path hash differs from the string hash");
+        message->Free();
+    }
+
+    // Paths which are prefixes or extensions of registered paths, or
+    // not registered at all, go to the default handler.
+
+    ReceiveRequest(*coap, "a", messageInfo);
+    ReceiveRequest(*coap, "a/aqx", messageInfo);
+    ReceiveRequest(*coap, "app/lights", messageInfo);
+    ReceiveRequest(*coap, "app/lights/1/on", messageInfo);
+    ReceiveRequest(*coap, "z/zz", messageInfo);
+    expectedDefault += 5;
+
+    VerifyRequestCounts(expected, expectedDefault);
+
+    // A resource added later with the same URI path takes precedence
+    // until it is removed again.
+
+    {
+        Coap::Resource duplicate(kUriPaths[3], HandleRequest, reinterpret_cast<void *>(0));
+
+        coap->AddResource(duplicate);
+        ReceiveRequest(*coap, kUriPaths[3], messageInfo);
+        expected[0]++;
+        VerifyRequestCounts(expected, expectedDefault);
+
+        coap->RemoveResource(duplicate);
+        ReceiveRequest(*coap, kUriPaths[3], messageInfo);
+        expected[3]++;
+        VerifyRequestCounts(expected, expectedDefault);
+    }
+
+    // Removed resources are no longer dispatched to.
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(kUriPaths); i += 2)
+    {
+        coap->RemoveResource(*resources[i]);
+    }
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(kUriPaths); i++)
+    {
+        ReceiveRequest(*coap, kUriPaths[i], messageInfo);
+
+        if (i % 2 == 0)
+        {
+            expectedDefault++;
+        }
+        else
+        {
+            expected[i]++;
+        }
+    }
+
+    VerifyRequestCounts(expected, expectedDefault);
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(kUriPaths); i++)
+    {
+        coap->RemoveResource(*resources[i]);
+        delete resources[i];
+    }
+
+    delete coap;
+    testFreeInstance(sInstance);
+
+    printf("TestCoapResourceDispatch(%u) passed\n", aResourceIndexSize);
+}
+
+static TestCoap *sCacheCoap;
+static uint32_t  sCacheHandlerCount;
+
+static void HandleCachedRequest(void *, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    sCacheHandlerCount++;
+    SuccessOrQuit(sCacheCoap->SendEmptyAck(*static_cast<Coap::Message *>(aMessage),
+                                           *static_cast<const Ip6::MessageInfo *>(aMessageInfo)),
+                  "SendEmptyAck() failed");
+}
+
+static void HandleLongLifetimeRequest(void *, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    // About 1610 seconds of exchange lifetime.
+    static const otCoapTxParameters kTxParameters = {60000, 3, 2, 4};
+
+    Coap::Message *response = sCacheCoap->NewMessage();
+
+    sCacheHandlerCount++;
+    VerifyOrQuit(response != nullptr, "NewMessage() failed");
+    SuccessOrQuit(response->SetDefaultResponseHeader(*static_cast<Coap::Message *>(aMessage)),
+                  "SetDefaultResponseHeader() failed");
+    SuccessOrQuit(sCacheCoap->SendMessage(*response, *static_cast<const Ip6::MessageInfo *>(aMessageInfo),
+                                          Coap::TxParameters::From(&kTxParameters)),
+                  "SendMessage() failed");
+}
+
+static void ReceiveConfirmableRequest(TestCoap &              aCoap,
+                                      uint16_t                aMessageId,
+                                      const Ip6::MessageInfo &aMessageInfo,
+                                      const char *            aUriPath = "a/cache")
+{
+    Coap::Message *message = aCoap.NewMessage();
+
+    VerifyOrQuit(message != nullptr, "NewMessage() failed");
+    SuccessOrQuit(message->Init(Coap::kTypeConfirmable, Coap::kCodePost, aUriPath), "Init() failed");
+    message->SetMessageId(aMessageId);
+    message->Finish();
+
+    aCoap.Receive(*message, aMessageInfo);
+    message->Free();
+}
+
+static void VerifyResponseCacheCounters(const TestCoap &aCoap, uint32_t aHits, uint32_t aMisses, uint32_t aEvictions)
+{
+    const otCoapResponseCacheCounters &counters = aCoap.GetResponseCacheCounters();
+
+    VerifyOrQuit(counters.mHits == aHits, "response cache hit count is incorrect");
+    VerifyOrQuit(counters.mMisses == aMisses, "response cache miss count is incorrect");
+    VerifyOrQuit(counters.mEvictions == aEvictions, "response cache eviction count is incorrect");
+}
+
+void TestCoapResponseCache(void)
+{
+    const uint32_t   kExchangeLifetime     = 247000;
+    const uint32_t   kMaxCacheLifetime     = 31 * 8192; // Span of the response cache expiry wheel less one tick.
+    const uint32_t   kLongExchangeLifetime = 1610000;    // Exchange lifetime of `HandleLongLifetimeRequest()`.
+    Ip6::MessageInfo messageInfo;
+    Ip6::MessageInfo otherPeerInfo;
+    uint32_t         misses = 0;
+
+    g_testPlatAlarmStop    = TestAlarmStop;
+    g_testPlatAlarmStartAt = TestAlarmStartAt;
+    g_testPlatAlarmGetNow  = TestAlarmGetNow;
+
+    sNow     = 0;
+    sAlarmOn = false;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    sCacheCoap = new TestCoap(*sInstance);
+    PrepareMessageInfo(messageInfo);
+    PrepareMessageInfo(otherPeerInfo);
+    otherPeerInfo.SetPeerPort(kPeerPort + 1);
+
+    Coap::Resource resource("a/cache", HandleCachedRequest, nullptr);
+    Coap::Resource longLifetimeResource("a/long", HandleLongLifetimeRequest, nullptr);
+
+    sCacheCoap->AddResource(resource);
+    sCacheCoap->AddResource(longLifetimeResource);
+    sCacheHandlerCount = 0;
+
+    // Fill the cache, one response per millisecond so that the
+    // responses expire in the order they were added.
+
+    for (uint16_t i = 0; i < kMaxCachedResponses; i++)
+    {
+        ReceiveConfirmableRequest(*sCacheCoap, i, messageInfo);
+        VerifyOrQuit(sCacheHandlerCount == ++misses, "request was not handled");
+        AdvanceTime(1);
+    }
+
+    VerifyResponseCacheCounters(*sCacheCoap, 0, misses, 0);
+
+    // Retransmitted requests are answered from the cache.
+
+    for (uint16_t i = 0; i < kMaxCachedResponses; i++)
+    {
+        ReceiveConfirmableRequest(*sCacheCoap, i, messageInfo);
+        VerifyOrQuit(sLastMessageId == i, "cached response has the wrong message ID");
+    }
+
+    VerifyOrQuit(sCacheHandlerCount == misses, "duplicate request was handled again");
+    VerifyResponseCacheCounters(*sCacheCoap, kMaxCachedResponses, misses, 0);
+
+    // The same message ID from another peer is a new request, and
+    // with the cache full it evicts the oldest response.
+
+    ReceiveConfirmableRequest(*sCacheCoap, 0, otherPeerInfo);
+    VerifyOrQuit(sCacheHandlerCount == ++misses, "request from another peer was not handled");
+    VerifyResponseCacheCounters(*sCacheCoap, kMaxCachedResponses, misses, 1);
+
+    ReceiveConfirmableRequest(*sCacheCoap, 0, messageInfo);
+    VerifyOrQuit(sCacheHandlerCount == ++misses, "evicted response was still served");
+    VerifyResponseCacheCounters(*sCacheCoap, kMaxCachedResponses, misses, 2);
+
+    ReceiveConfirmableRequest(*sCacheCoap, kMaxCachedResponses - 1, messageInfo);
+    ReceiveConfirmableRequest(*sCacheCoap, 0, otherPeerInfo);
+    VerifyOrQuit(sCacheHandlerCount == misses, "duplicate request was handled again");
+    VerifyResponseCacheCounters(*sCacheCoap, kMaxCachedResponses + 2, misses, 2);
+
+    // All responses are removed once their exchange lifetime ends.
+
+    AdvanceTime(kExchangeLifetime - kMaxCachedResponses);
+    VerifyOrQuit(sAlarmOn, "responses expired before the exchange lifetime");
+    VerifyOrQuit(sCacheCoap->GetCachedResponses().GetHead() != nullptr, "responses expired too early");
+
+    AdvanceTime(1000);
+    VerifyOrQuit(!sAlarmOn, "response cache timer still running");
+    VerifyOrQuit(sCacheCoap->GetCachedResponses().GetHead() == nullptr, "expired responses are still cached");
+
+    ReceiveConfirmableRequest(*sCacheCoap, kMaxCachedResponses - 1, messageInfo);
+    VerifyOrQuit(sCacheHandlerCount == ++misses, "expired response was still served");
+    VerifyResponseCacheCounters(*sCacheCoap, kMaxCachedResponses + 2, misses, 2);
+
+    // A response whose exchange lifetime is longer than the expiry
+    // wheel span is cached for its whole exchange lifetime, alongside
+    // and independently of the responses in the wheel.
+
+    AdvanceTime(kExchangeLifetime);
+    VerifyOrQuit(sCacheCoap->GetCachedResponses().GetHead() == nullptr, "expired responses are still cached");
+
+    ReceiveConfirmableRequest(*sCacheCoap, kMaxCachedResponses, messageInfo, "a/long");
+    VerifyOrQuit(sCacheHandlerCount == ++misses, "request was not handled");
+    ReceiveConfirmableRequest(*sCacheCoap, kMaxCachedResponses + 1, messageInfo);
+    VerifyOrQuit(sCacheHandlerCount == ++misses, "request was not handled");
+
+    AdvanceTime(kExchangeLifetime);
+    ReceiveConfirmableRequest(*sCacheCoap, kMaxCachedResponses + 1, messageInfo);
+    VerifyOrQuit(sCacheHandlerCount == ++misses, "expired response was still served");
+
+    AdvanceTime(kMaxCacheLifetime);
+    ReceiveConfirmableRequest(*sCacheCoap, kMaxCachedResponses, messageInfo, "a/long");
+    VerifyOrQuit(sCacheHandlerCount == misses, "duplicate request was handled again");
+
+    AdvanceTime(kLongExchangeLifetime - kExchangeLifetime - kMaxCacheLifetime - 1);
+    ReceiveConfirmableRequest(*sCacheCoap, kMaxCachedResponses, messageInfo, "a/long");
+    VerifyOrQuit(sCacheHandlerCount == misses, "duplicate request was handled again");
+    VerifyOrQuit(sAlarmOn, "response cache timer is not running");
+
+    AdvanceTime(1);
+    VerifyOrQuit(!sAlarmOn, "response cache timer still running");
+    VerifyOrQuit(sCacheCoap->GetCachedResponses().GetHead() == nullptr, "long lifetime response outlived its lifetime");
+
+    ReceiveConfirmableRequest(*sCacheCoap, kMaxCachedResponses, messageInfo, "a/long");
+    VerifyOrQuit(sCacheHandlerCount == ++misses, "expired response was still served");
+
+    sCacheCoap->ClearRequestsAndResponses();
+    VerifyOrQuit(sCacheCoap->GetCachedResponses().GetHead() == nullptr, "responses were not cleared");
+    VerifyOrQuit(!sAlarmOn, "response cache timer still running");
+
+    sCacheCoap->RemoveResource(longLifetimeResource);
+    sCacheCoap->RemoveResource(resource);
+    delete sCacheCoap;
+    testFreeInstance(sInstance);
+
+    g_testPlatAlarmStop    = nullptr;
+    g_testPlatAlarmStartAt = nullptr;
+    g_testPlatAlarmGetNow  = nullptr;
+
+    printf("TestCoapResponseCache passed\n");
+}
+
+void BenchmarkCoapDispatch(void)
+{
+    TestCoap *       coap;
+    Ip6::MessageInfo messageInfo;
+    Coap::Resource * resources[OT_ARRAY_LENGTH(kUriPaths)];
+    Coap::Message *  requests[OT_ARRAY_LENGTH(kUriPaths)];
+    uint32_t         scanMatches = 0;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    coap = new TestCoap(*sInstance);
+    coap->SetResourceIndexSize(kResourceIndexSize);
+    PrepareMessageInfo(messageInfo);
+
+    memset(sRequestCounts, 0, sizeof(sRequestCounts));
+
+    for (uintptr_t i = 0; i < OT_ARRAY_LENGTH(kUriPaths); i++)
+    {
+        resources[i] = new Coap::Resource(kUriPaths[i], HandleRequest, reinterpret_cast<void *>(i));
+        coap->AddResource(*resources[i]);
+        requests[i] = NewRequest(*coap, kUriPaths[i]);
+    }
+
+    // Linear `strcmp()` pass over the resources, as done before the
+    // URI path index, for comparison.
+
+    auto scanStart = std::chrono::steady_clock::now();
+
+    for (uint32_t round = 0; round < kNumDispatchRounds; round++)
+    {
+        for (const char *uriPath : kUriPaths)
+        {
+            for (const Coap::Resource *resource : resources)
+            {
+                if (strcmp(resource->GetUriPath(), uriPath) == 0)
+                {
+                    scanMatches++;
+                    break;
+                }
+            }
+        }
+    }
+
+    auto scanDuration = std::chrono::steady_clock::now() - scanStart;
+    auto start        = std::chrono::steady_clock::now();
+
+    for (uint32_t round = 0; round < kNumDispatchRounds; round++)
+    {
+        for (Coap::Message *request : requests)
+        {
+            ReceiveRequest(*coap, *request, messageInfo);
+        }
+    }
+
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    VerifyOrQuit(scanMatches == kNumDispatchRounds * OT_ARRAY_LENGTH(kUriPaths), "linear scan missed a resource");
+
+    for (uint32_t count : sRequestCounts)
+    {
+        VerifyOrQuit(count == kNumDispatchRounds, "request dispatched to the wrong resource");
+    }
+
+    printf("CoAP dispatch with %u resources: linear path scan %.1f ns/lookup, full dispatch %.1f ns/request "
+           "(%.0f requests/s)\n",
+           static_cast<unsigned>(OT_ARRAY_LENGTH(kUriPaths)),
+           std::chrono::duration<double, std::nano>(scanDuration).count() /
+               (kNumDispatchRounds * OT_ARRAY_LENGTH(kUriPaths)),
+           std::chrono::duration<double, std::nano>(duration).count() /
+               (kNumDispatchRounds * OT_ARRAY_LENGTH(kUriPaths)),
+           (kNumDispatchRounds * OT_ARRAY_LENGTH(kUriPaths)) / std::chrono::duration<double>(duration).count());
+
+    for (uint16_t i = 0; i < OT_ARRAY_LENGTH(kUriPaths); i++)
+    {
+        requests[i]->Free();
+        coap->RemoveResource(*resources[i]);
+        delete resources[i];
+    }
+
+    delete coap;
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestCoapResponseMatching();
+    ot::TestCoapRetransmission();
+    ot::TestCoapResourceDispatch(0);
+    ot::TestCoapResourceDispatch(ot::kResourceIndexSize);
+    ot::TestCoapResourceDispatch(ot::kResourceIndexSize / 4); // Fewer slots than resources, walks the list.
+    ot::TestCoapResponseCache();
+    ot::BenchmarkCoapDispatch();
+    printf("\nAll tests passed.\n");
+    return 0;
+}
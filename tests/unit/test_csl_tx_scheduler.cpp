@@ -0,0 +1,394 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "openthread-core-config.h"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/random.hpp"
+#include "mac/mac.hpp"
+#include "thread/child_table.hpp"
+#include "thread/csl_tx_scheduler.hpp"
+#include "thread/indirect_sender.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+namespace ot {
+
+static uint64_t     sRadioNow;
+static uint8_t      sTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+static otRadioFrame sTxFrame;
+
+uint64_t testRadioGetNow(otInstance *)
+{
+    return sRadioNow;
+}
+
+otRadioFrame *testRadioGetTransmitBuffer(otInstance *)
+{
+    return &sTxFrame;
+}
+
+class CslTxSchedulerTester
+{
+public:
+    enum
+    {
+        kMaxChildren   = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+        kNumOperations = 5000,
+        kPeriod        = 1000, // CSL period in units of 10 symbols (160 ms).
+        kStartTime     = 1000000000,
+    };
+
+    static void TestScheduleMatchesScan(void)
+    {
+        Instance *instance = InitInstance();
+
+        for (uint16_t i = 0; i < kNumOperations; i++)
+        {
+            Child &child = GetRandomChild(*instance);
+
+            switch (Random::NonCrypto::GetUint8() % 8)
+            {
+            case 0:
+            case 1:
+                SyncChild(*instance, child, 1 + Random::NonCrypto::GetUint16() % 3000,
+                          sRadioNow - Random::NonCrypto::GetUint32() % 1000000);
+                break;
+
+            case 2:
+            case 3:
+                QueueMessage(*instance, child);
+                break;
+
+            case 4:
+                instance->Get<IndirectSender>().ClearAllMessagesForSleepyChild(child);
+                break;
+
+            case 5:
+                child.SetCslSynchronized(false);
+
+                // Sometimes let the scheduler find out on its own
+                // (lazily, when the stale entry reaches the heap top).
+
+                if ((Random::NonCrypto::GetUint8() % 2) == 0)
+                {
+                    instance->Get<CslTxScheduler>().Update(child);
+                }
+                break;
+
+            case 6:
+            case 7:
+                sRadioNow += Random::NonCrypto::GetUint32() % 500000;
+                break;
+            }
+
+            instance->Get<CslTxScheduler>().Update();
+            VerifySchedule(*instance);
+        }
+
+        FreeInstance(*instance);
+
+        printf("TestScheduleMatchesScan passed\n");
+    }
+
+    static void TestClockDrift(void)
+    {
+        Instance &      instance  = *InitInstance();
+        CslTxScheduler &scheduler = instance.Get<CslTxScheduler>();
+        Child &         childA    = *instance.Get<ChildTable>().GetChildAtIndex(0);
+        Child &         childB    = *instance.Get<ChildTable>().GetChildAtIndex(1);
+        uint64_t        lastRx    = sRadioNow;
+
+        VerifyOrQuit(scheduler.mCslFrameRequestAheadUs < 100 * kUsPerTenSymbols, "CSL request ahead time too large");
+
+        // Child A listens 100 (16 ms), child B 120 (19.2 ms) units
+        // after their last CSL IE.
+
+        QueueMessage(instance, childA);
+        QueueMessage(instance, childB);
+        SyncChild(instance, childA, 100, lastRx);
+        SyncChild(instance, childB, 120, lastRx);
+
+        VerifyOrQuit(scheduler.mCslTxChild == &childA, "Nearest CSL window not scheduled first");
+        VerifyOrQuit(GetTxWindow(instance, childA) == lastRx + 100 * kUsPerTenSymbols, "CSL tx window is incorrect");
+        VerifySchedule(instance);
+
+        // Child A re-synchronizes and its clock has drifted by 5 ms,
+        // which moves its window past the one of child B.
+
+        SyncChild(instance, childA, 100, lastRx + 5000);
+
+        VerifyOrQuit(scheduler.mCslTxChild == &childB, "Drifted CSL window did not update the schedule");
+        VerifyOrQuit(GetTxWindow(instance, childA) == lastRx + 5000 + 100 * kUsPerTenSymbols,
+                     "Drifted CSL tx window is incorrect");
+        VerifySchedule(instance);
+
+        // Let the window of child B pass, it must move to the next
+        // period and child A is now the nearest one.
+
+        sRadioNow = lastRx + 120 * kUsPerTenSymbols - scheduler.mCslFrameRequestAheadUs + 1;
+        scheduler.Update();
+
+        VerifyOrQuit(scheduler.mCslTxChild == &childA, "Passed CSL window is still scheduled");
+        VerifyOrQuit(GetTxWindow(instance, childB) == lastRx + (120 + kPeriod) * kUsPerTenSymbols,
+                     "Passed CSL tx window did not move to the next period");
+        VerifySchedule(instance);
+
+        // Losing synchronization drops the child from the schedule.
+
+        childA.SetCslSynchronized(false);
+        scheduler.Update(childA);
+
+        VerifyOrQuit(scheduler.mWindowHeap.Find(instance.Get<ChildTable>().GetChildIndex(childA)) == nullptr,
+                     "Unsynchronized child is still in the window heap");
+        VerifyOrQuit(scheduler.mCslTxChild == &childB, "Unsynchronized child is still scheduled");
+        VerifySchedule(instance);
+
+        FreeInstance(instance);
+
+        printf("TestClockDrift passed\n");
+    }
+
+    static void TestFrameRequestPreemption(void)
+    {
+        Instance &      instance  = *InitInstance();
+        CslTxScheduler &scheduler = instance.Get<CslTxScheduler>();
+        Mac::TxFrames & txFrames  = instance.Get<Mac::Mac>().mLinks.GetTxFrames();
+        Child &         childA    = *instance.Get<ChildTable>().GetChildAtIndex(0);
+        Child &         childB    = *instance.Get<ChildTable>().GetChildAtIndex(1);
+        Child &         childC    = *instance.Get<ChildTable>().GetChildAtIndex(2);
+        Mac::TxFrame *  frame;
+        Message *       messageB;
+        Mac::Address    dst;
+
+        SyncChild(instance, childA, 300, sRadioNow);
+        QueueMessage(instance, childA);
+        VerifyOrQuit(scheduler.mCslTxChild == &childA, "CSL tx is not scheduled");
+
+        // A nearer window pre-empts the scheduled (not yet requested) CSL tx.
+
+        SyncChild(instance, childB, 200, sRadioNow);
+        messageB = QueueMessage(instance, childB);
+        VerifyOrQuit(scheduler.mCslTxChild == &childB, "Nearer CSL window did not pre-empt scheduled tx");
+
+        frame = scheduler.HandleFrameRequest(txFrames);
+        VerifyOrQuit(frame != nullptr, "HandleFrameRequest() failed");
+        SuccessOrQuit(frame->GetDstAddr(dst), "GetDstAddr() failed");
+        VerifyOrQuit(dst.IsExtended() && dst.GetExtended() == childB.GetExtAddress(), "Frame is not for child B");
+        VerifyOrQuit(scheduler.mCslTxMessage == messageB, "CSL tx message is incorrect");
+        VerifyOrQuit(frame->mInfo.mTxInfo.mTxDelay == 200 * kUsPerTenSymbols, "CSL tx delay is incorrect");
+
+        // Once the frame is handed to `Mac`, a nearer window must wait.
+
+        SyncChild(instance, childC, 100, sRadioNow);
+        QueueMessage(instance, childC);
+        VerifyOrQuit(scheduler.mCslTxChild == &childB, "In-flight CSL tx was pre-empted");
+        VerifyOrQuit(scheduler.mWindowHeap.Find(instance.Get<ChildTable>().GetChildIndex(childC)) != nullptr,
+                     "Child C is not in the window heap");
+
+        scheduler.HandleSentFrame(*frame, OT_ERROR_CHANNEL_ACCESS_FAILURE);
+        VerifyOrQuit(scheduler.mCslTxMessage == nullptr, "CSL tx message was not cleared");
+        VerifyOrQuit(scheduler.mCslTxChild == &childC, "Nearest CSL window not scheduled after tx done");
+        VerifySchedule(instance);
+
+        // Removing the message of an in-flight CSL tx aborts it, and the
+        // tx done then moves on to the next nearest window.
+
+        frame = scheduler.HandleFrameRequest(txFrames);
+        VerifyOrQuit(frame != nullptr, "HandleFrameRequest() failed");
+        instance.Get<IndirectSender>().ClearAllMessagesForSleepyChild(childC);
+        VerifyOrQuit(scheduler.mCslTxChild == nullptr, "In-flight CSL tx was not aborted");
+
+        scheduler.HandleSentFrame(*frame, OT_ERROR_NONE);
+        VerifyOrQuit(scheduler.mCslTxMessage == nullptr, "CSL tx message was not cleared");
+        VerifyOrQuit(scheduler.mCslTxChild == &childB, "Next CSL window not scheduled after aborted tx");
+        VerifySchedule(instance);
+
+        FreeInstance(instance);
+
+        printf("TestFrameRequestPreemption passed\n");
+    }
+
+private:
+    static Instance *InitInstance(void)
+    {
+        Instance *instance;
+
+        sRadioNow                        = kStartTime;
+        sTxFrame.mPsdu                   = sTxPsdu;
+        g_testPlatRadioGetNow            = testRadioGetNow;
+        g_testPlatRadioGetTransmitBuffer = testRadioGetTransmitBuffer;
+
+        instance = testInitInstance();
+        VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+        instance->Get<IndirectSender>().Start();
+
+        for (uint16_t i = 0; i < kMaxChildren; i++)
+        {
+            Child *          child = instance->Get<ChildTable>().GetNewChild();
+            Mac::ExtAddress extAddress;
+
+            VerifyOrQuit(child != nullptr, "ChildTable::GetNewChild() failed");
+            child->SetState(Child::kStateValid);
+            child->SetRloc16(0x1401 + i);
+            child->SetDeviceMode(Mle::DeviceMode(0));
+
+            memset(&extAddress, 0, sizeof(extAddress));
+            extAddress.m8[7] = static_cast<uint8_t>(i + 1);
+            child->SetExtAddress(extAddress);
+        }
+
+        return instance;
+    }
+
+    static void FreeInstance(Instance &aInstance)
+    {
+        PriorityQueue &sendQueue = aInstance.Get<MeshForwarder>().mSendQueue;
+        Message *      message;
+
+        for (Child &child : aInstance.Get<ChildTable>().Iterate(Child::kInStateValid))
+        {
+            aInstance.Get<IndirectSender>().ClearAllMessagesForSleepyChild(child);
+        }
+
+        while ((message = sendQueue.GetHead()) != nullptr)
+        {
+            sendQueue.Dequeue(*message);
+            message->Free();
+        }
+
+        testFreeInstance(&aInstance);
+        g_testPlatRadioGetNow            = nullptr;
+        g_testPlatRadioGetTransmitBuffer = nullptr;
+    }
+
+    static Child &GetRandomChild(Instance &aInstance)
+    {
+        return *aInstance.Get<ChildTable>().GetChildAtIndex(Random::NonCrypto::GetUint16() % kMaxChildren);
+    }
+
+    // Emulates `Mac::ProcessCsl()` on receiving a frame with a CSL IE.
+    static void SyncChild(Instance &aInstance, Child &aChild, uint16_t aPhase, uint64_t aLastRxTimestamp)
+    {
+        aChild.SetCslPeriod(kPeriod);
+        aChild.SetCslPhase(aPhase);
+        aChild.SetCslSynchronized(true);
+        aChild.SetLastRxTimestamp(aLastRxTimestamp);
+        aInstance.Get<CslTxScheduler>().Update(aChild);
+    }
+
+    static Message *QueueMessage(Instance &aInstance, Child &aChild)
+    {
+        Message *message = aInstance.Get<MessagePool>().New(Message::kTypeSupervision, 0);
+
+        VerifyOrQuit(message != nullptr, "Message::New() failed");
+        aInstance.Get<MeshForwarder>().mSendQueue.Enqueue(*message);
+        aInstance.Get<IndirectSender>().AddMessageForSleepyChild(*message, aChild);
+
+        return message;
+    }
+
+    static uint64_t GetTxWindow(Instance &aInstance, const Child &aChild)
+    {
+        const CslTxScheduler::WindowHeap::Entry *entry =
+            aInstance.Get<CslTxScheduler>().mWindowHeap.Find(aInstance.Get<ChildTable>().GetChildIndex(aChild));
+
+        VerifyOrQuit(entry != nullptr, "Child is not in the window heap");
+
+        return entry->mTxWindow;
+    }
+
+    // Checks the scheduled child against the reference (full child
+    // table scan) implementation.
+    static void VerifySchedule(Instance &aInstance)
+    {
+        CslTxScheduler &scheduler = aInstance.Get<CslTxScheduler>();
+        uint32_t        minDelay  = Time::kMaxDuration;
+        Child *         bestChild = nullptr;
+        uint32_t        delayFromLastRx;
+
+        for (Child &child : aInstance.Get<ChildTable>().Iterate(Child::kInStateAnyExceptInvalid))
+        {
+            uint32_t delay;
+
+            if (!child.IsCslSynchronized() || child.GetIndirectMessageCount() == 0)
+            {
+                continue;
+            }
+
+            delay = scheduler.GetNextCslTransmissionDelay(child, delayFromLastRx);
+
+            if (delay < minDelay)
+            {
+                minDelay  = delay;
+                bestChild = &child;
+            }
+        }
+
+        if (bestChild == nullptr)
+        {
+            VerifyOrQuit(scheduler.mCslTxChild == nullptr, "CSL tx scheduled without any candidate child");
+            ExitNow();
+        }
+
+        VerifyOrQuit(scheduler.mCslTxChild != nullptr, "No CSL tx scheduled");
+        VerifyOrQuit(scheduler.GetNextCslTransmissionDelay(*scheduler.mCslTxChild, delayFromLastRx) == minDelay,
+                     "Scheduled CSL tx is not the nearest one");
+        VerifyOrQuit(GetTxWindow(aInstance, *scheduler.mCslTxChild) ==
+                         sRadioNow + scheduler.mCslFrameRequestAheadUs + minDelay,
+                     "Heap top CSL tx window is incorrect");
+
+    exit:
+        return;
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::CslTxSchedulerTester::TestScheduleMatchesScan();
+    ot::CslTxSchedulerTester::TestClockDrift();
+    ot::CslTxSchedulerTester::TestFrameRequestPreemption();
+
+    printf("All tests passed\n");
+    return 0;
+}
+
+#else
+int main(void)
+{
+    return 0;
+}
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
@@ -28,6 +28,7 @@
 
 #include <openthread/platform/flash.h>
 
+#include <chrono>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -186,11 +187,226 @@ void TestFlash(void)
 #endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE
 }
 
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE && OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+static void VerifyValue(Flash &aFlash, uint16_t aKey, int aIndex, const uint8_t *aValue, uint16_t aLength)
+{
+    uint8_t  readBuffer[64];
+    uint16_t length = sizeof(readBuffer);
+
+    SuccessOrQuit(aFlash.Get(aKey, aIndex, readBuffer, &length), "Get() failed");
+    VerifyOrQuit(length == aLength, "Get() did not return expected length");
+    VerifyOrQuit(memcmp(readBuffer, aValue, length) == 0, "Get() did not return expected value");
+}
+
+void TestFlashIndex(void)
+{
+    uint8_t   writeBuffer[64];
+    uint32_t  reads;
+    bool      compacted = false;
+    Instance *instance  = testInitInstance();
+    Flash     flash(*instance);
+
+    for (uint32_t i = 0; i < sizeof(writeBuffer); i++)
+    {
+        writeBuffer[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    g_testPlatFlashKeepOnInit = false;
+    flash.Init();
+    VerifyOrQuit(flash.IsIndexValid(), "index is not used");
+
+    // Set() replaces all values of a key, deleted values stay deleted after a reboot
+
+    SuccessOrQuit(flash.Add(1, writeBuffer, 4), "Add() failed");
+    SuccessOrQuit(flash.Add(1, writeBuffer + 1, 5), "Add() failed");
+    SuccessOrQuit(flash.Set(1, writeBuffer + 2, 6), "Set() failed");
+    SuccessOrQuit(flash.Add(1, writeBuffer + 3, 7), "Add() failed");
+    VerifyValue(flash, 1, 0, writeBuffer + 2, 6);
+    VerifyValue(flash, 1, 1, writeBuffer + 3, 7);
+    VerifyOrQuit(flash.Get(1, 2, nullptr, nullptr) == OT_ERROR_NOT_FOUND, "Get() failed");
+
+    SuccessOrQuit(flash.Delete(1, 0), "Delete() failed");
+    VerifyValue(flash, 1, 0, writeBuffer + 3, 7);
+
+    g_testPlatFlashKeepOnInit = true;
+    flash.Init();
+    VerifyValue(flash, 1, 0, writeBuffer + 3, 7);
+    VerifyOrQuit(flash.Get(1, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND, "Get() failed");
+
+    SuccessOrQuit(flash.Delete(1, -1), "Delete() failed");
+    flash.Init();
+    VerifyOrQuit(flash.Get(1, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND, "deleted value reappeared");
+
+    // A Get() reads the record header and value only
+
+    SuccessOrQuit(flash.Add(2, writeBuffer, 8), "Add() failed");
+    reads = g_testPlatFlashReadCount;
+    VerifyValue(flash, 2, 0, writeBuffer, 8);
+    VerifyOrQuit(g_testPlatFlashReadCount - reads == 2, "Get() scanned the flash area");
+
+    // Frequent Set() calls (e.g. frame counters) are compacted in the background
+
+    flash.Wipe();
+
+    for (uint16_t key = 0; key < 8; key++)
+    {
+        SuccessOrQuit(flash.Add(key, writeBuffer + key, key + 1), "Add() failed");
+    }
+
+    for (uint32_t counter = 0; counter < 2000; counter++)
+    {
+        SuccessOrQuit(flash.Set(8, reinterpret_cast<uint8_t *>(&counter), sizeof(counter)), "Set() failed");
+        compacted |= flash.IsCompacting();
+        VerifyValue(flash, 8, 0, reinterpret_cast<uint8_t *>(&counter), sizeof(counter));
+
+        if ((counter % 100) == 0)
+        {
+            for (uint16_t key = 0; key < 8; key++)
+            {
+                VerifyValue(flash, key, 0, writeBuffer + key, key + 1);
+            }
+        }
+    }
+
+    VerifyOrQuit(compacted, "background compaction did not run");
+
+    // A reboot in the middle of a compaction keeps the active swap area
+
+    while (!flash.IsCompacting())
+    {
+        SuccessOrQuit(flash.Set(8, writeBuffer, 4), "Set() failed");
+    }
+
+    flash.Init();
+    VerifyOrQuit(!flash.IsCompacting(), "compaction survived a reboot");
+    VerifyValue(flash, 8, 0, writeBuffer, 4);
+
+    for (uint16_t key = 0; key < 8; key++)
+    {
+        VerifyValue(flash, key, 0, writeBuffer + key, key + 1);
+    }
+
+    // Deleting or replacing an already copied record keeps the compaction going
+
+    while (!flash.IsCompacting())
+    {
+        SuccessOrQuit(flash.Set(8, writeBuffer + 1, 4), "Set() failed");
+    }
+
+    flash.ContinueCompaction();
+    SuccessOrQuit(flash.Delete(0, 0), "Delete() failed");
+    SuccessOrQuit(flash.Set(1, writeBuffer + 9, 3), "Set() failed");
+    VerifyOrQuit(flash.IsCompacting(), "compaction was aborted");
+    SuccessOrQuit(flash.Set(8, writeBuffer + 2, 4), "Set() failed");
+
+    while (flash.IsCompacting())
+    {
+        flash.ContinueCompaction();
+    }
+
+    flash.Init();
+    VerifyOrQuit(flash.Get(0, 0, nullptr, nullptr) == OT_ERROR_NOT_FOUND, "deleted value reappeared");
+    VerifyOrQuit(flash.Get(1, 1, nullptr, nullptr) == OT_ERROR_NOT_FOUND, "replaced value reappeared");
+    VerifyValue(flash, 1, 0, writeBuffer + 9, 3);
+    VerifyValue(flash, 8, 0, writeBuffer + 2, 4);
+
+    for (uint16_t key = 2; key < 8; key++)
+    {
+        VerifyValue(flash, key, 0, writeBuffer + key, key + 1);
+    }
+
+    g_testPlatFlashKeepOnInit = false;
+    testFreeInstance(instance);
+}
+
+void TestFlashBootLoad(void)
+{
+    enum : uint16_t
+    {
+        kValueLength = 28,
+        kIterations  = 1000,
+    };
+
+    uint8_t   writeBuffer[kValueLength];
+    uint16_t  numKeys = 0;
+    uint32_t  initReads;
+    uint32_t  loadReads;
+    Instance *instance = testInitInstance();
+    Flash     flash(*instance);
+
+    memset(writeBuffer, 0x5a, sizeof(writeBuffer));
+
+    g_testPlatFlashKeepOnInit = false;
+    flash.Init();
+
+    // Fill the flash area with live records
+    while (flash.Add(numKeys, writeBuffer, sizeof(writeBuffer)) == OT_ERROR_NONE)
+    {
+        numKeys++;
+    }
+
+    VerifyOrQuit(flash.IsIndexValid(), "index is not used");
+
+    g_testPlatFlashKeepOnInit = true;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint16_t i = 0; i < kIterations; i++)
+    {
+        flash.Init();
+    }
+
+    auto initDuration = std::chrono::steady_clock::now() - start;
+
+    initReads = g_testPlatFlashReadCount;
+    flash.Init();
+    initReads = g_testPlatFlashReadCount - initReads;
+
+    start = std::chrono::steady_clock::now();
+
+    for (uint16_t i = 0; i < kIterations; i++)
+    {
+        for (uint16_t key = 0; key < numKeys; key++)
+        {
+            uint8_t  readBuffer[kValueLength];
+            uint16_t length = sizeof(readBuffer);
+
+            SuccessOrQuit(flash.Get(key, 0, readBuffer, &length), "Get() failed");
+        }
+    }
+
+    auto loadDuration = std::chrono::steady_clock::now() - start;
+
+    loadReads = g_testPlatFlashReadCount;
+
+    for (uint16_t key = 0; key < numKeys; key++)
+    {
+        VerifyValue(flash, key, 0, writeBuffer, sizeof(writeBuffer));
+    }
+
+    loadReads = g_testPlatFlashReadCount - loadReads;
+    VerifyOrQuit(loadReads == 2u * numKeys, "loading settings scanned the flash area");
+
+    printf("Boot load of %u records: Init() %.0f ns with %u reads, loading all keys %.0f ns with %u reads "
+           "(a full scan per key needs %u reads)\n",
+           numKeys, std::chrono::duration<double, std::nano>(initDuration).count() / kIterations, initReads,
+           std::chrono::duration<double, std::nano>(loadDuration).count() / kIterations, loadReads,
+           static_cast<unsigned>(numKeys) * (numKeys + 1u));
+
+    g_testPlatFlashKeepOnInit = false;
+    testFreeInstance(instance);
+}
+#endif // OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE && OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestFlash();
+#if OPENTHREAD_CONFIG_PLATFORM_FLASH_API_ENABLE && OPENTHREAD_CONFIG_FLASH_INDEX_ENABLE
+    ot::TestFlashIndex();
+    ot::TestFlashBootLoad();
+#endif
     printf("All tests passed\n");
     return 0;
 }
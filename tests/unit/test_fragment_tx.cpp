@@ -0,0 +1,344 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "openthread-core-config.h"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#if OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_TX_PIPELINE_ENABLE
+
+#include <openthread/tasklet.h>
+#include <openthread/platform/radio.h>
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "mac/mac.hpp"
+#include "net/ip6_headers.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+namespace ot {
+
+static uint8_t      sTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+static otRadioFrame sTxFrame;
+static uint16_t     sTransmitCount;
+
+otRadioFrame *testRadioGetTransmitBuffer(otInstance *)
+{
+    return &sTxFrame;
+}
+
+otError testRadioTransmit(otInstance *)
+{
+    sTransmitCount++;
+    return OT_ERROR_NONE;
+}
+
+class FragmentTxTester
+{
+public:
+    enum
+    {
+        kPayloadLength      = 600,
+        kShortPayloadLength = 20,
+        kOobLength          = 12,
+    };
+
+    static void TestPipelinedFragments(void)
+    {
+        Instance &                  instance = *InitInstance();
+        const otFragmentTxCounters &counters = instance.Get<MeshForwarder>().GetFragmentTxCounters();
+        uint16_t                    numFrames;
+
+        SendDatagram(instance);
+
+        ProcessTasklets(instance);
+        VerifyOrQuit(sTransmitCount == 1, "first fragment was not transmitted");
+
+        // Every following fragment must be handed to the radio from
+        // within the tx done callback of the previous one, without
+        // running any tasklet in between.
+
+        for (numFrames = 1; instance.Get<MeshForwarder>().mSendMessage != nullptr; numFrames++)
+        {
+            VerifyOrQuit(numFrames < 20, "too many fragments");
+            otPlatRadioTxDone(&instance, &sTxFrame, nullptr, OT_ERROR_NONE);
+
+            if (instance.Get<MeshForwarder>().mSendMessage != nullptr)
+            {
+                VerifyOrQuit(sTransmitCount == numFrames + 1, "next fragment was not pipelined");
+            }
+        }
+
+        numFrames--;
+        ProcessTasklets(instance);
+
+        VerifyOrQuit(numFrames > 2, "datagram was not fragmented");
+        VerifyOrQuit(sTransmitCount == numFrames, "unexpected number of frames");
+        VerifyOrQuit(counters.mTxFragments == numFrames, "TxFragments counter is incorrect");
+        VerifyOrQuit(counters.mTxPipelined == numFrames - 1U, "TxPipelined counter is incorrect");
+        VerifyOrQuit(counters.mTxFailures == 0, "TxFailures counter is incorrect");
+        VerifyOrQuit(counters.mDatagramsAborted == 0, "DatagramsAborted counter is incorrect");
+        VerifyOrQuit(instance.Get<MeshForwarder>().GetCounters().mTxSuccess == 1, "TxSuccess counter is incorrect");
+
+        printf("TestPipelinedFragments passed (%d fragments)\n", numFrames);
+
+        FreeInstance(instance);
+    }
+
+    static void TestHigherPriorityOperation(void)
+    {
+        Instance &                  instance = *InitInstance();
+        const otFragmentTxCounters &counters = instance.Get<MeshForwarder>().GetFragmentTxCounters();
+        uint8_t                     oobPsdu[kOobLength];
+        otRadioFrame                oobFrame;
+
+        memset(oobPsdu, 0x5a, sizeof(oobPsdu));
+        memset(&oobFrame, 0, sizeof(oobFrame));
+        oobFrame.mPsdu    = oobPsdu;
+        oobFrame.mLength  = kOobLength;
+        oobFrame.mChannel = OPENTHREAD_CONFIG_DEFAULT_CHANNEL;
+
+        SendDatagram(instance);
+        ProcessTasklets(instance);
+        VerifyOrQuit(sTransmitCount == 1, "first fragment was not transmitted");
+
+        // An out-of-band frame requested while a fragment is in flight
+        // goes before the next fragment.
+
+        SuccessOrQuit(instance.Get<Mac::Mac>().RequestOutOfBandFrameTransmission(&oobFrame), "OOB request failed");
+        otPlatRadioTxDone(&instance, &sTxFrame, nullptr, OT_ERROR_NONE);
+        VerifyOrQuit(sTransmitCount == 2, "OOB frame was not transmitted");
+        VerifyOrQuit(sTxFrame.mLength == kOobLength && memcmp(sTxFrame.mPsdu, oobPsdu, kOobLength) == 0,
+                     "OOB frame did not preempt the next fragment");
+
+        // The pending fragment follows the OOB frame right away.
+
+        otPlatRadioTxDone(&instance, &sTxFrame, nullptr, OT_ERROR_NONE);
+        VerifyOrQuit(sTransmitCount == 3, "fragment did not follow the OOB frame");
+        VerifyOrQuit(sTxFrame.mLength != kOobLength, "OOB frame was sent twice");
+        VerifyOrQuit(counters.mTxPipelined == 1, "TxPipelined counter is incorrect");
+
+        while (instance.Get<MeshForwarder>().mSendMessage != nullptr)
+        {
+            VerifyOrQuit(sTransmitCount < 20, "too many fragments");
+            otPlatRadioTxDone(&instance, &sTxFrame, nullptr, OT_ERROR_NONE);
+        }
+
+        ProcessTasklets(instance);
+        VerifyOrQuit(counters.mTxFragments == sTransmitCount - 1U, "TxFragments counter is incorrect");
+        VerifyOrQuit(instance.Get<MeshForwarder>().GetCounters().mTxSuccess == 1, "TxSuccess counter is incorrect");
+
+        printf("TestHigherPriorityOperation passed\n");
+
+        FreeInstance(instance);
+    }
+
+    static void TestHigherPriorityMessage(void)
+    {
+        Instance &                  instance = *InitInstance();
+        const otFragmentTxCounters &counters = instance.Get<MeshForwarder>().GetFragmentTxCounters();
+        Message *                   netMessage;
+
+        SendDatagram(instance);
+        ProcessTasklets(instance);
+        VerifyOrQuit(sTransmitCount == 1, "first fragment was not transmitted");
+        otPlatRadioTxDone(&instance, &sTxFrame, nullptr, OT_ERROR_NONE);
+        VerifyOrQuit(sTransmitCount == 2, "second fragment was not pipelined");
+
+        // A network control message queued while a fragment is in
+        // flight is sent before the next fragment.
+
+        netMessage = SendDatagram(instance, kShortPayloadLength, Message::kPriorityNet);
+        otPlatRadioTxDone(&instance, &sTxFrame, nullptr, OT_ERROR_NONE);
+        VerifyOrQuit(sTransmitCount == 2, "fragment was pipelined ahead of a higher priority message");
+
+        ProcessTasklets(instance);
+        VerifyOrQuit(sTransmitCount == 3, "higher priority message was not transmitted");
+        VerifyOrQuit(instance.Get<MeshForwarder>().mSendMessage == netMessage,
+                     "higher priority message did not preempt the next fragment");
+
+        otPlatRadioTxDone(&instance, &sTxFrame, nullptr, OT_ERROR_NONE);
+        ProcessTasklets(instance);
+        VerifyOrQuit(sTransmitCount == 4, "fragment did not follow the higher priority message");
+        VerifyOrQuit(counters.mTxPipelined == 1, "TxPipelined counter is incorrect");
+
+        // With the higher priority message sent, the remaining
+        // fragments are pipelined again.
+
+        while (instance.Get<MeshForwarder>().mSendMessage != nullptr)
+        {
+            uint16_t transmitCount = sTransmitCount;
+
+            VerifyOrQuit(sTransmitCount < 20, "too many fragments");
+            otPlatRadioTxDone(&instance, &sTxFrame, nullptr, OT_ERROR_NONE);
+            VerifyOrQuit(instance.Get<MeshForwarder>().mSendMessage == nullptr || sTransmitCount == transmitCount + 1,
+                         "next fragment was not pipelined");
+        }
+
+        ProcessTasklets(instance);
+        VerifyOrQuit(counters.mTxFragments == sTransmitCount - 1U, "TxFragments counter is incorrect");
+        VerifyOrQuit(instance.Get<MeshForwarder>().GetCounters().mTxSuccess == 2, "TxSuccess counter is incorrect");
+
+        printf("TestHigherPriorityMessage passed\n");
+
+        FreeInstance(instance);
+    }
+
+    static void TestFragmentFailure(void)
+    {
+        Instance &                  instance = *InitInstance();
+        const otFragmentTxCounters &counters = instance.Get<MeshForwarder>().GetFragmentTxCounters();
+
+        SendDatagram(instance);
+        ProcessTasklets(instance);
+        VerifyOrQuit(sTransmitCount == 1, "first fragment was not transmitted");
+
+        otPlatRadioTxDone(&instance, &sTxFrame, nullptr, OT_ERROR_NONE);
+        VerifyOrQuit(sTransmitCount == 2, "second fragment was not pipelined");
+
+        // The radio reports a failure once all retries of the second
+        // fragment are used.
+
+        otPlatRadioTxDone(&instance, &sTxFrame, nullptr, OT_ERROR_NO_ACK);
+        VerifyOrQuit(counters.mTxFailures == 1, "TxFailures counter is incorrect");
+
+#if OPENTHREAD_CONFIG_DROP_MESSAGE_ON_FRAGMENT_TX_FAILURE
+        ProcessTasklets(instance);
+        VerifyOrQuit(sTransmitCount == 2, "fragment sent after a failed fragment");
+        VerifyOrQuit(instance.Get<MeshForwarder>().mSendMessage == nullptr, "datagram was not dropped");
+        VerifyOrQuit(counters.mDatagramsAborted == 1, "DatagramsAborted counter is incorrect");
+        VerifyOrQuit(counters.mTxFragments == 2, "TxFragments counter is incorrect");
+#else
+        VerifyOrQuit(sTransmitCount == 3, "next fragment was not pipelined after a failure");
+        VerifyOrQuit(counters.mDatagramsAborted == 0, "DatagramsAborted counter is incorrect");
+
+        while (instance.Get<MeshForwarder>().mSendMessage != nullptr)
+        {
+            otPlatRadioTxDone(&instance, &sTxFrame, nullptr, OT_ERROR_NONE);
+        }
+#endif
+
+        VerifyOrQuit(instance.Get<MeshForwarder>().GetCounters().mTxFailure == 1, "TxFailure counter is incorrect");
+
+        printf("TestFragmentFailure passed\n");
+
+        FreeInstance(instance);
+    }
+
+private:
+    static void ProcessTasklets(Instance &aInstance)
+    {
+        while (otTaskletsArePending(&aInstance))
+        {
+            otTaskletsProcess(&aInstance);
+        }
+    }
+
+    static Instance *InitInstance(void)
+    {
+        Instance *instance;
+
+        sTransmitCount                   = 0;
+        sTxFrame.mPsdu                   = sTxPsdu;
+        g_testPlatRadioCaps              = OT_RADIO_CAPS_ACK_TIMEOUT | OT_RADIO_CAPS_CSMA_BACKOFF |
+                              OT_RADIO_CAPS_TRANSMIT_RETRIES;
+        g_testPlatRadioTransmit          = testRadioTransmit;
+        g_testPlatRadioGetTransmitBuffer = testRadioGetTransmitBuffer;
+
+        instance = testInitInstance();
+        VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+        instance->Get<MeshForwarder>().Start();
+
+        return instance;
+    }
+
+    static void FreeInstance(Instance &aInstance)
+    {
+        testFreeInstance(&aInstance);
+        g_testPlatRadioCaps              = OT_RADIO_CAPS_NONE;
+        g_testPlatRadioTransmit          = nullptr;
+        g_testPlatRadioGetTransmitBuffer = nullptr;
+    }
+
+    static Message *SendDatagram(Instance &        aInstance,
+                                 uint16_t          aPayloadLength = kPayloadLength,
+                                 Message::Priority aPriority      = Message::kPriorityNormal)
+    {
+        Message *message = aInstance.Get<MessagePool>().New(
+            Message::kTypeIp6, 0, Message::Settings(Message::kWithLinkSecurity, aPriority));
+        Ip6::Header     ip6Header;
+        Mac::ExtAddress extAddress;
+        uint8_t         payload[kPayloadLength];
+
+        VerifyOrQuit(message != nullptr, "Message::New() failed");
+
+        memset(&extAddress, 0, sizeof(extAddress));
+        extAddress.m8[7] = 0x01;
+
+        ip6Header.Init();
+        ip6Header.SetPayloadLength(aPayloadLength);
+        ip6Header.SetNextHeader(Ip6::kProtoNone);
+        ip6Header.SetHopLimit(64);
+        ip6Header.GetSource().SetToLinkLocalAddress(aInstance.Get<Mac::Mac>().GetExtAddress());
+        ip6Header.GetDestination().SetToLinkLocalAddress(extAddress);
+
+        for (uint16_t i = 0; i < aPayloadLength; i++)
+        {
+            payload[i] = static_cast<uint8_t>(i);
+        }
+
+        SuccessOrQuit(message->Append(ip6Header), "Message::Append() failed");
+        SuccessOrQuit(message->AppendBytes(payload, aPayloadLength), "Message::AppendBytes() failed");
+        SuccessOrQuit(aInstance.Get<MeshForwarder>().SendMessage(*message), "MeshForwarder::SendMessage() failed");
+
+        return message;
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::FragmentTxTester::TestPipelinedFragments();
+    ot::FragmentTxTester::TestHigherPriorityOperation();
+    ot::FragmentTxTester::TestHigherPriorityMessage();
+    ot::FragmentTxTester::TestFragmentFailure();
+    printf("All tests passed\n");
+    return 0;
+}
+
+#else // OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_TX_PIPELINE_ENABLE
+
+int main(void)
+{
+    return 0;
+}
+
+#endif // OPENTHREAD_CONFIG_6LOWPAN_FRAGMENT_TX_PIPELINE_ENABLE
@@ -0,0 +1,471 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <chrono>
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "common/random.hpp"
+#include "thread/child_table.hpp"
+#include "thread/indirect_sender.hpp"
+#include "net/ip6_headers.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+class IndirectSenderTester
+{
+public:
+    enum
+    {
+        kMaxChildren   = OPENTHREAD_CONFIG_MLE_MAX_CHILDREN,
+        kNumOperations = 5000,
+        kNumPolls      = 20000,
+    };
+
+    static void TestFirstQueuedMessage(void)
+    {
+        Instance *instance = testInitInstance();
+
+        VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+        AddSleepyChildren(*instance);
+
+        for (uint16_t i = 0; i < kNumOperations; i++)
+        {
+            switch (Random::NonCrypto::GetUint8() % 8)
+            {
+            case 0:
+            case 1:
+            case 2:
+                AddRandomMessage(*instance);
+                break;
+
+            case 3:
+            case 4:
+                RemoveRandomMessageFromChild(*instance);
+                break;
+
+            case 5:
+                FinishRandomDirectTransmission(*instance);
+                break;
+
+            case 6:
+                if ((Random::NonCrypto::GetUint8() % 8) == 0)
+                {
+                    instance->Get<IndirectSender>().ClearAllMessagesForSleepyChild(GetRandomChild(*instance));
+                }
+                break;
+
+            case 7:
+                if ((Random::NonCrypto::GetUint8() % 8) == 0)
+                {
+                    ChangeRandomChildToRxOn(*instance);
+                }
+                break;
+            }
+
+            VerifyChildren(*instance);
+        }
+
+        FreeAllMessages(*instance);
+        VerifyChildren(*instance);
+
+        printf("TestFirstQueuedMessage passed\n");
+
+        testFreeInstance(instance);
+    }
+
+    static void TestRemoveDataResponseMessages(void)
+    {
+        Instance *      instance = testInitInstance();
+        IndirectSender *indirectSender;
+        Message *       dataResponse;
+        Message *       message;
+        Ip6::Header     ip6Header;
+
+        VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+        indirectSender = &instance->Get<IndirectSender>();
+
+        AddSleepyChildren(*instance);
+
+        // Queue a multicast MLE Data Response for all sleepy children,
+        // followed by a unicast message for the first child.
+
+        dataResponse = NewMessage(*instance, Message::kTypeIp6, Message::kPriorityNet);
+        VerifyOrQuit(dataResponse != nullptr, "Message::New() failed");
+
+        ip6Header.Init();
+        ip6Header.GetDestination().SetToLinkLocalAllNodesMulticast();
+        SuccessOrQuit(dataResponse->Append(ip6Header), "Message::Append() failed");
+        dataResponse->SetSubType(Message::kSubTypeMleDataResponse);
+
+        instance->Get<MeshForwarder>().mSendQueue.Enqueue(*dataResponse);
+
+        for (Child &child : instance->Get<ChildTable>().Iterate(Child::kInStateValid))
+        {
+            indirectSender->AddMessageForSleepyChild(*dataResponse, child);
+        }
+
+        message = NewMessage(*instance, Message::kTypeIp6, Message::kPriorityNormal);
+        VerifyOrQuit(message != nullptr, "Message::New() failed");
+        instance->Get<MeshForwarder>().mSendQueue.Enqueue(*message);
+        indirectSender->AddMessageForSleepyChild(*message, *instance->Get<ChildTable>().GetChildAtIndex(0));
+
+        VerifyChildren(*instance);
+
+        instance->Get<MeshForwarder>().RemoveDataResponseMessages();
+
+        // Poll for every child after the Data Response was freed.
+
+        for (Child &child : instance->Get<ChildTable>().Iterate(Child::kInStateValid))
+        {
+            Message *expected = (&child == instance->Get<ChildTable>().GetChildAtIndex(0)) ? message : nullptr;
+
+            VerifyOrQuit(indirectSender->FindIndirectMessage(child) == expected,
+                         "FindIndirectMessage() returned a removed Data Response");
+        }
+
+        VerifyChildren(*instance);
+
+        FreeAllMessages(*instance);
+        VerifyChildren(*instance);
+
+        printf("TestRemoveDataResponseMessages passed\n");
+
+        testFreeInstance(instance);
+    }
+
+    static void BenchmarkPolling(void)
+    {
+        Instance *     instance  = testInitInstance();
+        PriorityQueue *sendQueue = &instance->Get<MeshForwarder>().mSendQueue;
+        uint16_t       numQueued = 0;
+        uint32_t       hash      = 0;
+        uint32_t       scanHash  = 0;
+        Message *      message;
+
+        VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+        AddSleepyChildren(*instance);
+
+        // Fill the send queue with a backlog of direct messages and
+        // then queue one indirect message per sleepy child behind it.
+
+        while ((numQueued + kMaxChildren < OPENTHREAD_CONFIG_NUM_MESSAGE_BUFFERS - 2) &&
+               (message = NewMessage(*instance, Message::kTypeIp6, Message::kPriorityNormal)) != nullptr)
+        {
+            sendQueue->Enqueue(*message);
+            message->SetDirectTransmission();
+            numQueued++;
+        }
+
+        for (Child &child : instance->Get<ChildTable>().Iterate(Child::kInStateValid))
+        {
+            message = NewMessage(*instance, Message::kTypeIp6, Message::kPriorityNormal);
+            VerifyOrQuit(message != nullptr, "Message::New() failed");
+            sendQueue->Enqueue(*message);
+            instance->Get<IndirectSender>().AddMessageForSleepyChild(*message, child);
+            numQueued++;
+        }
+
+        VerifyChildren(*instance);
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t i = 0; i < kNumPolls; i++)
+        {
+            for (Child &child : instance->Get<ChildTable>().Iterate(Child::kInStateValid))
+            {
+                scanHash += reinterpret_cast<uintptr_t>(FindByScan(*instance, child, false)) & 0xffff;
+            }
+        }
+
+        auto scanDuration = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+
+        for (uint16_t i = 0; i < kNumPolls; i++)
+        {
+            for (Child &child : instance->Get<ChildTable>().Iterate(Child::kInStateValid))
+            {
+                hash += reinterpret_cast<uintptr_t>(instance->Get<IndirectSender>().FindIndirectMessage(child)) &
+                        0xffff;
+            }
+        }
+
+        auto duration = std::chrono::steady_clock::now() - start;
+
+        VerifyOrQuit(hash == scanHash, "FindIndirectMessage() does not match full queue scan");
+
+        printf("Indirect message lookup for %d sleepy children, %u queued messages: full scan %.1f ns, "
+               "first queued message %.1f ns\n",
+               kMaxChildren, numQueued,
+               std::chrono::duration<double, std::nano>(scanDuration).count() / (kNumPolls * kMaxChildren),
+               std::chrono::duration<double, std::nano>(duration).count() / (kNumPolls * kMaxChildren));
+
+        FreeAllMessages(*instance);
+        testFreeInstance(instance);
+    }
+
+private:
+    static void AddSleepyChildren(Instance &aInstance)
+    {
+        for (uint16_t i = 0; i < kMaxChildren; i++)
+        {
+            Child *child = aInstance.Get<ChildTable>().GetNewChild();
+
+            VerifyOrQuit(child != nullptr, "ChildTable::GetNewChild() failed");
+            child->SetState(Child::kStateValid);
+            child->SetRloc16(0x1401 + i);
+            child->SetDeviceMode(Mle::DeviceMode(0));
+        }
+    }
+
+    static Child &GetRandomChild(Instance &aInstance)
+    {
+        Child *child = aInstance.Get<ChildTable>().GetChildAtIndex(Random::NonCrypto::GetUint16() % kMaxChildren);
+
+        VerifyOrQuit(child != nullptr, "ChildTable::GetChildAtIndex() failed");
+
+        return *child;
+    }
+
+    static Message *NewMessage(Instance &aInstance, Message::Type aType, Message::Priority aPriority)
+    {
+        return aInstance.Get<MessagePool>().New(aType, 0, Message::Settings(Message::kWithLinkSecurity, aPriority));
+    }
+
+    static Message *GetRandomMessage(Instance &aInstance)
+    {
+        PriorityQueue &sendQueue = aInstance.Get<MeshForwarder>().mSendQueue;
+        uint16_t       length    = 0;
+        uint16_t       index;
+        Message *      message;
+
+        for (message = sendQueue.GetHead(); message != nullptr; message = message->GetNext())
+        {
+            length++;
+        }
+
+        VerifyOrExit(length > 0);
+
+        index = Random::NonCrypto::GetUint16() % length;
+
+        for (message = sendQueue.GetHead(); index > 0; message = message->GetNext())
+        {
+            index--;
+        }
+
+    exit:
+        return message;
+    }
+
+    static void DequeueIfDone(Instance &aInstance, Message &aMessage)
+    {
+        if (!aMessage.GetDirectTransmission() && !aMessage.IsChildPending())
+        {
+            aInstance.Get<MeshForwarder>().mSendQueue.Dequeue(aMessage);
+            aMessage.Free();
+        }
+    }
+
+    static void AddRandomMessage(Instance &aInstance)
+    {
+        bool              supervision = ((Random::NonCrypto::GetUint8() % 8) == 0);
+        Message::Type     type        = supervision ? Message::kTypeSupervision : Message::kTypeIp6;
+        Message::Priority priority    = static_cast<Message::Priority>(Random::NonCrypto::GetUint8() % 4);
+        Message *         message     = NewMessage(aInstance, type, priority);
+
+        VerifyOrExit(message != nullptr);
+
+        aInstance.Get<MeshForwarder>().mSendQueue.Enqueue(*message);
+
+        if (supervision)
+        {
+            aInstance.Get<IndirectSender>().AddMessageForSleepyChild(*message, GetRandomChild(aInstance));
+        }
+        else
+        {
+            uint16_t childMask = Random::NonCrypto::GetUint16();
+
+            for (Child &child : aInstance.Get<ChildTable>().Iterate(Child::kInStateValid))
+            {
+                uint16_t childIndex = aInstance.Get<ChildTable>().GetChildIndex(child);
+
+                if (!child.IsRxOnWhenIdle() && ((childMask & (1U << (childIndex % 16))) != 0))
+                {
+                    aInstance.Get<IndirectSender>().AddMessageForSleepyChild(*message, child);
+                }
+            }
+
+            if ((Random::NonCrypto::GetUint8() % 4) == 0)
+            {
+                message->SetDirectTransmission();
+            }
+        }
+
+        DequeueIfDone(aInstance, *message);
+
+    exit:
+        return;
+    }
+
+    static void RemoveRandomMessageFromChild(Instance &aInstance)
+    {
+        Child &  child   = GetRandomChild(aInstance);
+        Message *message = FindByScan(aInstance, child, false);
+
+        // Mostly remove the first message (as on a successful poll
+        // delivery) and sometimes a random one (as on eviction).
+
+        if ((Random::NonCrypto::GetUint8() % 4) == 0)
+        {
+            message = GetRandomMessage(aInstance);
+        }
+
+        VerifyOrExit(message != nullptr);
+
+        IgnoreError(aInstance.Get<IndirectSender>().RemoveMessageFromSleepyChild(*message, child));
+        DequeueIfDone(aInstance, *message);
+
+    exit:
+        return;
+    }
+
+    static void FinishRandomDirectTransmission(Instance &aInstance)
+    {
+        Message *message = GetRandomMessage(aInstance);
+
+        VerifyOrExit(message != nullptr);
+
+        message->ClearDirectTransmission();
+        DequeueIfDone(aInstance, *message);
+
+    exit:
+        return;
+    }
+
+    static void ChangeRandomChildToRxOn(Instance &aInstance)
+    {
+        Child &         child   = GetRandomChild(aInstance);
+        Mle::DeviceMode oldMode = child.GetDeviceMode();
+
+        VerifyOrExit(!child.IsRxOnWhenIdle());
+
+        child.SetDeviceMode(Mle::DeviceMode(Mle::DeviceMode::kModeRxOnWhenIdle));
+        aInstance.Get<IndirectSender>().HandleChildModeChange(child, oldMode);
+        VerifyOrQuit(child.GetIndirectMessageCount() == 0, "HandleChildModeChange() did not clear the messages");
+        VerifyOrQuit(FindByScan(aInstance, child, false) == nullptr, "HandleChildModeChange() left messages");
+
+        // Make the child sleepy again, without any queued messages.
+        child.SetDeviceMode(oldMode);
+
+    exit:
+        return;
+    }
+
+    static void FreeAllMessages(Instance &aInstance)
+    {
+        PriorityQueue &sendQueue = aInstance.Get<MeshForwarder>().mSendQueue;
+        Message *      message;
+
+        for (Child &child : aInstance.Get<ChildTable>().Iterate(Child::kInStateValid))
+        {
+            aInstance.Get<IndirectSender>().ClearAllMessagesForSleepyChild(child);
+        }
+
+        while ((message = sendQueue.GetHead()) != nullptr)
+        {
+            sendQueue.Dequeue(*message);
+            message->Free();
+        }
+    }
+
+    // The reference (full send queue scan) implementation.
+    static Message *FindByScan(Instance &aInstance, Child &aChild, bool aSupervisionTypeOnly)
+    {
+        uint16_t childIndex = aInstance.Get<ChildTable>().GetChildIndex(aChild);
+        Message *message;
+
+        for (message = aInstance.Get<MeshForwarder>().mSendQueue.GetHead(); message; message = message->GetNext())
+        {
+            if (message->GetChildMask(childIndex) &&
+                (!aSupervisionTypeOnly || (message->GetType() == Message::kTypeSupervision)))
+            {
+                break;
+            }
+        }
+
+        return message;
+    }
+
+    static void VerifyChildren(Instance &aInstance)
+    {
+        IndirectSender &indirectSender = aInstance.Get<IndirectSender>();
+
+        for (Child &child : aInstance.Get<ChildTable>().Iterate(Child::kInStateValid))
+        {
+            uint16_t childIndex = aInstance.Get<ChildTable>().GetChildIndex(child);
+            uint16_t count      = 0;
+
+            for (Message *message = aInstance.Get<MeshForwarder>().mSendQueue.GetHead(); message;
+                 message          = message->GetNext())
+            {
+                if (message->GetChildMask(childIndex))
+                {
+                    count++;
+                }
+            }
+
+            VerifyOrQuit(child.GetIndirectMessageCount() == count, "Child queued message count is incorrect");
+            VerifyOrQuit(indirectSender.FindIndirectMessage(child) == FindByScan(aInstance, child, false),
+                         "FindIndirectMessage() does not match full queue scan");
+            VerifyOrQuit(indirectSender.FindIndirectMessage(child, /* aSupervisionTypeOnly */ true) ==
+                             FindByScan(aInstance, child, true),
+                         "FindIndirectMessage(aSupervisionTypeOnly) does not match full queue scan");
+            VerifyOrQuit(child.GetIndirectMessage() == child.GetFirstQueuedMessage(),
+                         "Child indirect message is not the first queued message");
+        }
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::IndirectSenderTester::TestFirstQueuedMessage();
+    ot::IndirectSenderTester::TestRemoveDataResponseMessages();
+    ot::IndirectSenderTester::BenchmarkPolling();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -0,0 +1,219 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/tasklet.h>
+#include <openthread/thread.h>
+
+#include "common/instance.hpp"
+#include "mac/sub_mac.hpp"
+#include "thread/key_manager.hpp"
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#if OPENTHREAD_FTD
+
+static void ProcessTasklets(ot::Instance &aInstance)
+{
+    while (otTaskletsArePending(&aInstance))
+    {
+        otTaskletsProcess(&aInstance);
+    }
+}
+
+static void VerifyKeyRingCounters(ot::Instance &aInstance, uint32_t aHits, uint32_t aMisses, uint32_t aRefreshes)
+{
+    const otKeyRingCounters &counters = aInstance.Get<ot::KeyManager>().GetKeyRingCounters();
+
+    VerifyOrQuit(counters.mHits == aHits, "Key ring hits counter is incorrect");
+    VerifyOrQuit(counters.mMisses == aMisses, "Key ring misses counter is incorrect");
+    VerifyOrQuit(counters.mRefreshes == aRefreshes, "Key ring refreshes counter is incorrect");
+}
+
+void TestKeyRing(void)
+{
+    ot::Instance *instance = static_cast<ot::Instance *>(testInitInstance());
+    ot::Mle::Key  mleKeys[5];
+    ot::Mac::Key  macKeys[5];
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    ot::KeyManager & keyManager = instance->Get<ot::KeyManager>();
+    ot::Mac::SubMac &subMac     = instance->Get<ot::Mac::SubMac>();
+
+    // Reference keys (for key sequence 7 to 11) are the current keys
+    // when each key sequence is the current one. They are taken in
+    // reverse order, so that key sequence 12 is not in the ring.
+
+    for (uint8_t i = OT_ARRAY_LENGTH(mleKeys); i-- > 0;)
+    {
+        keyManager.SetCurrentKeySequence(7 + i);
+        mleKeys[i] = keyManager.GetCurrentMleKey();
+        macKeys[i] = keyManager.GetTemporaryMacKey(7 + i);
+    }
+
+    // The previous and next keys are prepared along with the current
+    // keys and `SubMac` gets all of them right away.
+
+    keyManager.SetCurrentKeySequence(10);
+    ProcessTasklets(*instance);
+    otThreadResetMleCounters(instance);
+
+    VerifyOrQuit(subMac.GetPreviousMacKey() == macKeys[2], "SubMac previous key is incorrect");
+    VerifyOrQuit(subMac.GetCurrentMacKey() == macKeys[3], "SubMac current key is incorrect");
+    VerifyOrQuit(subMac.GetNextMacKey() == macKeys[4], "SubMac next key is incorrect");
+
+    VerifyOrQuit(keyManager.GetCurrentMleKey() == mleKeys[3], "GetCurrentMleKey() is incorrect");
+    VerifyOrQuit(keyManager.GetTemporaryMleKey(9) == mleKeys[2], "GetTemporaryMleKey() is incorrect");
+    VerifyOrQuit(keyManager.GetTemporaryMleKey(11) == mleKeys[4], "GetTemporaryMleKey() is incorrect");
+    VerifyOrQuit(keyManager.GetTemporaryMacKey(9) == macKeys[2], "GetTemporaryMacKey() is incorrect");
+    VerifyOrQuit(keyManager.GetTemporaryMacKey(11) == macKeys[4], "GetTemporaryMacKey() is incorrect");
+    VerifyKeyRingCounters(*instance, 4, 0, 0);
+
+    // A key rotation keeps the keys already in the ring and only the
+    // new next key sequence is prepared.
+
+    keyManager.SetCurrentKeySequence(11);
+
+    VerifyOrQuit(keyManager.GetCurrentMleKey() == mleKeys[4], "GetCurrentMleKey() is incorrect after key rotation");
+    VerifyOrQuit(subMac.GetPreviousMacKey() == macKeys[3], "SubMac previous key is incorrect after key rotation");
+    VerifyOrQuit(subMac.GetCurrentMacKey() == macKeys[4], "SubMac current key is incorrect after key rotation");
+    VerifyKeyRingCounters(*instance, 4, 0, 1);
+
+    ProcessTasklets(*instance);
+    VerifyKeyRingCounters(*instance, 4, 0, 1);
+
+    VerifyOrQuit(subMac.GetNextMacKey() == keyManager.GetTemporaryMacKey(12), "SubMac next key is incorrect");
+    VerifyKeyRingCounters(*instance, 5, 0, 1);
+
+    // Going back to a key sequence with its adjacent keys in the ring
+    // does not compute any key.
+
+    keyManager.SetCurrentKeySequence(10);
+
+    VerifyOrQuit(subMac.GetPreviousMacKey() == macKeys[2], "SubMac previous key is incorrect");
+    VerifyOrQuit(subMac.GetCurrentMacKey() == macKeys[3], "SubMac current key is incorrect");
+    VerifyOrQuit(subMac.GetNextMacKey() == macKeys[4], "SubMac next key is incorrect");
+
+    ProcessTasklets(*instance);
+    VerifyKeyRingCounters(*instance, 5, 0, 1);
+
+    // After a jump to a key sequence outside of the ring, `SubMac` has
+    // the new keys before any tasklet runs.
+
+    keyManager.SetCurrentKeySequence(8);
+
+    VerifyOrQuit(subMac.GetPreviousMacKey() == macKeys[0], "SubMac previous key is incorrect after a jump");
+    VerifyOrQuit(subMac.GetCurrentMacKey() == macKeys[1], "SubMac current key is incorrect after a jump");
+    VerifyOrQuit(subMac.GetNextMacKey() == macKeys[2], "SubMac next key is incorrect after a jump");
+    VerifyKeyRingCounters(*instance, 5, 0, 2);
+
+    ProcessTasklets(*instance);
+    VerifyKeyRingCounters(*instance, 5, 0, 2);
+
+    VerifyOrQuit(keyManager.GetTemporaryMleKey(7) == mleKeys[0], "GetTemporaryMleKey() is incorrect");
+    VerifyOrQuit(keyManager.GetTemporaryMacKey(7) == macKeys[0], "GetTemporaryMacKey() is incorrect");
+    VerifyKeyRingCounters(*instance, 7, 0, 2);
+
+    // Key sequences outside of the ring are always computed.
+
+    VerifyOrQuit(keyManager.GetTemporaryMleKey(11) == mleKeys[4], "GetTemporaryMleKey() is incorrect");
+    VerifyOrQuit(keyManager.GetTemporaryMleKey(11) == mleKeys[4], "GetTemporaryMleKey() is incorrect");
+    VerifyOrQuit(keyManager.GetTemporaryMacKey(11) == macKeys[4], "GetTemporaryMacKey() is incorrect");
+    VerifyKeyRingCounters(*instance, 7, 3, 2);
+
+    otThreadResetMleCounters(instance);
+    VerifyKeyRingCounters(*instance, 0, 0, 0);
+
+    testFreeInstance(instance);
+
+    printf("TestKeyRing passed\n");
+}
+
+void TestKeyRingMasterKeyChange(void)
+{
+    ot::Instance *instance = static_cast<ot::Instance *>(testInitInstance());
+    ot::MasterKey masterKey;
+    ot::Mle::Key  oldNextKey;
+    ot::Mac::Key  oldMacKeys[3];
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    ot::KeyManager & keyManager = instance->Get<ot::KeyManager>();
+    ot::Mac::SubMac &subMac     = instance->Get<ot::Mac::SubMac>();
+
+    // A new master key resets the key sequence and drops all keys
+    // derived from the old master key.
+
+    keyManager.SetCurrentKeySequence(0);
+    ProcessTasklets(*instance);
+    oldNextKey    = keyManager.GetTemporaryMleKey(1);
+    oldMacKeys[0] = subMac.GetPreviousMacKey();
+    oldMacKeys[1] = subMac.GetCurrentMacKey();
+    oldMacKeys[2] = subMac.GetNextMacKey();
+
+    memset(&masterKey, 0xa5, sizeof(masterKey));
+    SuccessOrQuit(keyManager.SetMasterKey(masterKey), "SetMasterKey() failed");
+
+    // `SubMac` has the keys of the new master key before any tasklet
+    // runs.
+
+    VerifyOrQuit(!(subMac.GetPreviousMacKey() == oldMacKeys[0]), "SubMac kept previous key of old master key");
+    VerifyOrQuit(!(subMac.GetCurrentMacKey() == oldMacKeys[1]), "SubMac kept current key of old master key");
+    VerifyOrQuit(!(subMac.GetNextMacKey() == oldMacKeys[2]), "SubMac kept next key of old master key");
+
+    otThreadResetMleCounters(instance);
+
+    VerifyOrQuit(keyManager.GetCurrentKeySequence() == 0, "Key sequence was not reset");
+    VerifyOrQuit(subMac.GetPreviousMacKey() == keyManager.GetTemporaryMacKey(0xffffffff),
+                 "SubMac previous key is incorrect");
+    VerifyOrQuit(subMac.GetCurrentMacKey() == keyManager.GetTemporaryMacKey(0), "SubMac current key is incorrect");
+    VerifyOrQuit(subMac.GetNextMacKey() == keyManager.GetTemporaryMacKey(1), "SubMac next key is incorrect");
+    VerifyOrQuit(!(keyManager.GetTemporaryMleKey(1) == oldNextKey), "Key ring kept key of old master key");
+    VerifyKeyRingCounters(*instance, 4, 0, 0);
+
+    ProcessTasklets(*instance);
+    VerifyKeyRingCounters(*instance, 4, 0, 0);
+
+    testFreeInstance(instance);
+
+    printf("TestKeyRingMasterKeyChange passed\n");
+}
+
+#endif // OPENTHREAD_FTD
+
+int main(void)
+{
+#if OPENTHREAD_FTD
+    TestKeyRing();
+    TestKeyRingMasterKeyChange();
+#endif
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -28,6 +28,8 @@
 
 #include "test_lowpan.hpp"
 
+#include <chrono>
+
 #include "test_platform.h"
 #include "test_util.hpp"
 
@@ -39,6 +41,18 @@ ot::Instance *  sInstance;
 Ip6::Ip6 *      sIp6;
 Lowpan::Lowpan *sLowpan;
 
+// The test vectors successfully compressed, used by the compression benchmark.
+struct CompressVector
+{
+    Mac::Address mMacSource;
+    Mac::Address mMacDestination;
+    uint8_t      mIp6[256];
+    uint16_t     mIp6Length;
+};
+
+static CompressVector sCompressVectors[64];
+static uint8_t        sNumCompressVectors;
+
 void TestIphcVector::GetCompressedStream(uint8_t *aIphc, uint16_t &aIphcLength)
 {
     memcpy(aIphc, mIphcHeader.mData, mIphcHeader.mLength);
@@ -167,7 +181,9 @@ static void Test(TestIphcVector &aVector, bool aCompress, bool aDecompress)
     DumpBuffer("Expected IPv6 uncompressed packet", ip6, ip6Length);
     DumpBuffer("Expected LOWPAN_IPHC compressed frame", iphc, iphcLength);
 
-    if (aCompress)
+    // Compress twice, so that the second run is always served from
+    // the LOWPAN_IPHC compression cache.
+    for (uint8_t pass = 0; aCompress && pass < 2; pass++)
     {
         Lowpan::BufferWriter buffer(result, 127);
 
@@ -193,6 +209,17 @@ static void Test(TestIphcVector &aVector, bool aCompress, bool aDecompress)
             VerifyOrQuit(compressBytes == aVector.mIphcHeader.mLength, "6lo: Lowpan::Compress failed");
             VerifyOrQuit(message->GetOffset() == aVector.mPayloadOffset, "6lo: Lowpan::Compress failed");
             VerifyOrQuit(memcmp(iphc, result, iphcLength) == 0, "6lo: Lowpan::Compress failed");
+
+            if ((pass == 0) && (sNumCompressVectors < OT_ARRAY_LENGTH(sCompressVectors)) &&
+                (ip6Length <= sizeof(sCompressVectors[0].mIp6)))
+            {
+                CompressVector &vector = sCompressVectors[sNumCompressVectors++];
+
+                vector.mMacSource      = aVector.mMacSource;
+                vector.mMacDestination = aVector.mMacDestination;
+                vector.mIp6Length      = ip6Length;
+                memcpy(vector.mIp6, ip6, ip6Length);
+            }
         }
 
         message->Free();
@@ -1738,6 +1765,125 @@ static void TestErrorReservedNhc6(void)
  * @section Main test.
  **************************************************************************************************/
 
+static uint16_t CompressMessage(Message &aMessage, const Mac::Address &aMacSource, const Mac::Address &aMacDest)
+{
+    uint8_t              result[127];
+    Lowpan::BufferWriter buffer(result, sizeof(result));
+
+    aMessage.SetOffset(0);
+    SuccessOrQuit(sLowpan->Compress(aMessage, aMacSource, aMacDest, buffer), "6lo: Lowpan::Compress failed");
+
+    return static_cast<uint16_t>(buffer.GetWritePointer() - result);
+}
+
+static void TestCompressionCacheInvalidation(void)
+{
+    // Same Network Data as in `Init()`, but context 1 with C = FALSE.
+    uint8_t networkData[] = {
+        0x0c, // MLE Network Data Type
+        0x20, // MLE Network Data Length
+
+        // Prefix 2001:2:0:1::/64
+        0x03, 0x0e,                                                             // Prefix TLV
+        0x00, 0x40, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x07, 0x02, // 6LoWPAN Context ID TLV
+        0x01, 0x40,                                                             // Context ID = 1, C = FALSE
+
+        // Prefix 2001:2:0:2::/64
+        0x03, 0x0e,                                                             // Prefix TLV
+        0x00, 0x40, 0x20, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x07, 0x02, // 6LoWPAN Context ID TLV
+        0x02, 0x40                                                              // Context ID = 2, C = FALSE
+    };
+
+    TestIphcVector testVector("Compression cache invalidation");
+    Message *      message;
+    Message *      networkDataMessage;
+
+    printf("\n=== Test name: %s ===\n\n", testVector.mTestName);
+
+    testVector.SetMacSource(sTestMacSourceDefaultShort);
+    testVector.SetMacDestination(sTestMacDestinationDefaultShort);
+    testVector.SetIpHeader(0x60000000, sizeof(sTestPayloadDefault), Ip6::kProtoIcmp6, 64,
+                           "2001:2:0:1:abcd:ef01:2345:6789", "2001:2:0:1:c31d:a702:0d41:beef");
+    testVector.SetPayload(sTestPayloadDefault, sizeof(sTestPayloadDefault));
+
+    VerifyOrQuit((message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0)) != nullptr,
+                 "6lo: Ip6::NewMessage failed");
+    testVector.GetUncompressedStream(*message);
+
+    // Both addresses are compressed using context 1 (and the result is cached).
+    VerifyOrQuit(CompressMessage(*message, testVector.mMacSource, testVector.mMacDestination) == 20,
+                 "6lo: Lowpan::Compress did not use context 1");
+    VerifyOrQuit(CompressMessage(*message, testVector.mMacSource, testVector.mMacDestination) == 20,
+                 "6lo: Lowpan::Compress did not use context 1");
+
+    // New Network Data (with the same version) no longer allows
+    // compression with context 1, so both addresses are now in-line.
+    VerifyOrQuit((networkDataMessage = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0)) != nullptr,
+                 "6lo: Ip6::NewMessage failed");
+    SuccessOrQuit(networkDataMessage->AppendBytes(networkData, sizeof(networkData)), "6lo: Message::Append failed");
+    SuccessOrQuit(sInstance->Get<NetworkData::Leader>().SetNetworkData(0, 0, true, *networkDataMessage, 0),
+                  "6lo: SetNetworkData failed");
+    networkDataMessage->Free();
+
+    VerifyOrQuit(CompressMessage(*message, testVector.mMacSource, testVector.mMacDestination) == 3 + 2 * 16,
+                 "6lo: Lowpan::Compress used a stale cached context");
+
+    message->Free();
+
+    // Restore the Network Data used by the other tests.
+    Init();
+
+    printf("PASS\n\n");
+}
+
+static void BenchmarkCompression(void)
+{
+    enum
+    {
+        kNumIterations = 2000,
+    };
+
+    std::chrono::steady_clock::duration uncachedDuration{0};
+    std::chrono::steady_clock::duration cachedDuration{0};
+
+    for (uint8_t i = 0; i < sNumCompressVectors; i++)
+    {
+        const CompressVector &vector        = sCompressVectors[i];
+        uint32_t              numCompressed = 0;
+        Message *             message;
+
+        VerifyOrQuit((message = sInstance->Get<MessagePool>().New(Message::kTypeIp6, 0)) != nullptr,
+                     "6lo: Ip6::NewMessage failed");
+        SuccessOrQuit(message->AppendBytes(vector.mIp6, vector.mIp6Length), "6lo: Message::Append failed");
+
+        auto start = std::chrono::steady_clock::now();
+
+        for (uint16_t n = 0; n < kNumIterations; n++)
+        {
+            sLowpan->ClearCompressionCache();
+            numCompressed += CompressMessage(*message, vector.mMacSource, vector.mMacDestination);
+        }
+
+        uncachedDuration += std::chrono::steady_clock::now() - start;
+        start = std::chrono::steady_clock::now();
+
+        for (uint16_t n = 0; n < kNumIterations; n++)
+        {
+            numCompressed -= CompressMessage(*message, vector.mMacSource, vector.mMacDestination);
+        }
+
+        cachedDuration += std::chrono::steady_clock::now() - start;
+
+        VerifyOrQuit(numCompressed == 0, "6lo: Cached compression result differs from uncached one");
+
+        message->Free();
+    }
+
+    printf("LOWPAN_IPHC compression of %u test vectors: uncached %.1f ns, cached %.1f ns\n", sNumCompressVectors,
+           std::chrono::duration<double, std::nano>(uncachedDuration).count() / (kNumIterations * sNumCompressVectors),
+           std::chrono::duration<double, std::nano>(cachedDuration).count() / (kNumIterations * sNumCompressVectors));
+}
+
 void TestLowpanIphc(void)
 {
     sInstance = testInitInstance();
@@ -1827,6 +1973,10 @@ void TestLowpanIphc(void)
     TestErrorReservedNhc5();
     TestErrorReservedNhc6();
 
+    // LOWPAN_IPHC compression cache tests.
+    TestCompressionCacheInvalidation();
+    BenchmarkCompression();
+
     testFreeInstance(sInstance);
 }
 
@@ -0,0 +1,279 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "openthread-core-config.h"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+
+#include "common/instance.hpp"
+#include "mac/mac.hpp"
+#include "mac/sub_mac.hpp"
+#include "thread/mle.hpp"
+
+namespace ot {
+
+static uint8_t      sTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+static otRadioFrame sTxFrame;
+
+class AdaptiveTxPolicyTester
+{
+public:
+    enum
+    {
+        kMaxFrameRetries   = 15,
+        kNumCcaSamples     = 4 * OPENTHREAD_CONFIG_CCA_FAILURE_RATE_AVERAGING_WINDOW,
+        kNumFrameTxSamples = 4 * OPENTHREAD_CONFIG_FRAME_TX_ERR_RATE_AVERAGING_WINDOW,
+    };
+
+    static void TestBackoffExponent(void)
+    {
+        Instance &                      instance = *testInitInstance();
+        Mac::Mac &                      mac      = instance.Get<Mac::Mac>();
+        const otLinkAdaptiveTxCounters &counters = mac.GetAdaptiveTxCounters();
+        Mac::TxFrame &                  frame    = PrepareFrame(instance);
+
+        VerifyOrQuit(!mac.IsAdaptiveTxPolicyEnabled(), "adaptive tx policy is enabled by default");
+
+        // Disabled: a fully busy channel does not change the backoff.
+
+        AddCcaSamples(mac, 100);
+        mac.ApplyAdaptiveBackoff(frame);
+        VerifyOrQuit(GetMinBackoffExponent(mac) == Mac::SubMac::kMinBE, "backoff changed while disabled");
+
+        mac.SetAdaptiveTxPolicyEnabled(true);
+
+        // 100% CCA failures: the backoff starts at macMaxBE.
+
+        mac.ApplyAdaptiveBackoff(frame);
+        VerifyOrQuit(GetMinBackoffExponent(mac) == Mac::SubMac::kMaxBE, "backoff is not raised to macMaxBE");
+        VerifyOrQuit(counters.mBackoffRaised == 1, "BackoffRaised counter is incorrect");
+
+        // A third of the CCA attempts fail: one step above macMinBE.
+
+        AddCcaSamples(mac, 33);
+        mac.ApplyAdaptiveBackoff(frame);
+        VerifyOrQuit(GetMinBackoffExponent(mac) == Mac::SubMac::kMinBE + 1, "backoff is not raised by one");
+
+        // Frames without CSMA-CA or on another channel are not affected.
+
+        frame.SetCsmaCaEnabled(false);
+        mac.ApplyAdaptiveBackoff(frame);
+        VerifyOrQuit(GetMinBackoffExponent(mac) == Mac::SubMac::kMinBE, "backoff raised for frame without CSMA-CA");
+        frame.SetCsmaCaEnabled(true);
+
+        frame.SetChannel(mac.GetPanChannel() == Radio::kChannelMin ? Radio::kChannelMax : Radio::kChannelMin);
+        mac.ApplyAdaptiveBackoff(frame);
+        VerifyOrQuit(GetMinBackoffExponent(mac) == Mac::SubMac::kMinBE, "backoff raised for frame on other channel");
+        frame.SetChannel(mac.GetPanChannel());
+
+        // A quiet channel brings the backoff back to macMinBE.
+
+        AddCcaSamples(mac, 0);
+        mac.ApplyAdaptiveBackoff(frame);
+        VerifyOrQuit(GetMinBackoffExponent(mac) == Mac::SubMac::kMinBE, "backoff is not back to macMinBE");
+        VerifyOrQuit(counters.mBackoffRaised == 2, "BackoffRaised counter is incorrect");
+
+        // Disabling the policy restores macMinBE right away.
+
+        AddCcaSamples(mac, 100);
+        mac.ApplyAdaptiveBackoff(frame);
+        VerifyOrQuit(GetMinBackoffExponent(mac) == Mac::SubMac::kMaxBE, "backoff is not raised to macMaxBE");
+        mac.SetAdaptiveTxPolicyEnabled(false);
+        VerifyOrQuit(GetMinBackoffExponent(mac) == Mac::SubMac::kMinBE, "backoff not restored on disable");
+
+        testFreeInstance(&instance);
+
+        printf("TestBackoffExponent passed\n");
+    }
+
+    static void TestFrameRetries(void)
+    {
+        Instance &                      instance = *testInitInstance();
+        Mac::Mac &                      mac      = instance.Get<Mac::Mac>();
+        const otLinkAdaptiveTxCounters &counters = mac.GetAdaptiveTxCounters();
+        Router &                        parent   = instance.Get<Mle::Mle>().GetParent();
+        Mac::TxFrame &                  frame    = PrepareFrame(instance);
+
+        // Disabled: no change even for a hopeless link.
+
+        AddFrameTxSamples(parent, 100);
+        VerifyOrQuit(ApplyFrameRetries(mac, frame) == kMaxFrameRetries, "retries changed while disabled");
+
+        mac.SetAdaptiveTxPolicyEnabled(true);
+
+        // Hopeless link: retries drop to the minimum.
+
+        VerifyOrQuit(ApplyFrameRetries(mac, frame) == Mac::Mac::kAdaptiveMinFrameRetries,
+                     "retries not lowered for a hopeless link");
+        VerifyOrQuit(counters.mRetriesLimited == 1, "RetriesLimited counter is incorrect");
+        VerifyOrQuit(counters.mRetriesRemoved == kMaxFrameRetries - Mac::Mac::kAdaptiveMinFrameRetries,
+                     "RetriesRemoved counter is incorrect");
+
+        // Poor link (about 80% of the attempts fail): retries are halved.
+
+        AddFrameTxSamples(parent, 80);
+        VerifyOrQuit(ApplyFrameRetries(mac, frame) == (kMaxFrameRetries + 1) / 2, "retries not halved");
+
+        // Good link: the configured retries are kept.
+
+        AddFrameTxSamples(parent, 0);
+        VerifyOrQuit(ApplyFrameRetries(mac, frame) == kMaxFrameRetries, "retries lowered for a good link");
+        VerifyOrQuit(counters.mRetriesLimited == 2, "RetriesLimited counter is incorrect");
+
+        // Frames to an unknown destination or without ack request are not affected.
+
+        AddFrameTxSamples(parent, 100);
+        frame.SetAckRequest(false);
+        VerifyOrQuit(ApplyFrameRetries(mac, frame) == kMaxFrameRetries, "retries lowered for frame without ack");
+        frame.SetAckRequest(true);
+
+        parent.SetState(Neighbor::kStateInvalid);
+        VerifyOrQuit(ApplyFrameRetries(mac, frame) == kMaxFrameRetries, "retries lowered for unknown neighbor");
+
+        mac.ResetAdaptiveTxCounters();
+        VerifyOrQuit(counters.mRetriesLimited == 0 && counters.mRetriesRemoved == 0, "counters were not reset");
+
+        testFreeInstance(&instance);
+
+        printf("TestFrameRetries passed\n");
+    }
+
+#if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
+    static void TestRetryHistogram(void)
+    {
+        Instance &    instance = *testInitInstance();
+        Mac::Mac &    mac      = instance.Get<Mac::Mac>();
+        Mac::TxFrame &frame    = PrepareFrame(instance);
+        uint8_t       maxFrameRetries =
+            OT_MIN(kMaxFrameRetries, OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_MAX_SIZE_COUNT_DIRECT - 1);
+
+        instance.Get<Mle::Mle>().GetParent().SetState(Neighbor::kStateInvalid);
+        mac.SetAdaptiveTxPolicyEnabled(true);
+
+        // Too few samples: the histogram is not used.
+
+        mac.mRetryHistogram.mTxDirectRetrySuccess[0] = Mac::Mac::kAdaptiveMinHistogramSamples - 1;
+        VerifyOrQuit(ApplyFrameRetries(mac, frame, maxFrameRetries) == maxFrameRetries, "histogram used too early");
+
+        // All successful frames needed at most two retries.
+
+        mac.mRetryHistogram.mTxDirectRetrySuccess[0] = 500;
+        mac.mRetryHistogram.mTxDirectRetrySuccess[1] = 300;
+        mac.mRetryHistogram.mTxDirectRetrySuccess[2] = 200;
+        VerifyOrQuit(ApplyFrameRetries(mac, frame, maxFrameRetries) == 3, "retries not limited by the histogram");
+
+        testFreeInstance(&instance);
+
+        printf("TestRetryHistogram passed\n");
+    }
+#endif
+
+private:
+    static Mac::TxFrame &PrepareFrame(Instance &aInstance)
+    {
+        Mac::TxFrame &   frame = *static_cast<Mac::TxFrame *>(&sTxFrame);
+        Router &         parent = aInstance.Get<Mle::Mle>().GetParent();
+        Mac::ExtAddress  extAddress;
+
+        sTxFrame.mPsdu = sTxPsdu;
+
+        memset(&extAddress, 0, sizeof(extAddress));
+        extAddress.m8[7] = 0x01;
+
+        parent.SetExtAddress(extAddress);
+        parent.SetState(Neighbor::kStateValid);
+
+        frame.InitMacHeader(Mac::Frame::kFcfFrameData | Mac::Frame::kFcfFrameVersion2006 | Mac::Frame::kFcfAckRequest |
+                                Mac::Frame::kFcfDstAddrExt | Mac::Frame::kFcfSrcAddrExt,
+                            Mac::Frame::kSecNone);
+        frame.SetDstAddr(extAddress);
+        frame.SetChannel(aInstance.Get<Mac::Mac>().GetPanChannel());
+        frame.SetCsmaCaEnabled(true);
+
+        return frame;
+    }
+
+    static uint8_t ApplyFrameRetries(Mac::Mac &aMac, Mac::TxFrame &aFrame, uint8_t aMaxFrameRetries = kMaxFrameRetries)
+    {
+        aFrame.SetMaxFrameRetries(aMaxFrameRetries);
+        aMac.ApplyAdaptiveFrameRetries(aFrame, /* aIsDirect */ true);
+
+        return aFrame.GetMaxFrameRetries();
+    }
+
+    static uint8_t GetMinBackoffExponent(Mac::Mac &aMac) { return aMac.mLinks.GetSubMac().GetMinBackoffExponent(); }
+
+    static bool IsFailureSample(uint16_t aIndex, uint8_t aFailurePercent)
+    {
+        // Spread the failures evenly so that the averaged rate settles
+        // close to the given percentage.
+
+        return ((aIndex * aFailurePercent) / 100) != (((aIndex + 1) * aFailurePercent) / 100);
+    }
+
+    static void AddCcaSamples(Mac::Mac &aMac, uint8_t aFailurePercent)
+    {
+        for (uint16_t i = 0; i < kNumCcaSamples; i++)
+        {
+            aMac.RecordCcaStatus(!IsFailureSample(i, aFailurePercent), aMac.GetPanChannel());
+        }
+    }
+
+    static void AddFrameTxSamples(Neighbor &aNeighbor, uint8_t aFailurePercent)
+    {
+        for (uint16_t i = 0; i < kNumFrameTxSamples; i++)
+        {
+            aNeighbor.GetLinkInfo().AddFrameTxStatus(!IsFailureSample(i, aFailurePercent));
+        }
+    }
+};
+
+} // namespace ot
+
+int main(void)
+{
+    ot::AdaptiveTxPolicyTester::TestBackoffExponent();
+    ot::AdaptiveTxPolicyTester::TestFrameRetries();
+#if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
+    ot::AdaptiveTxPolicyTester::TestRetryHistogram();
+#endif
+    printf("All tests passed\n");
+    return 0;
+}
+
+#else // OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
+
+int main(void)
+{
+    return 0;
+}
+
+#endif // OPENTHREAD_CONFIG_MAC_ADAPTIVE_TX_POLICY_ENABLE
@@ -199,11 +199,439 @@ void TestMessage(void)
     testFreeInstance(instance);
 }
 
+void TestMessageCursor(void)
+{
+    enum : uint16_t
+    {
+        kMaxSize = (kBufferSize * 3 + 24),
+    };
+
+    Instance *   instance;
+    MessagePool *messagePool;
+    Message *    message;
+    uint8_t      writeBuffer[kMaxSize];
+    uint8_t      readBuffer[kMaxSize];
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMaxSize);
+
+    VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMaxSize), "Message::AppendBytes failed");
+
+    for (uint16_t offset = 0; offset <= kMaxSize; offset += 7)
+    {
+        for (uint16_t length = 0; length <= kMaxSize + 1; length += 13)
+        {
+            uint16_t expectedLength = (offset + length <= kMaxSize) ? length : kMaxSize - offset;
+            uint16_t totalLength    = 0;
+
+            // Iterate over all spans.
+
+            for (Message::Cursor cursor(*message, offset, length); !cursor.IsAtEnd(); cursor.Advance())
+            {
+                VerifyOrQuit(cursor.GetOffset() == offset + totalLength, "Cursor::GetOffset() failed");
+                VerifyOrQuit(cursor.GetRemainingLength() == expectedLength - totalLength,
+                             "Cursor::GetRemainingLength() failed");
+                VerifyOrQuit(cursor.GetLength() > 0, "Cursor::GetLength() failed");
+                VerifyOrQuit(memcmp(cursor.GetData(), &writeBuffer[cursor.GetOffset()], cursor.GetLength()) == 0,
+                             "Cursor data does not match");
+                totalLength += cursor.GetLength();
+            }
+
+            VerifyOrQuit(totalLength == expectedLength, "Cursor span lengths do not match range length");
+
+            // Read the range in small pieces.
+
+            {
+                Message::Cursor cursor(*message, offset, length);
+                uint16_t        readLength = 0;
+                uint16_t        step       = 1 + (length % 5);
+
+                memset(readBuffer, 0, sizeof(readBuffer));
+
+                while (!cursor.IsAtEnd())
+                {
+                    readLength += cursor.ReadBytes(&readBuffer[readLength], step);
+                    VerifyOrQuit(cursor.GetOffset() == offset + readLength, "Cursor::ReadBytes() offset failed");
+                }
+
+                VerifyOrQuit(readLength == expectedLength, "Cursor::ReadBytes() length failed");
+                VerifyOrQuit(memcmp(readBuffer, &writeBuffer[offset], readLength) == 0, "Cursor::ReadBytes() failed");
+                VerifyOrQuit(cursor.ReadBytes(readBuffer, 1) == 0, "Cursor::ReadBytes() read past end");
+            }
+
+            // Skip and then read the rest.
+
+            {
+                Message::Cursor cursor(*message, offset, length);
+                uint16_t        skipLength = length / 3;
+                uint16_t        readLength;
+
+                cursor.Skip(skipLength);
+                readLength = cursor.ReadBytes(readBuffer, kMaxSize);
+
+                if (skipLength >= expectedLength)
+                {
+                    VerifyOrQuit(readLength == 0, "Cursor::Skip() failed");
+                }
+                else
+                {
+                    VerifyOrQuit(readLength == expectedLength - skipLength, "Cursor::Skip() failed");
+                    VerifyOrQuit(memcmp(readBuffer, &writeBuffer[offset + skipLength], readLength) == 0,
+                                 "Cursor::Skip() failed");
+                }
+            }
+        }
+    }
+
+    message->Free();
+
+    testFreeInstance(instance);
+}
+
+void TestAppendBytesFromMessage(void)
+{
+    enum : uint16_t
+    {
+        kMaxSize    = (kBufferSize * 3 + 24),
+        kOffsetStep = 17,
+        kLengthStep = 29,
+    };
+
+    Instance *   instance;
+    MessagePool *messagePool;
+    Message *    message;
+    Message *    message2;
+    uint8_t      writeBuffer[kMaxSize];
+    uint8_t      readBuffer[kMaxSize * 2];
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMaxSize);
+
+    VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMaxSize), "Message::AppendBytes failed");
+
+    for (uint16_t existingLength = 0; existingLength < kMaxSize; existingLength += kOffsetStep)
+    {
+        for (uint16_t offset = 0; offset < kMaxSize; offset += kOffsetStep)
+        {
+            for (uint16_t length = 0; length <= kMaxSize - offset; length += kLengthStep)
+            {
+                VerifyOrQuit((message2 = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+                SuccessOrQuit(message2->AppendBytes(writeBuffer, existingLength), "Message::AppendBytes failed");
+
+                SuccessOrQuit(message2->AppendBytesFromMessage(*message, offset, length),
+                              "AppendBytesFromMessage() failed");
+                VerifyOrQuit(message2->GetLength() == existingLength + length, "AppendBytesFromMessage() length");
+
+                SuccessOrQuit(message2->Read(0, readBuffer, message2->GetLength()), "Message::Read failed");
+                VerifyOrQuit(memcmp(readBuffer, writeBuffer, existingLength) == 0, "AppendBytesFromMessage() failed");
+                VerifyOrQuit(memcmp(&readBuffer[existingLength], &writeBuffer[offset], length) == 0,
+                             "AppendBytesFromMessage() failed");
+
+                // Append from the same message.
+
+                SuccessOrQuit(message2->AppendBytesFromMessage(*message2, 0, existingLength),
+                              "AppendBytesFromMessage() from same message failed");
+                SuccessOrQuit(message2->Read(existingLength + length, readBuffer, existingLength),
+                              "Message::Read failed");
+                VerifyOrQuit(memcmp(readBuffer, writeBuffer, existingLength) == 0,
+                             "AppendBytesFromMessage() from same message failed");
+
+                message2->Free();
+            }
+        }
+    }
+
+    VerifyOrQuit((message2 = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+    VerifyOrQuit(message2->AppendBytesFromMessage(*message, kMaxSize - 1, 2) == OT_ERROR_PARSE,
+                 "AppendBytesFromMessage() accepted an out of bounds range");
+    VerifyOrQuit(message2->GetLength() == 0, "AppendBytesFromMessage() changed length on failure");
+    message2->Free();
+
+    message->Free();
+
+    testFreeInstance(instance);
+}
+
+void TestSpliceFromMessage(void)
+{
+    enum : uint16_t
+    {
+        kMaxSize = (kBufferSize * 5 + 24),
+    };
+
+    Instance *   instance;
+    MessagePool *messagePool;
+    Message *    message;
+    Message *    message2;
+    uint8_t      writeBuffer[kMaxSize];
+    uint8_t      readBuffer[kMaxSize * 2];
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMaxSize);
+
+    for (uint16_t reserved = 0; reserved < kBufferSize * 2; reserved += 37)
+    {
+        for (uint16_t existingLength = 0; existingLength < kMaxSize; existingLength += 53)
+        {
+            for (uint16_t offset = 0; offset <= kMaxSize; offset += 11)
+            {
+                uint16_t freeBufferCount;
+                uint8_t  bufferCount;
+
+                VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, reserved)) != nullptr,
+                             "Message::New failed");
+                SuccessOrQuit(message->AppendBytes(writeBuffer, kMaxSize), "Message::AppendBytes failed");
+
+                VerifyOrQuit((message2 = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+                SuccessOrQuit(message2->AppendBytes(writeBuffer, existingLength), "Message::AppendBytes failed");
+
+                freeBufferCount = messagePool->GetFreeBufferCount();
+                bufferCount     = message->GetBufferCount() + message2->GetBufferCount();
+
+                SuccessOrQuit(message2->SpliceFromMessage(*message, offset), "SpliceFromMessage() failed");
+
+                VerifyOrQuit(message->GetLength() == offset, "SpliceFromMessage() source length");
+                VerifyOrQuit(message2->GetLength() == existingLength + kMaxSize - offset,
+                             "SpliceFromMessage() destination length");
+
+                SuccessOrQuit(message->Read(0, readBuffer, offset), "Message::Read failed");
+                VerifyOrQuit(memcmp(readBuffer, writeBuffer, offset) == 0, "SpliceFromMessage() changed source");
+
+                SuccessOrQuit(message2->Read(0, readBuffer, message2->GetLength()), "Message::Read failed");
+                VerifyOrQuit(memcmp(readBuffer, writeBuffer, existingLength) == 0, "SpliceFromMessage() failed");
+                VerifyOrQuit(memcmp(&readBuffer[existingLength], &writeBuffer[offset], kMaxSize - offset) == 0,
+                             "SpliceFromMessage() failed");
+
+                if (existingLength == 0)
+                {
+                    // Buffers are moved (not copied), so the total
+                    // number of buffers used must not increase by
+                    // more than the one needed for alignment.
+
+                    VerifyOrQuit(message->GetBufferCount() + message2->GetBufferCount() <= bufferCount + 1,
+                                 "SpliceFromMessage() did not move the buffers");
+                    VerifyOrQuit(messagePool->GetFreeBufferCount() + 1 >= freeBufferCount,
+                                 "SpliceFromMessage() allocated new buffers");
+                }
+
+                // Verify that both messages remain usable.
+
+                SuccessOrQuit(message->AppendBytes(&writeBuffer[offset], kMaxSize - offset), "Message::AppendBytes failed");
+                VerifyOrQuit(message->Compare(0, writeBuffer), "Message::AppendBytes after splice failed");
+
+                message->Free();
+                message2->Free();
+            }
+        }
+    }
+
+    // Verify that splicing succeeds with no free buffers other than
+    // the one needed for alignment (i.e., the buffers are relinked).
+    // Network control priority is used so that no buffers are held
+    // back as reserve of a higher priority.
+
+    {
+        Message *filler;
+
+        VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0, Message::kPriorityNet)) != nullptr,
+                     "Message::New failed");
+        SuccessOrQuit(message->AppendBytes(writeBuffer, kMaxSize), "Message::AppendBytes failed");
+        VerifyOrQuit((message2 = messagePool->New(Message::kTypeIp6, 0, Message::kPriorityNet)) != nullptr,
+                     "Message::New failed");
+        VerifyOrQuit((filler = messagePool->New(Message::kTypeIp6, 0, Message::kPriorityNet)) != nullptr,
+                     "Message::New failed");
+
+        while (messagePool->GetFreeBufferCount() > 1)
+        {
+            SuccessOrQuit(filler->SetLength(filler->GetLength() + 1), "Message::SetLength failed");
+        }
+
+        SuccessOrQuit(message2->SpliceFromMessage(*message, 0), "SpliceFromMessage() failed with few free buffers");
+        VerifyOrQuit(message->GetLength() == 0, "SpliceFromMessage() source length");
+        VerifyOrQuit(message2->Compare(0, writeBuffer), "SpliceFromMessage() failed");
+
+        filler->Free();
+        message->Free();
+        message2->Free();
+    }
+
+    VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+    SuccessOrQuit(message->AppendBytes(writeBuffer, 10), "Message::AppendBytes failed");
+    VerifyOrQuit(message->SpliceFromMessage(*message, 0) == OT_ERROR_INVALID_ARGS,
+                 "SpliceFromMessage() accepted same message");
+    VerifyOrQuit((message2 = messagePool->New(Message::kTypeIp6, 0)) != nullptr, "Message::New failed");
+    VerifyOrQuit(message2->SpliceFromMessage(*message, 11) == OT_ERROR_INVALID_ARGS,
+                 "SpliceFromMessage() accepted offset beyond length");
+    message->Free();
+    message2->Free();
+
+    testFreeInstance(instance);
+}
+
+static uint16_t GetInUseBuffers(MessagePool &aMessagePool, Message::Priority aPriority)
+{
+    otMessagePriorityBufferInfo info;
+
+    aMessagePool.GetPriorityBufferInfo(aPriority, info);
+
+    return info.mInUseBuffers;
+}
+
+void TestPriorityBufferInfo(void)
+{
+    enum : uint16_t
+    {
+        kMaxSize = (kBufferSize * 3 + 17),
+    };
+
+    Instance *                  instance;
+    MessagePool *               messagePool;
+    Message *                   message;
+    Message *                   message2;
+    otMessagePriorityBufferInfo info;
+    uint16_t                    baseline[Message::kNumPriorities];
+    uint16_t                    inUse;
+    uint16_t                    minFreeBuffers;
+    uint16_t                    expectedBuffers;
+    uint8_t                     writeBuffer[kMaxSize];
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance\n");
+
+    messagePool = &instance->Get<MessagePool>();
+
+    Random::NonCrypto::FillBuffer(writeBuffer, kMaxSize);
+
+    inUse = 0;
+
+    for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+    {
+        baseline[priority] = GetInUseBuffers(*messagePool, static_cast<Message::Priority>(priority));
+        inUse += baseline[priority];
+    }
+
+    VerifyOrQuit(inUse == messagePool->GetTotalBufferCount() - messagePool->GetFreeBufferCount(),
+                 "Per-priority buffer counts do not match the pool");
+
+    // Buffers are accounted to the priority of the message holding them.
+
+    VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0, Message::kPriorityLow)) != nullptr,
+                 "Message::New failed");
+    SuccessOrQuit(message->AppendBytes(writeBuffer, kMaxSize), "Message::AppendBytes failed");
+    VerifyOrQuit(GetInUseBuffers(*messagePool, Message::kPriorityLow) ==
+                     baseline[Message::kPriorityLow] + message->GetBufferCount(),
+                 "Low priority buffer count is incorrect");
+
+    messagePool->GetPriorityBufferInfo(Message::kPriorityLow, info);
+    VerifyOrQuit(info.mMaxInUseBuffers >= info.mInUseBuffers, "High-water mark is incorrect");
+
+    SuccessOrQuit(message->SetPriority(Message::kPriorityNormal), "Message::SetPriority failed");
+    VerifyOrQuit(GetInUseBuffers(*messagePool, Message::kPriorityLow) == baseline[Message::kPriorityLow],
+                 "SetPriority() did not move the buffers");
+    VerifyOrQuit(GetInUseBuffers(*messagePool, Message::kPriorityNormal) ==
+                     baseline[Message::kPriorityNormal] + message->GetBufferCount(),
+                 "SetPriority() did not move the buffers");
+
+    // Buffers relinked by `SpliceFromMessage()` change priority.
+
+    VerifyOrQuit((message2 = messagePool->New(Message::kTypeIp6, 0, Message::kPriorityNet)) != nullptr,
+                 "Message::New failed");
+    SuccessOrQuit(message2->SpliceFromMessage(*message, 1), "SpliceFromMessage() failed");
+    VerifyOrQuit(GetInUseBuffers(*messagePool, Message::kPriorityNormal) ==
+                     baseline[Message::kPriorityNormal] + message->GetBufferCount(),
+                 "SpliceFromMessage() source buffer count is incorrect");
+    VerifyOrQuit(GetInUseBuffers(*messagePool, Message::kPriorityNet) ==
+                     baseline[Message::kPriorityNet] + message2->GetBufferCount(),
+                 "SpliceFromMessage() destination buffer count is incorrect");
+
+    SuccessOrQuit(message2->SetLength(1), "Message::SetLength failed");
+    VerifyOrQuit(GetInUseBuffers(*messagePool, Message::kPriorityNet) ==
+                     baseline[Message::kPriorityNet] + message2->GetBufferCount(),
+                 "SetLength() did not release the buffers");
+
+    message->Free();
+    message2->Free();
+
+    for (uint8_t priority = 0; priority < Message::kNumPriorities; priority++)
+    {
+        VerifyOrQuit(GetInUseBuffers(*messagePool, static_cast<Message::Priority>(priority)) == baseline[priority],
+                     "Free() did not release the buffers");
+    }
+
+    // A low priority message may use the buffers up to its quota
+    // and must leave the reserve of higher priorities untouched.
+
+    minFreeBuffers = 0;
+
+    for (uint8_t priority = Message::kPriorityNormal; priority < Message::kNumPriorities; priority++)
+    {
+        messagePool->GetPriorityBufferInfo(static_cast<Message::Priority>(priority), info);
+        minFreeBuffers += info.mReservedBuffers;
+    }
+
+    messagePool->GetPriorityBufferInfo(Message::kPriorityLow, info);
+
+    expectedBuffers = messagePool->GetFreeBufferCount() - minFreeBuffers;
+
+    if ((info.mQuota != 0) && (info.mQuota - info.mInUseBuffers < expectedBuffers))
+    {
+        expectedBuffers = info.mQuota - info.mInUseBuffers;
+    }
+
+    VerifyOrQuit((message = messagePool->New(Message::kTypeIp6, 0, Message::kPriorityLow)) != nullptr,
+                 "Message::New failed");
+
+    while (message->SetLength(message->GetLength() + kBufferSize) == OT_ERROR_NONE)
+    {
+    }
+
+    VerifyOrQuit(message->GetBufferCount() == expectedBuffers, "Low priority messages exceeded quota or reserve");
+
+    messagePool->GetPriorityBufferInfo(Message::kPriorityLow, info);
+    VerifyOrQuit(info.mAllocFailures == 1, "Allocation failure was not counted");
+    VerifyOrQuit(info.mMaxInUseBuffers == baseline[Message::kPriorityLow] + expectedBuffers,
+                 "High-water mark is incorrect");
+
+    if (minFreeBuffers > 0)
+    {
+        VerifyOrQuit((message2 = messagePool->New(Message::kTypeIp6, 0, Message::kPriorityNet)) != nullptr,
+                     "Reserved buffers are not available to network control priority");
+        message2->Free();
+    }
+
+    message->Free();
+
+    messagePool->ResetPriorityBufferInfo();
+    messagePool->GetPriorityBufferInfo(Message::kPriorityLow, info);
+    VerifyOrQuit(info.mAllocFailures == 0, "ResetPriorityBufferInfo() failed");
+    VerifyOrQuit(info.mMaxInUseBuffers == info.mInUseBuffers, "ResetPriorityBufferInfo() failed");
+
+    testFreeInstance(instance);
+}
+
 } // namespace ot
 
 int main(void)
 {
     ot::TestMessage();
+    ot::TestMessageCursor();
+    ot::TestAppendBytesFromMessage();
+    ot::TestSpliceFromMessage();
+    ot::TestPriorityBufferInfo();
     printf("All tests passed\n");
     return 0;
 }
@@ -0,0 +1,146 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <thread>
+
+#include <string.h>
+
+#include "test_platform.h"
+
+#include <openthread/config.h>
+
+#include "common/debug.hpp"
+#include "common/linked_list.hpp"
+#include "common/mpsc_queue.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+enum
+{
+    kNumProducers        = 4,
+    kEntriesPerProducer  = 20000,
+    kEntriesInSingleTest = 5,
+};
+
+struct Entry : public LinkedListEntry<Entry>
+{
+    Entry *  mNext;
+    uint8_t  mProducer;
+    uint32_t mSequence;
+};
+
+static Entry sEntries[kNumProducers][kEntriesPerProducer];
+
+void TestMpscQueueSingleThread(void)
+{
+    MpscQueue<Entry> queue;
+    Entry            entries[kEntriesInSingleTest];
+    Entry *          entry;
+    uint32_t         sequence = 0;
+
+    VerifyOrQuit(queue.IsEmpty(), "queue is not empty after init");
+    VerifyOrQuit(queue.PopAll() == nullptr, "PopAll() on empty queue failed");
+
+    for (uint32_t i = 0; i < kEntriesInSingleTest; i++)
+    {
+        entries[i].mSequence = i;
+        VerifyOrQuit(queue.Push(entries[i]) == (i == 0), "Push() returned incorrect empty state");
+        VerifyOrQuit(!queue.IsEmpty(), "queue is empty after Push()");
+    }
+
+    entry = queue.PopAll();
+    VerifyOrQuit(queue.IsEmpty(), "queue is not empty after PopAll()");
+
+    for (; entry != nullptr; entry = entry->GetNext())
+    {
+        VerifyOrQuit(entry->mSequence == sequence++, "PopAll() did not preserve the push order");
+    }
+
+    VerifyOrQuit(sequence == kEntriesInSingleTest, "PopAll() lost entries");
+
+    VerifyOrQuit(queue.Push(entries[0]), "Push() after PopAll() did not report empty queue");
+    VerifyOrQuit(queue.PopAll() == &entries[0], "PopAll() failed");
+    VerifyOrQuit(entries[0].GetNext() == nullptr, "PopAll() did not terminate the list");
+}
+
+void TestMpscQueueMultipleProducers(void)
+{
+    MpscQueue<Entry> queue;
+    std::thread      producers[kNumProducers];
+    uint32_t         nextSequence[kNumProducers];
+    uint32_t         numReceived = 0;
+
+    memset(nextSequence, 0, sizeof(nextSequence));
+
+    for (uint8_t producer = 0; producer < kNumProducers; producer++)
+    {
+        producers[producer] = std::thread([&queue, producer]() {
+            for (uint32_t i = 0; i < kEntriesPerProducer; i++)
+            {
+                Entry &entry = sEntries[producer][i];
+
+                entry.mProducer = producer;
+                entry.mSequence = i;
+                queue.Push(entry);
+            }
+        });
+    }
+
+    // The consumer runs concurrently with the producers. Entries of
+    // each producer must be received exactly once and in order.
+
+    while (numReceived < kNumProducers * kEntriesPerProducer)
+    {
+        for (Entry *entry = queue.PopAll(); entry != nullptr; entry = entry->GetNext())
+        {
+            VerifyOrQuit(entry->mSequence == nextSequence[entry->mProducer], "entries are lost or out of order");
+            nextSequence[entry->mProducer]++;
+            numReceived++;
+        }
+    }
+
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    VerifyOrQuit(queue.IsEmpty(), "queue is not empty after all entries are received");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestMpscQueueSingleThread();
+    ot::TestMpscQueueMultipleProducers();
+
+    printf("All tests passed\n");
+    return 0;
+}
@@ -47,6 +47,7 @@ testPlatRadioSetShortAddress    g_testPlatRadioSetShortAddress    = nullptr;
 testPlatRadioReceive            g_testPlatRadioReceive            = nullptr;
 testPlatRadioTransmit           g_testPlatRadioTransmit           = nullptr;
 testPlatRadioGetTransmitBuffer  g_testPlatRadioGetTransmitBuffer  = nullptr;
+testPlatRadioGetNow             g_testPlatRadioGetNow             = nullptr;
 
 enum
 {
@@ -54,7 +55,9 @@ enum
     FLASH_SWAP_NUM  = 2,
 };
 
-uint8_t g_flash[FLASH_SWAP_SIZE * FLASH_SWAP_NUM];
+uint8_t  g_flash[FLASH_SWAP_SIZE * FLASH_SWAP_NUM];
+bool     g_testPlatFlashKeepOnInit = false;
+uint32_t g_testPlatFlashReadCount  = 0;
 
 ot::Instance *testInitInstance(void)
 {
@@ -295,6 +298,16 @@ otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *aInstance)
     return nullptr;
 }
 
+uint64_t otPlatRadioGetNow(otInstance *aInstance)
+{
+    if (g_testPlatRadioGetNow)
+    {
+        return g_testPlatRadioGetNow(aInstance);
+    }
+
+    return UINT64_MAX;
+}
+
 int8_t otPlatRadioGetRssi(otInstance *)
 {
     return 0;
@@ -543,7 +556,10 @@ void otPlatFlashInit(otInstance *aInstance)
 {
     OT_UNUSED_VARIABLE(aInstance);
 
-    memset(g_flash, 0xff, sizeof(g_flash));
+    if (!g_testPlatFlashKeepOnInit)
+    {
+        memset(g_flash, 0xff, sizeof(g_flash));
+    }
 }
 
 uint32_t otPlatFlashGetSwapSize(otInstance *aInstance)
@@ -579,6 +595,7 @@ void otPlatFlashRead(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffset
     address = aSwapIndex ? FLASH_SWAP_SIZE : 0;
 
     memcpy(aData, g_flash + address + aOffset, aSize);
+    g_testPlatFlashReadCount++;
 }
 
 void otPlatFlashWrite(otInstance *aInstance, uint8_t aSwapIndex, uint32_t aOffset, const void *aData, uint32_t aSize)
@@ -71,6 +71,7 @@ typedef otError (*testPlatRadioDisable)(otInstance *);
 typedef otError (*testPlatRadioReceive)(otInstance *, uint8_t);
 typedef otError (*testPlatRadioTransmit)(otInstance *);
 typedef otRadioFrame *(*testPlatRadioGetTransmitBuffer)(otInstance *);
+typedef uint64_t (*testPlatRadioGetNow)(otInstance *);
 
 extern otRadioCaps                     g_testPlatRadioCaps;
 extern testPlatRadioSetPanId           g_testPlatRadioSetPanId;
@@ -82,6 +83,14 @@ extern testPlatRadioDisable            g_testPlatRadioDisable;
 extern testPlatRadioReceive            g_testPlatRadioReceive;
 extern testPlatRadioTransmit           g_testPlatRadioTransmit;
 extern testPlatRadioGetTransmitBuffer  g_testPlatRadioGetTransmitBuffer;
+extern testPlatRadioGetNow             g_testPlatRadioGetNow;
+
+//
+// Flash Platform
+//
+
+extern bool     g_testPlatFlashKeepOnInit; ///< Whether `otPlatFlashInit()` keeps the flash content (emulates a reboot).
+extern uint32_t g_testPlatFlashReadCount;  ///< Number of `otPlatFlashRead()` calls.
 
 ot::Instance *testInitInstance(void);
 void          testFreeInstance(otInstance *aInstance);
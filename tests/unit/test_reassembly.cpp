@@ -0,0 +1,363 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string.h>
+
+#include "common/instance.hpp"
+#include "common/message.hpp"
+#include "net/ip6_headers.hpp"
+#include "thread/lowpan.hpp"
+#include "thread/mesh_forwarder.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+static uint32_t sNow;
+
+static uint32_t testReassemblyAlarmGetNow(void)
+{
+    return sNow;
+}
+
+class ReassemblyTester
+{
+public:
+    enum : uint16_t
+    {
+        kDatagramSize  = 200, // IPv6 datagram size (uncompressed).
+        kFirstPayload  = 48,  // IPv6 payload bytes in the first fragment (header + payload is a multiple of 8).
+        kNextFragment  = 64,  // IPv6 datagram bytes in a next fragment.
+        kMaxEntries    = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_ENTRIES,
+        kMaxPerSource  = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_MAX_PER_SOURCE,
+        kTimeoutMsec   = OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT * 1000,
+        kNumFragments  = 3,
+        kFirstTag      = 0x1230,
+        kFirstSourceId = 1,
+    };
+
+    explicit ReassemblyTester(Instance &aInstance)
+        : mInstance(aInstance)
+    {
+        mMacDest.SetExtended(kDestExtAddress);
+    }
+
+    void Reset(void)
+    {
+        mInstance.Get<MeshForwarder>().ClearReassemblyList();
+        mInstance.Get<MeshForwarder>().ResetCounters();
+    }
+
+    // Delivers the fragment with index `aFragment` (0 is the first
+    // fragment) of datagram `aTag` from source `aSourceId`.
+    void SendFragment(uint8_t aSourceId, uint16_t aTag, uint8_t aFragment)
+    {
+        uint8_t                frame[OT_RADIO_FRAME_MAX_SIZE];
+        uint16_t               length;
+        Lowpan::FragmentHeader fragmentHeader;
+        Mac::Address           macSource;
+        ThreadLinkInfo         linkInfo;
+        uint8_t                datagram[kDatagramSize];
+
+        GetMacSource(aSourceId, macSource);
+        PrepareDatagram(macSource, aTag, datagram);
+
+        linkInfo.Clear();
+        linkInfo.mLinkSecurity = true;
+
+        if (aFragment == 0)
+        {
+            Lowpan::BufferWriter buffer(frame, sizeof(frame));
+            Message *            message = mInstance.Get<MessagePool>().New(Message::kTypeIp6, 0);
+
+            VerifyOrQuit(message != nullptr, "Message::New() failed");
+            SuccessOrQuit(message->AppendBytes(datagram, sizeof(Ip6::Header)), "Message::AppendBytes() failed");
+
+            fragmentHeader.InitFirstFragment(kDatagramSize, aTag);
+            SuccessOrQuit(buffer.Advance(static_cast<uint8_t>(fragmentHeader.WriteTo(frame))),
+                          "BufferWriter::Advance() failed");
+            SuccessOrQuit(mInstance.Get<Lowpan::Lowpan>().Compress(*message, macSource, mMacDest, buffer),
+                          "Lowpan::Compress() failed");
+            message->Free();
+
+            SuccessOrQuit(buffer.Write(&datagram[sizeof(Ip6::Header)], kFirstPayload), "BufferWriter::Write() failed");
+            length = static_cast<uint16_t>(buffer.GetWritePointer() - frame);
+        }
+        else
+        {
+            uint16_t offset = sizeof(Ip6::Header) + kFirstPayload + (aFragment - 1) * kNextFragment;
+            uint16_t size   = OT_MIN(static_cast<uint16_t>(kDatagramSize - offset), static_cast<uint16_t>(kNextFragment));
+
+            fragmentHeader.Init(kDatagramSize, aTag, offset);
+            length = fragmentHeader.WriteTo(frame);
+            memcpy(&frame[length], &datagram[offset], size);
+            length += size;
+        }
+
+        mInstance.Get<MeshForwarder>().HandleFragment(frame, length, macSource, mMacDest, linkInfo);
+    }
+
+    void SendDatagram(uint8_t aSourceId, uint16_t aTag)
+    {
+        for (uint8_t fragment = 0; fragment < kNumFragments; fragment++)
+        {
+            SendFragment(aSourceId, aTag, fragment);
+        }
+    }
+
+    const otReassemblyCounters &GetCounters(void) const
+    {
+        return mInstance.Get<MeshForwarder>().GetReassemblyCounters();
+    }
+
+    uint16_t GetNumInProgress(void) const
+    {
+        uint16_t count = 0;
+
+        for (const Message *message = mInstance.Get<MeshForwarder>().GetReassemblyQueue().GetHead(); message;
+             message               = message->GetNext())
+        {
+            count++;
+        }
+
+        return count;
+    }
+
+    void AdvanceTime(uint32_t aDuration)
+    {
+        sNow += aDuration;
+        otPlatAlarmMilliFired(&mInstance);
+    }
+
+private:
+    static const Mac::ExtAddress kDestExtAddress;
+
+    static void GetMacSource(uint8_t aSourceId, Mac::Address &aMacSource)
+    {
+        Mac::ExtAddress extAddress;
+
+        memset(extAddress.m8, 0x5a, sizeof(extAddress.m8));
+        extAddress.m8[7] = aSourceId;
+        aMacSource.SetExtended(extAddress);
+    }
+
+    void PrepareDatagram(const Mac::Address &aMacSource, uint16_t aTag, uint8_t *aDatagram)
+    {
+        Ip6::Header  header;
+        Ip6::Address address;
+
+        header.Init();
+        header.SetPayloadLength(kDatagramSize - sizeof(Ip6::Header));
+        header.SetNextHeader(Ip6::kProtoNone);
+        header.SetHopLimit(64);
+        address.SetToLinkLocalAddress(aMacSource.GetExtended());
+        header.SetSource(address);
+        address.SetToLinkLocalAddress(mMacDest.GetExtended());
+        header.SetDestination(address);
+
+        memcpy(aDatagram, &header, sizeof(header));
+
+        for (uint16_t i = sizeof(header); i < kDatagramSize; i++)
+        {
+            aDatagram[i] = static_cast<uint8_t>(i + aTag);
+        }
+    }
+
+    Instance &   mInstance;
+    Mac::Address mMacDest;
+};
+
+const Mac::ExtAddress ReassemblyTester::kDestExtAddress = {{0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80}};
+
+void TestReassemblyInterleaved(ReassemblyTester &aTester)
+{
+    aTester.Reset();
+
+    // Fragments of datagrams from many sources arriving interleaved.
+
+    for (uint8_t fragment = 0; fragment < ReassemblyTester::kNumFragments; fragment++)
+    {
+        for (uint8_t source = 0; source < ReassemblyTester::kMaxEntries; source++)
+        {
+            aTester.SendFragment(ReassemblyTester::kFirstSourceId + source, ReassemblyTester::kFirstTag + source,
+                                 fragment);
+        }
+
+        if (fragment == 0)
+        {
+            VerifyOrQuit(aTester.GetNumInProgress() == ReassemblyTester::kMaxEntries, "Datagrams not in reassembly");
+        }
+    }
+
+    VerifyOrQuit(aTester.GetCounters().mStarted == ReassemblyTester::kMaxEntries, "Started counter is incorrect");
+    VerifyOrQuit(aTester.GetCounters().mCompleted == ReassemblyTester::kMaxEntries, "Completed counter is incorrect");
+    VerifyOrQuit(aTester.GetCounters().mEvicted == 0, "Evicted counter is incorrect");
+    VerifyOrQuit(aTester.GetCounters().mUnmatched == 0, "Unmatched counter is incorrect");
+    VerifyOrQuit(aTester.GetNumInProgress() == 0, "Reassembly list is not empty");
+
+    // The same tag from different sources is reassembled separately,
+    // while a fragment with an unknown tag is not matched.
+
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag, 0);
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId + 1, ReassemblyTester::kFirstTag, 0);
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag + 1, 1);
+    VerifyOrQuit(aTester.GetCounters().mUnmatched == 1, "Unmatched counter is incorrect");
+
+    for (uint8_t fragment = 1; fragment < ReassemblyTester::kNumFragments; fragment++)
+    {
+        aTester.SendFragment(ReassemblyTester::kFirstSourceId + 1, ReassemblyTester::kFirstTag, fragment);
+        aTester.SendFragment(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag, fragment);
+    }
+
+    VerifyOrQuit(aTester.GetCounters().mCompleted == ReassemblyTester::kMaxEntries + 2,
+                 "Completed counter is incorrect");
+    VerifyOrQuit(aTester.GetNumInProgress() == 0, "Reassembly list is not empty");
+
+    printf("TestReassemblyInterleaved passed\n");
+}
+
+void TestReassemblyLimits(ReassemblyTester &aTester)
+{
+    aTester.Reset();
+
+    // A new first fragment with the tag of an in-progress datagram
+    // restarts the datagram.
+
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag, 0);
+    aTester.SendDatagram(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag);
+    VerifyOrQuit(aTester.GetCounters().mEvicted == 1, "Evicted counter is incorrect");
+    VerifyOrQuit(aTester.GetCounters().mCompleted == 1, "Completed counter is incorrect");
+    VerifyOrQuit(aTester.GetNumInProgress() == 0, "Reassembly list is not empty");
+
+    // A source going over its limit drops its own oldest datagram.
+
+    aTester.Reset();
+
+    for (uint16_t i = 0; i <= ReassemblyTester::kMaxPerSource; i++)
+    {
+        aTester.SendFragment(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag + i, 0);
+        aTester.AdvanceTime(10);
+    }
+
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId + 1, ReassemblyTester::kFirstTag, 0);
+
+    VerifyOrQuit(aTester.GetCounters().mSourceLimited == 1, "SourceLimited counter is incorrect");
+    VerifyOrQuit(aTester.GetNumInProgress() == ReassemblyTester::kMaxPerSource + 1, "Reassembly list is incorrect");
+
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag, 1);
+    VerifyOrQuit(aTester.GetCounters().mUnmatched == 1, "Dropped datagram was still reassembled");
+
+    for (uint16_t i = 1; i <= ReassemblyTester::kMaxPerSource; i++)
+    {
+        for (uint8_t fragment = 1; fragment < ReassemblyTester::kNumFragments; fragment++)
+        {
+            aTester.SendFragment(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag + i, fragment);
+        }
+    }
+
+    VerifyOrQuit(aTester.GetCounters().mCompleted == ReassemblyTester::kMaxPerSource, "Completed counter is incorrect");
+    VerifyOrQuit(aTester.GetNumInProgress() == 1, "Reassembly list is incorrect");
+
+    // A full table drops the oldest datagram of any source.
+
+    aTester.Reset();
+
+    for (uint8_t source = 0; source <= ReassemblyTester::kMaxEntries; source++)
+    {
+        aTester.SendFragment(ReassemblyTester::kFirstSourceId + source, ReassemblyTester::kFirstTag, 0);
+        aTester.AdvanceTime(10);
+    }
+
+    VerifyOrQuit(aTester.GetCounters().mEvicted == 1, "Evicted counter is incorrect");
+    VerifyOrQuit(aTester.GetNumInProgress() == ReassemblyTester::kMaxEntries, "Reassembly list is incorrect");
+
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag, 1);
+    VerifyOrQuit(aTester.GetCounters().mUnmatched == 1, "Dropped datagram was still reassembled");
+
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId + 1, ReassemblyTester::kFirstTag, 1);
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId + 1, ReassemblyTester::kFirstTag, 2);
+    VerifyOrQuit(aTester.GetCounters().mCompleted == 1, "Completed counter is incorrect");
+
+    printf("TestReassemblyLimits passed\n");
+}
+
+void TestReassemblyTimeout(ReassemblyTester &aTester)
+{
+    aTester.Reset();
+
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag, 0);
+    aTester.AdvanceTime(ReassemblyTester::kTimeoutMsec * 3 / 10);
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId + 1, ReassemblyTester::kFirstTag, 0);
+
+    // Each received fragment extends the deadline of its datagram.
+
+    aTester.AdvanceTime(ReassemblyTester::kTimeoutMsec * 3 / 10);
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag, 1);
+
+    aTester.AdvanceTime(ReassemblyTester::kTimeoutMsec * 3 / 4);
+    VerifyOrQuit(aTester.GetCounters().mTimedOut == 1, "TimedOut counter is incorrect");
+    VerifyOrQuit(aTester.GetNumInProgress() == 1, "Timed out datagram is still in reassembly");
+
+    aTester.SendFragment(ReassemblyTester::kFirstSourceId, ReassemblyTester::kFirstTag, 2);
+    VerifyOrQuit(aTester.GetCounters().mCompleted == 1, "Completed counter is incorrect");
+
+    aTester.AdvanceTime(ReassemblyTester::kTimeoutMsec);
+    VerifyOrQuit(aTester.GetCounters().mTimedOut == 1, "TimedOut counter is incorrect");
+    VerifyOrQuit(aTester.GetNumInProgress() == 0, "Reassembly list is not empty");
+
+    printf("TestReassemblyTimeout passed\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::Instance *instance;
+
+    ot::sNow              = 0;
+    g_testPlatAlarmGetNow = ot::testReassemblyAlarmGetNow;
+
+    instance = static_cast<ot::Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+    instance->Get<ot::MeshForwarder>().Start();
+
+    {
+        ot::ReassemblyTester tester(*instance);
+
+        ot::TestReassemblyInterleaved(tester);
+        ot::TestReassemblyLimits(tester);
+        ot::TestReassemblyTimeout(tester);
+    }
+
+    testFreeInstance(instance);
+    g_testPlatAlarmGetNow = nullptr;
+
+    printf("All tests passed\n");
+    return 0;
+}
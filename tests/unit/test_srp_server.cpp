@@ -0,0 +1,750 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <chrono>
+#include <stdlib.h>
+
+#include <openthread/config.h>
+#include <openthread/heap.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "crypto/ecdsa.hpp"
+#include "crypto/sha256.hpp"
+#include "net/dns_headers.hpp"
+#include "net/srp_server.hpp"
+
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+
+namespace ot {
+
+enum : uint32_t
+{
+    kNumHosts           = 16,
+    kNumServicesPerHost = 4,
+    kNumRefreshRounds   = 3,
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+    kNumRegistryHosts = 2048,
+#else
+    kNumRegistryHosts = 64, // As many as the internal heap can hold.
+#endif
+    kNumRegistryRounds  = 4, // One registration and three refreshes of each registry host.
+    kLease              = 120, // The LEASE requested by the hosts (in seconds).
+    kKeyLease           = 600, // The KEY-LEASE requested by the hosts (in seconds).
+    kRefreshInterval    = 500, // Interval between two refresh rounds (in milliseconds).
+    kMaxUpdateLength    = 1280,
+};
+
+static const char kDomain[]        = "default.service.arpa.";
+static const char kServiceLabels[] = "_srp-test._udp";
+
+struct TestHost
+{
+    Crypto::Ecdsa::P256::KeyPair mKeyPair;
+    char                         mName[Dns::Name::kMaxLabelLength + 1];
+    char                         mFullName[Dns::Name::kMaxLength + 1];
+    Ip6::MessageInfo             mMessageInfo;
+    uint8_t                      mUpdate[kMaxUpdateLength]; // A signed update which is replayed.
+    uint16_t                     mUpdateLength;
+};
+
+static Instance *sInstance;
+static TestHost  sHosts[kNumHosts];
+static uint16_t  sMessageId;
+static uint32_t  sNow;
+static uint32_t  sAlarmFireTime;
+static bool      sAlarmOn;
+
+static void TestAlarmStop(otInstance *)
+{
+    sAlarmOn = false;
+}
+
+static void TestAlarmStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn       = true;
+    sAlarmFireTime = aT0 + aDt;
+}
+
+static uint32_t TestAlarmGetNow(void)
+{
+    return sNow;
+}
+
+static void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t end = sNow + aDuration;
+
+    // Jump from one alarm to the next, the leases are much longer than
+    // what a walk over each millisecond could cover.
+
+    while (sAlarmOn && (static_cast<int32_t>(end - sAlarmFireTime) >= 0))
+    {
+        if (static_cast<int32_t>(sAlarmFireTime - sNow) > 0)
+        {
+            sNow = sAlarmFireTime;
+        }
+
+        sAlarmOn = false;
+        otPlatAlarmMilliFired(sInstance);
+    }
+
+    sNow = end;
+}
+
+class SrpServerTester
+{
+public:
+    static void Start(Srp::Server &aServer) { aServer.Start(); }
+    static void Stop(Srp::Server &aServer) { aServer.Stop(); }
+
+    static void Receive(Srp::Server &aServer, Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+    {
+        aServer.HandleUdpReceive(aMessage, aMessageInfo);
+    }
+
+    static Srp::Server::Host *FindHost(Srp::Server &aServer, const char *aFullName)
+    {
+        return aServer.FindHost(aFullName);
+    }
+
+    static Srp::Server::Service *FindService(Srp::Server &aServer, const char *aFullName)
+    {
+        return aServer.FindService(aFullName, nullptr);
+    }
+
+    static uint16_t GetLeaseHeapSize(const Srp::Server &aServer) { return aServer.mLeaseHeapSize; }
+
+    // This method creates the host of an update, as the server does once
+    // the update has been parsed and its signature verified.
+    static Srp::Server::Host *NewHost(const char *aFullName, const Ip6::Address &aAddress)
+    {
+        Srp::Server::Host *host = Srp::Server::Host::New(*sInstance);
+
+        VerifyOrQuit(host != nullptr, "Host::New() failed");
+        SuccessOrQuit(host->SetFullName(aFullName), "SetFullName() failed");
+        SuccessOrQuit(host->AddIp6Address(aAddress), "AddIp6Address() failed");
+        host->SetLease(kLease);
+        host->SetKeyLease(kKeyLease);
+
+        return host;
+    }
+
+    static void AddService(Srp::Server::Host &aHost, const char *aFullName, uint16_t aPort)
+    {
+        static const uint8_t kTxtData[] = {3, 'a', '=', '0'};
+
+        Srp::Server::Service *service = aHost.AddNewService(aFullName);
+
+        VerifyOrQuit(service != nullptr, "AddNewService() failed");
+        service->mPort = aPort;
+        SuccessOrQuit(service->SetTxtData(kTxtData, sizeof(kTxtData)), "SetTxtData() failed");
+    }
+
+    static void HandleUpdateResult(Srp::Server &aServer, Srp::Server::Host &aHost, const Ip6::MessageInfo &aMessageInfo)
+    {
+        Dns::UpdateHeader header;
+
+        header.SetMessageId(++sMessageId);
+        aServer.HandleSrpUpdateResult(OT_ERROR_NONE, header, aHost, aMessageInfo);
+    }
+
+    static uint32_t GetNumInternedNames(const Srp::Server &aServer)
+    {
+        uint32_t count = 0;
+
+        for (const Srp::Server::InternedName *entry : aServer.mNameTable)
+        {
+            for (; entry != nullptr; entry = entry->mNext)
+            {
+                count++;
+            }
+        }
+
+        return count;
+    }
+};
+
+static void GetServiceInstanceName(uint16_t aServiceIndex, char *aName, uint16_t aSize)
+{
+    snprintf(aName, aSize, "ins%u.%s.%s", aServiceIndex, kServiceLabels, kDomain);
+}
+
+static void UpdateRecordLength(Dns::ResourceRecord &aRecord, uint16_t aOffset, Message &aMessage)
+{
+    aRecord.SetLength(aMessage.GetLength() - aOffset - sizeof(Dns::ResourceRecord));
+    aMessage.Write(aOffset, aRecord);
+}
+
+// This function appends a name, compressed as a pointer to its previous
+// occurrence at `aNameOffset` if any, like `Srp::Client` does.
+static void AppendName(Message &aMessage, const char *aLabels, uint16_t &aNameOffset, uint16_t aSuffixOffset)
+{
+    if (aNameOffset != 0)
+    {
+        SuccessOrQuit(Dns::Name::AppendPointerLabel(aNameOffset, aMessage), "AppendPointerLabel() failed");
+    }
+    else
+    {
+        aNameOffset = aMessage.GetLength();
+        SuccessOrQuit(Dns::Name::AppendMultipleLabels(aLabels, aMessage), "AppendMultipleLabels() failed");
+        SuccessOrQuit(Dns::Name::AppendPointerLabel(aSuffixOffset, aMessage), "AppendPointerLabel() failed");
+    }
+}
+
+static void AppendDeleteAllRrsets(Message &aMessage)
+{
+    Dns::ResourceRecord rr;
+
+    rr.Init(Dns::ResourceRecord::kTypeAny, Dns::ResourceRecord::kClassAny);
+    rr.SetTtl(0);
+    rr.SetLength(0);
+    SuccessOrQuit(aMessage.Append(rr), "Append() failed");
+}
+
+// This function builds a signed SRP update in the same way as `Srp::Client`
+// does, registering `aNumServices` services starting from `aFirstService`.
+static Message *PrepareUpdate(const TestHost &aHost,
+                              uint16_t        aFirstService,
+                              uint16_t        aNumServices,
+                              uint32_t        aLease,
+                              uint32_t        aKeyLease)
+{
+    Message *                      message = sInstance->Get<Ip6::Udp>().NewMessage(0);
+    Dns::UpdateHeader              header;
+    Dns::ResourceRecord            rr;
+    Dns::SrvRecord                 srv;
+    Dns::KeyRecord                 key;
+    Dns::OptRecord                 optRecord;
+    Dns::LeaseOption               leaseOption;
+    Dns::SigRecord                 sig;
+    Crypto::Ecdsa::P256::PublicKey publicKey;
+    Crypto::Ecdsa::P256::Signature signature;
+    Crypto::Sha256                 sha256;
+    Crypto::Sha256::Hash           hash;
+    uint16_t                       recordCount       = 0;
+    uint16_t                       serviceNameOffset = 0;
+    uint16_t                       hostNameOffset    = 0;
+    uint16_t                       domainNameOffset;
+    uint16_t                       offset;
+
+    VerifyOrQuit(message != nullptr, "NewMessage() failed");
+
+    header.SetMessageId(++sMessageId);
+    header.SetZoneRecordCount(1);
+    header.SetAdditionalRecordCount(1);
+    SuccessOrQuit(message->Append(header), "Append() failed");
+
+    domainNameOffset = message->GetLength();
+    SuccessOrQuit(Dns::Name::AppendName(kDomain, *message), "AppendName() failed");
+    SuccessOrQuit(message->Append(Dns::Zone()), "Append() failed");
+
+    for (uint16_t index = aFirstService; index < aFirstService + aNumServices; index++)
+    {
+        char     instanceLabel[Dns::Name::kMaxLabelLength + 1];
+        uint16_t instanceNameOffset = 0;
+        uint8_t  txtData[]          = {3, 'a', '=', static_cast<uint8_t>('0' + index % 10)};
+
+        snprintf(instanceLabel, sizeof(instanceLabel), "ins%u", index);
+
+        // Service Discovery Instruction.
+
+        AppendName(*message, kServiceLabels, serviceNameOffset, domainNameOffset);
+        rr.Init(Dns::ResourceRecord::kTypePtr);
+        rr.SetTtl(kLease);
+        offset = message->GetLength();
+        SuccessOrQuit(message->Append(rr), "Append() failed");
+        AppendName(*message, instanceLabel, instanceNameOffset, serviceNameOffset);
+        UpdateRecordLength(rr, offset, *message);
+        recordCount++;
+
+        // Service Description Instruction.
+
+        AppendName(*message, instanceLabel, instanceNameOffset, serviceNameOffset);
+        AppendDeleteAllRrsets(*message);
+        recordCount++;
+
+        AppendName(*message, instanceLabel, instanceNameOffset, serviceNameOffset);
+        srv.Init();
+        srv.SetTtl(kLease);
+        srv.SetPriority(0);
+        srv.SetWeight(0);
+        srv.SetPort(static_cast<uint16_t>(1000 + index));
+        offset = message->GetLength();
+        SuccessOrQuit(message->Append(srv), "Append() failed");
+        AppendName(*message, aHost.mName, hostNameOffset, domainNameOffset);
+        UpdateRecordLength(srv, offset, *message);
+        recordCount++;
+
+        AppendName(*message, instanceLabel, instanceNameOffset, serviceNameOffset);
+        rr.Init(Dns::ResourceRecord::kTypeTxt);
+        rr.SetTtl(kLease);
+        offset = message->GetLength();
+        SuccessOrQuit(message->Append(rr), "Append() failed");
+        SuccessOrQuit(message->AppendBytes(txtData, sizeof(txtData)), "AppendBytes() failed");
+        UpdateRecordLength(rr, offset, *message);
+        recordCount++;
+    }
+
+    // Host Description Instruction.
+
+    AppendName(*message, aHost.mName, hostNameOffset, domainNameOffset);
+    AppendDeleteAllRrsets(*message);
+    recordCount++;
+
+    AppendName(*message, aHost.mName, hostNameOffset, domainNameOffset);
+    rr.Init(Dns::ResourceRecord::kTypeAaaa);
+    rr.SetTtl(kLease);
+    rr.SetLength(sizeof(Ip6::Address));
+    SuccessOrQuit(message->Append(rr), "Append() failed");
+    SuccessOrQuit(message->Append(aHost.mMessageInfo.GetPeerAddr()), "Append() failed");
+    recordCount++;
+
+    AppendName(*message, aHost.mName, hostNameOffset, domainNameOffset);
+    key.Init();
+    key.SetTtl(kLease);
+    key.SetFlags(Dns::KeyRecord::kAuthConfidPermitted, Dns::KeyRecord::kOwnerNonZone,
+                 Dns::KeyRecord::kSignatoryFlagGeneral);
+    key.SetProtocol(Dns::KeyRecord::kProtocolDnsSec);
+    key.SetAlgorithm(Dns::KeyRecord::kAlgorithmEcdsaP256Sha256);
+    key.SetLength(sizeof(Dns::KeyRecord) - sizeof(Dns::ResourceRecord) + sizeof(Crypto::Ecdsa::P256::PublicKey));
+    SuccessOrQuit(message->Append(key), "Append() failed");
+    SuccessOrQuit(aHost.mKeyPair.GetPublicKey(publicKey), "GetPublicKey() failed");
+    SuccessOrQuit(message->Append(publicKey), "Append() failed");
+    recordCount++;
+
+    header.SetUpdateRecordCount(recordCount);
+    message->Write(0, header);
+
+    // Additional Data section: Update Lease OPT and SIG(0).
+
+    SuccessOrQuit(Dns::Name::AppendTerminator(*message), "AppendTerminator() failed");
+    optRecord.Init();
+    optRecord.SetUdpPayloadSize(Ip6::Ip6::kMaxDatagramLength);
+    optRecord.SetDnsSecurityFlag();
+    optRecord.SetLength(sizeof(Dns::LeaseOption));
+    SuccessOrQuit(message->Append(optRecord), "Append() failed");
+    leaseOption.Init();
+    leaseOption.SetLeaseInterval(aLease);
+    leaseOption.SetKeyLeaseInterval(aKeyLease);
+    SuccessOrQuit(message->Append(leaseOption), "Append() failed");
+
+    sig.Clear();
+    sig.Init(Dns::ResourceRecord::kClassAny);
+    sig.SetAlgorithm(Dns::KeyRecord::kAlgorithmEcdsaP256Sha256);
+
+    offset = message->GetLength();
+    SuccessOrQuit(message->Append(sig), "Append() failed");
+    SuccessOrQuit(Dns::Name::AppendName(aHost.mFullName, *message), "AppendName() failed");
+
+    sha256.Start();
+    sha256.Update(*message, offset + sizeof(Dns::ResourceRecord),
+                  message->GetLength() - offset - sizeof(Dns::ResourceRecord));
+    sha256.Update(*message, 0, offset);
+    sha256.Finish(hash);
+    SuccessOrQuit(aHost.mKeyPair.Sign(hash, signature), "Sign() failed");
+
+    IgnoreError(message->SetLength(offset));
+    SuccessOrQuit(Dns::Name::AppendTerminator(*message), "AppendTerminator() failed");
+    offset = message->GetLength();
+    SuccessOrQuit(message->Append(sig), "Append() failed");
+    AppendName(*message, aHost.mName, hostNameOffset, domainNameOffset);
+    SuccessOrQuit(message->Append(signature), "Append() failed");
+    UpdateRecordLength(sig, offset, *message);
+
+    header.SetAdditionalRecordCount(2);
+    message->Write(0, header);
+
+    return message;
+}
+
+static void SendUpdate(const TestHost &aHost, Message &aMessage)
+{
+    SrpServerTester::Receive(sInstance->Get<Srp::Server>(), aMessage, aHost.mMessageInfo);
+
+    // Flush the responses.
+    otTaskletsProcess(sInstance);
+}
+
+static void SendUpdate(const TestHost &aHost,
+                       uint16_t        aFirstService,
+                       uint16_t        aNumServices,
+                       uint32_t        aLease,
+                       uint32_t        aKeyLease)
+{
+    Message *message = PrepareUpdate(aHost, aFirstService, aNumServices, aLease, aKeyLease);
+
+    SendUpdate(aHost, *message);
+    message->Free();
+}
+
+static void SaveUpdate(TestHost &aHost, uint16_t aFirstService, uint16_t aNumServices)
+{
+    Message *message = PrepareUpdate(aHost, aFirstService, aNumServices, kLease, kKeyLease);
+
+    VerifyOrQuit(message->GetLength() <= sizeof(aHost.mUpdate), "update is too long");
+    aHost.mUpdateLength = message->ReadBytes(0, aHost.mUpdate, message->GetLength());
+    message->Free();
+}
+
+static void ReplayUpdate(const TestHost &aHost)
+{
+    Message *message = sInstance->Get<Ip6::Udp>().NewMessage(0);
+
+    VerifyOrQuit(message != nullptr, "NewMessage() failed");
+    SuccessOrQuit(message->AppendBytes(aHost.mUpdate, aHost.mUpdateLength), "AppendBytes() failed");
+
+    SendUpdate(aHost, *message);
+    message->Free();
+}
+
+static void InitHost(TestHost &aHost, uint16_t aIndex)
+{
+    char address[sizeof("fd00::ffff")];
+
+    snprintf(aHost.mName, sizeof(aHost.mName), "host%u", aIndex);
+    snprintf(aHost.mFullName, sizeof(aHost.mFullName), "%s.%s", aHost.mName, kDomain);
+    snprintf(address, sizeof(address), "fd00::%x", aIndex + 1);
+
+    SuccessOrQuit(aHost.mKeyPair.Generate(), "KeyPair::Generate() failed");
+    SuccessOrQuit(aHost.mMessageInfo.GetPeerAddr().FromString(address), "FromString() failed");
+    aHost.mMessageInfo.SetPeerPort(static_cast<uint16_t>(5000 + aIndex));
+}
+
+static void VerifyHostRegistered(Srp::Server &aServer, const char *aFullName, uint16_t aHostIndex)
+{
+    const Srp::Server::Host *host        = SrpServerTester::FindHost(aServer, aFullName);
+    uint16_t                 numServices = 0;
+
+    VerifyOrQuit(host != nullptr, "registered host is not found");
+    VerifyOrQuit(!host->IsDeleted(), "registered host is deleted");
+
+    for (uint16_t index = aHostIndex * kNumServicesPerHost; index < (aHostIndex + 1) * kNumServicesPerHost; index++)
+    {
+        char                        name[Dns::Name::kMaxLength + 1];
+        const Srp::Server::Service *service;
+
+        GetServiceInstanceName(index, name, sizeof(name));
+        service = SrpServerTester::FindService(aServer, name);
+
+        VerifyOrQuit(service != nullptr, "registered service is not found");
+        VerifyOrQuit(&service->GetHost() == host, "service is found under the wrong host");
+        VerifyOrQuit(!service->IsDeleted(), "registered service is deleted");
+        VerifyOrQuit(service->GetPort() == 1000 + index, "service has the wrong port");
+    }
+
+    for (const Srp::Server::Service *service = host->GetNextService(nullptr); service != nullptr;
+         service                             = host->GetNextService(service))
+    {
+        numServices++;
+    }
+
+    VerifyOrQuit(numServices == kNumServicesPerHost, "host has the wrong number of services");
+}
+
+static void VerifyHostRegistered(Srp::Server &aServer, uint16_t aHostIndex)
+{
+    VerifyHostRegistered(aServer, sHosts[aHostIndex].mFullName, aHostIndex);
+}
+
+void TestSrpServerLoad(void)
+{
+    Srp::Server *server;
+    TestHost     intruder;
+    char         serviceName[Dns::Name::kMaxLength + 1];
+    uint32_t     numUpdates = 0;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    g_testPlatAlarmStop    = TestAlarmStop;
+    g_testPlatAlarmStartAt = TestAlarmStartAt;
+    g_testPlatAlarmGetNow  = TestAlarmGetNow;
+
+    sNow     = 0;
+    sAlarmOn = false;
+
+    server = &sInstance->Get<Srp::Server>();
+    SuccessOrQuit(server->SetLeaseRange(kLease / 2, kLease, kKeyLease / 2, kKeyLease), "SetLeaseRange() failed");
+    SrpServerTester::Start(*server);
+    VerifyOrQuit(server->IsRunning(), "server failed to start");
+
+    // The updates are signed once and replayed, so that the time spent in
+    // the server is measured.
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        InitHost(sHosts[i], i);
+        SaveUpdate(sHosts[i], i * kNumServicesPerHost, kNumServicesPerHost);
+    }
+
+    // Register all hosts, then replay refreshes of all of them.
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t round = 0; round <= kNumRefreshRounds; round++)
+    {
+        if (round > 0)
+        {
+            AdvanceTime(kRefreshInterval);
+        }
+
+        for (uint16_t i = 0; i < kNumHosts; i++)
+        {
+            ReplayUpdate(sHosts[i]);
+            numUpdates++;
+        }
+    }
+
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    printf("SRP server: %u signed updates of %u hosts with %u services each in %.1f ms (%.1f us/update)\n",
+           static_cast<unsigned>(numUpdates), static_cast<unsigned>(kNumHosts),
+           static_cast<unsigned>(kNumServicesPerHost), std::chrono::duration<double, std::milli>(duration).count(),
+           std::chrono::duration<double, std::micro>(duration).count() / numUpdates);
+
+    // The refreshes extend the leases beyond the LEASE of the first registration.
+
+    AdvanceTime(kLease * 1000 - kRefreshInterval);
+
+    for (uint16_t i = 0; i < kNumHosts; i++)
+    {
+        VerifyHostRegistered(*server, i);
+    }
+
+    VerifyOrQuit(SrpServerTester::GetLeaseHeapSize(*server) == kNumHosts, "lease heap has the wrong size");
+    VerifyOrQuit(SrpServerTester::GetNumInternedNames(*server) == kNumHosts * (kNumServicesPerHost + 1),
+                 "names are not shared between the updates");
+
+    // A host with another key can take neither the name of a registered
+    // host nor a service instance name of a registered host.
+
+    intruder = sHosts[1];
+    SuccessOrQuit(intruder.mKeyPair.Generate(), "KeyPair::Generate() failed");
+    SendUpdate(intruder, 0, 1, kLease, kKeyLease);
+    VerifyHostRegistered(*server, 0);
+    VerifyHostRegistered(*server, 1);
+
+    snprintf(intruder.mName, sizeof(intruder.mName), "intruder");
+    snprintf(intruder.mFullName, sizeof(intruder.mFullName), "%s.%s", intruder.mName, kDomain);
+    SendUpdate(intruder, kNumServicesPerHost, 1, kLease, kKeyLease);
+    VerifyOrQuit(SrpServerTester::FindHost(*server, intruder.mFullName) == nullptr, "conflicting host is registered");
+    VerifyHostRegistered(*server, 1);
+
+    // Host 0 removes its services but retains its name, host 1 removes
+    // its name as well.
+
+    SendUpdate(sHosts[0], 0, 0, 0, kKeyLease);
+    VerifyOrQuit(SrpServerTester::FindHost(*server, sHosts[0].mFullName)->IsDeleted(), "host is not deleted");
+    GetServiceInstanceName(0, serviceName, sizeof(serviceName));
+    VerifyOrQuit(SrpServerTester::FindService(*server, serviceName)->IsDeleted(), "service is not deleted");
+
+    SendUpdate(sHosts[1], 0, 0, 0, 0);
+    VerifyOrQuit(SrpServerTester::FindHost(*server, sHosts[1].mFullName) == nullptr, "host is not removed");
+    GetServiceInstanceName(kNumServicesPerHost, serviceName, sizeof(serviceName));
+    VerifyOrQuit(SrpServerTester::FindService(*server, serviceName) == nullptr, "service is not removed");
+    VerifyOrQuit(SrpServerTester::GetLeaseHeapSize(*server) == kNumHosts - 1, "lease heap has the wrong size");
+
+    // When the LEASE expires, the names are retained until the KEY-LEASE
+    // expires.
+
+    AdvanceTime(kLease * 1000);
+
+    for (uint16_t i = 2; i < kNumHosts; i++)
+    {
+        const Srp::Server::Host *host = SrpServerTester::FindHost(*server, sHosts[i].mFullName);
+
+        VerifyOrQuit(host != nullptr, "host is removed before its KEY-LEASE expires");
+        VerifyOrQuit(host->IsDeleted(), "host is not deleted after its LEASE expired");
+
+        for (const Srp::Server::Service *service = host->GetNextService(nullptr); service != nullptr;
+             service                             = host->GetNextService(service))
+        {
+            VerifyOrQuit(service->IsDeleted(), "service is not deleted after its LEASE expired");
+        }
+    }
+
+    AdvanceTime(kKeyLease * 1000);
+
+    VerifyOrQuit(server->GetNextHost(nullptr) == nullptr, "host is not removed after its KEY-LEASE expired");
+    VerifyOrQuit(SrpServerTester::GetLeaseHeapSize(*server) == 0, "lease heap is not empty");
+    VerifyOrQuit(SrpServerTester::GetNumInternedNames(*server) == 0, "interned names are leaked");
+
+    SrpServerTester::Stop(*server);
+
+    g_testPlatAlarmStop    = nullptr;
+    g_testPlatAlarmStartAt = nullptr;
+    g_testPlatAlarmGetNow  = nullptr;
+
+    testFreeInstance(sInstance);
+
+    printf("TestSrpServerLoad passed\n");
+}
+
+static void GetRegistryHostName(uint16_t aHostIndex, char *aName, uint16_t aSize)
+{
+    snprintf(aName, aSize, "reg%u.%s", aHostIndex, kDomain);
+}
+
+static void GetRegistryHostMessageInfo(uint16_t aHostIndex, Ip6::MessageInfo &aMessageInfo)
+{
+    char address[sizeof("fd00::1:ffff")];
+
+    snprintf(address, sizeof(address), "fd00::1:%x", aHostIndex);
+    SuccessOrQuit(aMessageInfo.GetPeerAddr().FromString(address), "FromString() failed");
+    aMessageInfo.SetPeerPort(static_cast<uint16_t>(5000 + aHostIndex));
+}
+
+// This function builds the host of an update of registry host `aHostIndex`
+// with all its services, leaving out the parsing and the signature
+// verification of the update.
+static Srp::Server::Host *PrepareRegistryHost(uint16_t aHostIndex, const Ip6::MessageInfo &aMessageInfo)
+{
+    char               name[Dns::Name::kMaxLength + 1];
+    Srp::Server::Host *host;
+
+    GetRegistryHostName(aHostIndex, name, sizeof(name));
+    host = SrpServerTester::NewHost(name, aMessageInfo.GetPeerAddr());
+
+    for (uint16_t index = aHostIndex * kNumServicesPerHost; index < (aHostIndex + 1) * kNumServicesPerHost; index++)
+    {
+        GetServiceInstanceName(index, name, sizeof(name));
+        SrpServerTester::AddService(*host, name, static_cast<uint16_t>(1000 + index));
+    }
+
+    return host;
+}
+
+void TestSrpServerRegistry(void)
+{
+    Srp::Server *                       server;
+    Ip6::MessageInfo                    messageInfo;
+    std::chrono::steady_clock::duration duration   = std::chrono::steady_clock::duration::zero();
+    uint32_t                            numUpdates = 0;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    g_testPlatAlarmStop    = TestAlarmStop;
+    g_testPlatAlarmStartAt = TestAlarmStartAt;
+    g_testPlatAlarmGetNow  = TestAlarmGetNow;
+
+    sNow     = 0;
+    sAlarmOn = false;
+
+    server = &sInstance->Get<Srp::Server>();
+    SuccessOrQuit(server->SetLeaseRange(kLease / 2, kLease, kKeyLease / 2, kKeyLease), "SetLeaseRange() failed");
+    SrpServerTester::Start(*server);
+    VerifyOrQuit(server->IsRunning(), "server failed to start");
+
+    // Register all hosts, then refresh all of them. Only the time spent
+    // in applying the updates to the registry is measured.
+
+    for (uint32_t round = 0; round < kNumRegistryRounds; round++)
+    {
+        if (round > 0)
+        {
+            AdvanceTime(kRefreshInterval);
+        }
+
+        for (uint16_t i = 0; i < kNumRegistryHosts; i++)
+        {
+            Srp::Server::Host *host;
+
+            GetRegistryHostMessageInfo(i, messageInfo);
+            host = PrepareRegistryHost(i, messageInfo);
+
+            auto start = std::chrono::steady_clock::now();
+
+            SrpServerTester::HandleUpdateResult(*server, *host, messageInfo);
+            duration += std::chrono::steady_clock::now() - start;
+            numUpdates++;
+
+            // Flush the response.
+            otTaskletsProcess(sInstance);
+        }
+    }
+
+    printf("SRP server registry: %u updates of %u hosts with %u services each in %.1f ms (%.2f us/update)\n",
+           static_cast<unsigned>(numUpdates), static_cast<unsigned>(kNumRegistryHosts),
+           static_cast<unsigned>(kNumServicesPerHost), std::chrono::duration<double, std::milli>(duration).count(),
+           std::chrono::duration<double, std::micro>(duration).count() / numUpdates);
+
+    for (uint16_t i = 0; i < kNumRegistryHosts; i++)
+    {
+        char name[Dns::Name::kMaxLength + 1];
+
+        GetRegistryHostName(i, name, sizeof(name));
+        VerifyHostRegistered(*server, name, i);
+    }
+
+    VerifyOrQuit(SrpServerTester::GetLeaseHeapSize(*server) == kNumRegistryHosts, "lease heap has the wrong size");
+    VerifyOrQuit(SrpServerTester::GetNumInternedNames(*server) == kNumRegistryHosts * (kNumServicesPerHost + 1),
+                 "names are not shared between the updates");
+
+    // All hosts are removed once their KEY-LEASE expires.
+
+    AdvanceTime(kKeyLease * 1000);
+
+    VerifyOrQuit(server->GetNextHost(nullptr) == nullptr, "host is not removed after its KEY-LEASE expired");
+    VerifyOrQuit(SrpServerTester::GetLeaseHeapSize(*server) == 0, "lease heap is not empty");
+    VerifyOrQuit(SrpServerTester::GetNumInternedNames(*server) == 0, "interned names are leaked");
+
+    SrpServerTester::Stop(*server);
+
+    g_testPlatAlarmStop    = nullptr;
+    g_testPlatAlarmStartAt = nullptr;
+    g_testPlatAlarmGetNow  = nullptr;
+
+    testFreeInstance(sInstance);
+
+    printf("TestSrpServerRegistry passed\n");
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+#if OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+    otHeapSetCAllocFree(calloc, free);
+#endif
+    ot::TestSrpServerLoad();
+    ot::TestSrpServerRegistry();
+    printf("\nAll tests passed.\n");
+#else
+    printf("SRP_SERVER feature is not enabled\n");
+#endif
+
+    return 0;
+}
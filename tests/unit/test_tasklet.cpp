@@ -0,0 +1,174 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <thread>
+
+#include <openthread/tasklet.h>
+
+#include "test_platform.h"
+
+#include "common/instance.hpp"
+#include "common/tasklet.hpp"
+
+#include "test_util.h"
+
+namespace ot {
+
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+
+enum
+{
+    kNumRepostsInHandler = 3,
+};
+
+static Tasklet *sTasklet;
+static uint32_t sNumTaskletRuns;
+static uint32_t sNumEntryRuns;
+
+static void HandleTasklet(Tasklet &)
+{
+    sNumTaskletRuns++;
+}
+
+static void HandleEntryPostingTasklet(otInstance *, void *)
+{
+    sNumEntryRuns++;
+    sTasklet->Post();
+}
+
+static void HandleEntryReposting(otInstance *aInstance, void *aContext)
+{
+    sNumEntryRuns++;
+
+    if (sNumEntryRuns < kNumRepostsInHandler)
+    {
+        SuccessOrQuit(otTaskletsPostFromThread(aInstance, static_cast<otTaskletEntry *>(aContext)),
+                      "otTaskletsPostFromThread() failed from the entry handler");
+    }
+}
+
+static void PostFromOtherThread(Instance &aInstance, otTaskletEntry &aEntry)
+{
+    std::thread poster([&aInstance, &aEntry]() {
+        SuccessOrQuit(otTaskletsPostFromThread(&aInstance, &aEntry), "otTaskletsPostFromThread() failed");
+        VerifyOrQuit(otTaskletsPostFromThread(&aInstance, &aEntry) == OT_ERROR_ALREADY,
+                     "otTaskletsPostFromThread() did not fail on an already posted entry");
+    });
+
+    poster.join();
+}
+
+void TestTaskletPostedFromThreadEntry(void)
+{
+    Instance *     instance = testInitInstance();
+    otTaskletEntry entry    = {nullptr, HandleEntryPostingTasklet, nullptr, false};
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    Tasklet tasklet(*instance, HandleTasklet, nullptr);
+
+    sTasklet        = &tasklet;
+    sNumTaskletRuns = 0;
+    sNumEntryRuns   = 0;
+
+    // Run any tasklets posted while the instance was initialized.
+    otTaskletsProcess(instance);
+
+    // The handler of an entry posted from another thread posts a
+    // tasklet, which must run in the same `otTaskletsProcess()` call
+    // and must not be lost.
+
+    PostFromOtherThread(*instance, entry);
+    VerifyOrQuit(otTaskletsArePending(instance), "no tasklets are pending after posting an entry");
+
+    otTaskletsProcess(instance);
+
+    VerifyOrQuit(sNumEntryRuns == 1, "entry handler was not called once");
+    VerifyOrQuit(sNumTaskletRuns == 1, "tasklet posted from an entry handler was not run");
+    VerifyOrQuit(!tasklet.IsPosted(), "tasklet is still posted after it was run");
+    VerifyOrQuit(!otTaskletsArePending(instance), "tasklets are pending after all were run");
+
+    // The tasklet and the entry can be posted again.
+
+    PostFromOtherThread(*instance, entry);
+    otTaskletsProcess(instance);
+
+    VerifyOrQuit(sNumEntryRuns == 2, "entry handler was not called after the entry was posted again");
+    VerifyOrQuit(sNumTaskletRuns == 2, "tasklet was not run after it was posted again");
+
+    testFreeInstance(instance);
+
+    printf("TestTaskletPostedFromThreadEntry passed\n");
+}
+
+void TestEntryRepostedFromHandler(void)
+{
+    Instance *     instance = testInitInstance();
+    otTaskletEntry entry    = {nullptr, HandleEntryReposting, &entry, false};
+
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    sNumEntryRuns = 0;
+    otTaskletsProcess(instance);
+
+    // An entry posted again from its own handler runs once per
+    // `otTaskletsProcess()` call.
+
+    PostFromOtherThread(*instance, entry);
+
+    for (uint32_t i = 1; i <= kNumRepostsInHandler; i++)
+    {
+        VerifyOrQuit(otTaskletsArePending(instance), "reposted entry is not pending");
+        otTaskletsProcess(instance);
+        VerifyOrQuit(sNumEntryRuns == i, "reposted entry did not run once per otTaskletsProcess()");
+    }
+
+    VerifyOrQuit(!otTaskletsArePending(instance), "tasklets are pending after all were run");
+
+    testFreeInstance(instance);
+
+    printf("TestEntryRepostedFromHandler passed\n");
+}
+
+#endif // OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_TASKLET_THREAD_SAFE_POST_ENABLE
+    ot::TestTaskletPostedFromThreadEntry();
+    ot::TestEntryRepostedFromHandler();
+    printf("All tests passed\n");
+#else
+    printf("TASKLET_THREAD_SAFE_POST feature is not enabled\n");
+#endif
+
+    return 0;
+}
@@ -25,6 +25,7 @@
  *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
  *  POSSIBILITY OF SUCH DAMAGE.
  */
+#include <chrono>
 
 #include "test_platform.h"
 
@@ -48,6 +49,11 @@ uint32_t sPlatDt;
 bool     sTimerOn;
 uint32_t sCallCount[kCallCountIndexMax];
 
+const ot::Timer *sFiredTimer;      // Last fired timer.
+bool             sCheckFireOrder;  // Whether to check that timers fire in order of their fire time.
+ot::Time         sLastFireTime;    // Fire time of last fired timer (used when `sCheckFireOrder` is set).
+uint32_t         sFireOrderErrors; // Number of timers fired out of order or before their fire time.
+
 void testTimerAlarmStop(otInstance *)
 {
     sTimerOn = false;
@@ -98,6 +104,17 @@ public:
     {
         sCallCount[kCallCountIndexTimerHandler]++;
         mFiredCounter++;
+        sFiredTimer = this;
+
+        if (sCheckFireOrder)
+        {
+            if ((this->GetFireTime() < sLastFireTime) || (ot::Time(sNow) < this->GetFireTime()))
+            {
+                sFireOrderErrors++;
+            }
+
+            sLastFireTime = this->GetFireTime();
+        }
     }
 
     uint32_t GetFiredCounter(void) { return mFiredCounter; }
@@ -338,21 +355,16 @@ template <typename TimerType> int TestTwoTimers(void)
     VerifyOrQuit(timer2.IsRunning() == true, "TestTwoTimers: Timer running Failed.");
     VerifyOrQuit(sTimerOn, "TestTwoTimers: Platform Timer State Failed.");
 
-    AlarmFired<TimerType>(instance);
-
-    VerifyOrQuit(sCallCount[kCallCountIndexAlarmStop] == 0, "TestTwoTimers: Stop CallCount Failed.");
-    VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == 1, "TestTwoTimers: Handler CallCount Failed.");
-    VerifyOrQuit(timer2.GetFiredCounter() == 1, "TestTwoTimers: Fire Counter failed.");
-    VerifyOrQuit(sPlatT0 == sNow && sPlatDt == 0, "TestTwoTimers: Start params Failed.");
-    VerifyOrQuit(timer1.IsRunning() == true, "TestTwoTimers: Timer running Failed.");
-    VerifyOrQuit(timer2.IsRunning() == false, "TestTwoTimers: Timer running Failed.");
-    VerifyOrQuit(sTimerOn == true, "TestTwoTimers: Platform Timer State Failed.");
+    // Both timers have expired, so they are fired from the same alarm callback (timer 2 first).
 
+    sFiredTimer = nullptr;
     AlarmFired<TimerType>(instance);
 
     VerifyOrQuit(sCallCount[kCallCountIndexAlarmStop] == 1, "TestTwoTimers: Stop CallCount Failed.");
     VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == 2, "TestTwoTimers: Handler CallCount Failed.");
     VerifyOrQuit(timer1.GetFiredCounter() == 1, "TestTwoTimers: Fire Counter failed.");
+    VerifyOrQuit(timer2.GetFiredCounter() == 1, "TestTwoTimers: Fire Counter failed.");
+    VerifyOrQuit(sFiredTimer == &timer1, "TestTwoTimers: Fire order failed.");
     VerifyOrQuit(timer1.IsRunning() == false, "TestTwoTimers: Timer running Failed.");
     VerifyOrQuit(timer2.IsRunning() == false, "TestTwoTimers: Timer running Failed.");
     VerifyOrQuit(sTimerOn == false, "TestTwoTimers: Platform Timer State Failed.");
@@ -469,7 +481,7 @@ template <typename TimerType> static void TenTimers(uint32_t aTimeShift)
 
     const uint32_t kTimerStopCountAfterTrigger[kNumTriggers] = {0, 0, 0, 0, 0, 0, 1};
 
-    const uint32_t kTimerStartCountAfterTrigger[kNumTriggers] = {3, 4, 5, 7, 9, 11, 11};
+    const uint32_t kTimerStartCountAfterTrigger[kNumTriggers] = {3, 4, 5, 6, 7, 8, 8};
 
     ot::Instance *instance = testInitInstance();
 
@@ -522,12 +534,10 @@ template <typename TimerType> static void TenTimers(uint32_t aTimeShift)
 
         do
         {
-            // By design, each call to AlarmFired<TimerType>() can result in 0 or 1 calls to a timer handler.
-            // For some combinations of sNow and Timers queued, it is necessary to call AlarmFired<TimerType>()
-            // multiple times in order to handle all the expired timers.  It can be determined that another
-            // timer is ready to be triggered by examining the aDt arg passed into otPlatAlarmMilliStartAt().  If
-            // that value is 0, then AlarmFired should be fired immediately. This loop calls
-            // AlarmFired<TimerType>() the requisite number of times based on the aDt argument.
+            // Each call to AlarmFired<TimerType>() fires all the expired timers, up to a maximum batch size.
+            // If more timers are expired, the platform alarm is started with aDt of 0 and AlarmFired should be
+            // fired immediately. This loop calls AlarmFired<TimerType>() the requisite number of times based on
+            // the aDt argument.
             AlarmFired<TimerType>(instance);
         } while (sPlatDt == 0);
 
@@ -573,6 +583,193 @@ template <typename TimerType> int TestTenTimers(void)
     return 0;
 }
 
+static uint32_t NextRandom(uint32_t &aSeed)
+{
+    // Simple linear congruential generator (deterministic across runs).
+    aSeed = aSeed * 1103515245 + 12345;
+    return aSeed >> 8;
+}
+
+/**
+ * Test the TimerScheduler with a large number of timers which are started, re-started and stopped at random, ensuring
+ * that they all fire in order of their fire time. The delays span many revolutions of the timer wheel.
+ */
+template <typename TimerType> static void ManyTimers(uint16_t aNumTimers, uint32_t aTimeShift)
+{
+    const uint32_t kTimeT0   = 1000;
+    const uint32_t kMaxDelay = 200000;
+
+    ot::Instance *         instance = testInitInstance();
+    TestTimer<TimerType> **timers   = new TestTimer<TimerType> *[aNumTimers];
+    bool *                 stopped  = new bool[aNumTimers];
+    uint32_t               seed     = aNumTimers;
+    uint32_t               numFired = 0;
+
+    printf("TestManyTimers() num=%-5u aTimeShift=%-10u ", aNumTimers, aTimeShift);
+
+    InitTestTimer();
+    InitCounters();
+
+    sNow = kTimeT0 + aTimeShift;
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        timers[i] = new TestTimer<TimerType>(*instance);
+        timers[i]->Start(NextRandom(seed) % kMaxDelay);
+        stopped[i] = false;
+    }
+
+    // Re-start some of the timers (with different delays and some with same fire time as others) and stop some.
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        switch (NextRandom(seed) % 4)
+        {
+        case 0:
+            timers[i]->Start(NextRandom(seed) % kMaxDelay);
+            break;
+        case 1:
+            timers[i]->StartAt(timers[(i + 1) % aNumTimers]->GetFireTime(), 0);
+            break;
+        case 2:
+            timers[i]->Stop();
+            stopped[i] = true;
+            break;
+        default:
+            break;
+        }
+    }
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        VerifyOrQuit(timers[i]->IsRunning() == !stopped[i], "TestManyTimers: Timer running Failed.");
+    }
+
+    sCheckFireOrder  = true;
+    sLastFireTime    = ot::Time(sNow);
+    sFireOrderErrors = 0;
+
+    while (sTimerOn)
+    {
+        sNow = sPlatT0 + sPlatDt;
+        AlarmFired<TimerType>(instance);
+    }
+
+    sCheckFireOrder = false;
+
+    VerifyOrQuit(sFireOrderErrors == 0, "TestManyTimers: Fire order Failed.");
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        VerifyOrQuit(!timers[i]->IsRunning(), "TestManyTimers: Timer running Failed.");
+        VerifyOrQuit(timers[i]->GetFiredCounter() == (stopped[i] ? 0 : 1), "TestManyTimers: Fire Counter failed.");
+        numFired += timers[i]->GetFiredCounter();
+        delete timers[i];
+    }
+
+    VerifyOrQuit(sCallCount[kCallCountIndexTimerHandler] == numFired, "TestManyTimers: Handler CallCount Failed.");
+
+    delete[] timers;
+    delete[] stopped;
+
+    printf("--> PASSED\n");
+
+    testFreeInstance(instance);
+}
+
+template <typename TimerType> int TestManyTimers(void)
+{
+    const uint16_t kNumTimers[] = {10, 100, 1000};
+    const uint32_t kTimeShift[] = {0, 0U - 50000U, ot::Timer::kMaxDelay};
+
+    for (uint16_t numTimers : kNumTimers)
+    {
+        for (uint32_t timeShift : kTimeShift)
+        {
+            ManyTimers<TimerType>(numTimers, timeShift);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Benchmark the cost of starting and stopping a timer while a given number of timers are running.
+ */
+static void BenchmarkTimers(uint16_t aNumTimers)
+{
+    const uint32_t kNumIterations = 100000;
+    const uint32_t kMaxDelay      = 200000;
+
+    typedef std::chrono::steady_clock Clock;
+
+    ot::Instance *               instance = testInitInstance();
+    TestTimer<ot::TimerMilli> ** timers   = new TestTimer<ot::TimerMilli> *[aNumTimers];
+    uint32_t                     seed     = 1;
+    Clock::time_point            startTime;
+    std::chrono::nanoseconds     startDuration;
+    std::chrono::nanoseconds     stopDuration;
+
+    InitTestTimer();
+    InitCounters();
+
+    sNow = 1000;
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        timers[i] = new TestTimer<ot::TimerMilli>(*instance);
+        timers[i]->Start(NextRandom(seed) % kMaxDelay);
+    }
+
+    // Measure re-starting a running timer (remove and add).
+
+    startTime = Clock::now();
+
+    for (uint32_t iter = 0; iter < kNumIterations; iter++)
+    {
+        timers[iter % aNumTimers]->Start(NextRandom(seed) % kMaxDelay);
+    }
+
+    startDuration = Clock::now() - startTime;
+
+    // Measure stopping a timer and starting it again.
+
+    startTime = Clock::now();
+
+    for (uint32_t iter = 0; iter < kNumIterations; iter++)
+    {
+        TestTimer<ot::TimerMilli> &timer = *timers[NextRandom(seed) % aNumTimers];
+
+        timer.Stop();
+        timer.Start(NextRandom(seed) % kMaxDelay);
+    }
+
+    stopDuration = Clock::now() - startTime;
+
+    printf("BenchmarkTimers() num=%-5u start: %6.1f ns/op, stop+start: %6.1f ns/op\n", aNumTimers,
+           static_cast<double>(startDuration.count()) / kNumIterations,
+           static_cast<double>(stopDuration.count()) / kNumIterations);
+
+    for (uint16_t i = 0; i < aNumTimers; i++)
+    {
+        timers[i]->Stop();
+        delete timers[i];
+    }
+
+    delete[] timers;
+
+    testFreeInstance(instance);
+}
+
+int BenchmarkTimers(void)
+{
+    BenchmarkTimers(10);
+    BenchmarkTimers(100);
+    BenchmarkTimers(1000);
+
+    return 0;
+}
+
 /**
  * Test the `Timer::Time` class.
  */
@@ -665,6 +862,7 @@ template <typename TimerType> void RunTimerTests(void)
     TestOneTimer<TimerType>();
     TestTwoTimers<TimerType>();
     TestTenTimers<TimerType>();
+    TestManyTimers<TimerType>();
 }
 
 int main(void)
@@ -674,6 +872,7 @@ int main(void)
     RunTimerTests<ot::TimerMicro>();
 #endif
     TestTimerTime();
+    BenchmarkTimers();
     printf("All tests passed\n");
     return 0;
 }
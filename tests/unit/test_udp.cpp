@@ -0,0 +1,257 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "test_platform.h"
+
+#include <chrono>
+
+#include <openthread/config.h>
+
+#include "test_util.h"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "net/udp6.hpp"
+
+namespace ot {
+
+enum
+{
+    kBasePort          = 5600,
+    kPeerPort          = 5700,
+    kNumSockets        = 3 * OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE / 2,
+    kNumDispatchRounds = 20000,
+};
+
+static Instance *sInstance;
+static uintptr_t sLastReceiver;
+static uint32_t  sReceiveCount;
+
+static void HandleUdpReceive(void *aContext, otMessage *, const otMessageInfo *)
+{
+    sLastReceiver = reinterpret_cast<uintptr_t>(aContext);
+    sReceiveCount++;
+}
+
+static void OpenSocket(Ip6::Udp::Socket &aSocket, uintptr_t aId, uint16_t aPort)
+{
+    SuccessOrQuit(aSocket.Open(HandleUdpReceive, reinterpret_cast<void *>(aId)), "Open() failed");
+    SuccessOrQuit(aSocket.Bind(aPort), "Bind() failed");
+}
+
+static void PrepareMessageInfo(Ip6::MessageInfo &aMessageInfo, const char *aPeerAddress, uint16_t aSockPort)
+{
+    SuccessOrQuit(aMessageInfo.GetPeerAddr().FromString(aPeerAddress), "FromString() failed");
+    SuccessOrQuit(aMessageInfo.GetSockAddr().FromString("fd00::1"), "FromString() failed");
+    aMessageInfo.SetPeerPort(kPeerPort);
+    aMessageInfo.SetSockPort(aSockPort);
+}
+
+static uintptr_t Deliver(Ip6::MessageInfo &aMessageInfo)
+{
+    Ip6::Udp &udp     = sInstance->Get<Ip6::Udp>();
+    Message * message = udp.NewMessage(0);
+
+    VerifyOrQuit(message != nullptr, "NewMessage() failed");
+    SuccessOrQuit(message->Append<uint8_t>(0), "Append() failed");
+
+    sLastReceiver = 0;
+    udp.HandlePayload(*message, aMessageInfo);
+    message->Free();
+
+    return sLastReceiver;
+}
+
+void TestUdpSocketDemux(void)
+{
+    Ip6::Udp::Socket *sockets[4];
+    Ip6::MessageInfo  peerInfo;
+    Ip6::MessageInfo  otherPeerInfo;
+    Ip6::SockAddr     peer;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    for (Ip6::Udp::Socket *&socket : sockets)
+    {
+        socket = new Ip6::Udp::Socket(*sInstance);
+    }
+
+    PrepareMessageInfo(peerInfo, "fd00::1234", kBasePort);
+    PrepareMessageInfo(otherPeerInfo, "fd00::5678", kBasePort);
+    SuccessOrQuit(peer.GetAddress().FromString("fd00::1234"), "FromString() failed");
+    peer.mPort = kPeerPort;
+
+    // A connected socket opened after a wildcard socket on the same
+    // port is found first, so it takes the datagrams from its peer.
+
+    OpenSocket(*sockets[0], 1, kBasePort);
+    OpenSocket(*sockets[1], 2, kBasePort);
+    SuccessOrQuit(sockets[1]->Connect(peer), "Connect() failed");
+
+    VerifyOrQuit(Deliver(peerInfo) == 2, "datagram from the peer did not go to the connected socket");
+    VerifyOrQuit(Deliver(otherPeerInfo) == 1, "datagram from another peer did not go to the wildcard socket");
+
+    // A wildcard socket opened after the connected one is found first
+    // and takes all datagrams, as with a walk of the socket list.
+
+    OpenSocket(*sockets[2], 3, kBasePort);
+
+    VerifyOrQuit(Deliver(peerInfo) == 3, "datagram did not go to the most recently opened socket");
+    VerifyOrQuit(Deliver(otherPeerInfo) == 3, "datagram did not go to the most recently opened socket");
+
+    SuccessOrQuit(sockets[2]->Close(), "Close() failed");
+
+    VerifyOrQuit(Deliver(peerInfo) == 2, "datagram went to a closed socket");
+
+    // Re-binding a socket moves it to its new port.
+
+    OpenSocket(*sockets[3], 4, kBasePort + 1);
+    PrepareMessageInfo(otherPeerInfo, "fd00::5678", kBasePort + 1);
+    VerifyOrQuit(Deliver(otherPeerInfo) == 4, "datagram did not go to the socket bound to the port");
+
+    SuccessOrQuit(sockets[3]->Bind(kBasePort + 2), "Bind() failed");
+    VerifyOrQuit(Deliver(otherPeerInfo) == 0, "datagram went to a socket no longer bound to the port");
+    PrepareMessageInfo(otherPeerInfo, "fd00::5678", kBasePort + 2);
+    VerifyOrQuit(Deliver(otherPeerInfo) == 4, "datagram did not go to the re-bound socket");
+
+    // Ephemeral ports skip over ports which are already bound.
+
+    {
+        Ip6::Udp &udp  = sInstance->Get<Ip6::Udp>();
+        uint16_t  port = udp.GetEphemeralPort();
+
+        SuccessOrQuit(sockets[2]->Open(HandleUdpReceive, nullptr), "Open() failed");
+        SuccessOrQuit(sockets[2]->Bind(port + 1), "Bind() failed");
+        SuccessOrQuit(sockets[3]->Bind(port + 2), "Bind() failed");
+
+        VerifyOrQuit(udp.GetEphemeralPort() == port + 3, "ephemeral port is already in use");
+    }
+
+    for (Ip6::Udp::Socket *socket : sockets)
+    {
+        IgnoreError(socket->Close());
+        delete socket;
+    }
+
+    testFreeInstance(sInstance);
+
+    printf("TestUdpSocketDemux passed\n");
+}
+
+void TestUdpSocketDemuxOverflow(void)
+{
+    Ip6::Udp::Socket *sockets[kNumSockets];
+    Ip6::MessageInfo  messageInfo;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    // Open more sockets than the index holds, so datagrams are matched
+    // by walking the list, then close them again until they are all
+    // indexed.
+
+    for (uintptr_t i = 0; i < kNumSockets; i++)
+    {
+        sockets[i] = new Ip6::Udp::Socket(*sInstance);
+        OpenSocket(*sockets[i], i + 1, static_cast<uint16_t>(kBasePort + i));
+    }
+
+    for (uint16_t numOpen = kNumSockets; numOpen > 0; numOpen--)
+    {
+        for (uint16_t i = 0; i < kNumSockets; i++)
+        {
+            PrepareMessageInfo(messageInfo, "fd00::1234", kBasePort + i);
+            VerifyOrQuit(Deliver(messageInfo) == ((i < numOpen) ? i + 1u : 0u), "datagram went to the wrong socket");
+        }
+
+        SuccessOrQuit(sockets[numOpen - 1]->Close(), "Close() failed");
+    }
+
+    for (Ip6::Udp::Socket *socket : sockets)
+    {
+        delete socket;
+    }
+
+    testFreeInstance(sInstance);
+
+    printf("TestUdpSocketDemuxOverflow passed\n");
+}
+
+void BenchmarkUdpSocketDemux(void)
+{
+    const uint16_t    kNumIndexed = OPENTHREAD_CONFIG_UDP_SOCKET_INDEX_SIZE / 2;
+    Ip6::Udp::Socket *sockets[kNumIndexed];
+    Ip6::MessageInfo  messageInfo;
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr, "Null instance");
+
+    for (uintptr_t i = 0; i < kNumIndexed; i++)
+    {
+        sockets[i] = new Ip6::Udp::Socket(*sInstance);
+        OpenSocket(*sockets[i], i + 1, static_cast<uint16_t>(kBasePort + i));
+    }
+
+    sReceiveCount = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t round = 0; round < kNumDispatchRounds; round++)
+    {
+        // The first socket opened is the last one in the socket list.
+
+        PrepareMessageInfo(messageInfo, "fd00::1234", kBasePort);
+        IgnoreReturnValue(Deliver(messageInfo));
+    }
+
+    auto duration = std::chrono::steady_clock::now() - start;
+
+    VerifyOrQuit(sReceiveCount == kNumDispatchRounds, "datagram was not delivered");
+
+    printf("UDP demux with %u sockets: %.1f ns/datagram\n", static_cast<unsigned>(kNumIndexed),
+           std::chrono::duration<double, std::nano>(duration).count() / kNumDispatchRounds);
+
+    for (Ip6::Udp::Socket *socket : sockets)
+    {
+        IgnoreError(socket->Close());
+        delete socket;
+    }
+
+    testFreeInstance(sInstance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestUdpSocketDemux();
+    ot::TestUdpSocketDemuxOverflow();
+    ot::BenchmarkUdpSocketDemux();
+    printf("\nAll tests passed.\n");
+    return 0;
+}